@@ -68,10 +68,14 @@ struct cloud_data_gps {
 		/** Structure containing PVT data. */
 		struct cloud_data_gps_pvt pvt;
 
+#if defined(CONFIG_GPS_MODULE_NMEA)
 		/* Null terminated NMEA string. The maximum number of characters in an
-		 * NMEA string is 83.
+		 * NMEA string is 83. Only present when the GPS module produces NMEA
+		 * data, so that PVT-only builds do not pay for the string in every
+		 * ringbuffer entry.
 		 */
 		char nmea[83];
+#endif
 	};
 
 	/** Enum signifying the type of GPS data that is valid. */
@@ -401,6 +401,7 @@ int json_common_gps_data_add(cJSON *parent,
 
 		json_add_obj(gps_obj, DATA_VALUE, gps_val_obj);
 		break;
+#if defined(CONFIG_GPS_MODULE_NMEA)
 	case CLOUD_CODEC_GPS_FORMAT_NMEA:
 		cJSON_Delete(gps_val_obj);
 		err = json_add_str(gps_obj, DATA_VALUE, data->nmea);
@@ -409,6 +410,7 @@ int json_common_gps_data_add(cJSON *parent,
 			goto exit;
 		}
 		break;
+#endif
 	case CLOUD_CODEC_GPS_FORMAT_INVALID:
 		/* Fall through */
 	default:
@@ -1114,6 +1116,39 @@ void json_common_config_get(cJSON *parent, struct cloud_data_cfg *data)
 	}
 }
 
+/* Replace the last entry in the array with its printed form so that only one
+ * entry at a time is held as a full cJSON tree. The printed string is wrapped
+ * in a raw item that is pasted verbatim into the final printout.
+ */
+static int batch_entry_compact(cJSON *array_obj)
+{
+	cJSON *item = cJSON_DetachItemFromArray(array_obj,
+						cJSON_GetArraySize(array_obj) - 1);
+	cJSON *raw_obj;
+	char *printed;
+
+	if (item == NULL) {
+		return -ENOMEM;
+	}
+
+	printed = cJSON_PrintUnformatted(item);
+	cJSON_Delete(item);
+
+	if (printed == NULL) {
+		return -ENOMEM;
+	}
+
+	raw_obj = cJSON_CreateRaw(printed);
+	cJSON_FreeString(printed);
+
+	if (raw_obj == NULL) {
+		return -ENOMEM;
+	}
+
+	json_add_obj_array(array_obj, raw_obj);
+	return 0;
+}
+
 int json_common_batch_data_add(cJSON *parent, enum json_common_buffer_type type, void *buf,
 			       size_t buf_count, const char *object_label)
 {
@@ -1213,6 +1248,15 @@ int json_common_batch_data_add(cJSON *parent, enum json_common_buffer_type type,
 			cJSON_Delete(array_obj);
 			return err;
 		}
+
+		if (IS_ENABLED(CONFIG_CLOUD_CODEC_INCREMENTAL_BATCH) && (err == 0)) {
+			err = batch_entry_compact(array_obj);
+			if (err) {
+				LOG_ERR("Failed compacting array entry");
+				cJSON_Delete(array_obj);
+				return err;
+			}
+		}
 	}
 
 	if (cJSON_GetArraySize(array_obj) == 0) {
@@ -21,6 +21,10 @@
 #include <logging/log.h>
 LOG_MODULE_REGISTER(cloud_codec, CONFIG_CLOUD_CODEC_LOG_LEVEL);
 
+/* The nRF Cloud codec sends GPS data as NMEA strings only. */
+BUILD_ASSERT(IS_ENABLED(CONFIG_GPS_MODULE_NMEA),
+	     "The nRF Cloud codec requires CONFIG_GPS_MODULE_NMEA");
+
 /* Function that checks the version number of the incoming message and determines if it has already
  * been handled. Receiving duplicate messages can often occur upon retransmissions from the AWS IoT
  * broker due to unACKed MQTT QoS 1 messages and unACKed TCP packets. Messages from AWS IoT
@@ -1313,6 +1313,7 @@ static void on_all_states(struct data_msg_data *msg)
 
 		};
 			break;
+#if defined(CONFIG_GPS_MODULE_NMEA)
 		case GPS_MODULE_DATA_FORMAT_NMEA: {
 			/* Add NMEA data */
 			BUILD_ASSERT(sizeof(new_gps_data.nmea) >=
@@ -1321,6 +1322,7 @@ static void on_all_states(struct data_msg_data *msg)
 			strcpy(new_gps_data.nmea, msg->module.gps.data.gps.nmea);
 		};
 			break;
+#endif
 		case GPS_MODULE_DATA_FORMAT_INVALID:
 			/* Fall through */
 		default:
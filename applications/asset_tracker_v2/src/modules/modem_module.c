@@ -876,6 +876,22 @@ static void on_all_states(struct modem_msg_data *msg)
 	}
 
 	if (IS_EVENT(msg, app, APP_EVT_DATA_GET)) {
+		/* Start the neighbor cell measurement first. The measurement runs
+		 * asynchronously in the modem and is by far the slowest of the
+		 * requested operations, so it proceeds in parallel with the
+		 * synchronous modem information requests below instead of
+		 * starting after them.
+		 */
+		if (neighbor_cells_data_requested(msg->module.app.data_list,
+						  msg->module.app.count)) {
+			int err;
+
+			err = neighbor_cells_measurement_start();
+			if (err) {
+				SEND_EVENT(modem, MODEM_EVT_NEIGHBOR_CELLS_DATA_NOT_READY);
+			}
+		}
+
 		if (static_modem_data_requested(msg->module.app.data_list,
 						msg->module.app.count)) {
 
@@ -911,16 +927,6 @@ static void on_all_states(struct modem_msg_data *msg)
 					MODEM_EVT_BATTERY_DATA_NOT_READY);
 			}
 		}
-
-		if (neighbor_cells_data_requested(msg->module.app.data_list,
-						  msg->module.app.count)) {
-			int err;
-
-			err = neighbor_cells_measurement_start();
-			if (err) {
-				SEND_EVENT(modem, MODEM_EVT_NEIGHBOR_CELLS_DATA_NOT_READY);
-			}
-		}
 	}
 
 	if (IS_EVENT(msg, util, UTIL_EVT_SHUTDOWN_REQUEST)) {
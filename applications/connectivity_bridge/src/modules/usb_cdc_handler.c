@@ -5,6 +5,7 @@
  */
 #include <stdio.h>
 #include <zephyr/types.h>
+#include <sys/ring_buffer.h>
 #include <drivers/uart.h>
 #include <usb/usb_device.h>
 
@@ -38,6 +39,37 @@ static uint32_t cdc_ready[CDC_DEVICE_COUNT];
 
 static uint8_t overflow_buf[64];
 
+#if defined(CONFIG_BRIDGE_CDC_TX_BUF)
+/* Elastic buffer towards the USB endpoint. The endpoint buffer fills up
+ * faster than the host drains it at high UART baud rates; data is held
+ * here and moved into the endpoint from the TX ready interrupt.
+ */
+struct cdc_tx_buf {
+	struct ring_buf rb;
+	uint8_t buf[CONFIG_BRIDGE_CDC_TX_BUF_SIZE];
+};
+
+static struct cdc_tx_buf cdc_tx_ringbufs[CDC_DEVICE_COUNT];
+
+static void cdc_tx_drain(const struct device *dev, int dev_idx)
+{
+	uint8_t *data;
+	uint32_t len;
+	int written;
+
+	len = ring_buf_get_claim(&cdc_tx_ringbufs[dev_idx].rb, &data,
+				 sizeof(cdc_tx_ringbufs[dev_idx].buf));
+	if (len > 0) {
+		written = uart_fifo_fill(dev, data, len);
+		ring_buf_get_finish(&cdc_tx_ringbufs[dev_idx].rb, MAX(written, 0));
+	}
+
+	if (ring_buf_is_empty(&cdc_tx_ringbufs[dev_idx].rb)) {
+		uart_irq_tx_disable(dev);
+	}
+}
+#endif /* CONFIG_BRIDGE_CDC_TX_BUF */
+
 static void cdc_dtr_timer_handler(struct k_timer *timer)
 {
 	k_work_submit(&cdc_dtr_work);
@@ -93,6 +125,12 @@ static void cdc_uart_interrupt_handler(const struct device *dev, void *user_data
 
 	uart_irq_update(dev);
 
+#if defined(CONFIG_BRIDGE_CDC_TX_BUF)
+	if (uart_irq_tx_ready(dev)) {
+		cdc_tx_drain(dev, dev_idx);
+	}
+#endif
+
 	while (uart_irq_rx_ready(dev)) {
 		void *rx_buf;
 		int err;
@@ -185,10 +223,18 @@ static bool event_handler(const struct event_header *eh)
 			return false;
 		}
 
+#if defined(CONFIG_BRIDGE_CDC_TX_BUF)
+		tx_written = ring_buf_put(
+			&cdc_tx_ringbufs[event->dev_idx].rb,
+			event->buf,
+			event->len);
+		uart_irq_tx_enable(devices[event->dev_idx]);
+#else
 		tx_written = uart_fifo_fill(
 			devices[event->dev_idx],
 			event->buf,
 			event->len);
+#endif
 
 		if (tx_written != event->len) {
 			LOG_DBG("UART_%d->CDC_%d overflow",
@@ -241,6 +287,12 @@ static bool event_handler(const struct event_header *eh)
 				}
 
 				cdc_ready[i] = 0;
+#if defined(CONFIG_BRIDGE_CDC_TX_BUF)
+				ring_buf_init(
+					&cdc_tx_ringbufs[i].rb,
+					sizeof(cdc_tx_ringbufs[i].buf),
+					cdc_tx_ringbufs[i].buf);
+#endif
 				devices[i] = device_get_binding(dev_name);
 				if (devices[i]) {
 					enable_rx_irq(i);
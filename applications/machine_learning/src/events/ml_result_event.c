@@ -13,8 +13,9 @@ static int log_ml_result_event(const struct event_header *eh, char *buf, size_t
 {
 	const struct ml_result_event *event = cast_ml_result_event(eh);
 
-	return snprintf(buf, buf_len, "%s val: %0.2f anomaly: %0.2f",
-			event->label, event->value, event->anomaly);
+	return snprintf(buf, buf_len, "%s val: %0.2f anomaly: %0.2f dsp: %d ms class: %d ms",
+			event->label, event->value, event->anomaly,
+			event->dsp_time, event->classification_time);
 }
 
 static int log_ml_result_signin_event(const struct event_header *eh, char *buf, size_t buf_len)
@@ -30,6 +31,10 @@ static int log_ml_result_signin_event(const struct event_header *eh, char *buf,
 
 static void profile_ml_result_event(struct log_event_buf *buf, const struct event_header *eh)
 {
+	const struct ml_result_event *event = cast_ml_result_event(eh);
+
+	profiler_log_encode_int32(buf, event->dsp_time);
+	profiler_log_encode_int32(buf, event->classification_time);
 }
 
 static void profile_ml_result_signin_event(struct log_event_buf *buf,
@@ -42,8 +47,8 @@ static void profile_ml_result_signin_event(struct log_event_buf *buf,
 }
 
 EVENT_INFO_DEFINE(ml_result_event,
-		  ENCODE(),
-		  ENCODE(),
+		  ENCODE(PROFILER_ARG_S32, PROFILER_ARG_S32),
+		  ENCODE("dsp_time", "classification_time"),
 		  profile_ml_result_event);
 
 EVENT_TYPE_DEFINE(ml_result_event,
@@ -28,6 +28,10 @@ struct ml_result_event {
 	const char *label; /**< Classification label. */
 	float value; /**< Classification value. */
 	float anomaly; /**< Anomaly value. */
+
+	int dsp_time; /**< Time spent on DSP operations [ms]. */
+	int classification_time; /**< Time spent on classification [ms]. */
+	int anomaly_time; /**< Time spent on anomaly detection [ms]. -1 if unsupported. */
 };
 
 /** @brief Sign in event
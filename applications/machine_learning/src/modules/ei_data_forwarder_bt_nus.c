@@ -225,6 +225,7 @@ static bool handle_sensor_event(const struct sensor_event *event)
 	static uint8_t buf[DATA_BUF_SIZE];
 	int pos = ei_data_forwarder_parse_data(sensor_event_get_data_ptr(event),
 					       sensor_event_get_data_cnt(event),
+					       CONFIG_ML_APP_EI_DATA_FORWARDER_FRAME_DATA_CNT,
 					       buf,
 					       sizeof(buf));
 
@@ -109,6 +109,7 @@ static bool handle_sensor_event(const struct sensor_event *event)
 
 	int pos = ei_data_forwarder_parse_data(sensor_event_get_data_ptr(event),
 					       sensor_event_get_data_cnt(event),
+					       CONFIG_ML_APP_EI_DATA_FORWARDER_FRAME_DATA_CNT,
 					       buf,
 					       sizeof(buf));
 
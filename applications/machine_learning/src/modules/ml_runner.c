@@ -77,6 +77,11 @@ static void submit_result(void)
 	struct ml_result_event *evt = new_ml_result_event();
 	int err = ei_wrapper_get_classification_results(&evt->label, &evt->value, &evt->anomaly);
 
+	__ASSERT_NO_MSG(!err);
+
+	err = ei_wrapper_get_timing(&evt->dsp_time, &evt->classification_time,
+				    &evt->anomaly_time);
+
 	__ASSERT_NO_MSG(!err);
 	ARG_UNUSED(err);
 
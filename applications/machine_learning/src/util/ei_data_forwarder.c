@@ -21,16 +21,19 @@ static int snprintf_error_check(int res, size_t buf_size)
 }
 
 int ei_data_forwarder_parse_data(const float *data_ptr, size_t data_cnt,
-				 uint8_t *buf, size_t buf_size)
+				 size_t frame_data_cnt, uint8_t *buf, size_t buf_size)
 {
 	int pos = 0;
 
+	__ASSERT_NO_MSG(frame_data_cnt > 0);
+	__ASSERT_NO_MSG((data_cnt % frame_data_cnt) == 0);
+
 	for (size_t i = 0; i < 2 * data_cnt; i++) {
 		int tmp;
 
 		if ((i % 2) == 0) {
 			tmp = snprintf(&buf[pos], buf_size - pos, "%.2f", data_ptr[i / 2]);
-		} else if (i == (2 * data_cnt - 1)) {
+		} else if (((i / 2) % frame_data_cnt) == (frame_data_cnt - 1)) {
 			tmp = snprintf(&buf[pos], buf_size - pos, "\r\n");
 		} else {
 			tmp = snprintf(&buf[pos], buf_size - pos, ",");
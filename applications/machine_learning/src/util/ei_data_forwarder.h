@@ -8,7 +8,11 @@
 #define _EI_DATA_FORWARDER_H_
 
 
+/* Format sampled data for the Edge Impulse data forwarder protocol.
+ * A sensor event may batch multiple sampling frames of frame_data_cnt
+ * values each - every frame is put in a separate line.
+ */
 int ei_data_forwarder_parse_data(const float *data_ptr, size_t data_cnt,
-				 uint8_t *buf, size_t buf_size);
+				 size_t frame_data_cnt, uint8_t *buf, size_t buf_size);
 
 #endif /* _EI_DATA_FORWARDER_H_ */
@@ -47,6 +47,23 @@ constexpr int16_t kPressureMeasurementAttributeMaxValue = 0x7fff;
 constexpr int16_t kPressureMeasurementAttributeMinValue = 0x8001;
 constexpr int16_t kPressureMeasurementAttributeInvalidValue = 0x8000;
 
+/* Minimum changes, in attribute units, that are reported. Smaller changes
+ * are suppressed to save Thread packets and radio wakeups. */
+constexpr int32_t kTemperatureMeasurementAttributeChangeThreshold = 10; /* 0.1 degC */
+constexpr int32_t kPressureMeasurementAttributeChangeThreshold = 2; /* 0.2 kPa */
+constexpr int32_t kHumidityMeasurementAttributeChangeThreshold = 50; /* 0.5% RH */
+constexpr int32_t kMeasurementAttributeNotReported = INT32_MIN;
+
+struct MeasurementAttribute {
+	uint8_t endpointId;
+	uint16_t clusterId;
+	uint16_t attributeId;
+	uint8_t attributeType;
+	int32_t changeThreshold;
+	int32_t invalidValue;
+	int32_t reportedValue = kMeasurementAttributeNotReported;
+};
+
 K_MSGQ_DEFINE(sAppEventQueue, sizeof(AppEvent), kAppEventQueueSize, alignof(AppEvent));
 k_timer sFunctionTimer;
 k_timer sMeasurementsTimer;
@@ -64,6 +81,49 @@ bool sHaveBLEConnections;
 LedState sLedState = LedState::kAlive;
 
 const device *kBme688SensorDev = device_get_binding(DT_LABEL(DT_INST(0, bosch_bme680)));
+
+MeasurementAttribute sTemperatureAttribute = { kTemperatureMeasurementEndpointId,
+					       ZCL_TEMP_MEASUREMENT_CLUSTER_ID,
+					       ZCL_TEMP_MEASURED_VALUE_ATTRIBUTE_ID,
+					       ZCL_INT16S_ATTRIBUTE_TYPE,
+					       kTemperatureMeasurementAttributeChangeThreshold,
+					       kTemperatureMeasurementAttributeInvalidValue };
+MeasurementAttribute sPressureAttribute = { kPressureMeasurementEndpointId, ZCL_PRESSURE_MEASUREMENT_CLUSTER_ID,
+					    ZCL_PRESSURE_MEASURED_VALUE_ATTRIBUTE_ID, ZCL_INT16S_ATTRIBUTE_TYPE,
+					    kPressureMeasurementAttributeChangeThreshold,
+					    kPressureMeasurementAttributeInvalidValue };
+MeasurementAttribute sHumidityAttribute = { kHumidityMeasurementEndpointId,
+					    ZCL_RELATIVE_HUMIDITY_MEASUREMENT_CLUSTER_ID,
+					    ZCL_RELATIVE_HUMIDITY_MEASURED_VALUE_ATTRIBUTE_ID,
+					    ZCL_INT16U_ATTRIBUTE_TYPE, kHumidityMeasurementAttributeChangeThreshold,
+					    kHumidityMeasurementAttributeInvalidValue };
+
+void UpdateMeasurementAttribute(MeasurementAttribute &attr, int32_t newValue)
+{
+	/* Transitions to and from the invalid value and the very first
+	 * measurement are always reported; other updates are suppressed
+	 * while the change stays below the per-attribute threshold. */
+	if (attr.reportedValue != kMeasurementAttributeNotReported && newValue != attr.invalidValue &&
+	    attr.reportedValue != attr.invalidValue) {
+		int32_t change = newValue - attr.reportedValue;
+
+		if (change < attr.changeThreshold && -change < attr.changeThreshold) {
+			return;
+		}
+	}
+
+	int16_t rawValue = static_cast<int16_t>(newValue);
+	EmberAfStatus status = emberAfWriteAttribute(attr.endpointId, attr.clusterId, attr.attributeId,
+						     CLUSTER_MASK_SERVER, reinterpret_cast<uint8_t *>(&rawValue),
+						     attr.attributeType);
+
+	if (status != EMBER_ZCL_STATUS_SUCCESS) {
+		LOG_ERR("Updating attribute %x of cluster %x failed: %x", attr.attributeId, attr.clusterId, status);
+		return;
+	}
+
+	attr.reportedValue = newValue;
+}
 } /* namespace */
 
 AppTask AppTask::sAppTask;
@@ -249,8 +309,15 @@ void AppTask::MeasurementsTimerHandler(AppEvent *)
 void AppTask::UpdateClusterState()
 {
 	struct sensor_value sTemperature, sPressure, sHumidity;
+	bool haveTemperature = false;
+	bool havePressure = false;
+	bool haveHumidity = false;
+	int32_t temperatureValue = 0;
+	int32_t pressureValue = 0;
+	int32_t humidityValue = 0;
+
+	/* One fetch reads all channels from the sensor in a single I2C burst. */
 	int result = sensor_sample_fetch(kBme688SensorDev);
-	EmberAfStatus status;
 
 	if (result != 0) {
 		LOG_ERR("Fetching data from BME688 sensor failed with: %d", result);
@@ -270,13 +337,8 @@ void AppTask::UpdateClusterState()
 			newValue = kTemperatureMeasurementAttributeInvalidValue;
 		}
 
-		status = emberAfWriteAttribute(kTemperatureMeasurementEndpointId, ZCL_TEMP_MEASUREMENT_CLUSTER_ID,
-					       ZCL_TEMP_MEASURED_VALUE_ATTRIBUTE_ID, CLUSTER_MASK_SERVER,
-					       reinterpret_cast<uint8_t *>(&newValue), ZCL_INT16S_ATTRIBUTE_TYPE);
-
-		if (status != EMBER_ZCL_STATUS_SUCCESS) {
-			LOG_ERR("Updating temperature measurement %x", status);
-		}
+		temperatureValue = newValue;
+		haveTemperature = true;
 	} else {
 		LOG_ERR("Getting temperature measurement data from BME688 failed with: %d", result);
 	}
@@ -294,13 +356,8 @@ void AppTask::UpdateClusterState()
 			newValue = kPressureMeasurementAttributeInvalidValue;
 		}
 
-		status = emberAfWriteAttribute(kPressureMeasurementEndpointId, ZCL_PRESSURE_MEASUREMENT_CLUSTER_ID,
-					       ZCL_PRESSURE_MEASURED_VALUE_ATTRIBUTE_ID, CLUSTER_MASK_SERVER,
-					       reinterpret_cast<uint8_t *>(&newValue), ZCL_INT16S_ATTRIBUTE_TYPE);
-
-		if (status != EMBER_ZCL_STATUS_SUCCESS) {
-			LOG_ERR("Updating pressure measurement %x", status);
-		}
+		pressureValue = newValue;
+		havePressure = true;
 	} else {
 		LOG_ERR("Getting pressure measurement data from BME688 failed with: %d", result);
 	}
@@ -310,7 +367,7 @@ void AppTask::UpdateClusterState()
 		/* Defined by cluster humidity measured value = 100 x humidity in %RH with resolution of 0.01 %.
 		 * val1 is an integer part of the value and val2 is fractional part in one-millionth parts.
 		 * To achieve resolution of 0.01 % val2 needs to be divided by 10000. */
-		uint16_t newValue = static_cast<int16_t>(sHumidity.val1 * 100 + sHumidity.val2 / 10000);
+		uint16_t newValue = static_cast<uint16_t>(sHumidity.val1 * 100 + sHumidity.val2 / 10000);
 
 		if (newValue > kHumidityMeasurementAttributeMaxValue ||
 		    newValue < kHumidityMeasurementAttributeMinValue) {
@@ -318,17 +375,25 @@ void AppTask::UpdateClusterState()
 			newValue = kHumidityMeasurementAttributeInvalidValue;
 		}
 
-		status = emberAfWriteAttribute(kHumidityMeasurementEndpointId,
-					       ZCL_RELATIVE_HUMIDITY_MEASUREMENT_CLUSTER_ID,
-					       ZCL_RELATIVE_HUMIDITY_MEASURED_VALUE_ATTRIBUTE_ID, CLUSTER_MASK_SERVER,
-					       reinterpret_cast<uint8_t *>(&newValue), ZCL_INT16U_ATTRIBUTE_TYPE);
-
-		if (status != EMBER_ZCL_STATUS_SUCCESS) {
-			LOG_ERR("Updating relative humidity measurement %x", status);
-		}
+		humidityValue = newValue;
+		haveHumidity = true;
 	} else {
 		LOG_ERR("Getting humidity measurement data from BME688 failed with: %d", result);
 	}
+
+	/* All channels have been converted at this point, so the attribute
+	 * writes happen back to back and the reporting engine can coalesce
+	 * the resulting changes into one report. Writes are suppressed
+	 * entirely while a value stays within its change threshold. */
+	if (haveTemperature) {
+		UpdateMeasurementAttribute(sTemperatureAttribute, temperatureValue);
+	}
+	if (havePressure) {
+		UpdateMeasurementAttribute(sPressureAttribute, pressureValue);
+	}
+	if (haveHumidity) {
+		UpdateMeasurementAttribute(sHumidityAttribute, humidityValue);
+	}
 }
 
 void AppTask::UpdateLedState()
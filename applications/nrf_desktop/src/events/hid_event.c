@@ -58,7 +58,9 @@ EVENT_INFO_DEFINE(hid_report_event,
 		  profile_hid_report_event);
 
 
-EVENT_TYPE_DEFINE(hid_report_event,
+EVENT_TYPE_PRIO_DEFINE(hid_report_event,
+		  IS_ENABLED(CONFIG_DESKTOP_HID_EVENT_PRIO_HIGH) ?
+			EVENT_PRIO_HIGH : EVENT_PRIO_NORMAL,
 		  IS_ENABLED(CONFIG_DESKTOP_INIT_LOG_HID_REPORT_EVENT),
 		  log_hid_report_event,
 		  &hid_report_event_info);
@@ -129,7 +131,9 @@ EVENT_INFO_DEFINE(hid_report_sent_event,
 		  ENCODE("subscriber", "report_id", "error"),
 		  profile_hid_report_sent_event);
 
-EVENT_TYPE_DEFINE(hid_report_sent_event,
+EVENT_TYPE_PRIO_DEFINE(hid_report_sent_event,
+		  IS_ENABLED(CONFIG_DESKTOP_HID_EVENT_PRIO_HIGH) ?
+			EVENT_PRIO_HIGH : EVENT_PRIO_NORMAL,
 		  IS_ENABLED(CONFIG_DESKTOP_INIT_LOG_HID_REPORT_SENT_EVENT),
 		  log_hid_report_sent_event,
 		  &hid_report_sent_event_info);
@@ -31,7 +31,9 @@ EVENT_INFO_DEFINE(motion_event,
 		  ENCODE("dx", "dy"),
 		  profile_motion_event);
 
-EVENT_TYPE_DEFINE(motion_event,
+EVENT_TYPE_PRIO_DEFINE(motion_event,
+		  IS_ENABLED(CONFIG_DESKTOP_HID_EVENT_PRIO_HIGH) ?
+			EVENT_PRIO_HIGH : EVENT_PRIO_NORMAL,
 		  IS_ENABLED(CONFIG_DESKTOP_INIT_LOG_MOTION_EVENT),
 		  log_motion_event,
 		  &motion_event_info);
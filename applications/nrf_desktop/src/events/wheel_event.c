@@ -16,7 +16,9 @@ static int log_wheel_event(const struct event_header *eh, char *buf,
 	return snprintf(buf, buf_len, "wheel=%d", event->wheel);
 }
 
-EVENT_TYPE_DEFINE(wheel_event,
+EVENT_TYPE_PRIO_DEFINE(wheel_event,
+		  IS_ENABLED(CONFIG_DESKTOP_HID_EVENT_PRIO_HIGH) ?
+			EVENT_PRIO_HIGH : EVENT_PRIO_NORMAL,
 		  IS_ENABLED(CONFIG_DESKTOP_INIT_LOG_WHEEL_EVENT),
 		  log_wheel_event,
 		  NULL);
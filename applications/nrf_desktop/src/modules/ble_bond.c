@@ -204,7 +204,13 @@ static uint8_t get_bt_stack_peer_id(uint8_t id)
 	}
 }
 
-static int store_bt_stack_id_lut(void)
+#if defined(CONFIG_DESKTOP_BLE_BOND_DEFERRED_STORE)
+static struct k_work_delayable deferred_store;
+static bool peer_id_dirty;
+static bool id_lut_dirty;
+#endif
+
+static int store_bt_stack_id_lut_now(void)
 {
 	if (IS_ENABLED(CONFIG_SETTINGS)) {
 		char key[] = MODULE_NAME "/" BT_ID_LUT_STORAGE_NAME;
@@ -220,6 +226,18 @@ static int store_bt_stack_id_lut(void)
 	return 0;
 }
 
+static int store_bt_stack_id_lut(void)
+{
+#if defined(CONFIG_DESKTOP_BLE_BOND_DEFERRED_STORE)
+	id_lut_dirty = true;
+	k_work_reschedule(&deferred_store,
+			  K_MSEC(CONFIG_DESKTOP_BLE_BOND_STORE_DELAY));
+	return 0;
+#else
+	return store_bt_stack_id_lut_now();
+#endif
+}
+
 static void swap_bt_stack_peer_id(void)
 {
 	__ASSERT_NO_MSG(state == STATE_ERASE_ADV);
@@ -358,7 +376,7 @@ static void select_next(void)
 	EVENT_SUBMIT(event);
 }
 
-static int store_peer_id(uint8_t peer_id)
+static int store_peer_id_now(uint8_t peer_id)
 {
 	if (IS_ENABLED(CONFIG_SETTINGS)) {
 		char key[] = MODULE_NAME "/" PEER_ID_STORAGE_NAME;
@@ -374,6 +392,48 @@ static int store_peer_id(uint8_t peer_id)
 	return 0;
 }
 
+static int store_peer_id(uint8_t peer_id)
+{
+#if defined(CONFIG_DESKTOP_BLE_BOND_DEFERRED_STORE)
+	ARG_UNUSED(peer_id);
+
+	peer_id_dirty = true;
+	k_work_reschedule(&deferred_store,
+			  K_MSEC(CONFIG_DESKTOP_BLE_BOND_STORE_DELAY));
+	return 0;
+#else
+	return store_peer_id_now(peer_id);
+#endif
+}
+
+#if defined(CONFIG_DESKTOP_BLE_BOND_DEFERRED_STORE)
+static void deferred_store_flush(void)
+{
+	int err = 0;
+
+	if (peer_id_dirty) {
+		err = store_peer_id_now(cur_peer_id);
+		peer_id_dirty = (err != 0);
+	}
+
+	if (!err && id_lut_dirty) {
+		err = store_bt_stack_id_lut_now();
+		id_lut_dirty = (err != 0);
+	}
+
+	if (err) {
+		module_set_state(MODULE_STATE_ERROR);
+	}
+}
+
+static void deferred_store_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	deferred_store_flush();
+}
+#endif /* CONFIG_DESKTOP_BLE_BOND_DEFERRED_STORE */
+
 static void select_confirm(void)
 {
 	LOG_INF("Select peer");
@@ -712,6 +772,10 @@ static int init(void)
 		k_work_init_delayable(&timeout, timeout_handler);
 	}
 
+#if defined(CONFIG_DESKTOP_BLE_BOND_DEFERRED_STORE)
+	k_work_init_delayable(&deferred_store, deferred_store_handler);
+#endif
+
 	load_identities();
 
 	if (IS_ENABLED(CONFIG_BT_PERIPHERAL) &&
@@ -911,6 +975,13 @@ static void config_fetch(const uint8_t opt_id, uint8_t *data, size_t *size)
 
 static bool handle_power_down_event(const struct power_down_event *event)
 {
+#if defined(CONFIG_DESKTOP_BLE_BOND_DEFERRED_STORE)
+	/* Do not enter standby with unsaved peer state. */
+	if (k_work_cancel_delayable(&deferred_store)) {
+		deferred_store_flush();
+	}
+#endif
+
 	switch (state) {
 	case STATE_DISABLED:
 		state = STATE_DISABLED_STANDBY;
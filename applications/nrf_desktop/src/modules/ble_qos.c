@@ -19,6 +19,11 @@
 
 #include "sdc_hci_vs.h"
 
+#if defined(CONFIG_DESKTOP_BLE_QOS_CONN_EVENT_PROFILING)
+#include <profiler.h>
+#include <debug/cpu_load.h>
+#endif
+
 #include "chmap_filter.h"
 
 #define MODULE ble_qos
@@ -96,6 +101,10 @@ static uint8_t current_chmap[CHMAP_BLE_BITMASK_SIZE] = CHMAP_BLE_BITMASK_DEFAULT
 static atomic_t processing;
 static atomic_t new_blacklist;
 static atomic_t params_updated;
+#if defined(CONFIG_DESKTOP_BLE_QOS_CHMAP_PERSIST)
+static uint8_t stored_chmap[CHMAP_BLE_BITMASK_SIZE];
+static atomic_t chmap_restore;
+#endif
 static struct chmap_filter_params filter_params;
 static struct k_mutex data_access_mutex;
 
@@ -213,8 +222,23 @@ static int settings_set(const char *key, size_t len_rd,
 		update_blacklist(data);
 
 	} else if (!strcmp(key, opt_descr[BLE_QOS_OPT_CHMAP])) {
+#if defined(CONFIG_DESKTOP_BLE_QOS_CHMAP_PERSIST)
+		uint8_t data[sizeof(struct params_chmap)];
+
+		ssize_t len = read_cb(cb_arg, data, sizeof(data));
+
+		if ((len != sizeof(data)) || (len != len_rd)) {
+			LOG_ERR("Can't read option %s from storage",
+				opt_descr[BLE_QOS_OPT_CHMAP]);
+			return len;
+		}
+
+		memcpy(stored_chmap, data, sizeof(stored_chmap));
+		atomic_set(&chmap_restore, true);
+#else
 		LOG_ERR("Chmap is not stored in settings");
 		__ASSERT_NO_MSG(false);
+#endif
 
 	} else if (!strcmp(key, opt_descr[BLE_QOS_OPT_PARAM_BLE])) {
 		uint8_t data[sizeof(struct params_ble)];
@@ -405,6 +429,35 @@ static void hid_pkt_stats_print(uint32_t ble_recv)
 	send_uart_data(cdc_dev, str, str_len);
 }
 
+#if defined(CONFIG_DESKTOP_BLE_QOS_CONN_EVENT_PROFILING)
+static uint16_t conn_evt_profiler_id;
+
+static void register_conn_evt_profiler_event(void)
+{
+	static const char * const arg_descr[] =
+		{"channel", "crc_ok", "crc_err", "cpu_load"};
+	static const enum profiler_arg arg_types[] =
+		{PROFILER_ARG_U8, PROFILER_ARG_U16,
+		 PROFILER_ARG_U16, PROFILER_ARG_U32};
+
+	conn_evt_profiler_id = profiler_register_event_type(
+		"ble_conn_evt", arg_descr, arg_types, ARRAY_SIZE(arg_types));
+}
+
+static void profile_conn_event_report(
+	const sdc_hci_subevent_vs_qos_conn_event_report_t *evt)
+{
+	struct log_event_buf buf;
+
+	profiler_log_start(&buf);
+	profiler_log_encode_uint8(&buf, evt->channel_index);
+	profiler_log_encode_uint16(&buf, evt->crc_ok_count);
+	profiler_log_encode_uint16(&buf, evt->crc_error_count);
+	profiler_log_encode_uint32(&buf, cpu_load_get());
+	profiler_log_send(&buf, conn_evt_profiler_id);
+}
+#endif /* CONFIG_DESKTOP_BLE_QOS_CONN_EVENT_PROFILING */
+
 static bool on_vs_evt(struct net_buf_simple *buf)
 {
 	uint8_t *subevent_code;
@@ -416,14 +469,18 @@ static bool on_vs_evt(struct net_buf_simple *buf)
 
 	switch (*subevent_code) {
 	case SDC_HCI_SUBEVENT_VS_QOS_CONN_EVENT_REPORT:
+		evt = (void *)buf->data;
+
+#if defined(CONFIG_DESKTOP_BLE_QOS_CONN_EVENT_PROFILING)
+		profile_conn_event_report(evt);
+#endif
+
 		if (atomic_get(&processing)) {
 			/* Cheaper to skip this update */
 			/* instead of using locks */
 			return true;
 		}
 
-		evt = (void *)buf->data;
-
 		chmap_filter_crc_update(
 			chmap_inst,
 			evt->channel_index,
@@ -695,6 +752,10 @@ static bool event_handler(const struct event_header *eh)
 			new_blacklist = INVALID_BLACKLIST;
 			atomic_set(&params_updated, false);
 
+#if defined(CONFIG_DESKTOP_BLE_QOS_CONN_EVENT_PROFILING)
+			register_conn_evt_profiler_event();
+#endif
+
 			if (IS_ENABLED(CONFIG_DESKTOP_BLE_QOS_STATS_PRINTOUT_ENABLE)) {
 				cdc_dev = device_get_binding(
 					USB_SERIAL_DEVICE_NAME "_0");
@@ -745,6 +806,32 @@ static void apply_new_params(void)
 	}
 }
 
+#if defined(CONFIG_DESKTOP_BLE_QOS_CHMAP_PERSIST)
+static void restore_chmap(void)
+{
+	int err;
+
+	struct ble_qos_event *event = new_ble_qos_event();
+
+	BUILD_ASSERT(sizeof(event->chmap) == CHMAP_BLE_BITMASK_SIZE, "");
+	memcpy(event->chmap, stored_chmap, CHMAP_BLE_BITMASK_SIZE);
+	EVENT_SUBMIT(event);
+
+	if (IS_ENABLED(CONFIG_BT_CENTRAL)) {
+		err = bt_le_set_chan_map(stored_chmap);
+		if (err) {
+			LOG_WRN("bt_le_set_chan_map: %d", err);
+		} else {
+			LOG_INF("Restored stored channel map");
+		}
+	}
+
+	k_mutex_lock(&data_access_mutex, K_FOREVER);
+	memcpy(current_chmap, stored_chmap, sizeof(current_chmap));
+	k_mutex_unlock(&data_access_mutex);
+}
+#endif /* CONFIG_DESKTOP_BLE_QOS_CHMAP_PERSIST */
+
 static void ble_qos_thread_fn(void)
 {
 	while (true) {
@@ -753,6 +840,15 @@ static void ble_qos_thread_fn(void)
 
 		k_sleep(K_MSEC(CONFIG_DESKTOP_BLE_QOS_INTERVAL));
 
+#if defined(CONFIG_DESKTOP_BLE_QOS_CHMAP_PERSIST)
+		/* Seed the link with the channel map learned before
+		 * the last power cycle.
+		 */
+		if (atomic_cas(&chmap_restore, true, false)) {
+			restore_chmap();
+		}
+#endif
+
 		/* Check and apply new parameters received via config channel */
 		if (atomic_get(&params_updated)) {
 			apply_new_params();
@@ -806,6 +902,11 @@ static void ble_qos_thread_fn(void)
 		k_mutex_lock(&data_access_mutex, K_FOREVER);
 		memcpy(current_chmap, chmap, sizeof(current_chmap));
 		k_mutex_unlock(&data_access_mutex);
+
+		if (IS_ENABLED(CONFIG_DESKTOP_BLE_QOS_CHMAP_PERSIST)) {
+			store_config(BLE_QOS_OPT_CHMAP, current_chmap,
+				     sizeof(current_chmap));
+		}
 	}
 }
 
@@ -46,6 +46,12 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_CONFIG_CHANNEL_DFU_LOG_LEVEL);
 
 #define SYNC_BUFFER_SIZE (CONFIG_DESKTOP_CONFIG_CHANNEL_DFU_SYNC_BUFFER_SIZE * sizeof(uint32_t)) /* bytes */
 
+/* With double buffering the host fills one sync buffer while the other
+ * is written to flash.
+ */
+#define SYNC_BUFFER_COUNT \
+	(IS_ENABLED(CONFIG_DESKTOP_CONFIG_CHANNEL_DFU_DOUBLE_BUFFER) ? 2 : 1)
+
 #if CONFIG_SECURE_BOOT
  #include <fw_info.h>
  #define IMAGE0_ID		PM_S0_IMAGE_ID
@@ -73,8 +79,11 @@ static uint32_t img_csum;
 static uint32_t img_length;
 
 static uint16_t store_offset;
+static uint16_t store_len;
 static uint16_t sync_offset;
-static char sync_buffer[SYNC_BUFFER_SIZE] __aligned(4);
+static char sync_buffer[SYNC_BUFFER_COUNT][SYNC_BUFFER_SIZE] __aligned(4);
+static uint8_t rx_buf_idx;
+static uint8_t store_buf_idx;
 
 static bool device_in_use;
 static bool is_flash_area_clean;
@@ -149,6 +158,10 @@ static void terminate_dfu(void)
 	(void)k_work_cancel_delayable(&background_store);
 	flash_area = NULL;
 	sync_offset = 0;
+	store_len = 0;
+	store_offset = 0;
+	rx_buf_idx = 0;
+	store_buf_idx = 0;
 }
 
 static void dfu_timeout_handler(struct k_work *work)
@@ -226,8 +239,8 @@ static void background_erase_handler(struct k_work *work)
 
 static void complete_dfu_data_store(void)
 {
-	cur_offset += sync_offset;
-	sync_offset = 0;
+	cur_offset += store_len;
+	store_len = 0;
 	store_offset = 0;
 
 	LOG_DBG("DFU data store complete: %" PRIu32, cur_offset);
@@ -248,15 +261,15 @@ static void store_dfu_data_chunk(void)
 {
 	/* Some flash may require word alignment. */
 	BUILD_ASSERT((STORE_CHUNK_SIZE % sizeof(uint32_t)) == 0);
-	BUILD_ASSERT((sizeof(sync_buffer) % sizeof(uint32_t)) == 0);
+	BUILD_ASSERT((SYNC_BUFFER_SIZE % sizeof(uint32_t)) == 0);
 
-	__ASSERT_NO_MSG(store_offset <= sync_offset);
+	__ASSERT_NO_MSG(store_offset <= store_len);
 	__ASSERT_NO_MSG(flash_area != NULL);
 
 	size_t store_size = STORE_CHUNK_SIZE;
 
-	if (sync_offset - store_offset < store_size) {
-		store_size = sync_offset - store_offset;
+	if (store_len - store_offset < store_size) {
+		store_size = store_len - store_offset;
 	}
 	if ((store_size > sizeof(uint32_t)) &&
 	    ((store_size % sizeof(uint32_t)) != 0)) {
@@ -266,7 +279,8 @@ static void store_dfu_data_chunk(void)
 
 	LOG_DBG("DFU data store chunk: %" PRIu32, cur_offset + store_offset);
 	int err = flash_area_write(flash_area, cur_offset + store_offset,
-				   &sync_buffer[store_offset], store_size);
+				   &sync_buffer[store_buf_idx][store_offset],
+				   store_size);
 	if (err) {
 		LOG_ERR("Cannot write data (%d)", err);
 		terminate_dfu();
@@ -283,7 +297,7 @@ static void background_store_handler(struct k_work *work)
 		store_dfu_data_chunk();
 	}
 
-	if (store_offset < sync_offset) {
+	if (store_offset < store_len) {
 		k_work_reschedule(&background_store, BACKGROUND_FLASH_STORE_TIMEOUT);
 		k_work_reschedule(&dfu_timeout, DFU_TIMEOUT);
 	} else {
@@ -291,14 +305,19 @@ static void background_store_handler(struct k_work *work)
 	}
 }
 
-static bool is_dfu_data_store_active(void)
-{
-	return k_work_delayable_is_pending(&background_store);
-}
-
 static void start_dfu_data_store(void)
 {
-	LOG_DBG("DFU data store start: %" PRIu32 " %" PRIu32, cur_offset, sync_offset);
+	/* Hand the received data over to the background store and make the
+	 * next sync buffer available to the host.
+	 */
+	__ASSERT_NO_MSG(store_len == 0);
+
+	store_buf_idx = rx_buf_idx;
+	store_len = sync_offset;
+	rx_buf_idx = (rx_buf_idx + 1) % SYNC_BUFFER_COUNT;
+	sync_offset = 0;
+
+	LOG_DBG("DFU data store start: %" PRIu32 " %" PRIu16, cur_offset, store_len);
 	store_offset = 0;
 	k_work_reschedule(&background_store, K_NO_WAIT);
 }
@@ -323,11 +342,11 @@ static void handle_dfu_data(const uint8_t *data, size_t size)
 		return;
 	}
 
-	if (size > sizeof(sync_buffer) - sync_offset) {
+	if (size > SYNC_BUFFER_SIZE - sync_offset) {
 		LOG_WRN("Chunk size truncated");
-		size = sizeof(sync_buffer) - sync_offset;
+		size = SYNC_BUFFER_SIZE - sync_offset;
 	}
-	memcpy(&sync_buffer[sync_offset], data, size);
+	memcpy(&sync_buffer[rx_buf_idx][sync_offset], data, size);
 
 	sync_offset += size;
 
@@ -434,20 +453,27 @@ static void handle_dfu_start(const uint8_t *data, const size_t size)
 static void handle_dfu_sync(uint8_t *data, size_t *size)
 {
 	LOG_INF("DFU sync requested");
-	uint16_t sync_buffer_size = sizeof(sync_buffer);
+	uint16_t sync_buffer_size = SYNC_BUFFER_SIZE;
 
-	bool storing_data = (sync_offset > 0);
 	bool dfu_active = (flash_area != NULL);
 
-	if (storing_data && !is_dfu_data_store_active()) {
+	if ((sync_offset > 0) && (store_len == 0)) {
 		start_dfu_data_store();
 	}
 
 	uint8_t dfu_state;
 
+	/* With double buffering the host may keep streaming into the free
+	 * sync buffer while the previous one is written to flash, so the
+	 * storing state is reported only when no buffer can receive data.
+	 */
+	bool rx_blocked = (store_len > 0) &&
+			  ((SYNC_BUFFER_COUNT == 1) ||
+			   (sync_offset == SYNC_BUFFER_SIZE));
+
 	if (!is_flash_area_clean) {
 		dfu_state = DFU_STATE_CLEANING;
-	} else if (storing_data) {
+	} else if (rx_blocked) {
 		dfu_state = DFU_STATE_STORING;
 	} else if (dfu_active) {
 		dfu_state = DFU_STATE_ACTIVE;
@@ -1084,6 +1084,98 @@ static void init(void)
 	reset_peripheral_address();
 }
 
+#if defined(CONFIG_DESKTOP_HID_FORWARD_MERGE_MOUSE_REPORTS)
+static int16_t mouse_report_get_xy(const uint8_t *payload, size_t axis)
+{
+	uint16_t val;
+
+	if (axis == MOUSE_REPORT_AXIS_X) {
+		val = ((payload[3] & 0x0f) << 8) | payload[2];
+	} else {
+		val = (payload[4] << 4) | (payload[3] >> 4);
+	}
+
+	/* Sign-extend the 12-bit value. */
+	return (val > MOUSE_REPORT_XY_MAX) ? (val - 0x1000) : val;
+}
+
+static bool mouse_report_merge(struct hid_report_event *dst,
+			       const struct hid_report_event *src)
+{
+	const size_t mouse_report_size = sizeof(uint8_t) + REPORT_SIZE_MOUSE;
+
+	if ((dst->dyndata.size != mouse_report_size) ||
+	    (src->dyndata.size != mouse_report_size) ||
+	    (dst->dyndata.data[0] != REPORT_ID_MOUSE) ||
+	    (src->dyndata.data[0] != REPORT_ID_MOUSE) ||
+	    (dst->source != src->source)) {
+		return false;
+	}
+
+	uint8_t *dd = &dst->dyndata.data[1];
+	const uint8_t *sd = &src->dyndata.data[1];
+
+	/* Merging across a button state change would drop a click edge. */
+	if (dd[0] != sd[0]) {
+		return false;
+	}
+
+	int32_t wheel = (int32_t)(int8_t)dd[1] + (int8_t)sd[1];
+	int32_t x = (int32_t)mouse_report_get_xy(dd, MOUSE_REPORT_AXIS_X) +
+		    mouse_report_get_xy(sd, MOUSE_REPORT_AXIS_X);
+	int32_t y = (int32_t)mouse_report_get_xy(dd, MOUSE_REPORT_AXIS_Y) +
+		    mouse_report_get_xy(sd, MOUSE_REPORT_AXIS_Y);
+
+	if ((wheel < MOUSE_REPORT_WHEEL_MIN) || (wheel > MOUSE_REPORT_WHEEL_MAX) ||
+	    (x < MOUSE_REPORT_XY_MIN) || (x > MOUSE_REPORT_XY_MAX) ||
+	    (y < MOUSE_REPORT_XY_MIN) || (y > MOUSE_REPORT_XY_MAX)) {
+		/* Motion would saturate, keep the reports separate. */
+		return false;
+	}
+
+	uint8_t x_buff[2];
+	uint8_t y_buff[2];
+
+	sys_put_le16(x, x_buff);
+	sys_put_le16(y, y_buff);
+
+	dd[1] = (int8_t)wheel;
+	dd[2] = x_buff[0];
+	dd[3] = (y_buff[0] << 4) | (x_buff[1] & 0x0f);
+	dd[4] = (y_buff[1] << 4) | (y_buff[0] >> 4);
+
+	return true;
+}
+
+static void merge_enqueued_mouse_reports(struct enqueued_reports *enqueued_reports,
+					 struct enqueued_report *item)
+{
+	int irep_idx = get_input_report_idx(REPORT_ID_MOUSE);
+
+	if (irep_idx < 0) {
+		return;
+	}
+
+	struct counted_list *reports = &enqueued_reports->reports[irep_idx];
+
+	while (!sys_slist_is_empty(&reports->list)) {
+		struct enqueued_report *next =
+			CONTAINER_OF(sys_slist_peek_head(&reports->list),
+				     __typeof__(*next),
+				     node);
+
+		if (!mouse_report_merge(item->report, next->report)) {
+			break;
+		}
+
+		(void)get_enqueued_report(enqueued_reports, irep_idx);
+
+		k_free(next->report);
+		k_free(next);
+	}
+}
+#endif /* CONFIG_DESKTOP_HID_FORWARD_MERGE_MOUSE_REPORTS */
+
 static void send_enqueued_report(struct subscriber *sub)
 {
 	if (sub->busy) {
@@ -1091,6 +1183,7 @@ static void send_enqueued_report(struct subscriber *sub)
 	}
 
 	struct enqueued_report *item;
+	struct enqueued_reports *item_src = &sub->enqueued_reports;
 
 	/* First try to send report left at subscriber. */
 	item = get_next_enqueued_report(&sub->enqueued_reports);
@@ -1111,12 +1204,20 @@ static void send_enqueued_report(struct subscriber *sub)
 
 			if (item) {
 				sub->last_peripheral_id = per_id;
+				item_src = &per->enqueued_reports;
 				break;
 			}
 		}
 	}
 
 	if (item) {
+#if defined(CONFIG_DESKTOP_HID_FORWARD_MERGE_MOUSE_REPORTS)
+		/* Drain the motion backlog of the source in one pass. */
+		merge_enqueued_mouse_reports(item_src, item);
+#else
+		ARG_UNUSED(item_src);
+#endif
+
 		EVENT_SUBMIT(item->report);
 
 		k_free(item);
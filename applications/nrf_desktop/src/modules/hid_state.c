@@ -157,6 +157,49 @@ static bool report_send(struct report_state *rs,
 			bool send_always);
 
 
+#if defined(CONFIG_DESKTOP_HID_MOTION_INTERPOLATION)
+static struct {
+	uint32_t last_sample_time;
+	uint8_t reports_left;
+} motion_interp;
+
+/**@brief Get the share of accumulated motion to put into the next report.
+ *
+ * The accumulated delta is spread evenly over the reports expected before
+ * the next sensor sample arrives. Only counts reported by the sensor are
+ * redistributed, the total pointer path is unchanged.
+ */
+static int16_t motion_interp_share(int16_t total)
+{
+	int16_t steps = motion_interp.reports_left;
+
+	if (steps <= 1) {
+		return total;
+	}
+
+	/* Round away from zero so slow motion is not starved. */
+	if (total >= 0) {
+		return (total + steps - 1) / steps;
+	} else {
+		return (total - steps + 1) / steps;
+	}
+}
+
+/**@brief Update the motion spread on a new sensor sample. */
+static void motion_interp_sample(void)
+{
+	uint32_t now = k_uptime_get_32();
+	uint32_t interval = now - motion_interp.last_sample_time;
+	uint32_t reports =
+		interval * CONFIG_DESKTOP_HID_MOTION_INTERPOLATION_REPORT_RATE / 1000;
+
+	motion_interp.last_sample_time = now;
+	motion_interp.reports_left = CLAMP(reports, 1,
+		CONFIG_DESKTOP_HID_MOTION_INTERPOLATION_MAX_SPAN);
+}
+#endif /* CONFIG_DESKTOP_HID_MOTION_INTERPOLATION */
+
+
 /**@brief Binary search. Input array must be already sorted.
  *
  * bsearch is also available from newlib libc, but including
@@ -653,9 +696,20 @@ static void send_report_mouse(struct report_state *rs, struct report_data *rd)
 	}
 
 	/* X/Y axis */
-	int16_t dx = MAX(MIN(rd->axes.axis[MOUSE_REPORT_AXIS_X], MOUSE_REPORT_XY_MAX),
+	int16_t dx_total = rd->axes.axis[MOUSE_REPORT_AXIS_X];
+	int16_t dy_total = rd->axes.axis[MOUSE_REPORT_AXIS_Y];
+
+#if defined(CONFIG_DESKTOP_HID_MOTION_INTERPOLATION)
+	dx_total = motion_interp_share(dx_total);
+	dy_total = motion_interp_share(dy_total);
+	if (motion_interp.reports_left > 1) {
+		motion_interp.reports_left--;
+	}
+#endif
+
+	int16_t dx = MAX(MIN(dx_total, MOUSE_REPORT_XY_MAX),
 		       MOUSE_REPORT_XY_MIN);
-	int16_t dy = MAX(MIN(-rd->axes.axis[MOUSE_REPORT_AXIS_Y], MOUSE_REPORT_XY_MAX),
+	int16_t dy = MAX(MIN(-dy_total, MOUSE_REPORT_XY_MAX),
 		       MOUSE_REPORT_XY_MIN);
 	if (dx) {
 		rd->axes.axis[MOUSE_REPORT_AXIS_X] -= dx;
@@ -1430,6 +1484,10 @@ static bool handle_motion_event(const struct motion_event *event)
 	rd->axes.axis[MOUSE_REPORT_AXIS_X] += event->dx;
 	rd->axes.axis[MOUSE_REPORT_AXIS_Y] += event->dy;
 
+#if defined(CONFIG_DESKTOP_HID_MOTION_INTERPOLATION)
+	motion_interp_sample();
+#endif
+
 	report_send(NULL, rd, true, true);
 
 	return false;
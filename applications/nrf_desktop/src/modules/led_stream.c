@@ -18,6 +18,7 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_LED_STREAM_LOG_LEVEL);
 
 #define INCOMING_LED_COLOR_COUNT 3
 #define LED_STREAM_DATA_SIZE 8
+#define LED_STREAM_STEP_SIZE (LED_STREAM_DATA_SIZE - sizeof(uint8_t))
 #define FETCH_CONFIG_SIZE 2
 #define LED_ID_POS 7
 
@@ -46,6 +47,9 @@ static bool initialized;
 enum led_stream_opt {
 	LED_STREAM_OPT_SET_LED_EFFECT,
 	LED_STREAM_OPT_GET_LEDS_STATE,
+#if defined(CONFIG_DESKTOP_LED_STREAM_BATCH)
+	LED_STREAM_OPT_SET_LED_EFFECT_BATCH,
+#endif
 
 	LED_STREAM_OPT_COUNT,
 };
@@ -53,6 +57,9 @@ enum led_stream_opt {
 const static char * const opt_descr[] = {
 	[LED_STREAM_OPT_SET_LED_EFFECT] = "set_led_effect",
 	[LED_STREAM_OPT_GET_LEDS_STATE] = "get_leds_state",
+#if defined(CONFIG_DESKTOP_LED_STREAM_BATCH)
+	[LED_STREAM_OPT_SET_LED_EFFECT_BATCH] = "set_led_effect_batch",
+#endif
 };
 
 
@@ -61,22 +68,15 @@ static size_t next_index(size_t index)
 	return (index + 1) % STEPS_QUEUE_ARRAY_SIZE;
 }
 
-static bool queue_data(const uint8_t *data, const size_t size, struct led *led)
+static bool queue_step(const uint8_t *data, struct led *led)
 {
 	BUILD_ASSERT(ARRAY_SIZE(led->steps_queue[led->rx_idx].color.c) == INCOMING_LED_COLOR_COUNT,
 		     "");
 
-	static const size_t min_len = sizeof(led->steps_queue[led->rx_idx].color.c)
-				    + sizeof(led->steps_queue[led->rx_idx].substep_count)
-				    + sizeof(led->steps_queue[led->rx_idx].substep_time)
-				    + sizeof(uint8_t); /* LED ID */
-
-	BUILD_ASSERT(min_len <= LED_STREAM_DATA_SIZE, "");
-
-	if (size != LED_STREAM_DATA_SIZE) {
-		LOG_WRN("Invalid stream data size (%zu)", size);
-		return false;
-	}
+	BUILD_ASSERT(sizeof(led->steps_queue[led->rx_idx].color.c)
+		     + sizeof(led->steps_queue[led->rx_idx].substep_count)
+		     + sizeof(led->steps_queue[led->rx_idx].substep_time) <=
+		     LED_STREAM_STEP_SIZE, "");
 
 	LOG_DBG("Enqueue effect data");
 
@@ -101,6 +101,16 @@ static bool queue_data(const uint8_t *data, const size_t size, struct led *led)
 	return true;
 }
 
+static bool queue_data(const uint8_t *data, const size_t size, struct led *led)
+{
+	if (size != LED_STREAM_DATA_SIZE) {
+		LOG_WRN("Invalid stream data size (%zu)", size);
+		return false;
+	}
+
+	return queue_step(data, led);
+}
+
 static void send_effect(const struct led_effect *effect, struct led *led)
 {
 	LOG_DBG("Send effect to leds");
@@ -192,6 +202,51 @@ static void handle_incoming_step(const uint8_t *data, const size_t size)
 	}
 }
 
+#if defined(CONFIG_DESKTOP_LED_STREAM_BATCH)
+static void handle_incoming_batch(const uint8_t *data, const size_t size)
+{
+	if (!initialized) {
+		LOG_WRN("Not initialized");
+		return;
+	}
+
+	if ((size <= LED_STREAM_STEP_SIZE) ||
+	    ((size - sizeof(uint8_t)) % LED_STREAM_STEP_SIZE != 0)) {
+		LOG_WRN("Invalid batch data size (%zu)", size);
+		return;
+	}
+
+	size_t led_id = data[size - 1];
+
+	if (led_id >= ARRAY_SIZE(leds)) {
+		LOG_WRN("Wrong LED ID: %zu, effect ignored", led_id);
+		return;
+	}
+
+	struct led *led = &leds[led_id];
+	size_t step_count = (size - sizeof(uint8_t)) / LED_STREAM_STEP_SIZE;
+
+	for (size_t i = 0; i < step_count; i++) {
+		if (count_free_places(led) == 0) {
+			LOG_WRN("Queue is full - drop remaining steps");
+			break;
+		}
+
+		if (!queue_step(&data[i * LED_STREAM_STEP_SIZE], led)) {
+			break;
+		}
+	}
+
+	if (!led->streaming && !is_queue_empty(led)) {
+		LOG_DBG("Sending first led effect for led %zu", led_id);
+
+		led->streaming = true;
+
+		send_data_from_queue(led);
+	}
+}
+#endif /* CONFIG_DESKTOP_LED_STREAM_BATCH */
+
 static void config_set(const uint8_t opt_id, const uint8_t *data, const size_t size)
 {
 	switch (opt_id) {
@@ -199,6 +254,12 @@ static void config_set(const uint8_t opt_id, const uint8_t *data, const size_t s
 		handle_incoming_step(data, size);
 		break;
 
+#if defined(CONFIG_DESKTOP_LED_STREAM_BATCH)
+	case LED_STREAM_OPT_SET_LED_EFFECT_BATCH:
+		handle_incoming_batch(data, size);
+		break;
+#endif
+
 	default:
 		LOG_WRN("Unknown config set: %" PRIu8, opt_id);
 		break;
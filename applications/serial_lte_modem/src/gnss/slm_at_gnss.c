@@ -46,6 +46,10 @@ static struct k_work pgps_req;
 static struct k_work fix_rep;
 static struct k_work cell_pos_req;
 static enum nrf_cloud_cell_pos_type cell_pos_type;
+#if defined(CONFIG_SLM_GNSS_PSM_REQUEST)
+static struct k_work psm_req;
+static bool psm_requested;
+#endif
 
 static struct cloud_backend *nrf_cloud;
 static bool nrf_cloud_ready;
@@ -150,6 +154,34 @@ static void pgps_req_wk(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_SLM_GNSS_PSM_REQUEST)
+static void psm_req_wk(struct k_work *work)
+{
+	int err;
+
+	ARG_UNUSED(work);
+
+	/* The modem gives GNSS radio time only while LTE is idle. Request
+	 * PSM so that the network lets the modem interleave LTE and GNSS.
+	 */
+	err = lte_lc_psm_req(true);
+	if (err) {
+		LOG_ERR("Failed to request PSM, error: %d", err);
+	} else {
+		LOG_INF("PSM requested to unblock GNSS");
+		psm_requested = true;
+	}
+}
+
+static void gnss_psm_release(void)
+{
+	if (psm_requested) {
+		psm_requested = false;
+		(void)lte_lc_psm_req(false);
+	}
+}
+#endif /* CONFIG_SLM_GNSS_PSM_REQUEST */
+
 AT_MONITOR(ncell_meas, "NCELLMEAS", ncell_meas_mon, PAUSED);
 
 static void ncell_meas_mon(const char *notify)
@@ -496,6 +528,11 @@ static void gnss_event_handler(int event)
 		break;
 	case NRF_MODEM_GNSS_EVT_BLOCKED:
 		LOG_INF("GNSS_EVT_BLOCKED");
+#if defined(CONFIG_SLM_GNSS_PSM_REQUEST)
+		if (!psm_requested) {
+			k_work_submit_to_queue(&slm_work_q, &psm_req);
+		}
+#endif
 		break;
 	case NRF_MODEM_GNSS_EVT_UNBLOCKED:
 		LOG_INF("GNSS_EVT_UNBLOCKED");
@@ -706,6 +743,9 @@ int handle_at_gps(enum at_cmd_type cmd_type)
 			}
 		} else if (op == GPS_STOP && run_type == RUN_TYPE_GPS) {
 			err = nrf_modem_gnss_stop();
+#if defined(CONFIG_SLM_GNSS_PSM_REQUEST)
+			gnss_psm_release();
+#endif
 			run_type = RUN_TYPE_NONE;
 		} else {
 			err = -EINVAL;
@@ -853,6 +893,9 @@ int handle_at_agps(enum at_cmd_type cmd_type)
 			}
 		} else if (op == AGPS_STOP && run_type == RUN_TYPE_AGPS) {
 			err = nrf_modem_gnss_stop();
+#if defined(CONFIG_SLM_GNSS_PSM_REQUEST)
+			gnss_psm_release();
+#endif
 			run_type = RUN_TYPE_NONE;
 		} else {
 			err = -EINVAL;
@@ -941,6 +984,9 @@ int handle_at_pgps(enum at_cmd_type cmd_type)
 			}
 		} else if (op == PGPS_STOP && run_type == RUN_TYPE_PGPS) {
 			err = nrf_modem_gnss_stop();
+#if defined(CONFIG_SLM_GNSS_PSM_REQUEST)
+			gnss_psm_release();
+#endif
 			run_type = RUN_TYPE_NONE;
 		} else {
 			err = -EINVAL;
@@ -1040,6 +1086,9 @@ int slm_at_gnss_init(void)
 	k_work_init(&pgps_req, pgps_req_wk);
 	k_work_init(&cell_pos_req, cell_pos_req_wk);
 	k_work_init(&fix_rep, fix_rep_wk);
+#if defined(CONFIG_SLM_GNSS_PSM_REQUEST)
+	k_work_init(&psm_req, psm_req_wk);
+#endif
 
 	return err;
 }
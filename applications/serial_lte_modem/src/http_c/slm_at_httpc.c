@@ -56,6 +56,7 @@ static struct slm_httpc_ctx {
 	char *resource;			/* resource */
 	char *headers;			/* headers */
 	size_t pl_len;			/* payload length */
+	bool chunked;			/* chunked transfer encoding */
 	size_t total_sent;		/* payload has been sent to server */
 	enum httpc_state state;		/* HTTPC state */
 } httpc;
@@ -192,16 +193,64 @@ int do_send_payload(const uint8_t *data, int len)
 	return 0;
 }
 
-int httpc_datamode_callback(uint8_t op, const uint8_t *data, int len)
+static int send_all(const uint8_t *data, size_t len)
 {
-	int ret = 0;
+	while (len > 0) {
+		ssize_t ret = send(httpc.fd, data, len, 0);
+
+		if (ret < 0) {
+			return -errno;
+		}
+		data += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+static int do_send_payload_chunked(const uint8_t *data, int len)
+{
+	char chunk_header[sizeof("FFFFFFFF\r\n")];
+	int ret;
 
 	if (data == NULL || len <= 0) {
-		LOG_ERR("Wrong raw data");
 		return -EINVAL;
 	}
+
+	/* Wrap the received data in one chunk */
+	sprintf(chunk_header, "%x\r\n", len);
+	ret = send_all(chunk_header, strlen(chunk_header));
+	if (ret == 0) {
+		ret = send_all(data, len);
+	}
+	if (ret == 0) {
+		ret = send_all("\r\n", 2);
+	}
+	if (ret) {
+		LOG_ERR("Fail to send chunk: %d", ret);
+		httpc.total_sent = ret;
+		k_sem_give(&http_req_sem);
+		return ret;
+	}
+	httpc.total_sent += len;
+
+	return 0;
+}
+
+int httpc_datamode_callback(uint8_t op, const uint8_t *data, int len)
+{
+	int ret = 0;
+
 	if (op == DATAMODE_SEND) {
-		ret = do_send_payload(data, len);
+		if (data == NULL || len <= 0) {
+			LOG_ERR("Wrong raw data");
+			return -EINVAL;
+		}
+		if (httpc.chunked) {
+			ret = do_send_payload_chunked(data, len);
+		} else {
+			ret = do_send_payload(data, len);
+		}
 		LOG_INF("datamode send: %d", ret);
 		if (ret == 0) {
 			/* Payload sent successfully */
@@ -213,6 +262,10 @@ int httpc_datamode_callback(uint8_t op, const uint8_t *data, int len)
 			rsp_send(rsp_buf, strlen(rsp_buf));
 		}
 	} else if (op == DATAMODE_EXIT) {
+		if (httpc.chunked) {
+			/* Terminate the chunked body */
+			(void)send_all("0\r\n\r\n", sizeof("0\r\n\r\n") - 1);
+		}
 		k_sem_give(&http_req_sem);
 	}
 
@@ -221,7 +274,7 @@ int httpc_datamode_callback(uint8_t op, const uint8_t *data, int len)
 
 static int payload_cb(int sock, struct http_request *req, void *user_data)
 {
-	if (httpc.pl_len > 0) {
+	if (httpc.pl_len > 0 || httpc.chunked) {
 		enter_datamode(httpc_datamode_callback);
 		sprintf(rsp_buf, "\r\n#XHTTPCREQ: 1\r\n");
 		rsp_send(rsp_buf, strlen(rsp_buf));
@@ -521,7 +574,7 @@ static void httpc_thread_fn(void *arg1, void *arg2, void *arg3)
 }
 
 /**@brief handle AT#XHTTPCREQ commands
- *  AT#XHTTPCREQ=<method>,<resource>,<header>[,<payload_length>]
+ *  AT#XHTTPCREQ=<method>,<resource>,<header>[,<payload_length>[,<chunked>]]
  *  AT#XHTTPCREQ? READ command not supported
  *  AT#XHTTPCREQ=?
  */
@@ -574,6 +627,20 @@ int handle_at_httpc_request(enum at_cmd_type cmd_type)
 				return err;
 			}
 		}
+		httpc.chunked = false;
+		if (param_count >= 6) {
+			uint16_t chunked;
+
+			err = at_params_unsigned_short_get(&at_param_list, 5, &chunked);
+			if (err != 0) {
+				return err;
+			}
+			/* Payload with chunked transfer encoding, of a length not
+			 * known in advance. The payload length is ignored and the
+			 * body ends when data mode is terminated.
+			 */
+			httpc.chunked = (chunked == 1);
+		}
 		/* start http request thread */
 		k_thread_create(&httpc_thread, httpc_thread_stack,
 				K_THREAD_STACK_SIZEOF(httpc_thread_stack),
@@ -596,6 +663,7 @@ int slm_at_httpc_init(void)
 	httpc.fd = INVALID_SOCKET;
 	httpc.state = HTTPC_INIT;
 	httpc.pl_len = 0;
+	httpc.chunked = false;
 	httpc.total_sent = 0;
 
 	return 0;
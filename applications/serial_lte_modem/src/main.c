@@ -277,16 +277,17 @@ void start_execute(void)
 		return;
 	}
 
+	/* Start the work queue before the AT host, which submits work to it */
+	k_work_queue_start(&slm_work_q, slm_wq_stack_area,
+			   K_THREAD_STACK_SIZEOF(slm_wq_stack_area),
+			   SLM_WQ_PRIORITY, NULL);
+	k_work_init(&exit_idle_work, exit_idle);
+
 	err = slm_at_host_init();
 	if (err) {
 		LOG_ERR("Failed to init at_host: %d", err);
 		return;
 	}
-
-	k_work_queue_start(&slm_work_q, slm_wq_stack_area,
-			   K_THREAD_STACK_SIZEOF(slm_wq_stack_area),
-			   SLM_WQ_PRIORITY, NULL);
-	k_work_init(&exit_idle_work, exit_idle);
 }
 
 #if defined(CONFIG_SLM_START_SLEEP)
@@ -59,6 +59,11 @@ static struct mqtt_publish_param pub_param;
 static uint8_t pub_topic[MQTT_MAX_TOPIC_LEN];
 static uint8_t pub_msg[MQTT_MESSAGE_BUFFER_LEN];
 
+#if defined(CONFIG_SLM_MQTT_TOPIC_ALIAS)
+/* Topics registered by #XMQTTALIAS, published by index. Empty: unused. */
+static char topic_alias[CONFIG_SLM_MQTT_TOPIC_ALIAS_CNT][MQTT_MAX_TOPIC_LEN + 1];
+#endif
+
 /* global variable defined in different files */
 extern struct at_param_list at_param_list;
 extern char rsp_buf[CONFIG_AT_CMD_RESPONSE_MAX_LEN];
@@ -562,10 +567,32 @@ int handle_at_mqtt_publish(enum at_cmd_type cmd_type)
 
 	switch (cmd_type) {
 	case AT_CMD_TYPE_SET_COMMAND:
+#if defined(CONFIG_SLM_MQTT_TOPIC_ALIAS)
+		if (at_params_type_get(&at_param_list, 1) == AT_PARAM_TYPE_NUM_INT) {
+			uint16_t alias;
+
+			err = at_params_unsigned_short_get(&at_param_list, 1, &alias);
+			if (err) {
+				return err;
+			}
+			if (alias >= CONFIG_SLM_MQTT_TOPIC_ALIAS_CNT ||
+			    topic_alias[alias][0] == '\0') {
+				return -EINVAL;
+			}
+			strcpy(pub_topic, topic_alias[alias]);
+			topic_sz = strlen(pub_topic);
+		} else {
+			err = util_string_get(&at_param_list, 1, pub_topic, &topic_sz);
+			if (err) {
+				return err;
+			}
+		}
+#else
 		err = util_string_get(&at_param_list, 1, pub_topic, &topic_sz);
 		if (err) {
 			return err;
 		}
+#endif
 		pub_msg[0] = '\0';
 		if (at_params_type_get(&at_param_list, 3) == AT_PARAM_TYPE_STRING) {
 			err = util_string_get(&at_param_list, 3, pub_msg, &msg_sz);
@@ -636,6 +663,60 @@ int handle_at_mqtt_publish(enum at_cmd_type cmd_type)
 	return err;
 }
 
+#if defined(CONFIG_SLM_MQTT_TOPIC_ALIAS)
+/**@brief handle AT#XMQTTALIAS commands
+ *  AT#XMQTTALIAS=<index>,<topic>
+ *  AT#XMQTTALIAS?
+ *  AT#XMQTTALIAS=?
+ */
+int handle_at_mqtt_alias(enum at_cmd_type cmd_type)
+{
+	int err = -EINVAL;
+	uint16_t index;
+	size_t topic_sz = MQTT_MAX_TOPIC_LEN;
+
+	switch (cmd_type) {
+	case AT_CMD_TYPE_SET_COMMAND:
+		err = at_params_unsigned_short_get(&at_param_list, 1, &index);
+		if (err) {
+			return err;
+		}
+		if (index >= CONFIG_SLM_MQTT_TOPIC_ALIAS_CNT) {
+			return -EINVAL;
+		}
+		/* An empty topic releases the alias */
+		err = util_string_get(&at_param_list, 2, topic_alias[index], &topic_sz);
+		if (err) {
+			return err;
+		}
+		break;
+
+	case AT_CMD_TYPE_READ_COMMAND:
+		for (int i = 0; i < CONFIG_SLM_MQTT_TOPIC_ALIAS_CNT; i++) {
+			if (topic_alias[i][0] == '\0') {
+				continue;
+			}
+			sprintf(rsp_buf, "\r\n#XMQTTALIAS: %d,\"%s\"\r\n", i, topic_alias[i]);
+			rsp_send(rsp_buf, strlen(rsp_buf));
+		}
+		err = 0;
+		break;
+
+	case AT_CMD_TYPE_TEST_COMMAND:
+		sprintf(rsp_buf, "\r\n#XMQTTALIAS: (0-%d),<topic>\r\n",
+			CONFIG_SLM_MQTT_TOPIC_ALIAS_CNT - 1);
+		rsp_send(rsp_buf, strlen(rsp_buf));
+		err = 0;
+		break;
+
+	default:
+		break;
+	}
+
+	return err;
+}
+#endif /* CONFIG_SLM_MQTT_TOPIC_ALIAS */
+
 /**@brief handle AT#XMQTTSUB commands
  *  AT#XMQTTSUB=<topic>,<qos>
  *  AT#XMQTTSUB? READ command not supported
@@ -722,6 +803,9 @@ int slm_at_mqtt_init(void)
 	pub_param.message_id = 0;
 	memset(&ctx, 0, sizeof(ctx));
 	ctx.sec_tag = INVALID_SEC_TAG;
+#if defined(CONFIG_SLM_MQTT_TOPIC_ALIAS)
+	memset(topic_alias, 0, sizeof(topic_alias));
+#endif
 
 	return 0;
 }
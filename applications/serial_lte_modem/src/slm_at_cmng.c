@@ -110,6 +110,11 @@ int handle_at_xcmng(enum at_cmd_type cmd_type)
 			if (err != 0) {
 				LOG_ERR("FAILED! modem_key_mgmt_write() = %d",
 					err);
+#if defined(CONFIG_SLM_NATIVE_TLS_CACHE)
+			} else {
+				/* Next load must read the new credentials */
+				(void)slm_tls_flushcrdl(sec_tag);
+#endif
 			}
 			k_free(content);
 		} else if (op == AT_CMNG_OP_READ) {
@@ -140,6 +145,10 @@ int handle_at_xcmng(enum at_cmd_type cmd_type)
 			if (err != 0) {
 				LOG_ERR("FAILED! modem_key_mgmt_delete() = %d",
 					err);
+#if defined(CONFIG_SLM_NATIVE_TLS_CACHE)
+			} else {
+				(void)slm_tls_flushcrdl(sec_tag);
+#endif
 			}
 		}
 		break;
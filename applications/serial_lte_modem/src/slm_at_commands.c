@@ -355,6 +355,9 @@ int handle_at_ftp(enum at_cmd_type cmd_type);
 #if defined(CONFIG_SLM_MQTTC)
 int handle_at_mqtt_connect(enum at_cmd_type cmd_type);
 int handle_at_mqtt_publish(enum at_cmd_type cmd_type);
+#if defined(CONFIG_SLM_MQTT_TOPIC_ALIAS)
+int handle_at_mqtt_alias(enum at_cmd_type cmd_type);
+#endif
 int handle_at_mqtt_subscribe(enum at_cmd_type cmd_type);
 int handle_at_mqtt_unsubscribe(enum at_cmd_type cmd_type);
 #endif
@@ -447,6 +450,9 @@ static struct slm_at_cmd {
 #if defined(CONFIG_SLM_MQTTC)
 	{"AT#XMQTTCON", handle_at_mqtt_connect},
 	{"AT#XMQTTPUB", handle_at_mqtt_publish},
+#if defined(CONFIG_SLM_MQTT_TOPIC_ALIAS)
+	{"AT#XMQTTALIAS", handle_at_mqtt_alias},
+#endif
 	{"AT#XMQTTSUB", handle_at_mqtt_subscribe},
 	{"AT#XMQTTUNSUB", handle_at_mqtt_unsubscribe},
 #endif
@@ -31,8 +31,8 @@ LOG_MODULE_REGISTER(slm_at_host, CONFIG_SLM_LOG_LEVEL);
  *  Modem library's NRF_MODEM_AT_MAX_CMD_SIZE */
 #define AT_MAX_CMD_LEN          4096
 
-#define UART_RX_BUF_NUM         2
-#define UART_RX_LEN             256
+#define UART_RX_BUF_NUM         CONFIG_SLM_UART_RX_BUF_COUNT
+#define UART_RX_LEN             CONFIG_SLM_UART_RX_BUF_SIZE
 #define UART_RX_TIMEOUT_MS      1
 #define UART_ERROR_DELAY_MS     500
 #define UART_RX_MARGIN_MS       10
@@ -56,11 +56,36 @@ static struct k_work raw_send_work;
 static struct k_work cmd_send_work;
 
 static uint8_t uart_rx_buf[UART_RX_BUF_NUM][UART_RX_LEN];
-static uint8_t *next_buf;
+/* Ring of RX buffers currently not owned by the UART driver */
+static uint8_t *uart_rx_free[UART_RX_BUF_NUM];
+static uint8_t uart_rx_free_put;
+static uint8_t uart_rx_free_get;
+static uint8_t uart_rx_free_cnt;
 static uint8_t *uart_tx_buf;
 static bool uart_recovery_pending;
 static struct k_work_delayable uart_recovery_work;
 
+#if defined(CONFIG_SLM_DATAMODE_PASSTHROUGH)
+/** @brief Segment of an RX buffer pending consumption in data mode. */
+struct rx_segment {
+	const uint8_t *data;
+	uint16_t len;
+	int8_t buf;  /* Index in uart_rx_buf, or -1 for re-injected data */
+};
+
+#define RX_SEGMENT_NUM (4 * UART_RX_BUF_NUM)
+
+/* Queue of received segments, sent to the data mode handler in place */
+static struct rx_segment rx_segments[RX_SEGMENT_NUM];
+static uint8_t rx_seg_put;
+static uint8_t rx_seg_get;
+static uint8_t rx_seg_cnt;
+/* Bytes received into each RX buffer but not consumed yet */
+static uint16_t rx_buf_unconsumed[UART_RX_BUF_NUM];
+/* RX buffers released by the UART driver while still being consumed */
+static bool rx_buf_held[UART_RX_BUF_NUM];
+#endif /* CONFIG_SLM_DATAMODE_PASSTHROUGH */
+
 static K_SEM_DEFINE(tx_done, 0, 1);
 
 /* global functions defined in different files */
@@ -77,6 +102,7 @@ uint16_t datamode_time_limit;                 /* Send trigger by time in data mo
 /* global variable defined in different files */
 extern bool uart_configured;
 extern struct uart_config slm_uart;
+extern struct k_work_q slm_work_q;
 
 static int uart_send(const uint8_t *str, size_t len)
 {
@@ -118,17 +144,114 @@ void datamode_send(const uint8_t *data, size_t len)
 	(void)uart_send(data, len);
 }
 
+static void uart_rx_buf_free_put(uint8_t *buf)
+{
+	uart_rx_free[uart_rx_free_put] = buf;
+	uart_rx_free_put = (uart_rx_free_put + 1) % UART_RX_BUF_NUM;
+	uart_rx_free_cnt++;
+}
+
+static uint8_t *uart_rx_buf_free_get(void)
+{
+	uint8_t *buf;
+
+	if (uart_rx_free_cnt == 0) {
+		return NULL;
+	}
+	buf = uart_rx_free[uart_rx_free_get];
+	uart_rx_free_get = (uart_rx_free_get + 1) % UART_RX_BUF_NUM;
+	uart_rx_free_cnt--;
+
+	return buf;
+}
+
+#if defined(CONFIG_SLM_DATAMODE_PASSTHROUGH)
+static int8_t rx_buf_index(const uint8_t *data)
+{
+	return (data - &uart_rx_buf[0][0]) / UART_RX_LEN;
+}
+
+/* Called in interrupt context */
+static int rx_segment_put(const uint8_t *data, uint16_t len, int8_t buf)
+{
+	if (rx_seg_cnt >= RX_SEGMENT_NUM) {
+		return -ENOSPC;
+	}
+	rx_segments[rx_seg_put].data = data;
+	rx_segments[rx_seg_put].len = len;
+	rx_segments[rx_seg_put].buf = buf;
+	rx_seg_put = (rx_seg_put + 1) % RX_SEGMENT_NUM;
+	rx_seg_cnt++;
+	if (buf >= 0) {
+		rx_buf_unconsumed[buf] += len;
+	}
+
+	return 0;
+}
+
+/* Account for consumed data and recycle a fully consumed, released buffer */
+static void rx_segment_consume(struct rx_segment *seg, uint16_t len)
+{
+	unsigned int key = irq_lock();
+
+	seg->data += len;
+	seg->len -= len;
+	if (seg->buf >= 0) {
+		rx_buf_unconsumed[seg->buf] -= len;
+		if (rx_buf_unconsumed[seg->buf] == 0 && rx_buf_held[seg->buf]) {
+			rx_buf_held[seg->buf] = false;
+			uart_rx_buf_free_put(uart_rx_buf[seg->buf]);
+		}
+	}
+	if (seg->len == 0) {
+		rx_seg_get = (rx_seg_get + 1) % RX_SEGMENT_NUM;
+		rx_seg_cnt--;
+	}
+	irq_unlock(key);
+}
+#endif /* CONFIG_SLM_DATAMODE_PASSTHROUGH */
+
+/* Called in interrupt context */
+static void uart_rx_buf_release(uint8_t *buf)
+{
+#if defined(CONFIG_SLM_DATAMODE_PASSTHROUGH)
+	int8_t idx = rx_buf_index(buf);
+
+	if (rx_buf_unconsumed[idx] > 0) {
+		/* Recycled when its last segment has been consumed */
+		rx_buf_held[idx] = true;
+		return;
+	}
+#endif
+	uart_rx_buf_free_put(buf);
+}
+
 static int uart_receive(void)
 {
 	int ret;
 
+	/* Prepare the free buffer ring before enabling RX, as the driver
+	 * requests its next buffer from interrupt context.
+	 */
+	uart_rx_free_put = 0;
+	uart_rx_free_get = 0;
+	uart_rx_free_cnt = 0;
+	for (int i = 1; i < UART_RX_BUF_NUM; i++) {
+		uart_rx_buf_free_put(uart_rx_buf[i]);
+	}
+#if defined(CONFIG_SLM_DATAMODE_PASSTHROUGH)
+	rx_seg_put = 0;
+	rx_seg_get = 0;
+	rx_seg_cnt = 0;
+	memset(rx_buf_unconsumed, 0, sizeof(rx_buf_unconsumed));
+	memset(rx_buf_held, 0, sizeof(rx_buf_held));
+#endif
 	ret = uart_rx_enable(uart_dev, uart_rx_buf[0], sizeof(uart_rx_buf[0]), UART_RX_TIMEOUT_MS);
 	if (ret) {
 		LOG_ERR("UART RX failed: %d", ret);
 		rsp_send(FATAL_STR, sizeof(FATAL_STR) - 1);
 		return ret;
 	}
-	next_buf = uart_rx_buf[1];
 	at_buf_overflow = false;
 	at_buf_len = 0;
 
@@ -281,6 +404,58 @@ static void response_handler(void *context, const char *response)
 	}
 }
 
+#if defined(CONFIG_SLM_DATAMODE_PASSTHROUGH)
+static void raw_send(struct k_work *work)
+{
+	struct rx_segment *seg;
+	int size_sent;
+	unsigned int key;
+
+	ARG_UNUSED(work);
+
+	while (true) {
+		key = irq_lock();
+		if (rx_seg_cnt == 0) {
+			irq_unlock(key);
+			break;
+		}
+		seg = &rx_segments[rx_seg_get];
+		irq_unlock(key);
+
+		LOG_INF("Raw send %d", seg->len);
+		LOG_HEXDUMP_DBG(seg->data, MIN(seg->len, HEXDUMP_DATAMODE_MAX), "RX-DATAMODE");
+		if (datamode_handler) {
+			size_sent = datamode_handler(DATAMODE_SEND, seg->data, seg->len);
+			if (size_sent > 0) {
+				rx_segment_consume(seg, MIN(size_sent, seg->len));
+			} else if (size_sent == 0) {
+				rx_segment_consume(seg, seg->len);
+			} else {
+				LOG_WRN("Raw send failed, %d dropped", seg->len);
+				rx_segment_consume(seg, seg->len);
+				/* remaining segments are dropped when UART RX
+				 * is restarted by exit_datamode()
+				 */
+				(void)exit_datamode(DATAMODE_EXIT_ERROR);
+				if (datamode_rx_disabled) {
+					/* UART RX already resumed */
+					datamode_rx_disabled = false;
+				}
+				break;
+			}
+		} else {
+			LOG_WRN("no handler, %d dropped", seg->len);
+			rx_segment_consume(seg, seg->len);
+		}
+	}
+
+	/* resume UART RX in case of stopped by buffer full */
+	if (datamode_rx_disabled) {
+		(void)uart_receive();
+		datamode_rx_disabled = false;
+	}
+}
+#else /* CONFIG_SLM_DATAMODE_PASSTHROUGH */
 static void raw_send(struct k_work *work)
 {
 	uint8_t *data = NULL;
@@ -325,14 +500,24 @@ static void raw_send(struct k_work *work)
 		datamode_rx_disabled = false;
 	}
 }
+#endif /* CONFIG_SLM_DATAMODE_PASSTHROUGH */
+
+static bool raw_data_pending(void)
+{
+#if defined(CONFIG_SLM_DATAMODE_PASSTHROUGH)
+	return rx_seg_cnt > 0;
+#else
+	return !ring_buf_is_empty(&data_rb);
+#endif
+}
 
 static void inactivity_timer_handler(struct k_timer *timer)
 {
 	ARG_UNUSED(timer);
 
 	LOG_INF("time limit reached");
-	if (!ring_buf_is_empty(&data_rb)) {
-		k_work_submit(&raw_send_work);
+	if (raw_data_pending()) {
+		k_work_submit_to_queue(&slm_work_q, &raw_send_work);
 	} else {
 		LOG_WRN("data buffer empty");
 	}
@@ -375,7 +560,11 @@ static int raw_rx_handler(const uint8_t *data, int datalen)
 			/* quit procedure aborted */
 			k_timer_stop(&silence_timer);
 			datamode_off_pending = false;
+#if defined(CONFIG_SLM_DATAMODE_PASSTHROUGH)
+			(void)rx_segment_put(quit_str, quit_str_len, -1);
+#else
 			(void)ring_buf_put(&data_rb, quit_str, quit_str_len);
+#endif
 			LOG_INF("datamode off cancelled");
 		}
 	} else {
@@ -395,6 +584,18 @@ static int raw_rx_handler(const uint8_t *data, int datalen)
 		k_timer_stop(&inactivity_timer);
 	}
 
+#if defined(CONFIG_SLM_DATAMODE_PASSTHROUGH)
+	/* Second, queue the DMA buffer segment for sending in place.
+	 * When the driver runs out of RX buffers because sending lags
+	 * behind, reception stops and is resumed from UART_RX_DISABLED.
+	 */
+	ret = rx_segment_put(data, datalen, rx_buf_index(data));
+	if (ret) {
+		LOG_ERR("segment queue full, %d dropped", datalen);
+		uart_rx_disable(uart_dev);
+		return -1;
+	}
+#else
 	/* Second, save data to buffer */
 	ret = ring_buf_put(&data_rb, data, datalen);
 	if (ret != datalen) {
@@ -408,12 +609,13 @@ static int raw_rx_handler(const uint8_t *data, int datalen)
 		uart_rx_disable(uart_dev);
 		return -1;
 	}
+#endif /* CONFIG_SLM_DATAMODE_PASSTHROUGH */
 
 	/* Third, start/restart inactivity timer, or trigger sending */
 	if (datamode_time_limit > 0) {
 		k_timer_start(&inactivity_timer, K_MSEC(datamode_time_limit), K_NO_WAIT);
 	} else {
-		k_work_submit(&raw_send_work);
+		k_work_submit_to_queue(&slm_work_q, &raw_send_work);
 	}
 
 	rx_start = k_uptime_get();
@@ -638,7 +840,7 @@ send:
 
 	at_buf[at_cmd_len] = '\0';
 	at_buf_len = at_cmd_len;
-	k_work_submit(&cmd_send_work);
+	k_work_submit_to_queue(&slm_work_q, &cmd_send_work);
 
 	inside_quotes = false;
 	at_cmd_len = 0;
@@ -651,6 +853,7 @@ send:
 static void uart_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	int err;
+	uint8_t *next_buf;
 	static uint16_t pos;
 	static bool enable_rx_retry;
 
@@ -688,13 +891,21 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 		break;
 	case UART_RX_BUF_REQUEST:
 		pos = 0;
+		next_buf = uart_rx_buf_free_get();
+		if (next_buf == NULL) {
+			/* RX stops when the driver runs out of buffers and is
+			 * restarted from the UART_RX_DISABLED event.
+			 */
+			LOG_WRN("No free RX buffer");
+			break;
+		}
 		err = uart_rx_buf_rsp(uart_dev, next_buf, sizeof(uart_rx_buf[0]));
 		if (err) {
 			LOG_WRN("UART RX buf rsp: %d", err);
 		}
 		break;
 	case UART_RX_BUF_RELEASED:
-		next_buf = evt->data.rx_buf.buf;
+		uart_rx_buf_release(evt->data.rx_buf.buf);
 		break;
 	case UART_RX_STOPPED:
 		LOG_WRN("RX_STOPPED (%d)", evt->data.rx_stop.reason);
@@ -708,7 +919,7 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 		if (slm_operation_mode == SLM_DATA_MODE) {
 			datamode_rx_disabled = true;
 			/* flush data in ring-buffer, if any */
-			k_work_submit(&raw_send_work);
+			k_work_submit_to_queue(&slm_work_q, &raw_send_work);
 		}
 		if (enable_rx_retry && !uart_recovery_pending) {
 			k_work_schedule(&uart_recovery_work, K_MSEC(UART_ERROR_DELAY_MS));
@@ -63,6 +63,9 @@ extern char rsp_buf[CONFIG_AT_CMD_RESPONSE_MAX_LEN];
 /* forward declarations */
 #define SOCKET_SEND_TMO_SEC      30
 static int socket_poll(int sock_fd, int event, int timeout);
+#if defined(CONFIG_SLM_SOCKETIND)
+static void sockind_rearm(int fd);
+#endif
 
 static int do_socket_open(void)
 {
@@ -137,6 +140,18 @@ static int do_secure_socket_open(int peer_verify)
 		goto error_exit;
 	}
 
+#if defined(CONFIG_SLM_NATIVE_TLS_CACHE)
+	/* Keep session state across socket closes for resumption */
+	int session_cache = TLS_SESSION_CACHE_ENABLED;
+
+	ret = setsockopt(sock.fd, SOL_TLS, TLS_SESSION_CACHE, &session_cache, sizeof(int));
+	if (ret) {
+		LOG_ERR("setsockopt(TLS_SESSION_CACHE) error: %d", -errno);
+		ret = -errno;
+		goto error_exit;
+	}
+#endif
+
 	/* Set up (D)TLS peer verification */
 	ret = setsockopt(sock.fd, SOL_TLS, TLS_PEER_VERIFY, &peer_verify, sizeof(peer_verify));
 	if (ret) {
@@ -688,6 +703,9 @@ static int do_recv(int timeout)
 		return ret;
 	}
 	ret = recv(sockfd, (void *)rx_data, length, 0);
+#if defined(CONFIG_SLM_SOCKETIND)
+	sockind_rearm(sockfd);
+#endif
 	if (ret < 0) {
 		LOG_WRN("recv() error: %d", -errno);
 		return -errno;
@@ -830,6 +848,9 @@ static int do_recvfrom(int timeout)
 		return ret;
 	}
 	ret = recvfrom(sock.fd, (void *)rx_data, length, 0, &remote, &addrlen);
+#if defined(CONFIG_SLM_SOCKETIND)
+	sockind_rearm(sock.fd);
+#endif
 	if (ret < 0) {
 		LOG_ERR("recvfrom() error: %d", -errno);
 		return -errno;
@@ -888,6 +909,98 @@ static int socket_poll(int sock_fd, int event, int timeout)
 	return 0;
 }
 
+#if defined(CONFIG_SLM_SOCKETIND)
+#define SOCKIND_STACK_SIZE	KB(1)
+#define SOCKIND_POLL_MS		500
+/** Events reported by the #XSOCKETIND notification. */
+#define SOCKIND_EVENT_DATA	1
+#define SOCKIND_EVENT_ERROR	2
+
+/* Whether the module has been initialized and sockets can be watched */
+static bool sockind_active;
+/* Notifications already sent for sock.fd and sock.fd_peer, re-armed by receiving */
+static bool sockind_notified[2];
+
+static void sockind_rearm(int fd)
+{
+	if (fd == sock.fd) {
+		sockind_notified[0] = false;
+	} else if (fd == sock.fd_peer) {
+		sockind_notified[1] = false;
+	}
+}
+
+static void sockind_notify(int fd, int event)
+{
+	char urc[32];
+
+	sprintf(urc, "\r\n#XSOCKETIND: %d,%d\r\n", fd, event);
+	rsp_send(urc, strlen(urc));
+}
+
+static void sockind_thread_fn(void *p1, void *p2, void *p3)
+{
+	struct pollfd fds[2];
+	int wfd[2] = { INVALID_SOCKET, INVALID_SOCKET };
+	int map[2];
+	int nfds;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		/* Reset the sent flags when the watched sockets change */
+		if (wfd[0] != sock.fd) {
+			wfd[0] = sock.fd;
+			sockind_notified[0] = false;
+		}
+		if (wfd[1] != sock.fd_peer) {
+			wfd[1] = sock.fd_peer;
+			sockind_notified[1] = false;
+		}
+
+		nfds = 0;
+		for (int i = 0; i < 2; i++) {
+			if (wfd[i] == INVALID_SOCKET || sockind_notified[i]) {
+				continue;
+			}
+			fds[nfds].fd = wfd[i];
+			fds[nfds].events = POLLIN;
+			map[nfds] = i;
+			nfds++;
+		}
+		/* No notifications while data mode owns the UART */
+		if (!sockind_active || nfds == 0 || in_datamode()) {
+			k_sleep(K_MSEC(SOCKIND_POLL_MS));
+			continue;
+		}
+
+		ret = poll(fds, nfds, SOCKIND_POLL_MS);
+		if (ret <= 0) {
+			continue;
+		}
+		for (int i = 0; i < nfds; i++) {
+			/* Skip if the socket was closed during poll() */
+			if (fds[i].fd != ((map[i] == 0) ? sock.fd : sock.fd_peer)) {
+				continue;
+			}
+			if (fds[i].revents & POLLIN) {
+				sockind_notified[map[i]] = true;
+				sockind_notify(fds[i].fd, SOCKIND_EVENT_DATA);
+			} else if (fds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+				sockind_notified[map[i]] = true;
+				sockind_notify(fds[i].fd, SOCKIND_EVENT_ERROR);
+			}
+		}
+	}
+}
+
+K_THREAD_DEFINE(sockind_thread, SOCKIND_STACK_SIZE, sockind_thread_fn,
+		NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+#endif /* CONFIG_SLM_SOCKETIND */
+
 static int socket_datamode_callback(uint8_t op, const uint8_t *data, int len)
 {
 	int ret = 0;
@@ -1525,6 +1638,9 @@ int slm_at_socket_init(void)
 	sock.role    = AT_SOCKET_ROLE_CLIENT;
 	sock.fd      = INVALID_SOCKET;
 	sock.fd_peer = INVALID_SOCKET;
+#if defined(CONFIG_SLM_SOCKETIND)
+	sockind_active = true;
+#endif
 
 	return 0;
 }
@@ -1533,5 +1649,8 @@ int slm_at_socket_init(void)
  */
 int slm_at_socket_uninit(void)
 {
+#if defined(CONFIG_SLM_SOCKETIND)
+	sockind_active = false;
+#endif
 	return do_socket_close();
 }
@@ -15,6 +15,44 @@ LOG_MODULE_REGISTER(slm_tls, CONFIG_SLM_LOG_LEVEL);
 /* pointer to credential buffer */
 static uint8_t *crdl;
 
+#if defined(CONFIG_SLM_NATIVE_TLS_CACHE)
+/* Credentials pinned in the TLS library after first load. An entry is
+ * in use when its buffer is non-NULL. The registered credentials and
+ * the buffer are kept when the reference count drops to zero, so the
+ * next load for the same sec_tag skips the modem storage read.
+ */
+static struct tls_cache {
+	sec_tag_t sec_tag;
+	uint8_t *crdl;
+	int ref;
+} tls_cache[CONFIG_SLM_NATIVE_TLS_CACHE_CNT];
+
+static struct tls_cache *tls_cache_find(sec_tag_t sec_tag)
+{
+	for (int i = 0; i < CONFIG_SLM_NATIVE_TLS_CACHE_CNT; i++) {
+		if (tls_cache[i].crdl != NULL && tls_cache[i].sec_tag == sec_tag) {
+			return &tls_cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void tls_cache_insert(sec_tag_t sec_tag, uint8_t *buf)
+{
+	for (int i = 0; i < CONFIG_SLM_NATIVE_TLS_CACHE_CNT; i++) {
+		if (tls_cache[i].crdl == NULL) {
+			tls_cache[i].sec_tag = sec_tag;
+			tls_cache[i].crdl = buf;
+			tls_cache[i].ref = 1;
+			return;
+		}
+	}
+	/* Cache full, credential is loaded and unloaded as usual */
+	LOG_DBG("No cache slot for sec_tag %d", sec_tag);
+}
+#endif /* CONFIG_SLM_NATIVE_TLS_CACHE */
+
 /**
  * @brief Map SLM security tag to nRF security tag
  */
@@ -41,6 +79,16 @@ int slm_tls_loadcrdl(sec_tag_t sec_tag)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_SLM_NATIVE_TLS_CACHE)
+	struct tls_cache *cache = tls_cache_find(sec_tag);
+
+	if (cache != NULL) {
+		/* Credentials are still registered from previous load */
+		cache->ref++;
+		return 0;
+	}
+#endif
+
 	crdl = k_malloc(MAX_CRDL_LEN);
 	if (crdl == NULL) {
 		LOG_ERR("Fail to allocate memory");
@@ -110,6 +158,9 @@ int slm_tls_loadcrdl(sec_tag_t sec_tag)
 
 	if (loaded) {
 		/* Load credential successfully */
+#if defined(CONFIG_SLM_NATIVE_TLS_CACHE)
+		tls_cache_insert(sec_tag, crdl);
+#endif
 		return 0;
 	}
 	LOG_ERR("No credential for sec_tag:%d", sec_tag);
@@ -129,6 +180,19 @@ int slm_tls_unloadcrdl(sec_tag_t sec_tag)
 		LOG_ERR("Invalid security tag.");
 		return -EINVAL;
 	}
+
+#if defined(CONFIG_SLM_NATIVE_TLS_CACHE)
+	struct tls_cache *cache = tls_cache_find(sec_tag);
+
+	if (cache != NULL) {
+		/* Keep credentials registered for the next load */
+		if (cache->ref > 0) {
+			cache->ref--;
+		}
+		return 0;
+	}
+#endif
+
 	tls_credential_delete(sec_tag, TLS_CREDENTIAL_CA_CERTIFICATE);
 	tls_credential_delete(sec_tag, TLS_CREDENTIAL_SERVER_CERTIFICATE);
 	tls_credential_delete(sec_tag, TLS_CREDENTIAL_PRIVATE_KEY);
@@ -136,3 +200,34 @@ int slm_tls_unloadcrdl(sec_tag_t sec_tag)
 
 	return 0;
 }
+
+#if defined(CONFIG_SLM_NATIVE_TLS_CACHE)
+/**
+ * @brief Flush cached TLS credentials
+ */
+int slm_tls_flushcrdl(sec_tag_t sec_tag)
+{
+	struct tls_cache *cache;
+
+	if (sec_tag > MAX_SLM_SEC_TAG || sec_tag < MIN_SLM_SEC_TAG) {
+		LOG_ERR("Invalid security tag.");
+		return -EINVAL;
+	}
+
+	cache = tls_cache_find(sec_tag);
+	if (cache == NULL) {
+		return -ENOENT;
+	}
+	if (cache->ref > 0) {
+		LOG_ERR("Credentials of sec_tag %d in use", sec_tag);
+		return -EBUSY;
+	}
+	tls_credential_delete(sec_tag, TLS_CREDENTIAL_CA_CERTIFICATE);
+	tls_credential_delete(sec_tag, TLS_CREDENTIAL_SERVER_CERTIFICATE);
+	tls_credential_delete(sec_tag, TLS_CREDENTIAL_PRIVATE_KEY);
+	k_free(cache->crdl);
+	cache->crdl = NULL;
+
+	return 0;
+}
+#endif /* CONFIG_SLM_NATIVE_TLS_CACHE */
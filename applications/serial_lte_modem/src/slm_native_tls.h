@@ -63,6 +63,22 @@ int slm_tls_loadcrdl(sec_tag_t sec_tag);
  */
 int slm_tls_unloadcrdl(sec_tag_t sec_tag);
 
+#if defined(CONFIG_SLM_NATIVE_TLS_CACHE)
+/**
+ * @brief Flush cached credential
+ *
+ * Unregisters and frees credentials kept in the cache after the last
+ * unload. Call after the stored credentials of a security tag have been
+ * modified, so that the next load reads them from modem storage again.
+ *
+ * @param[in] sec_tag TLS reference
+ *
+ * @return 0 if successful, -ENOENT if the security tag is not cached,
+ *         -EBUSY if the credentials are in use by a socket.
+ */
+int slm_tls_flushcrdl(sec_tag_t sec_tag);
+#endif
+
 /** @} */
 
 #endif /* SLM_NATIVE_TLS_ */
@@ -5,7 +5,9 @@
 #
 
 macro(add_region)
-  set(oneValueArgs NAME SIZE BASE PLACEMENT DEVICE DYNAMIC_PARTITION)
+  set(oneValueArgs
+    NAME SIZE BASE PLACEMENT DEVICE DYNAMIC_PARTITION
+    ERASE_BLOCK_SIZE WRITE_BLOCK_SIZE)
   cmake_parse_arguments(REGION "" "${oneValueArgs}" "" ${ARGN})
   list(APPEND regions ${REGION_NAME})
   list(APPEND region_arguments "--${REGION_NAME}-size;${REGION_SIZE}")
@@ -19,6 +21,14 @@ macro(add_region)
     list(APPEND region_arguments
       "--${REGION_NAME}-dynamic-partition;${REGION_DYNAMIC_PARTITION}")
   endif()
+  if (REGION_ERASE_BLOCK_SIZE)
+    list(APPEND region_arguments
+      "--${REGION_NAME}-erase-block-size;${REGION_ERASE_BLOCK_SIZE}")
+  endif()
+  if (REGION_WRITE_BLOCK_SIZE)
+    list(APPEND region_arguments
+      "--${REGION_NAME}-write-block-size;${REGION_WRITE_BLOCK_SIZE}")
+  endif()
 endmacro()
 
 # Load static configuration if found.
@@ -169,12 +179,28 @@ if (CONFIG_SOC_NRF9160 OR CONFIG_SOC_NRF5340_CPUAPP)
     PLACEMENT start_to_end
     )
 endif()
+# Flash geometry for compile-time sizing of stream_flash buffers and
+# erase batches in consumers of the generated header.
+dt_chosen(soc_flash_dev PROPERTY zephyr,flash)
+set(flash_primary_geometry)
+if (DEFINED soc_flash_dev)
+  dt_prop(soc_flash_ebs PATH ${soc_flash_dev} PROPERTY erase-block-size)
+  dt_prop(soc_flash_wbs PATH ${soc_flash_dev} PROPERTY write-block-size)
+  if (DEFINED soc_flash_ebs)
+    list(APPEND flash_primary_geometry ERASE_BLOCK_SIZE ${soc_flash_ebs})
+  endif()
+  if (DEFINED soc_flash_wbs)
+    list(APPEND flash_primary_geometry WRITE_BLOCK_SIZE ${soc_flash_wbs})
+  endif()
+endif()
+
 add_region(
   NAME flash_primary
   SIZE ${flash_size}
   BASE ${CONFIG_FLASH_BASE_ADDRESS}
   PLACEMENT complex
   DEVICE NRF_FLASH_DRV_NAME
+  ${flash_primary_geometry}
   )
 
 dt_chosen(ext_flash_dev PROPERTY nordic,pm-ext-flash)
@@ -183,12 +209,23 @@ if (DEFINED ext_flash_dev)
   dt_prop(num_bits PATH ${ext_flash_dev} PROPERTY size)
   math(EXPR num_bytes "${num_bits} / 8")
 
+  dt_prop(ext_flash_ebs PATH ${ext_flash_dev} PROPERTY erase-block-size)
+  dt_prop(ext_flash_wbs PATH ${ext_flash_dev} PROPERTY write-block-size)
+  set(external_flash_geometry)
+  if (DEFINED ext_flash_ebs)
+    list(APPEND external_flash_geometry ERASE_BLOCK_SIZE ${ext_flash_ebs})
+  endif()
+  if (DEFINED ext_flash_wbs)
+    list(APPEND external_flash_geometry WRITE_BLOCK_SIZE ${ext_flash_wbs})
+  endif()
+
   add_region(
     NAME external_flash
     SIZE ${num_bytes}
     BASE ${CONFIG_PM_EXTERNAL_FLASH_BASE}
     PLACEMENT start_to_end
     DEVICE ${dev_name}
+    ${external_flash_geometry}
     )
 elseif(CONFIG_PM_EXTERNAL_FLASH)
   if (NOT CONFIG_PM_EXTERNAL_FLASH_SUPPORT_LEGACY)
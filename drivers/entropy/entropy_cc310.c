@@ -26,6 +26,100 @@
 
 #define CTR_DRBG_MAX_REQUEST 1024
 
+#if defined(CONFIG_ENTROPY_CC3XX_POOL) && !defined(CONFIG_BUILD_WITH_TFM)
+/* Small requests are served from a pool filled in bulk, amortizing the
+ * per-request cost (NS/S transition under SPM, DRBG setup otherwise)
+ * that dominates the frequent small entropy requests of TLS handshakes.
+ * A background refill keeps the pool above a watermark, so handshakes
+ * normally never wait for the hardware.
+ */
+static uint8_t entropy_pool[CONFIG_ENTROPY_CC3XX_POOL_SIZE];
+static size_t pool_avail;
+static K_MUTEX_DEFINE(pool_lock);
+
+static int fetch_random(uint8_t *buffer, size_t len, size_t *olen)
+{
+#if defined(CONFIG_SPM)
+	return spm_request_random_number(buffer, len, olen);
+#else
+	return nrf_cc3xx_platform_ctr_drbg_get(NULL, buffer, len, olen);
+#endif
+}
+
+/* Top the pool up to its full size. Must be called with pool_lock held.
+ * Unserved bytes are kept, new bytes are appended after them.
+ */
+static int pool_topup(void)
+{
+	size_t want = sizeof(entropy_pool) - pool_avail;
+	size_t olen;
+	int res;
+
+	if (want == 0) {
+		return 0;
+	}
+
+	res = fetch_random(&entropy_pool[pool_avail], want, &olen);
+	if (res != 0) {
+		return res;
+	}
+
+	if (olen != want) {
+		return -EINVAL;
+	}
+
+	pool_avail = sizeof(entropy_pool);
+
+	return 0;
+}
+
+static void pool_refill_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+	(void)pool_topup();
+	k_mutex_unlock(&pool_lock);
+}
+
+static K_WORK_DEFINE(pool_refill_work, pool_refill_work_handler);
+
+static int pool_get_entropy(uint8_t *buffer, uint16_t length)
+{
+	int res = 0;
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	while (length > 0) {
+		size_t chunk;
+
+		if (pool_avail == 0) {
+			res = pool_topup();
+			if (res != 0) {
+				break;
+			}
+		}
+
+		chunk = MIN(length, pool_avail);
+		memcpy(buffer, &entropy_pool[pool_avail - chunk], chunk);
+		/* Wipe served bytes so they cannot be handed out twice. */
+		memset(&entropy_pool[pool_avail - chunk], 0, chunk);
+		pool_avail -= chunk;
+		buffer += chunk;
+		length -= chunk;
+	}
+
+	if ((res == 0) &&
+	    (pool_avail < CONFIG_ENTROPY_CC3XX_POOL_WATERMARK)) {
+		k_work_submit(&pool_refill_work);
+	}
+
+	k_mutex_unlock(&pool_lock);
+
+	return res;
+}
+#endif /* CONFIG_ENTROPY_CC3XX_POOL && !CONFIG_BUILD_WITH_TFM */
+
 static int entropy_cc3xx_rng_get_entropy(
 	const struct device *dev,
 	uint8_t *buffer,
@@ -48,6 +142,13 @@ static int entropy_cc3xx_rng_get_entropy(
 	size_t olen;
 	size_t offset = 0;
 	size_t chunk_size = CTR_DRBG_MAX_REQUEST;
+
+#if defined(CONFIG_ENTROPY_CC3XX_POOL)
+	/* Requests larger than the pool fetch in bulk directly. */
+	if (length <= sizeof(entropy_pool)) {
+		return pool_get_entropy(buffer, length);
+	}
+#endif
 	/** This is a call from a secure app, in which case entropy is
 	 *  gathered using CC3xx HW using the CTR_DRBG features of the
 	 *  nrf_cc310_platform/nrf_cc312_platform library.
@@ -44,6 +44,7 @@ struct gps_drv_data {
 	atomic_t is_init;
 	atomic_t is_running;
 	atomic_t fix_valid;
+	atomic_t fix_reportable;
 	atomic_t timeout_occurred;
 	atomic_t operation_blocked;
 	K_THREAD_STACK_MEMBER(thread_stack,
@@ -336,17 +337,37 @@ static void gps_thread(int dev_ptr)
 			copy_pvt(&evt.pvt, pvt_data);
 
 			if (pvt_data->flags & NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID) {
-				LOG_DBG("PVT: Position fix");
-
-				evt.type = GPS_EVT_PVT_FIX;
 				fix_timestamp = k_uptime_get();
 				atomic_set(&drv_data->fix_valid, 1);
+
+				/* The accuracy gate only affects how the fix is
+				 * reported to the application. The search
+				 * bookkeeping above uses the modem's fix flag,
+				 * so periodic mode timing is unaffected.
+				 */
+				if ((CONFIG_NRF9160_GPS_FIX_ACCURACY_THRESHOLD > 0) &&
+				    (pvt_data->accuracy >
+				     (float)CONFIG_NRF9160_GPS_FIX_ACCURACY_THRESHOLD)) {
+					LOG_DBG("PVT: Fix accuracy above threshold");
+
+					atomic_set(&drv_data->fix_reportable, 0);
+					evt.type = GPS_EVT_PVT;
+				} else {
+					LOG_DBG("PVT: Position fix");
+
+					atomic_set(&drv_data->fix_reportable, 1);
+					evt.type = GPS_EVT_PVT_FIX;
+				}
 			} else {
 				evt.type = GPS_EVT_PVT;
 				atomic_set(&drv_data->fix_valid, 0);
+				atomic_set(&drv_data->fix_reportable, 0);
 			}
 
-			notify_event(dev, &evt);
+			if (!IS_ENABLED(CONFIG_NRF9160_GPS_FIX_EVENTS_ONLY) ||
+			    (evt.type == GPS_EVT_PVT_FIX)) {
+				notify_event(dev, &evt);
+			}
 			print_satellite_stats(pvt_data);
 			break;
 		case NRF_MODEM_GNSS_EVT_NMEA:
@@ -361,11 +382,15 @@ static void gps_thread(int dev_ptr)
 			/* Null termination is not included in length. */
 			evt.nmea.len = nmea_len;
 
-			if (atomic_get(&drv_data->fix_valid)) {
+			if (atomic_get(&drv_data->fix_reportable)) {
 				LOG_DBG("NMEA: Position fix");
 
 				evt.type = GPS_EVT_NMEA_FIX;
 			} else {
+				if (IS_ENABLED(CONFIG_NRF9160_GPS_FIX_EVENTS_ONLY)) {
+					goto free_event;
+				}
+
 				evt.type = GPS_EVT_NMEA;
 			}
 
@@ -791,6 +816,7 @@ static int start(const struct device *dev, struct gps_config *cfg)
 
 	atomic_set(&drv_data->is_running, 1);
 	atomic_set(&drv_data->fix_valid, 0);
+	atomic_set(&drv_data->fix_reportable, 0);
 	atomic_set(&drv_data->timeout_occurred, 0);
 	atomic_set(&drv_data->operation_blocked, 0);
 
@@ -137,7 +137,12 @@ struct pmw3360_data {
 	int16_t                      x;
 	int16_t                      y;
 	sensor_trigger_handler_t     data_ready_handler;
+#if defined(CONFIG_PMW3360_TRIGGER_OWN_THREAD)
+	struct k_sem                 trigger_sem;
+	struct k_thread              trigger_thread;
+#else
 	struct k_work                trigger_handler_work;
+#endif
 	struct k_work_delayable      init_work;
 	enum async_init_step         async_init_step;
 	int                          err;
@@ -688,10 +693,14 @@ static void irq_handler(const struct device *gpiob, struct gpio_callback *cb,
 		k_panic();
 	}
 
+#if defined(CONFIG_PMW3360_TRIGGER_OWN_THREAD)
+	k_sem_give(&pmw3360_data.trigger_sem);
+#else
 	k_work_submit(&pmw3360_data.trigger_handler_work);
+#endif
 }
 
-static void trigger_handler(struct k_work *work)
+static void trigger_handler_process(void)
 {
 	sensor_trigger_handler_t handler;
 	int err = 0;
@@ -725,6 +734,29 @@ static void trigger_handler(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_PMW3360_TRIGGER_OWN_THREAD)
+static K_THREAD_STACK_DEFINE(trigger_thread_stack, CONFIG_PMW3360_THREAD_STACK_SIZE);
+
+static void trigger_thread_fn(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (true) {
+		k_sem_take(&pmw3360_data.trigger_sem, K_FOREVER);
+		trigger_handler_process();
+	}
+}
+#else
+static void trigger_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	trigger_handler_process();
+}
+#endif
+
 static int pmw3360_async_init_power_up(struct pmw3360_data *dev_data)
 {
 	/* Reset sensor */
@@ -854,7 +886,16 @@ static int pmw3360_init(const struct device *dev)
 
 	ARG_UNUSED(dev);
 
+#if defined(CONFIG_PMW3360_TRIGGER_OWN_THREAD)
+	k_sem_init(&dev_data->trigger_sem, 0, 1);
+	k_thread_create(&dev_data->trigger_thread, trigger_thread_stack,
+			K_THREAD_STACK_SIZEOF(trigger_thread_stack),
+			trigger_thread_fn, NULL, NULL, NULL,
+			CONFIG_PMW3360_THREAD_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&dev_data->trigger_thread, "pmw3360_trigger");
+#else
 	k_work_init(&dev_data->trigger_handler_work, trigger_handler);
+#endif
 
 	err = pmw3360_init_cs(dev_data);
 	if (err) {
@@ -362,6 +362,47 @@ static int generate_wave(enum sensor_channel chan, size_t val_cnt, double *out_v
 	return err;
 }
 
+#if defined(CONFIG_SENSOR_SIM_ACCEL_TRACE)
+/* Trace table generated from the configured CSV capture at build time. */
+extern const double sensor_sim_trace[][ACCEL_CHAN_COUNT];
+extern const size_t sensor_sim_trace_len;
+
+/**
+ * @brief Generate value for acceleration from a recorded trace.
+ *
+ * @param[in]	chan	Selected sensor channel.
+ * @param[in]	val_cnt	Number of generated values.
+ * @param[out]	out_val	Pointer to the variable that is used to store result.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+static int generate_trace(enum sensor_channel chan, size_t val_cnt, double *out_val)
+{
+	__ASSERT_NO_MSG((val_cnt == 1) || (chan == SENSOR_CHAN_ACCEL_XYZ));
+
+	/* Index by uptime so that playback progresses at the configured
+	 * (scaled) rate regardless of how often samples are fetched.
+	 * The trace loops when exhausted.
+	 */
+	size_t idx = (size_t)((k_uptime_get() *
+			       CONFIG_SENSOR_SIM_ACCEL_TRACE_SPEEDUP /
+			       CONFIG_SENSOR_SIM_ACCEL_TRACE_SAMPLE_PERIOD_MS) %
+			      sensor_sim_trace_len);
+	const double *sample = sensor_sim_trace[idx];
+
+	if (chan == SENSOR_CHAN_ACCEL_XYZ) {
+		for (size_t i = 0; i < val_cnt; i++) {
+			out_val[i] = sample[i];
+		}
+	} else {
+		out_val[0] = sample[chan - SENSOR_CHAN_ACCEL_X];
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SENSOR_SIM_ACCEL_TRACE */
+
 /**
  * @brief Generates accelerometer data.
  *
@@ -379,6 +420,10 @@ static int generate_accel_data(enum sensor_channel chan)
 		gen_fn = generate_wave;
 	} else if (IS_ENABLED(CONFIG_SENSOR_SIM_ACCEL_TOGGLE)) {
 		gen_fn = generate_toggle;
+#if defined(CONFIG_SENSOR_SIM_ACCEL_TRACE)
+	} else if (IS_ENABLED(CONFIG_SENSOR_SIM_ACCEL_TRACE)) {
+		gen_fn = generate_trace;
+#endif
 	} else {
 		return -ENOTSUP;
 	}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <zephyr.h>
+
+/**
+ * @file
+ * @defgroup benchmark Transport benchmark harness
+ * @{
+ * @brief Transport-agnostic throughput and latency benchmark.
+ *
+ * The harness generates a configurable traffic workload, sends it
+ * through a transport hook provided by the application and keeps
+ * goodput, latency and drop statistics in one shared format. The
+ * transport hook is the only per-transport code: it can push data into
+ * a GATT characteristic, an ESB pipe, a UART or a socket. Latency and
+ * drop accounting require the peer to echo the frames back and the
+ * application to pass the echoed frames to @ref benchmark_received.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Workload types. */
+enum benchmark_workload {
+	/** Frames sent at a fixed interval. */
+	BENCHMARK_WORKLOAD_FIXED_RATE,
+	/** Groups of back-to-back frames separated by idle gaps. */
+	BENCHMARK_WORKLOAD_BURST,
+	/** Fixed-rate traffic with the frame interval shrinking linearly
+	 *  towards zero over the run, probing the saturation point.
+	 */
+	BENCHMARK_WORKLOAD_RAMP,
+};
+
+/** @brief Benchmark results. */
+struct benchmark_stats {
+	/** Number of frames handed to the transport. */
+	uint32_t frames_sent;
+	/** Number of frames the transport refused. */
+	uint32_t frames_failed;
+	/** Number of echoed frames received back. */
+	uint32_t frames_echoed;
+	/** Number of bytes handed successfully to the transport. */
+	uint32_t bytes_sent;
+	/** Goodput of the accepted frames, in bits per second. */
+	uint32_t goodput_bps;
+	/** Average round-trip latency of the echoed frames,
+	 *  in milliseconds.
+	 */
+	uint32_t latency_avg_ms;
+	/** Highest observed round-trip latency, in milliseconds. */
+	uint32_t latency_max_ms;
+	/** Elapsed test time, in milliseconds. */
+	uint32_t duration_ms;
+};
+
+/** @brief Transport send hook.
+ *
+ * Called from the benchmark work queue context.
+ *
+ * @param[in] buf  Frame to send.
+ * @param[in] len  Length of the frame, in bytes.
+ *
+ * @retval 0 The frame was accepted by the transport.
+ * @return Otherwise, a negative error code. The frame is counted as
+ *         failed and the run continues.
+ */
+typedef int (*benchmark_send_t)(const uint8_t *buf, size_t len);
+
+/** @brief Benchmark configuration. */
+struct benchmark_config {
+	/** Transport send hook. */
+	benchmark_send_t send;
+	/** Workload type. */
+	enum benchmark_workload workload;
+	/** Frame size, in bytes. Must fit the transport MTU and be at
+	 *  least @ref BENCHMARK_FRAME_OVERHEAD.
+	 */
+	uint16_t frame_len;
+	/** Interval between frames or bursts, in milliseconds. */
+	uint32_t interval_ms;
+	/** Number of frames per burst. Used by the burst workload. */
+	uint16_t burst_frames;
+	/** Total duration of the run, in milliseconds. */
+	uint32_t duration_ms;
+};
+
+/** @brief Per-frame header size added by the harness, in bytes. */
+#define BENCHMARK_FRAME_OVERHEAD 8
+
+/** @brief Start a benchmark run.
+ *
+ * @param[in] config  Benchmark configuration. The content is copied.
+ *
+ * @retval 0         The run was started.
+ * @retval -EALREADY A run is already in progress.
+ * @retval -EINVAL   Invalid configuration.
+ */
+int benchmark_start(const struct benchmark_config *config);
+
+/** @brief Abort a benchmark run before its configured duration. */
+void benchmark_stop(void);
+
+/** @brief Pass a frame echoed by the peer to the harness.
+ *
+ * Updates the latency and drop statistics. Frames not generated by the
+ * harness are ignored.
+ *
+ * @param[in] buf  Received frame.
+ * @param[in] len  Length of the frame, in bytes.
+ */
+void benchmark_received(const uint8_t *buf, size_t len);
+
+/** @brief Read the statistics of the current or last run.
+ *
+ * @param[out] stats  Structure to fill.
+ */
+void benchmark_stats_get(struct benchmark_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* BENCHMARK_H_ */
@@ -40,6 +40,9 @@ extern "C" {
 		.mutex = &_name##_mutex                                        \
 	}
 
+/** Number of slots in the connection lookup table. */
+#define BT_CONN_CTX_HASH_SLOTS (2 * CONFIG_BT_MAX_CONN)
+
 /** @brief Context data for a connection. */
 struct bt_conn_ctx {
 	/** Any kind of data associated with a specific connection. */
@@ -47,6 +50,9 @@ struct bt_conn_ctx {
 
 	 /** The connection that the data is associated with. */
 	struct bt_conn *conn;
+
+	/** Lock that guards access to this context entry. */
+	struct k_mutex lock;
 };
 
 /** @brief Bluetooth connection context library structure. */
@@ -54,8 +60,17 @@ struct bt_conn_ctx_lib {
 	/** Connection contexts. */
 	struct bt_conn_ctx ctx[CONFIG_BT_MAX_CONN];
 
-	/** Context data mutex that ensures that only one connection context is
-	  * manipulated at a time. */
+	/** Open-addressed lookup table that maps a connection object to
+	 *  the index of its context entry. A slot stores the entry index
+	 *  incremented by one, zero means an empty slot.
+	 */
+	uint8_t hash_map[BT_CONN_CTX_HASH_SLOTS];
+
+	/** Entry locks are initialized. */
+	atomic_t initialized;
+
+	/** Mutex that serializes changes to the set of allocated contexts.
+	  * Access to a single context is guarded by its entry lock. */
 	struct k_mutex * const mutex;
 
 	/** Memory slab instance where the memory is allocated. */
@@ -140,6 +140,43 @@ int bt_mesh_lvl_cli_set_unack(struct bt_mesh_lvl_cli *cli,
 			      struct bt_mesh_msg_ctx *ctx,
 			      const struct bt_mesh_lvl_set *set);
 
+/** @brief Prepare an unacknowledged Level Set message for resending.
+ *
+ * Encodes the message once into the client's publication buffer, so that
+ * @ref bt_mesh_lvl_cli_set_unack_resend can send it repeatedly without
+ * re-encoding. Useful when bursting the same command to several
+ * destinations, for instance during scene recalls.
+ *
+ * The prepared message stays valid until the next call that sends or
+ * publishes on this client model.
+ *
+ * @param[in] cli Client model to prepare the message for.
+ * @param[in] set New Level parameters to set. @p set::transition can either
+ * point to a transition structure, or be left to NULL to use the default
+ * transition parameters on the server.
+ */
+void bt_mesh_lvl_cli_set_unack_prepare(struct bt_mesh_lvl_cli *cli,
+				       const struct bt_mesh_lvl_set *set);
+
+/** @brief Resend a prepared unacknowledged Level Set message.
+ *
+ * Sends the message prepared by @ref bt_mesh_lvl_cli_set_unack_prepare,
+ * only patching in a fresh transaction ID. Every resend starts a new
+ * transaction.
+ *
+ * @param[in] cli Client model to send on.
+ * @param[in] ctx Message context, or NULL to use the configured publish
+ * parameters.
+ *
+ * @retval 0 Successfully sent the message.
+ * @retval -EINVAL No prepared message in the publication buffer.
+ * @retval -EADDRNOTAVAIL A message context was not provided and publishing is
+ * not configured.
+ * @retval -EAGAIN The device has not been provisioned.
+ */
+int bt_mesh_lvl_cli_set_unack_resend(struct bt_mesh_lvl_cli *cli,
+				     struct bt_mesh_msg_ctx *ctx);
+
 /** @brief Trigger a differential level state change in the server.
  *
  * Makes the server move its level state by some delta value. If multiple
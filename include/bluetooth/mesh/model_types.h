@@ -28,6 +28,22 @@ extern "C" {
 #define BT_MESH_MODEL_DELAY_TIME_MAX_MS                                        \
 	(UINT8_MAX * BT_MESH_MODEL_DELAY_TIME_STEP_FACTOR_MS)
 
+/** Deferred model state storage handle.
+ *
+ * Lets a model server mark its persistent state as dirty, to be stored by
+ * the common storage coordinator when the store timeout expires. All dirty
+ * models are stored back to back. Used internally by the model servers;
+ * all fields are internal.
+ */
+struct bt_mesh_model_store {
+	/** Linked list node. */
+	sys_snode_t node;
+	/** Whether the state is marked dirty. */
+	bool queued;
+	/** Called from the storage coordinator to store the state. */
+	void (*store)(struct bt_mesh_model_store *store);
+};
+
 /** Generic Transition parameters for the model messages.
  *
  * @note Time can not be larger than @ref BT_MESH_MODEL_TRANSITION_TIME_MAX_MS
@@ -448,6 +448,48 @@ bool bt_mesh_sensor_value_in_column(const struct sensor_value *value,
 const struct bt_mesh_sensor_format *
 bt_mesh_sensor_column_format_get(const struct bt_mesh_sensor_type *type);
 
+/** @brief Encode a raw characteristic value into a sensor channel.
+ *
+ *  The raw value is written to the message as is, and must already be in the
+ *  resolution of the channel format, as defined by the mesh device properties
+ *  specification. This skips the scaling arithmetic of the @ref sensor_value
+ *  based codec, for use with high-rate sensors whose hardware registers
+ *  already match the characteristic's resolution.
+ *
+ *  Only available if @kconfig{CONFIG_BT_MESH_SENSOR_RAW_CODEC} is enabled.
+ *
+ *  @param[in]  format Format of the sensor channel.
+ *  @param[in]  raw    Raw characteristic value to encode.
+ *  @param[out] buf    Buffer to encode the value into.
+ *
+ *  @retval 0        The value was successfully encoded.
+ *  @retval -ENOTSUP The format does not have a scalar representation.
+ *  @retval -ENOMEM  The buffer cannot fit the encoded value.
+ *  @retval -ERANGE  The raw value is outside the format's valid range.
+ */
+int bt_mesh_sensor_ch_raw_encode(const struct bt_mesh_sensor_format *format,
+				 int64_t raw, struct net_buf_simple *buf);
+
+/** @brief Decode a sensor channel into a raw characteristic value.
+ *
+ *  Counterpart of @ref bt_mesh_sensor_ch_raw_encode. The resulting raw value
+ *  is in the resolution of the channel format, and special values (such as
+ *  "value is not known") are reported as out of range.
+ *
+ *  Only available if @kconfig{CONFIG_BT_MESH_SENSOR_RAW_CODEC} is enabled.
+ *
+ *  @param[in]  format Format of the sensor channel.
+ *  @param[in]  buf    Buffer to decode the value from.
+ *  @param[out] raw    Resulting raw characteristic value.
+ *
+ *  @retval 0        The value was successfully decoded.
+ *  @retval -ENOTSUP The format does not have a scalar representation.
+ *  @retval -ENOMEM  The buffer does not contain a full encoded value.
+ *  @retval -ERANGE  The encoded value is outside the format's valid range.
+ */
+int bt_mesh_sensor_ch_raw_decode(const struct bt_mesh_sensor_format *format,
+				 struct net_buf_simple *buf, int64_t *raw);
+
 /** @brief Get a human readable representation of a single sensor channel.
  *
  *  @param[in]  ch  Sensor channel to represent.
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file
+ *  @defgroup bt_mesh_sensor_series_store Sensor series store
+ *  @ingroup bt_mesh_sensor
+ *  @{
+ *  @brief Circular sample store backing the Sensor Series state.
+ */
+
+#ifndef BT_MESH_SENSOR_SERIES_STORE_H__
+#define BT_MESH_SENSOR_SERIES_STORE_H__
+
+#include <bluetooth/mesh/sensor.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Sensor series store instance.
+ *
+ *  Holds the most recent samples of a single sensor as a circular buffer of
+ *  series columns, replacing the application managed column array. Samples
+ *  must be added with monotonically increasing column start values (typically
+ *  at a fixed interval), which keeps the stored columns ordered and lets the
+ *  store resolve column and range lookups with a binary search.
+ *
+ *  Should be defined with @ref BT_MESH_SENSOR_SERIES_STORE_DEFINE and bound
+ *  to a sensor with @ref bt_mesh_sensor_series_store_init. The sensor's
+ *  series getter remains application provided, and should resolve the
+ *  requested column with @ref bt_mesh_sensor_series_store_get.
+ */
+struct bt_mesh_sensor_series_store {
+	/** Column descriptors, one per stored sample. */
+	struct bt_mesh_sensor_column *columns;
+	/** Sample values, @c channels entries per column. */
+	struct sensor_value *values;
+	/** Number of columns the store can hold. */
+	uint32_t capacity;
+	/** Index of the oldest stored column. */
+	uint32_t oldest;
+	/** Sensor this store backs. */
+	struct bt_mesh_sensor *sensor;
+	/** Number of value channels per sample. */
+	uint8_t channels;
+};
+
+/** @def BT_MESH_SENSOR_SERIES_STORE_DEFINE
+ *
+ *  @brief Define a sensor series store and its backing buffers.
+ *
+ *  @param[in] _name     Name of the store instance.
+ *  @param[in] _capacity Number of columns to keep. When full, new samples
+ *                       overwrite the oldest column.
+ *  @param[in] _channels Number of value channels per sample. Must match the
+ *                       channel count of the sensor type.
+ */
+#define BT_MESH_SENSOR_SERIES_STORE_DEFINE(_name, _capacity, _channels)        \
+	static struct bt_mesh_sensor_column                                    \
+		_bt_mesh_series_cols_##_name[_capacity];                       \
+	static struct sensor_value                                             \
+		_bt_mesh_series_vals_##_name[(_capacity) * (_channels)];       \
+	static struct bt_mesh_sensor_series_store _name = {                    \
+		.columns = _bt_mesh_series_cols_##_name,                       \
+		.values = _bt_mesh_series_vals_##_name,                        \
+		.capacity = (_capacity),                                       \
+		.channels = (_channels),                                       \
+	}
+
+/** @brief Bind a series store to a sensor.
+ *
+ *  Points the sensor's series column list at the store's buffers. The store
+ *  starts out empty, and the sensor's series column count follows the number
+ *  of stored samples.
+ *
+ *  Must be called before the sensor's server model starts receiving
+ *  messages.
+ *
+ *  @param[in] store  Series store instance.
+ *  @param[in] sensor Sensor to bind the store to.
+ */
+void bt_mesh_sensor_series_store_init(struct bt_mesh_sensor_series_store *store,
+				      struct bt_mesh_sensor *sensor);
+
+/** @brief Add a sample to the series store.
+ *
+ *  The column start must be greater than the start of the previously added
+ *  column. When the store is full, the oldest sample is overwritten.
+ *
+ *  @param[in] store Series store instance.
+ *  @param[in] col   Column the sample belongs to.
+ *  @param[in] value Sample value, as an array of @c channels channels.
+ *
+ *  @retval 0       The sample was successfully added.
+ *  @retval -EINVAL The column start is not greater than the newest stored
+ *                  column's start.
+ */
+int bt_mesh_sensor_series_store_add(struct bt_mesh_sensor_series_store *store,
+				    const struct bt_mesh_sensor_column *col,
+				    const struct sensor_value *value);
+
+/** @brief Get the stored value of a single column.
+ *
+ *  Intended for use in the sensor's series getter, where the requested
+ *  column points into the store's column list and resolves in constant time.
+ *  Columns that aren't part of the store are looked up by their start value.
+ *
+ *  @param[in]  store Series store instance.
+ *  @param[in]  col   Column to get the value of.
+ *  @param[out] value Value response buffer, holding @c channels channels.
+ *
+ *  @retval 0       The value was successfully retrieved.
+ *  @retval -ENOENT The column is not in the store.
+ */
+int bt_mesh_sensor_series_store_get(
+	const struct bt_mesh_sensor_series_store *store,
+	const struct bt_mesh_sensor_column *col, struct sensor_value *value);
+
+/** @brief Find the stored columns that fall inside a range.
+ *
+ *  Performs a binary search for the columns whose start value is inside the
+ *  given range. The resulting indexes are ordered oldest to newest, and
+ *  should be accessed with @ref bt_mesh_sensor_series_store_col.
+ *
+ *  @param[in]  store Series store instance.
+ *  @param[in]  range Range to match the column start values against.
+ *  @param[out] first Index of the first matching column.
+ *  @param[out] count Number of matching columns.
+ *
+ *  @retval 0       At least one stored column falls inside the range.
+ *  @retval -ENOENT No stored columns fall inside the range.
+ */
+int bt_mesh_sensor_series_store_range(
+	const struct bt_mesh_sensor_series_store *store,
+	const struct bt_mesh_sensor_column *range, uint32_t *first,
+	uint32_t *count);
+
+/** @brief Access a stored column by index.
+ *
+ *  Index 0 is the oldest stored column.
+ *
+ *  @param[in]  store Series store instance.
+ *  @param[in]  idx   Index of the column to access.
+ *  @param[out] value Value buffer to fill, holding @c channels channels.
+ *                    May be NULL.
+ *
+ *  @return The column at the given index, or NULL if the index is out of
+ *          range.
+ */
+const struct bt_mesh_sensor_column *bt_mesh_sensor_series_store_col(
+	const struct bt_mesh_sensor_series_store *store, uint32_t idx,
+	struct sensor_value *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BT_MESH_SENSOR_SERIES_STORE_H__ */
+
+/** @} */
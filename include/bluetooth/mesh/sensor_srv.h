@@ -63,6 +63,8 @@ struct bt_mesh_sensor_srv {
 	struct bt_mesh_sensor *const *sensor_array;
 	/** Ordered linked list of sensors. */
 	sys_slist_t sensors;
+	/** Sensor array indices, ordered by sensor type ID. */
+	uint8_t sensor_order[CONFIG_BT_MESH_SENSOR_SRV_SENSORS_MAX];
 	/** Publish sequence counter */
 	uint16_t seq;
 	/** Number of sensors. */
@@ -71,6 +73,10 @@ struct bt_mesh_sensor_srv {
 #if CONFIG_BT_SETTINGS
 	/** Storage timer */
 	struct k_work_delayable store_timer;
+#endif
+#if CONFIG_BT_MESH_SENSOR_SRV_PUB_COALESCE
+	/** Coalescing timer for triggered publications */
+	struct k_work_delayable pub_timer;
 #endif
 	/** Publish parameters. */
 	struct bt_mesh_model_pub pub;
@@ -129,6 +135,12 @@ int bt_mesh_sensor_srv_pub(struct bt_mesh_sensor_srv *srv,
  *  previous publication and the sensor's threshold parameters. Only single
  *  channel sensor values will be considered.
  *
+ *  If @option{CONFIG_BT_MESH_SENSOR_SRV_PUB_COALESCE} is enabled, the
+ *  publication is deferred by a short window, and all sensors on the server
+ *  whose values are outside their delta thresholds are packed into a single
+ *  Sensor Status message. In this case, the call returns 0 once the
+ *  publication has been scheduled.
+ *
  *  @param[in] srv    Sensor server instance.
  *  @param[in] sensor Sensor instance to sample.
  *
@@ -419,6 +419,24 @@ struct bt_ancs_client {
 	/** Allocate memory for the attribute response here.
 	 */
 	struct bt_ancs_attr_response attr_response;
+
+#if defined(CONFIG_BT_ANCS_CLIENT_ATTR_QUEUE)
+	/** Queue of notification attribute requests waiting for the request
+	 *  in flight to complete.
+	 */
+	struct {
+		/** Notification UID to request attributes for. */
+		uint32_t notif_uid;
+		/** Callback function for handling the NP write response. */
+		bt_ancs_write_cb func;
+	} attr_queue[CONFIG_BT_ANCS_CLIENT_ATTR_QUEUE_LEN];
+
+	/** Index of the oldest queued attribute request. */
+	uint8_t attr_queue_head;
+
+	/** Number of queued attribute requests. */
+	uint8_t attr_queue_cnt;
+#endif
 };
 
 /**@brief Function for initializing the ANCS client.
@@ -505,6 +523,11 @@ int bt_ancs_register_app_attr(struct bt_ancs_client *ancs_c,
 			      uint8_t *data, const uint16_t len);
 
 /**@brief Function for requesting attributes for a notification.
+ *
+ * If @kconfig{CONFIG_BT_ANCS_CLIENT_ATTR_QUEUE} is enabled and a previous
+ * attribute request is still being served, the request is queued and sent
+ * automatically when the attribute response for the previous request has
+ * been fully parsed.
  *
  * @param[in] ancs_c   ANCS client instance.
  * @param[in] notif    Pointer to the notification whose attributes will be requested from
@@ -512,6 +535,7 @@ int bt_ancs_register_app_attr(struct bt_ancs_client *ancs_c,
  * @param[in] func     Callback function for handling NP write response.
  *
  * @retval 0 If all operations are successful.
+ * @retval -ENOBUFS If the request queue is full.
  *           Otherwise, a (negative) error code is returned.
  */
 int bt_ancs_request_attrs(struct bt_ancs_client *ancs_c,
@@ -177,6 +177,8 @@ typedef void (*bt_hids_rep_handler_t) (struct bt_hids_rep *rep,
 				       struct bt_conn *conn,
 				       bool write);
 
+struct bt_hids;
+
 /** @brief Input Report.
  */
 struct bt_hids_inp_rep {
@@ -227,6 +229,11 @@ struct bt_hids_inp_rep {
 
 	/** Callback with the notification event. */
 	bt_hids_notify_handler_t handler;
+
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+	/** HIDS instance the report belongs to. Used internally. */
+	struct bt_hids *hids_obj;
+#endif
 };
 
 
@@ -485,6 +492,14 @@ struct bt_hids_conn_data {
 
 	/** Pointer to Feature Reports Context data. */
 	uint8_t *feat_rep_ctx;
+
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+	/** Bitmask of Input Reports with a notification in transit. */
+	uint32_t inp_rep_in_flight;
+
+	/** Bitmask of Input Reports updated while in transit. */
+	uint32_t inp_rep_pending;
+#endif
 };
 
 
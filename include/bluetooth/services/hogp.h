@@ -273,6 +273,77 @@ void bt_hogp_init(struct bt_hogp *hogp,
  */
 int bt_hogp_handles_assign(struct bt_gatt_dm *dm, struct bt_hogp *hogp);
 
+/**
+ * @brief Cached preparation data.
+ *
+ * Holds the values that the module reads from the peer after discovery:
+ * the HID information, the protocol mode, and the report references.
+ * The data can be captured from a ready instance with
+ * @ref bt_hogp_prep_data_get and applied on a later reconnection with
+ * @ref bt_hogp_handles_assign_prepped, which skips all the preparation
+ * GATT transfers.
+ *
+ * @note
+ * The cached data is only valid as long as the GATT database of the peer
+ * is unchanged. Key the stored data by peer identity and verify it, for
+ * example using the Database Hash characteristic, before applying it.
+ */
+struct bt_hogp_prep_data {
+	/** HID information characteristic value. */
+	struct bt_hids_info info_val;
+	/** Protocol mode. */
+	enum bt_hids_pm pm;
+	/** Number of cached report references. */
+	uint8_t rep_count;
+	/** Report references, in report discovery order. */
+	struct {
+		/** Report identifier. */
+		uint8_t id;
+		/** Report type (see @ref bt_hids_report_type). */
+		uint8_t type;
+	} rep_ref[CONFIG_BT_HOGP_REPORTS_MAX];
+};
+
+/**
+ * @brief Capture the preparation data of a ready instance.
+ *
+ * @param hogp HOGP object.
+ * @param prep Structure to be filled with the cached data.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval (-EAGAIN) If the instance is not ready
+ *         (see @ref bt_hogp_ready_check).
+ */
+int bt_hogp_prep_data_get(const struct bt_hogp *hogp,
+			  struct bt_hogp_prep_data *prep);
+
+/**
+ * @brief Assign handlers using cached preparation data.
+ *
+ * Works like @ref bt_hogp_handles_assign, but instead of reading the
+ * HID information, report references, and protocol mode from the peer,
+ * the values from @p prep are applied and the instance is marked ready
+ * before this function returns. This removes one GATT round-trip per
+ * report plus two more from the reconnection sequence.
+ *
+ * The cached data is validated against the discovered reports. If it
+ * does not match, the instance is released and an error is returned;
+ * the caller should then fall back to @ref bt_hogp_handles_assign and
+ * refresh its cache.
+ *
+ * @param dm     Discovery object.
+ * @param hogp   HOGP object.
+ * @param prep   Cached preparation data.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval (-EINVAL) If the cached data does not match the discovered
+ *         service.
+ */
+int bt_hogp_handles_assign_prepped(struct bt_gatt_dm *dm,
+				   struct bt_hogp *hogp,
+				   const struct bt_hogp_prep_data *prep);
+
 /**
  * @brief Release the HIDS client instance.
  *
@@ -404,6 +475,28 @@ int bt_hogp_rep_subscribe(struct bt_hogp *hogp,
 			  struct bt_hogp_rep_info *rep,
 			  bt_hogp_read_cb func);
 
+/**
+ * @brief Restore a report subscription without writing the CCC.
+ *
+ * Works like @ref bt_hogp_rep_subscribe, but does not generate a CCC
+ * write. Use it on reconnection to a bonded peer, where the server is
+ * required to persist the CCC state, to start receiving notifications
+ * without any GATT round-trip. The restored subscription also persists
+ * across reconnections.
+ *
+ * This function may be called only on Input type reports.
+ *
+ * @param hogp   HOGP object.
+ * @param rep    Report object.
+ * @param func   Function to be called to handle the notificated value.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int bt_hogp_rep_resubscribe(struct bt_hogp *hogp,
+			    struct bt_hogp_rep_info *rep,
+			    bt_hogp_read_cb func);
+
 /**
  * @brief Remove the subscription for a selected report.
  *
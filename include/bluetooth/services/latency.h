@@ -38,6 +38,24 @@ struct bt_latency_cb {
 	void (*latency_request)(const void *buf, uint16_t len);
 };
 
+/** @brief Latency statistics served by the statistics characteristic. */
+struct bt_latency_stats {
+	/** Number of recorded round trips. */
+	uint32_t count;
+
+	/** Median round-trip time in microseconds. */
+	uint32_t p50_us;
+
+	/** 95th percentile round-trip time in microseconds. */
+	uint32_t p95_us;
+
+	/** 99th percentile round-trip time in microseconds. */
+	uint32_t p99_us;
+
+	/** Largest recorded round-trip time in microseconds. */
+	uint32_t max_us;
+};
+
 /** @brief Latency structure. */
 struct bt_latency {
 	/** Characteristic handle. */
@@ -63,6 +81,13 @@ struct bt_latency {
 /** @brief UUID of the Latency Characteristic. **/
 #define BT_UUID_LATENCY_CHAR BT_UUID_DECLARE_128(BT_UUID_LATENCY_CHAR_VAL)
 
+#define BT_UUID_LATENCY_STATS_CHAR_VAL \
+	BT_UUID_128_ENCODE(0x67136e03, 0x58db, 0xf39b, 0x3446, 0xfdde58c0813a)
+
+/** @brief UUID of the Latency Statistics Characteristic. **/
+#define BT_UUID_LATENCY_STATS_CHAR \
+	BT_UUID_DECLARE_128(BT_UUID_LATENCY_STATS_CHAR_VAL)
+
 /** @brief Initialize the GATT latency service.
  *
  *  @param[in] latency Latency service instance.
@@ -78,6 +103,19 @@ struct bt_latency {
 int bt_latency_init(struct bt_latency *latency,
 		    const struct bt_latency_cb *cb);
 
+/** @brief Update the statistics served by the statistics characteristic.
+ *
+ *  Stores the provided statistics as the value of the Latency Statistics
+ *  Characteristic, where a monitoring peer can read them. The statistics
+ *  are typically obtained from @c bt_latency_client_stats_get on the
+ *  measuring link.
+ *
+ *  Requires @option{CONFIG_BT_LATENCY_STATS}.
+ *
+ *  @param[in] stats Statistics to publish.
+ */
+void bt_latency_stats_update(const struct bt_latency_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,7 @@
 #include <bluetooth/uuid.h>
 #include <bluetooth/conn.h>
 #include <bluetooth/gatt_dm.h>
+#include <bluetooth/services/latency.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -103,6 +104,57 @@ int bt_latency_handles_assign(struct bt_gatt_dm *dm,
 int bt_latency_request(struct bt_latency_client *latency,
 		       const void *data, uint16_t len);
 
+/** @brief Start the continuous latency measurement.
+ *
+ *  Sends a latency request at the given interval and records every measured
+ *  round-trip time in an on-device histogram. Responses to the internal
+ *  requests are not passed to the latency_response callback. Only one
+ *  client instance can be measured at a time.
+ *
+ *  Requires @option{CONFIG_BT_LATENCY_CLIENT_STATS}.
+ *
+ *  @param[in] latency Latency client instance.
+ *  @param[in] interval_ms Interval between requests in milliseconds.
+ *
+ *  @retval 0 If the operation was successful.
+ *  @retval (-EBUSY) When another instance is being measured.
+ *            Otherwise, a negative error code is returned.
+ */
+int bt_latency_client_measure_start(struct bt_latency_client *latency,
+				    uint32_t interval_ms);
+
+/** @brief Stop the continuous latency measurement.
+ *
+ *  Requires @option{CONFIG_BT_LATENCY_CLIENT_STATS}.
+ *
+ *  @param[in] latency Latency client instance.
+ *
+ *  @retval 0 If the operation was successful.
+ *            Otherwise, a negative error code is returned.
+ */
+int bt_latency_client_measure_stop(struct bt_latency_client *latency);
+
+/** @brief Get the accumulated latency statistics.
+ *
+ *  Computes the percentiles from the histogram recorded by the continuous
+ *  measurement. The result can be published to a monitoring peer with
+ *  @c bt_latency_stats_update.
+ *
+ *  Requires @option{CONFIG_BT_LATENCY_CLIENT_STATS}.
+ *
+ *  @param[out] stats Computed statistics.
+ *
+ *  @retval 0 If the operation was successful.
+ *            Otherwise, a negative error code is returned.
+ */
+int bt_latency_client_stats_get(struct bt_latency_stats *stats);
+
+/** @brief Reset the accumulated latency statistics.
+ *
+ *  Requires @option{CONFIG_BT_LATENCY_CLIENT_STATS}.
+ */
+void bt_latency_client_stats_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -39,6 +39,14 @@ extern "C" {
 #define BT_UUID_NUS_RX        BT_UUID_DECLARE_128(BT_UUID_NUS_RX_VAL)
 #define BT_UUID_NUS_TX        BT_UUID_DECLARE_128(BT_UUID_NUS_TX_VAL)
 
+/** @brief Scatter-gather element describing one fragment of a payload. */
+struct bt_nus_sg_elem {
+	/** Fragment data. */
+	const uint8_t *data;
+	/** Fragment length in bytes. */
+	uint16_t len;
+};
+
 /** @brief NUS send status. */
 enum bt_nus_send_status {
 	/** Send notification enabled. */
@@ -79,6 +87,18 @@ struct bt_nus_cb {
 	 */
 	void (*send_enabled)(enum bt_nus_send_status status);
 
+	/** @brief Stream queue resumed callback.
+	 *
+	 * Called when a @ref bt_nus_stream_send call could not queue all of
+	 * the provided data and the queue has since drained below the resume
+	 * watermark. The remaining data can be submitted again.
+	 *
+	 * Requires @option{CONFIG_BT_NUS_STREAM}.
+	 *
+	 * @param[in] conn Pointer to connection object.
+	 */
+	void (*stream_resumed)(struct bt_conn *conn);
+
 };
 
 /**@brief Initialize the service.
@@ -113,6 +133,48 @@ int bt_nus_init(struct bt_nus_cb *callbacks);
  */
 int bt_nus_send(struct bt_conn *conn, const uint8_t *data, uint16_t len);
 
+/**@brief Send data described by a scatter-gather list.
+ *
+ * @details This function serializes the listed fragments into a single
+ *          notification, so the application does not need to assemble
+ *          a contiguous buffer before sending. The combined length of the
+ *          fragments must fit in a single notification payload
+ *          (see @ref bt_nus_get_mtu).
+ *
+ * @param[in] conn     Pointer to connection object, or NULL to send to all
+ *                     connected peers.
+ * @param[in] elems    Array of scatter-gather elements.
+ * @param[in] elem_cnt Number of elements in the array.
+ *
+ * @retval 0 If the data is sent.
+ *           Otherwise, a negative value is returned.
+ */
+int bt_nus_send_sg(struct bt_conn *conn, const struct bt_nus_sg_elem *elems,
+		   size_t elem_cnt);
+
+/**@brief Send data through the streaming queue.
+ *
+ * @details This function copies the data into a pool of pre-allocated
+ *          notification buffers, segments it to the ATT MTU of the link and
+ *          transmits the segments as the ATT buffers become available. Unlike
+ *          @ref bt_nus_send, it does not fail when the ATT buffer pool is
+ *          momentarily empty. If the internal queue fills up, the function
+ *          queues as much data as fits and the application is notified
+ *          through the stream_resumed callback when it can submit the rest.
+ *
+ *          Only one connection can be streamed to at a time.
+ *
+ *          Requires @option{CONFIG_BT_NUS_STREAM}.
+ *
+ * @param[in] conn Pointer to connection object.
+ * @param[in] data Pointer to a data buffer.
+ * @param[in] len  Length of the data in the buffer.
+ *
+ * @return Number of bytes queued for transmission.
+ *         Otherwise, a negative value is returned.
+ */
+int bt_nus_stream_send(struct bt_conn *conn, const uint8_t *data, uint16_t len);
+
 /**@brief Get maximum data length that can be used for @ref bt_nus_send.
  *
  * @param[in] conn Pointer to connection Object.
@@ -21,6 +21,13 @@ extern "C" {
 #include <bluetooth/gatt.h>
 #include <bluetooth/conn.h>
 #include <bluetooth/gatt_dm.h>
+#include <bluetooth/services/nus.h>
+
+/** Size of the buffer used by @ref bt_nus_client_send_sg to serialize
+ *  the scatter-gather list. Matches the payload of a write at the largest
+ *  commonly negotiated ATT MTU (247).
+ */
+#define BT_NUS_CLIENT_SG_BUF_SIZE 244
 
 /** @brief Handles on the connected peer device that are needed to interact with
  * the device.
@@ -95,6 +102,11 @@ struct bt_nus_client {
         /** GATT write parameters for NUS RX Characteristic. */
 	struct bt_gatt_write_params rx_write_params;
 
+        /** Buffer holding a serialized scatter-gather payload while
+         * the write operation is pending.
+         */
+	uint8_t sg_buf[BT_NUS_CLIENT_SG_BUF_SIZE];
+
         /** Application callbacks. */
 	struct bt_nus_client_cb cb;
 };
@@ -137,6 +149,24 @@ int bt_nus_client_init(struct bt_nus_client *nus,
 int bt_nus_client_send(struct bt_nus_client *nus, const uint8_t *data,
 		       uint16_t len);
 
+/** @brief Send data described by a scatter-gather list to the server.
+ *
+ * This function serializes the listed fragments into the instance buffer
+ * and writes them to the RX Characteristic of the server in one operation,
+ * so the application does not need to assemble a contiguous buffer before
+ * sending. The combined length of the fragments must not exceed
+ * @ref BT_NUS_CLIENT_SG_BUF_SIZE.
+ *
+ * @param[in,out] nus NUS Client instance.
+ * @param[in] elems Array of scatter-gather elements.
+ * @param[in] elem_cnt Number of elements in the array.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a negative error code is returned.
+ */
+int bt_nus_client_send_sg(struct bt_nus_client *nus,
+			  const struct bt_nus_sg_elem *elems, size_t elem_cnt);
+
 /** @brief Assign handles to the NUS Client instance.
  *
  * This function should be called when a link with a peer has been established
@@ -83,6 +83,24 @@ struct bt_throughput {
 	struct bt_conn *conn;
 };
 
+/** @brief A single configuration tested by @ref bt_throughput_sweep. */
+struct bt_throughput_sweep_config {
+	/** Connection interval in 1.25 ms units. */
+	uint16_t conn_interval;
+
+	/** Payload length of a single write in bytes (at most 244). */
+	uint16_t data_len;
+
+	/** Preferred PHY, one of the BT_GAP_LE_PHY_* values. */
+	uint8_t phy;
+};
+
+/** @brief Result of a single sweep step. */
+struct bt_throughput_sweep_result {
+	/** Metrics reported by the peer after the step. */
+	struct bt_throughput_metrics metrics;
+};
+
 /** @brief Throughput Characteristic UUID. */
 #define BT_UUID_THROUGHPUT_CHAR BT_UUID_DECLARE_16(0x1524)
 
@@ -146,6 +164,37 @@ int bt_throughput_read(struct bt_throughput *throughput);
 int bt_throughput_write(struct bt_throughput *throughput,
 			const uint8_t *data, uint16_t len);
 
+/** @brief Benchmark a list of connection parameter combinations.
+ *
+ *  For every configuration, the connection parameters, data length and PHY
+ *  of the link are updated, the metrics on the peer are reset and a test
+ *  pattern is written for the given duration. The goodput reported by the
+ *  peer is stored in the corresponding element of the results array and
+ *  the index of the configuration with the highest rate is returned.
+ *
+ *  @note This function blocks for the whole duration of the sweep and must
+ *        be called from a thread context.
+ *
+ *  Requires @option{CONFIG_BT_THROUGHPUT_SWEEP}.
+ *
+ *  @param[in] throughput Throughput Service instance.
+ *  @param[in] configs Array of configurations to test.
+ *  @param[in] config_cnt Number of configurations.
+ *  @param[in] step_duration_ms Transmission time for a single step.
+ *  @param[out] results Array of config_cnt elements for the results.
+ *  @param[out] best Index of the configuration with the highest goodput.
+ *              Can be NULL.
+ *
+ *  @retval 0 If the operation was successful.
+ *            Otherwise, a negative error code is returned.
+ */
+int bt_throughput_sweep(struct bt_throughput *throughput,
+			const struct bt_throughput_sweep_config *configs,
+			size_t config_cnt,
+			uint32_t step_duration_ms,
+			struct bt_throughput_sweep_result *results,
+			size_t *best);
+
 #ifdef __cplusplus
 }
 #endif
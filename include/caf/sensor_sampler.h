@@ -40,6 +40,12 @@ struct sensor_config {
 	const struct sampled_channel *chans;
 	uint8_t chan_cnt;
 	uint8_t active_events_limit;
+	/* Number of consecutive samples aggregated into one sensor event.
+	 * Values 0 and 1 disable batching - every sample is sent in its
+	 * own event. With a bigger value the event's dynamic data carries
+	 * the readouts of the whole burst, oldest sample first.
+	 */
+	uint8_t sample_batch_cnt;
 	unsigned int sampling_period_ms;
 	struct trigger *trigger;
 };
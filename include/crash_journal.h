@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#ifndef CRASH_JOURNAL_H__
+#define CRASH_JOURNAL_H__
+
+#include <zephyr/types.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup crash_journal Crash journal
+ * @brief Retained-RAM journal of the most recent fatal error.
+ *
+ * On a fatal error, the fault registers and the top of the faulting
+ * stack are copied into noinit RAM as raw binary before the system
+ * resets. No formatting happens in fault context. On the next boot the
+ * application can fetch the record, format it and upload it through its
+ * cloud layer.
+ *
+ * @{
+ */
+
+/** Number of registers stored from the exception stack frame
+ *  (r0-r3, r12, lr, pc, xpsr).
+ */
+#define CRASH_JOURNAL_REG_CNT 8
+
+/** @brief Crash record, captured in fault context. */
+struct crash_journal_record {
+	/** Fatal error reason, as passed to the fatal error handler. */
+	uint32_t reason;
+
+	/** Uptime at the time of the fault, in milliseconds. */
+	uint32_t uptime;
+
+	/** Basic exception stack frame registers. */
+	uint32_t regs[CRASH_JOURNAL_REG_CNT];
+
+	/** Name of the faulting thread. May be empty. */
+	char thread_name[16];
+
+	/** Number of valid words in @ref stack. */
+	uint32_t stack_words;
+
+	/** Top of the faulting stack, starting at the exception frame. */
+	uint32_t stack[CONFIG_CRASH_JOURNAL_STACK_WORDS];
+};
+
+/** @brief Check if a crash record from a previous boot is present.
+ *
+ * @return true if a valid record is present.
+ */
+bool crash_journal_present(void);
+
+/** @brief Copy out the stored crash record.
+ *
+ * @param[out] record Destination for the record.
+ *
+ * @retval 0 The record was copied.
+ * @retval -ENOENT No valid record is present.
+ */
+int crash_journal_get(struct crash_journal_record *record);
+
+/** @brief Invalidate the stored crash record.
+ *
+ * Call after the record has been consumed, so that it is not reported
+ * again on the following boot.
+ */
+void crash_journal_clear(void);
+
+/** @brief Capture a crash record. For use by the fatal error handler. */
+void crash_journal_capture(unsigned int reason, const void *esf);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRASH_JOURNAL_H__ */
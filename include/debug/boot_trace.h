@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#ifndef __BOOT_TRACE_H
+#define __BOOT_TRACE_H
+
+#include <zephyr/types.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup boot_trace Boot trace
+ * @brief Module for recording named boot-phase markers.
+ *
+ * Markers are stored in a RAM region that is not initialized on boot, so
+ * the trace of the previous boot survives a reset and can be inspected
+ * post mortem. Marker names must be string literals: only the pointer is
+ * stored, which is valid across resets of the same firmware image.
+ *
+ * @{
+ */
+
+/** @brief Single boot-phase marker. */
+struct boot_trace_entry {
+	/** Marker name. Points to a string literal in flash. */
+	const char *name;
+
+	/** Timestamp in hardware cycles, as returned by k_cycle_get_32(). */
+	uint32_t cycles;
+};
+
+#if defined(CONFIG_BOOT_TRACE)
+/** @brief Record a boot-phase marker.
+ *
+ * Can be called from any context, including PRE_KERNEL init functions.
+ * When the trace buffer is full, further markers are dropped.
+ *
+ * Compiles to a no-op when the module is disabled, so instrumentation
+ * points can be left in place unconditionally.
+ *
+ * @param name Marker name. Must be a string literal.
+ */
+void boot_trace_mark(const char *name);
+#else
+static inline void boot_trace_mark(const char *name)
+{
+	(void)name;
+}
+#endif
+
+/** @brief Copy the markers recorded since the last reset.
+ *
+ * @param[out] buf Destination buffer.
+ * @param cnt Capacity of the destination buffer, in entries.
+ *
+ * @return Number of entries copied.
+ */
+size_t boot_trace_get(struct boot_trace_entry *buf, size_t cnt);
+
+/** @brief Copy the markers recorded during the previous boot.
+ *
+ * @param[out] buf Destination buffer.
+ * @param cnt Capacity of the destination buffer, in entries.
+ *
+ * @return Number of entries copied, or 0 if no valid previous-boot trace
+ *	   is present (for example after a power cycle).
+ */
+size_t boot_trace_previous_get(struct boot_trace_entry *buf, size_t cnt);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BOOT_TRACE_H */
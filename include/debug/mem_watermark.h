@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#ifndef __MEM_WATERMARK_H
+#define __MEM_WATERMARK_H
+
+#include <zephyr.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup mem_watermark Memory watermark telemetry
+ * @brief Module for tracking heap and thread stack usage watermarks.
+ *
+ * @{
+ */
+
+/** @brief Single memory telemetry sample. */
+struct mem_watermark_sample {
+	/** Uptime at which the sample was taken, in milliseconds. */
+	int64_t uptime;
+
+	/** Free heap bytes reported by the registered heap sampler.
+	 *  Zero if no heap sampler is registered.
+	 */
+	uint32_t heap_free;
+
+	/** Lowest free heap value observed since initialization. */
+	uint32_t heap_min_free;
+
+	/** Unused stack bytes of the most occupied thread. */
+	uint32_t stack_min_unused;
+
+	/** Thread owning the most occupied stack. */
+	k_tid_t stack_min_thread;
+};
+
+/** @brief Heap sampler callback.
+ *
+ * Reports the number of currently free heap bytes. The application
+ * provides the sampler because the heap in use (kernel heap, libc heap or
+ * a dedicated @c k_heap) is application specific. The module tracks the
+ * low watermark across samples.
+ *
+ * @param[out] free_bytes Currently free heap bytes.
+ */
+typedef void (*mem_watermark_heap_sampler_t)(uint32_t *free_bytes);
+
+/** @brief Export hook called after each periodic sample.
+ *
+ * Called from the system workqueue. The sample is only valid for the
+ * duration of the call, so hooks that forward it (for example through
+ * @c cloud_send) must either send synchronously or copy it.
+ *
+ * @param sample The sample that was just recorded.
+ */
+typedef void (*mem_watermark_export_t)(
+				const struct mem_watermark_sample *sample);
+
+/** @brief Initialize the module and start periodic sampling.
+ *
+ * @retval 0 The initialization is successful.
+ * @retval -EALREADY The module is already initialized.
+ */
+int mem_watermark_init(void);
+
+/** @brief Register the heap sampler.
+ *
+ * @param sampler Sampler callback, or NULL to disable heap sampling.
+ */
+void mem_watermark_heap_sampler_set(mem_watermark_heap_sampler_t sampler);
+
+/** @brief Register the export hook.
+ *
+ * @param hook Export callback, or NULL to disable exporting.
+ */
+void mem_watermark_export_hook_set(mem_watermark_export_t hook);
+
+/** @brief Take a sample immediately and record it in the history.
+ *
+ * @param[out] sample Location to store the sample. Can be NULL.
+ */
+void mem_watermark_sample_now(struct mem_watermark_sample *sample);
+
+/** @brief Copy recorded samples out of the history ring buffer.
+ *
+ * Samples are copied newest first.
+ *
+ * @param[out] buf Destination buffer.
+ * @param cnt Capacity of the destination buffer, in samples.
+ *
+ * @return Number of samples copied.
+ */
+size_t mem_watermark_history_get(struct mem_watermark_sample *buf,
+				 size_t cnt);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MEM_WATERMARK_H */
@@ -24,7 +24,9 @@ enum dfu_target_image_type {
 	DFU_TARGET_IMAGE_TYPE_ANY = 0,
 	DFU_TARGET_IMAGE_TYPE_MCUBOOT = 1,
 	DFU_TARGET_IMAGE_TYPE_MODEM_DELTA,
-	DFU_TARGET_IMAGE_TYPE_FULL_MODEM
+	DFU_TARGET_IMAGE_TYPE_FULL_MODEM,
+	DFU_TARGET_IMAGE_TYPE_LZSS,
+	DFU_TARGET_IMAGE_TYPE_PATCH
 };
 
 enum dfu_target_evt_id {
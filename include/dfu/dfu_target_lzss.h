@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file dfu_target_lzss.h
+ *
+ * @defgroup dfu_target_lzss LZSS decompressing DFU Target
+ * @{
+ * @brief DFU Target for LZSS compressed MCUBoot style upgrades.
+ *
+ * The compressed stream starts with a 12 byte little-endian header:
+ * a 32 bit magic value (0x4c5a5331), the 32 bit decompressed size, the
+ * window size in bits, the look-ahead size in bits and two reserved
+ * bytes. The header is followed by an MSB-first bitstream of tokens.
+ * A token is either a literal (a '1' flag bit followed by the 8 bit
+ * byte value) or a back-reference (a '0' flag bit followed by the
+ * distance minus one in window-size bits and the length minus two in
+ * look-ahead-size bits). Decompression stops when the decompressed
+ * size has been produced; trailing padding bits are ignored.
+ *
+ * The window and look-ahead sizes used by the compressor must match
+ * the sizes configured on the device, and are validated against the
+ * header before any data is written.
+ */
+
+#ifndef DFU_TARGET_LZSS_H__
+#define DFU_TARGET_LZSS_H__
+
+#include <stddef.h>
+#include <dfu/dfu_target.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief See if data in buf indicates an LZSS compressed upgrade.
+ *
+ * @retval true if data matches, false otherwise.
+ */
+bool dfu_target_lzss_identify(const void *const buf);
+
+/**
+ * @brief Initialize dfu target, perform steps necessary to receive firmware.
+ *
+ * @param[in] file_size Size of the current file being downloaded.
+ * @param[in] cb Callback for signaling events(unused).
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_lzss_init(size_t file_size, dfu_target_callback_t cb);
+
+/**
+ * @brief Get offset of the compressed stream.
+ *
+ * @param[out] offset Returns the number of compressed bytes consumed.
+ *
+ * @return 0 if success, otherwise negative value if unable to get the offset
+ */
+int dfu_target_lzss_offset_get(size_t *offset);
+
+/**
+ * @brief Write compressed firmware data.
+ *
+ * @param[in] buf Pointer to data that should be written.
+ * @param[in] len Length of data to write.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_lzss_write(const void *const buf, size_t len);
+
+/**
+ * @brief Deinitialize resources and finalize firmware upgrade if successful.
+
+ * @param[in] successful Indicate whether the firmware was successfully recived.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_lzss_done(bool successful);
+
+#endif /* DFU_TARGET_LZSS_H__ */
+
+/**@} */
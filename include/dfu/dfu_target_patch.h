@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file dfu_target_patch.h
+ *
+ * @defgroup dfu_target_patch Delta patch DFU Target
+ * @{
+ * @brief DFU Target for delta patches against the running MCUBoot image.
+ *
+ * The patch stream starts with a 16 byte little-endian header: a 32 bit
+ * magic value (0x4e504431), the 32 bit size of the patched image, the
+ * 32 bit size of the source image and the CRC32 (IEEE) of the source
+ * image. The source size and CRC pin the patch to one exact base
+ * version; they are checked against the running slot before any data is
+ * written, so a patch built against the wrong version is rejected
+ * instead of producing a corrupt image.
+ *
+ * The header is followed by a stream of commands. Each command starts
+ * with a control byte. If bit 7 is set, the command is a copy: the
+ * control byte is followed by the copy length and the absolute source
+ * offset, and that range of the running slot is appended to the output.
+ * If bit 7 is clear, the command is an add: the control byte is
+ * followed by the length and that many literal bytes, which are
+ * appended to the output. Lengths and offsets are encoded as LEB128
+ * style varints (7 bits per byte, least significant group first, bit 7
+ * set on all but the last byte). The low 7 bits of the control byte are
+ * reserved and must be zero. The stream ends when the patched image
+ * size has been produced.
+ */
+
+#ifndef DFU_TARGET_PATCH_H__
+#define DFU_TARGET_PATCH_H__
+
+#include <stddef.h>
+#include <dfu/dfu_target.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief See if data in buf indicates a delta patch upgrade.
+ *
+ * @retval true if data matches, false otherwise.
+ */
+bool dfu_target_patch_identify(const void *const buf);
+
+/**
+ * @brief Initialize dfu target, perform steps necessary to receive firmware.
+ *
+ * @param[in] file_size Size of the current file being downloaded.
+ * @param[in] cb Callback for signaling events(unused).
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_patch_init(size_t file_size, dfu_target_callback_t cb);
+
+/**
+ * @brief Get offset of the patch stream.
+ *
+ * @param[out] offset Returns the number of patch bytes consumed.
+ *
+ * @return 0 if success, otherwise negative value if unable to get the offset
+ */
+int dfu_target_patch_offset_get(size_t *offset);
+
+/**
+ * @brief Write patch data.
+ *
+ * @param[in] buf Pointer to data that should be written.
+ * @param[in] len Length of data to write.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_patch_write(const void *const buf, size_t len);
+
+/**
+ * @brief Deinitialize resources and finalize firmware upgrade if successful.
+
+ * @param[in] successful Indicate whether the firmware was successfully recived.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_patch_done(bool successful);
+
+#endif /* DFU_TARGET_PATCH_H__ */
+
+/**@} */
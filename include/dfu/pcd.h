@@ -85,6 +85,21 @@ int pcd_network_core_update(const void *src_addr, size_t len);
  */
 int pcd_network_core_update_initiate(const void *src_addr, size_t len);
 
+/** @brief Check whether an update procedure started with
+ *	   pcd_network_core_update_initiate() has completed, and if so turn
+ *	   the network core off.
+ *
+ *	   This function does not block, so the caller can continue other
+ *	   work, for instance downloading the application core image, while
+ *	   the network core performs the update, and poll this function in
+ *	   between.
+ *
+ * @retval 0 if the update completed successfully.
+ * @retval -EAGAIN if the update procedure is still in progress.
+ * @retval -EFAULT if the update failed.
+ */
+int pcd_network_core_update_finish(void);
+
 /** @brief Lock the RAM section used for IPC with the network core bootloader.
  */
 void pcd_lock_ram(void);
@@ -112,6 +127,16 @@ enum pcd_status pcd_fw_copy_status_get(void);
  */
 const void *pcd_cmd_data_ptr_get(void);
 
+#ifdef CONFIG_PCD_CHUNKED
+/** @brief Get the number of bytes of the image which have been copied.
+ *
+ * The count is updated by the network core as the copy progresses.
+ *
+ * @retval Number of bytes copied so far.
+ */
+size_t pcd_fw_copy_progress_get(void);
+#endif
+
 /** @brief Perform the DFU image transfer.
  *
  * Use the information in the PCD CMD to load a DFU image to the
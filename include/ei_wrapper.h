@@ -58,6 +58,28 @@ size_t ei_wrapper_get_frame_size(void);
 size_t ei_wrapper_get_window_size(void);
 
 
+/** Configure input data preprocessing.
+ *
+ * Input data added with ei_wrapper_add_data is scaled, offset and decimated
+ * with vectorized CMSIS-DSP routines before it is buffered. Every sample x
+ * is replaced with x * scale + offset, and only every decimation-th input
+ * frame is kept. The defaults are scale 1.0, offset 0.0 and decimation 1
+ * (all data kept unmodified).
+ *
+ * Call before adding data. Requires
+ * :kconfig:`CONFIG_EI_WRAPPER_PREPROCESS`.
+ *
+ * @param[in] scale       Multiplier applied to every sample.
+ * @param[in] offset      Value added to every sample after scaling.
+ * @param[in] decimation  Keep every decimation-th input frame. Must be
+ *                        greater than zero.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int ei_wrapper_set_preprocessing(float scale, float offset, size_t decimation);
+
+
 /** Add input data for the library.
  *
  * Size of the added data must be divisible by input frame size.
@@ -93,6 +115,11 @@ int ei_wrapper_clear_data(bool *cancelled);
  * If there is not enough data in the input buffer, the prediction start is
  * delayed until the missing data is added.
  *
+ * If :kconfig:`CONFIG_EI_WRAPPER_PREDICTION_PIPELINE` is enabled, one
+ * prediction can be requested while the previous one is still being
+ * processed. It is started right after the ongoing prediction finishes.
+ * Otherwise, calling this function during processing returns -EBUSY.
+ *
  * @param[in] window_shift  Number of windows the input window is shifted before
  *                          prediction.
  * @param[in] frame_shift   Number of frames the input window is shifted before
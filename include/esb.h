@@ -218,6 +218,29 @@ struct esb_evt {
 /** @brief Event handler prototype. */
 typedef void (*esb_event_handler)(const struct esb_evt *event);
 
+/** @brief Per-pipe link statistics.
+ *
+ *  Collected when @option{CONFIG_ESB_PIPE_STATS} is enabled. The average
+ *  RSSI of the pipe is -(rssi_sum / rssi_samples) dBm. The airtime is an
+ *  estimate derived from the frame lengths and the configured bitrate.
+ */
+struct esb_pipe_stats {
+	uint32_t tx_attempts;	/**< On-air transmissions, including
+				 *  retransmissions.
+				 */
+	uint32_t tx_success;	/**< Successfully completed transactions. */
+	uint32_t tx_failed;	/**< Transactions that failed after all
+				 *  retransmission attempts.
+				 */
+	uint32_t retransmits;	/**< Retransmissions. */
+	uint32_t rx_received;	/**< Received packets, including received
+				 *  acknowledgement payloads.
+				 */
+	uint32_t airtime_us;	/**< Estimated on-air time, in microseconds. */
+	uint32_t rssi_sum;	/**< Sum of RSSI samples, in dBm magnitude. */
+	uint32_t rssi_samples;	/**< Number of RSSI samples in rssi_sum. */
+};
+
 /** @brief Main configuration structure for the module. */
 struct esb_config {
 	enum esb_protocol protocol;		/**< Protocol. */
@@ -299,6 +322,55 @@ bool esb_is_idle(void);
  */
 int esb_write_payload(const struct esb_payload *payload);
 
+/** Headroom that zero-copy TX buffers must reserve for the radio header. */
+#define ESB_ZERO_COPY_HEADROOM 2
+
+/** @brief Zero-copy TX buffer.
+ *
+ *  Describes a caller-owned buffer that the radio transmits from directly,
+ *  without copying the payload into the internal FIFO. The frame must hold
+ *  @ref ESB_ZERO_COPY_HEADROOM bytes of headroom in front of the payload,
+ *  which the module fills in with the radio packet header.
+ */
+struct esb_zero_copy_buf {
+	/** Frame buffer of length + @ref ESB_ZERO_COPY_HEADROOM bytes. The
+	 *  payload starts at frame[ESB_ZERO_COPY_HEADROOM].
+	 */
+	uint8_t *frame;
+	/** Length of the payload, excluding the headroom. */
+	uint8_t length;
+	/** Pipe used for this payload. */
+	uint8_t pipe;
+	/** Flag indicating that this packet will not be acknowledged. */
+	uint8_t noack;
+	/** @brief Completion callback.
+	 *
+	 *  Called from interrupt context when the module releases the buffer.
+	 *  The buffer may be reused after this callback. May be NULL.
+	 *
+	 *  @param[in] buf     The completed buffer.
+	 *  @param[in] success True if the payload was transmitted, false if it
+	 *                     was dropped from the queue.
+	 */
+	void (*sent)(struct esb_zero_copy_buf *buf, bool success);
+};
+
+/** @brief Queue a zero-copy payload for transmission.
+ *
+ *  Queues the buffer by reference; the radio transmits directly from it over
+ *  EasyDMA, and the payload is never copied. The buffer, including its
+ *  contents, must stay valid and untouched until the @c sent callback fires.
+ *  Only supported in PTX mode.
+ *
+ *  Requires @option{CONFIG_ESB_ZERO_COPY_TX}.
+ *
+ *  @param[in] buf The buffer to queue.
+ *
+ * @retval 0 If successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_write_zero_copy_buf(struct esb_zero_copy_buf *buf);
+
 /** @brief Read a payload.
  *
  *  @param[in,out] payload	The payload to be received.
@@ -315,6 +387,37 @@ int esb_read_rx_payload(struct esb_payload *payload);
  */
 int esb_start_tx(void);
 
+/** @brief Start transmitting queued payloads at a fixed period.
+ *
+ * Starts a hardware-timed burst, where each transmission is triggered
+ * directly from a system timer compare event over (D)PPI. Packets are
+ * paced at the programmed period with sub-microsecond jitter and no CPU
+ * involvement per packet. The burst ends automatically when the TX FIFO
+ * is drained, or when @ref esb_stop_tx_burst is called.
+ *
+ * Only unacknowledged payloads can be sent in a burst, because
+ * acknowledged transfers need the system timer for the ACK timeout and
+ * retransmission delay. Requires @option{CONFIG_ESB_TX_BURST}.
+ *
+ * @param[in] period_us	Transmission period in microseconds. Must be long
+ *			enough for a complete on-air transaction.
+ *
+ * @retval 0 If successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_start_tx_burst(uint16_t period_us);
+
+/** @brief Stop an ongoing TX burst.
+ *
+ * Stops the periodic trigger timer. A transmission that is already in
+ * flight completes normally, and any remaining payloads stay in the
+ * TX FIFO.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If no burst is in progress.
+ */
+int esb_stop_tx_burst(void);
+
 /** @brief Start receiving data.
  *
  * @retval 0 If successful.
@@ -441,6 +544,29 @@ int esb_set_rf_channel(uint32_t channel);
  */
 int esb_get_rf_channel(uint32_t *channel);
 
+/** @brief Set the channel hop table.
+ *
+ *  Configures the table of channels that the PTX hops over. Each
+ *  retransmission moves to the next channel in the table while the radio
+ *  is disabled, so a hop costs only a frequency register write instead of
+ *  a full radio restart. Channels whose packet error rate exceeds
+ *  @option{CONFIG_ESB_CHANNEL_HOP_BLACKLIST_PCT} are temporarily skipped
+ *  in the rotation. The PRX side must be configured to cover the same
+ *  channels. Requires @option{CONFIG_ESB_CHANNEL_HOP}.
+ *
+ *  The module must be in an idle state to call this function. Passing a
+ *  count of zero disables hopping and returns to the channel set with
+ *  @ref esb_set_rf_channel.
+ *
+ *  @param[in] channels	Array of channel numbers (0 to 100).
+ *  @param[in] count	Number of channels in the array. Maximum
+ *			@option{CONFIG_ESB_CHANNEL_HOP_TABLE_SIZE}.
+ *
+ * @retval 0 If successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_set_channel_hop_table(const uint8_t *channels, uint8_t count);
+
 /** @brief Set the radio output power.
  *
  *  @param[in] tx_output_power	Output power.
@@ -491,6 +617,32 @@ int esb_set_bitrate(enum esb_bitrate bitrate);
  */
 int esb_reuse_pid(uint8_t pipe);
 
+/** @brief Read the link statistics for a pipe.
+ *
+ * Copies out a consistent snapshot of the counters collected for the
+ * given pipe. Requires @option{CONFIG_ESB_PIPE_STATS}.
+ *
+ *  @param[in]  pipe	Pipe to read the statistics for.
+ *  @param[out] stats	Destination for the statistics snapshot.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If the pipe number or the stats pointer is invalid.
+ */
+int esb_pipe_stats_get(uint8_t pipe, struct esb_pipe_stats *stats);
+
+/** @brief Reset the link statistics for a pipe.
+ *
+ * Clears all counters for the given pipe. If
+ * @option{CONFIG_ESB_TX_ARBITRATION} is enabled, this also restores the
+ * full retransmission budget of a deprioritized pipe.
+ *
+ *  @param[in] pipe	Pipe to reset the statistics for.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL If the pipe number is invalid.
+ */
+int esb_pipe_stats_clear(uint8_t pipe);
+
 /** @} */
 
 #ifdef __cplusplus
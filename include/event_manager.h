@@ -54,6 +54,23 @@ extern "C" {
 #define SUBS_PRIO_COUNT (SUBS_PRIO_MAX - SUBS_PRIO_MIN + 1)
 
 
+/** @brief Event dispatch priority classes.
+ *
+ * Events of a high priority class are always dispatched before queued
+ * events of the normal class.
+ */
+enum event_prio {
+	/** Normal dispatch priority. Used by default. */
+	EVENT_PRIO_NORMAL,
+
+	/** High dispatch priority. */
+	EVENT_PRIO_HIGH,
+
+	/** Number of priority classes. */
+	EVENT_PRIO_COUNT
+};
+
+
 /** @brief Event header.
  *
  * When defining an event structure, the event header
@@ -82,6 +99,59 @@ struct event_dyndata {
 };
 
 
+/** @brief Reference-counted event payload buffer.
+ *
+ * Used to pass large payloads with events without copying the data into
+ * the event structure. An event type carrying such payload must be defined
+ * with @ref EVENT_TYPE_BUF_DEFINE and must place a pointer to the buffer
+ * directly after the event header.
+ *
+ * The reference owned by the event sender is passed on with the submitted
+ * event and is dropped by the Event Manager after the event is dispatched.
+ * A subscriber that accesses the buffer after its notification function
+ * returns must take its own reference with @ref event_buf_get.
+ */
+struct event_buf {
+	/** Reference counter. */
+	atomic_t refcnt;
+
+	/** Size of the data buffer. */
+	size_t size;
+
+	/** Data buffer. */
+	uint8_t data[0];
+};
+
+
+/** Allocate an event payload buffer.
+ *
+ * The allocated buffer holds one reference.
+ *
+ * @param size  Size of the data buffer.
+ *
+ * @return Pointer to the allocated buffer.
+ */
+struct event_buf *event_buf_alloc(size_t size);
+
+
+/** Take a reference to an event payload buffer.
+ *
+ * @param buf  Pointer to the buffer.
+ *
+ * @return Pointer to the referenced buffer.
+ */
+struct event_buf *event_buf_get(struct event_buf *buf);
+
+
+/** Drop a reference to an event payload buffer.
+ *
+ * The buffer is freed when the last reference is dropped.
+ *
+ * @param buf  Pointer to the buffer.
+ */
+void event_buf_put(struct event_buf *buf);
+
+
 /** @brief Event listener.
  *
  * All event listeners must be defined using @ref EVENT_LISTENER.
@@ -128,6 +198,21 @@ struct event_type {
 	/** Event name. */
 	const char			*name;
 
+#ifdef CONFIG_EVENT_MANAGER_ALLOC_SLAB
+	/** Memory slab used to allocate events of this type. */
+	struct k_mem_slab		*slab;
+#endif
+
+#ifdef CONFIG_EVENT_MANAGER_PRIORITY_EVENTS
+	/** Dispatch priority class of this event type. */
+	uint8_t				priority;
+#endif
+
+#ifdef CONFIG_EVENT_MANAGER_EVENT_BUF
+	/** Bool indicating if the event carries a payload buffer. */
+	bool				has_buf;
+#endif
+
 	/** Array of pointers to the array of subscribers. */
 	const struct event_subscriber	*subs_start[SUBS_PRIO_COUNT];
 
@@ -258,7 +343,46 @@ extern const struct event_type __stop_event_types[];
  * @param ev_info_struct   Data structure describing the event type.
  */
 #define EVENT_TYPE_DEFINE(ename, init_log_en, log_fn, ev_info_struct) \
-	_EVENT_TYPE_DEFINE(ename, init_log_en, log_fn, ev_info_struct)
+	_EVENT_TYPE_DEFINE(ename, init_log_en, log_fn, ev_info_struct, EVENT_PRIO_NORMAL)
+
+
+/** Define an event type with a dispatch priority class.
+ *
+ * Behaves like @ref EVENT_TYPE_DEFINE, but additionally assigns a dispatch
+ * priority class to the event type. The priority class is used only if
+ * @kconfig{CONFIG_EVENT_MANAGER_PRIORITY_EVENTS} is enabled.
+ *
+ * @param ename     	   Name of the event.
+ * @param prio      	   Dispatch priority class (see @ref event_prio).
+ * @param init_log_en	   Bool indicating if the event is logged
+ *                         by default.
+ * @param log_fn  	   Function to stringify an event of this type.
+ * @param ev_info_struct   Data structure describing the event type.
+ */
+#define EVENT_TYPE_PRIO_DEFINE(ename, prio, init_log_en, log_fn, ev_info_struct) \
+	_EVENT_TYPE_DEFINE(ename, init_log_en, log_fn, ev_info_struct, prio)
+
+
+/** Define an event type carrying a reference-counted payload buffer.
+ *
+ * Behaves like @ref EVENT_TYPE_DEFINE, but additionally marks the event
+ * type as carrying a payload buffer (see @ref event_buf). The event
+ * structure must place a `struct event_buf *buf` member directly after
+ * the event header. The Event Manager drops the event's buffer reference
+ * after the event is dispatched.
+ *
+ * Requires @kconfig{CONFIG_EVENT_MANAGER_EVENT_BUF}.
+ *
+ * @param ename     	   Name of the event.
+ * @param init_log_en	   Bool indicating if the event is logged
+ *                         by default.
+ * @param log_fn  	   Function to stringify an event of this type.
+ * @param ev_info_struct   Data structure describing the event type.
+ */
+#define EVENT_TYPE_BUF_DEFINE(ename, init_log_en, log_fn, ev_info_struct)		\
+	BUILD_ASSERT(offsetof(struct ename, buf) == sizeof(struct event_header),	\
+			 "Payload buffer pointer must directly follow the header");	\
+	_EVENT_TYPE_BUF_DEFINE(ename, init_log_en, log_fn, ev_info_struct)
 
 
 /** Verify if an event ID is valid.
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FLASH_READ_CACHE_H__
+#define FLASH_READ_CACHE_H__
+
+/**
+ * @file
+ * @defgroup flash_read_cache Flash read cache
+ * @{
+ * @brief Line-based read cache with sequential prefetch for flash devices.
+ *
+ * Caches reads done through the flash driver API in RAM lines, so that
+ * consumers issuing many small reads from slow external flash pay one
+ * large transaction per line instead of one per read. Sequential read
+ * streams additionally prefetch the following line. Lines can be pinned
+ * to keep hot regions resident.
+ *
+ * The cache does not observe writes. Call @ref flash_read_cache_invalidate
+ * after modifying the underlying flash.
+ */
+
+#include <zephyr.h>
+#include <device.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Cache line state. Internal to the cache. */
+struct flash_read_cache_line {
+	/** Line-aligned flash offset, or -1 when the line is empty. */
+	off_t tag;
+
+	/** Last-use stamp for eviction. */
+	uint32_t stamp;
+
+	/** Pinned lines are never evicted. */
+	bool pinned;
+
+	/** Content is stale and is refetched before the next use. */
+	bool stale;
+};
+
+/** @brief Read cache instance. */
+struct flash_read_cache {
+	/** Flash device the cache reads from. */
+	const struct device *fdev;
+
+	/** Line storage, line_cnt * line_size bytes. */
+	uint8_t *buf;
+
+	/** Size of one cache line. */
+	size_t line_size;
+
+	/** Number of lines. */
+	size_t line_cnt;
+
+	/** Expected offset of a sequential continuation. */
+	off_t next_seq;
+
+	/** Use counter backing the eviction stamps. */
+	uint32_t stamp;
+
+	struct flash_read_cache_line lines[CONFIG_FLASH_READ_CACHE_MAX_LINES];
+
+	struct k_mutex lock;
+};
+
+/** @brief Initialize a read cache.
+ *
+ * @param cache Cache instance.
+ * @param fdev Flash device to read from.
+ * @param buf Line storage buffer.
+ * @param buf_size Size of @p buf. Must hold at least one line.
+ * @param line_size Size of one cache line. Large lines amortize more
+ *		    transaction overhead, small lines waste less RAM on
+ *		    scattered reads.
+ *
+ * @retval 0 On success.
+ * @retval -EINVAL On invalid parameters.
+ */
+int flash_read_cache_init(struct flash_read_cache *cache,
+			  const struct device *fdev, uint8_t *buf,
+			  size_t buf_size, size_t line_size);
+
+/** @brief Read through the cache.
+ *
+ * @param cache Cache instance.
+ * @param offset Flash offset to read from.
+ * @param data Destination buffer.
+ * @param len Number of bytes to read.
+ *
+ * @retval 0 On success.
+ * @return Negative errno from the flash driver on read failure.
+ */
+int flash_read_cache_read(struct flash_read_cache *cache, off_t offset,
+			  void *data, size_t len);
+
+/** @brief Pin the lines covering a flash range.
+ *
+ * The range is fetched into the cache and its lines are excluded from
+ * eviction until unpinned.
+ *
+ * @param cache Cache instance.
+ * @param offset Start of the range.
+ * @param len Length of the range.
+ *
+ * @retval 0 On success.
+ * @retval -ENOSPC If pinning would leave no unpinned line.
+ * @return Negative errno from the flash driver on read failure.
+ */
+int flash_read_cache_pin(struct flash_read_cache *cache, off_t offset,
+			 size_t len);
+
+/** @brief Unpin the lines covering a flash range.
+ *
+ * @param cache Cache instance.
+ * @param offset Start of the range.
+ * @param len Length of the range.
+ */
+void flash_read_cache_unpin(struct flash_read_cache *cache, off_t offset,
+			    size_t len);
+
+/** @brief Drop all cached content.
+ *
+ * Pinned lines stay pinned but are refetched on next use. Call after
+ * writing or erasing the underlying flash.
+ *
+ * @param cache Cache instance.
+ */
+void flash_read_cache_invalidate(struct flash_read_cache *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* FLASH_READ_CACHE_H__ */
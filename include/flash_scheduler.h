@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FLASH_SCHEDULER_H_
+#define FLASH_SCHEDULER_H_
+
+#include <zephyr.h>
+#include <device.h>
+
+/**
+ * @file
+ * @defgroup flash_scheduler Flash scheduler
+ * @{
+ * @brief Central scheduler for flash erase and write jobs.
+ *
+ * Subsystems that persist data while the radio is active enqueue their
+ * flash operations here instead of calling the flash driver directly.
+ * All jobs execute serially on one low-priority thread, ordered by
+ * deadline, and contiguous erase jobs on the same device are batched
+ * into a single erase. This prevents independent writers from
+ * clustering flash bursts, which starves the radio of the idle windows
+ * the flash driver synchronizes into.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct flash_scheduler_job;
+
+/** @brief Job completion callback.
+ *
+ * Called from the flash scheduler thread.
+ *
+ * @param[in] job     The completed job.
+ * @param[in] result  0 on success, otherwise the flash driver error code.
+ */
+typedef void (*flash_scheduler_cb_t)(struct flash_scheduler_job *job,
+				     int result);
+
+/** @brief Flash job descriptor.
+ *
+ * The structure must remain valid until the completion callback is
+ * called, or forever if no callback is given.
+ */
+struct flash_scheduler_job {
+	/** Internal: queue node. */
+	sys_snode_t node;
+	/** Internal: absolute deadline, in uptime milliseconds. */
+	int64_t deadline;
+	/** Flash device to operate on. */
+	const struct device *fdev;
+	/** Offset of the operation, in bytes. */
+	off_t offset;
+	/** Data to write, or NULL for an erase job. */
+	const void *data;
+	/** Length of the operation, in bytes. Erase jobs must cover whole
+	 *  pages.
+	 */
+	size_t len;
+	/** Completion callback. Can be NULL. */
+	flash_scheduler_cb_t cb;
+};
+
+/** @brief Enqueue a flash job.
+ *
+ * Jobs are executed in deadline order. The deadline is a scheduling
+ * hint, not a guarantee: a job already executing is never preempted.
+ *
+ * @param[in] job          Job descriptor with fdev, offset, data, len
+ *                         and cb filled in.
+ * @param[in] deadline_ms  Relative deadline of the job, in milliseconds.
+ *
+ * @retval 0       The job was enqueued.
+ * @retval -EINVAL Invalid job descriptor.
+ */
+int flash_scheduler_submit(struct flash_scheduler_job *job,
+			   int32_t deadline_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* FLASH_SCHEDULER_H_ */
@@ -135,6 +135,60 @@ int hw_unique_key_derive_key(enum hw_unique_key_slot kmu_slot,
 	uint8_t const *label, size_t label_size,
 	uint8_t *output, uint32_t output_size);
 
+#ifdef CONFIG_HW_UNIQUE_KEY_CACHE
+/** @brief Statistics for the derived-key cache. */
+struct hw_unique_key_cache_stats {
+	/** Number of derive calls served from the cache. */
+	uint32_t hits;
+	/** Number of derive calls that went through the CryptoCell. */
+	uint32_t derivations;
+	/** Number of cached keys zeroized to make room for new ones. */
+	uint32_t evictions;
+};
+
+/**
+ * @brief Derive a key from the specified HUK, caching the result.
+ *
+ * Behaves like @ref hw_unique_key_derive_key, but keeps the derived key
+ * in a bounded RAM cache keyed by slot, label and context, so repeated
+ * derivations with the same inputs skip the CryptoCell. Requests whose
+ * label, context or output do not fit in a cache entry are passed
+ * through to @ref hw_unique_key_derive_key without caching.
+ *
+ * The least recently used entry is zeroized and reused when the cache
+ * is full. Call @ref hw_unique_key_cache_flush to zeroize all cached
+ * keys, e.g. before entering a low power state or handing over control.
+ *
+ * @param[in]  kmu_slot      Keyslot to derive from.
+ * @param[in]  context       Context for key derivation.
+ * @param[in]  context_size  Size of context.
+ * @param[in]  label         Label for key derivation.
+ * @param[in]  label_size    Size of label.
+ * @param[out] output        The derived key.
+ * @param[in]  output_size   Size of output.
+ *
+ * @retval 0  on success
+ * @retval -ERR_HUK_MISSING  if the slot has not been written.
+ * @return otherwise, an error from nrf_cc3xx_platform_kmu_shadow_key_derive()
+ */
+int hw_unique_key_derive_key_cached(enum hw_unique_key_slot kmu_slot,
+	const uint8_t *context, size_t context_size,
+	uint8_t const *label, size_t label_size,
+	uint8_t *output, uint32_t output_size);
+
+/**
+ * @brief Zeroize all cached derived keys.
+ */
+void hw_unique_key_cache_flush(void);
+
+/**
+ * @brief Get the accumulated cache statistics.
+ *
+ * @param[out] stats  Statistics are copied here.
+ */
+void hw_unique_key_cache_stats_get(struct hw_unique_key_cache_stats *stats);
+#endif /* CONFIG_HW_UNIQUE_KEY_CACHE */
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,6 +48,29 @@ int agps_request_send(struct nrf_modem_gnss_agps_data_frame request, int socket)
  */
 int agps_cloud_data_process(const uint8_t *buf, size_t len);
 
+/**
+ * @brief Processes a fragment of A-GPS data from the cloud.
+ *
+ * Fragments must be fed in the order they appear in the payload, but may
+ * be split at arbitrary byte boundaries. Complete assistance elements are
+ * injected as they arrive, so no buffer for the whole payload is needed.
+ * Requires CONFIG_AGPS_FRAGMENT_PROCESSING.
+ *
+ * @param buf Pointer to a fragment of A-GPS data from the cloud.
+ * @param len Length of the fragment.
+ *
+ * @return Zero on success or (negative) error code otherwise.
+ */
+int agps_cloud_data_process_fragment(const uint8_t *buf, size_t len);
+
+/**
+ * @brief Resets the fragment processing state.
+ *
+ * Must be called before the first fragment of a new A-GPS payload is
+ * processed, and after an aborted transfer.
+ */
+void agps_cloud_data_reset(void);
+
 /** @} */
 
 #ifdef __cplusplus
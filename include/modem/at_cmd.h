@@ -132,6 +132,49 @@ int at_cmd_write(const char *const cmd,
 		 size_t buf_len,
 		 enum at_cmd_state *state);
 
+/**
+ * @brief Function to send a priority AT command to the modem, any data from
+ *        the modem will trigger the callback defined by the handler parameter
+ *        in the function prototype.
+ *
+ * Behaves like at_cmd_write_with_callback(), but the command is placed in
+ * the priority queue, which is drained before the normal queue. Use for
+ * time-critical commands, such as link control, that should not wait
+ * behind queued telemetry queries. Requires CONFIG_AT_CMD_PRIORITY_QUEUE.
+ *
+ * @param cmd     Pointer to null terminated AT command string.
+ * @param handler Pointer to handler that will process any returned data.
+ *                NULL pointer is allowed.
+ *
+ * @retval See at_cmd_write_with_callback().
+ */
+int at_cmd_write_with_callback_prio(const char *const cmd,
+				    at_cmd_handler_t handler);
+
+/**
+ * @brief Function to send a priority AT command and receive response
+ *        immediately
+ *
+ * Behaves like at_cmd_write(), but the command is placed in the priority
+ * queue, which is drained before the normal queue. The command that is
+ * currently being processed by the modem, if any, still completes first.
+ * Requires CONFIG_AT_CMD_PRIORITY_QUEUE.
+ *
+ * @param cmd Pointer to null terminated AT command string
+ * @param buf Buffer to put the response in. NULL pointer is allowed, see
+ *            behaviour explanation for @p buf_len equals 0.
+ * @param buf_len Length of response buffer. 0 length is allowed.
+ * @param state   Pointer to enum @em at_cmd_state variable that can hold
+ *                the error state returned by the modem. NULL pointer is
+ *                allowed.
+ *
+ * @retval See at_cmd_write().
+ */
+int at_cmd_write_prio(const char *const cmd,
+		      char *buf,
+		      size_t buf_len,
+		      enum at_cmd_state *state);
+
 /**
  * @brief Function to set AT command global notification handler
  *
@@ -106,6 +106,97 @@ int at_parser_max_params_from_str(const char *at_params_str,
 int at_parser_params_from_str(const char *at_params_str, char **next_param_str,
 			      struct at_param_list *const list);
 
+/**
+ * @brief Span of a single parameter within an AT response or notification.
+ *
+ * A span points into the original string instead of holding a copy, so no
+ * memory is allocated for it. It is only valid as long as the string it was
+ * parsed from.
+ */
+struct at_span {
+	/** Start of the parameter within the source string. For quoted
+	 *  string parameters, the quotes are not included.
+	 */
+	const char *str;
+	/** Length of the parameter in bytes. Zero for empty parameters. */
+	size_t len;
+	/** Detected parameter type. One of @c AT_PARAM_TYPE_NUM_INT,
+	 *  @c AT_PARAM_TYPE_STRING or @c AT_PARAM_TYPE_EMPTY.
+	 */
+	enum at_param_type type;
+};
+
+/**
+ * @brief Tokenize AT command or response parameters in place.
+ *
+ * This is an allocation-free alternative to at_parser_params_from_str().
+ * Instead of copying each parameter into an @ref at_param_list, the
+ * parameters are returned as spans into @p at_params_str, and numeric
+ * parameters are converted on demand with at_span_int_get() or
+ * at_span_int64_get(). This is intended for notification handlers, where
+ * parsing happens at notification rate and the source buffer outlives the
+ * handler call.
+ *
+ * If the string starts with a notification identifier, such as "+CEREG",
+ * the identifier is returned as the first span. Parenthesized arrays are
+ * not tokenized; they are returned as plain string spans.
+ *
+ * @param at_params_str  AT parameters as a null-terminated string. The
+ *                       string is not modified.
+ * @param next_param_str In the case a string contains multiple notifications,
+ *                       the tokenizer stops at the end of the first one and
+ *                       returns the remainder of the string in this pointer.
+ *                       Set to NULL when the whole string has been consumed.
+ *                       Can be NULL if multinotification is not used.
+ * @param spans          Array where the parameter spans are stored.
+ * @param max_spans      Number of elements in @p spans.
+ *
+ * @return The number of spans stored, or a (negative) error code.
+ * @retval -E2BIG  @p spans cannot hold all parameters in the string.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ */
+int at_parser_spans_from_str(const char *at_params_str,
+			     const char **next_param_str,
+			     struct at_span *spans, size_t max_spans);
+
+/**
+ * @brief Convert a span to a signed 64-bit integer number.
+ *
+ * @param[in]  span  Span to convert.
+ * @param[out] value Converted value.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL If the span is not a valid number.
+ */
+int at_span_int64_get(const struct at_span *span, int64_t *value);
+
+/**
+ * @brief Convert a span to an integer number.
+ *
+ * @param[in]  span  Span to convert.
+ * @param[out] value Converted value.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL If the span is not a valid number or out of range.
+ */
+int at_span_int_get(const struct at_span *span, int32_t *value);
+
+/**
+ * @brief Copy a span to a buffer.
+ *
+ * The copied string is not null-terminated.
+ *
+ * @param[in]     span  Span to copy.
+ * @param[in]     value Pointer to the buffer where to copy the value.
+ * @param[in,out] len   Available space in @p value, returns actual length
+ *                      copied into the buffer in bytes.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENOMEM If the buffer is too small.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ */
+int at_span_string_get(const struct at_span *span, char *value, size_t *len);
+
 enum at_cmd_type {
 	/** Unknown command, indicates that the actual command type could not
 	 *  be resolved.
@@ -63,6 +63,32 @@ int at_notif_init(void);
  */
 int at_notif_register_handler(void *context, at_notif_handler_t handler);
 
+/**
+ * @brief Function to register AT command notification handler for a prefix
+ *
+ * The handler is only called for notifications starting with @p prefix,
+ * for example "+CEREG". Other notifications are filtered out centrally, so
+ * the handler does not need to check the prefix itself. Registering an
+ * already registered combination of context and handler updates its prefix.
+ *
+ * @note  The prefix string is not copied and must remain valid while the
+ *        handler is registered.
+ *
+ * @param context Pointer to context provided by the module which has
+ *                registered the handler.
+ * @param handler Pointer to a received notification handler function of type
+ *                @ref at_notif_handler_t.
+ * @param prefix  Notification prefix to subscribe to. Must not be NULL or
+ *                empty.
+ *
+ * @retval 0            If command execution was successful.
+ * @retval -ENOBUFS     If memory cannot be allocated.
+ * @retval -EINVAL      If handler or prefix is invalid.
+ */
+int at_notif_register_handler_filtered(void *context,
+				       at_notif_handler_t handler,
+				       const char *prefix);
+
 /**
  * @brief Function to de-register AT command notification handler
  *
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file gnss_coex.h
+ *
+ * @defgroup gnss_coex GNSS/LTE coexistence scheduler
+ * @{
+ * @brief Library for time-sharing the radio between GNSS and LTE.
+ *
+ * The library tracks LTE activity through the @ref lte_lc events and
+ * tells the application when to suspend and resume its GNSS search.
+ * Outside declared priority windows, LTE wins: GNSS is suspended when
+ * the RRC connection becomes active and resumed a configurable guard
+ * time after it returns to idle. Inside a priority window, GNSS wins
+ * and is left running regardless of LTE activity. Window utilization
+ * statistics are kept so applications can tune the window layout
+ * against the observed time to fix.
+ */
+
+#ifndef GNSS_COEX_H_
+#define GNSS_COEX_H_
+
+#include <zephyr.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Configuration of the coexistence scheduler. */
+struct gnss_coex_config {
+	/** Work queue to run the suspend and resume callbacks on.
+	 *  If NULL, the system work queue is used.
+	 */
+	struct k_work_q *work_q;
+
+	/** Called when GNSS should be suspended to give LTE the radio. */
+	void (*gnss_suspend)(void);
+
+	/** Called when GNSS can be resumed. */
+	void (*gnss_resume)(void);
+
+	/** Guard time in seconds between the RRC connection going idle
+	 *  and GNSS being resumed.
+	 */
+	uint16_t resume_delay_sec;
+
+	/** Period of the recurring GNSS priority window in seconds.
+	 *  Set to 0 to disable priority windows.
+	 */
+	uint16_t window_period_sec;
+
+	/** Length of the GNSS priority window in seconds. Must be
+	 *  shorter than the window period.
+	 */
+	uint16_t window_length_sec;
+};
+
+/** @brief Window utilization statistics.
+ *
+ * All times are accumulated since initialization or the last call to
+ * gnss_coex_stats_reset().
+ */
+struct gnss_coex_stats {
+	/** Number of times GNSS was suspended due to LTE activity. */
+	uint32_t suspend_count;
+	/** Total time in milliseconds GNSS was allowed to run. */
+	int64_t gnss_time_ms;
+	/** Total time in milliseconds GNSS was suspended. */
+	int64_t suspended_time_ms;
+	/** Total time in milliseconds spent inside priority windows. */
+	int64_t window_time_ms;
+};
+
+/**
+ * @brief Initialize the coexistence scheduler.
+ *
+ * Registers an @ref lte_lc event handler and starts the priority
+ * window timer if windows are configured. GNSS is considered allowed
+ * to run until the first LTE activity is seen.
+ *
+ * @param[in] config Scheduler configuration. The configuration is
+ *		     copied and does not need to stay valid.
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int gnss_coex_init(const struct gnss_coex_config *config);
+
+/**
+ * @brief Check if GNSS is currently allowed to run.
+ *
+ * @retval true if GNSS holds the radio, false if it is suspended.
+ */
+bool gnss_coex_gnss_allowed(void);
+
+/**
+ * @brief Get the accumulated statistics.
+ *
+ * @param[out] stats Statistics are copied here.
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int gnss_coex_stats_get(struct gnss_coex_stats *stats);
+
+/**
+ * @brief Reset the accumulated statistics.
+ */
+void gnss_coex_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* GNSS_COEX_H_ */
@@ -858,6 +858,31 @@ int lte_lc_neighbor_cell_measurement(void);
  */
 int lte_lc_neighbor_cell_measurement_cancel(void);
 
+/** @brief Get the result of the most recent neighbor cell measurement.
+ *	   The result is served from a cache that is maintained from the
+ *	   measurement notifications, so calling this function does not
+ *	   start a new measurement and returns without modem interaction.
+ *	   The age of the result indicates its staleness; a new measurement
+ *	   can be started with lte_lc_neighbor_cell_measurement() when the
+ *	   cached result is considered too old.
+ *	   Requires CONFIG_LTE_NEIGHBOR_CELL_MEAS_CACHE.
+ *
+ * @param cells_info Structure where the measurement result is stored.
+ * @param neighbor_cells Array where the neighbor cell entries are stored.
+ *			 The structure's neighbor_cells member is set to
+ *			 point to this array.
+ * @param max_cells Number of elements in the neighbor_cells array.
+ * @param age_ms Age of the measurement result in milliseconds. Can be NULL.
+ *
+ * @retval 0 on success.
+ * @retval -ENODATA if no measurement result has been received yet.
+ * @retval -ENOTSUP if the measurement cache is not enabled.
+ * @retval -EINVAL if one of the supplied parameters is a NULL pointer.
+ */
+int lte_lc_neighbor_cell_data_get(struct lte_lc_cells_info *cells_info,
+				  struct lte_lc_ncell *neighbor_cells,
+				  uint8_t max_cells, uint64_t *age_ms);
+
 /** @brief Get connection evaluation parameters. Connection evaluation parameters can be used to
  *	   determine the energy efficiency of data transmission prior to the actual
  *	   data transmission.
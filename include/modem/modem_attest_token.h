@@ -128,6 +128,14 @@ int modem_attest_token_parse(struct nrf_attestation_token const *const token_in,
 int modem_attest_token_get_uuids(struct nrf_device_uuid *dev,
 				 struct nrf_modem_fw_uuid *mfw);
 
+/**
+ * @brief Invalidates the UUID cache so that the next call to
+ * @ref modem_attest_token_get_uuids requests a new attestation token.
+ *
+ * Only available if @kconfig{CONFIG_MODEM_ATTEST_TOKEN_CACHE} is enabled.
+ */
+void modem_attest_token_cache_invalidate(void);
+
 /** @} */
 
 #ifdef __cplusplus
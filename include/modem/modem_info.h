@@ -40,6 +40,17 @@ extern "C" {
 /**@brief RSRP event handler function protoype. */
 typedef void (*rsrp_cb_t)(char rsrp_value);
 
+struct modem_param_info;
+
+/**@brief Asynchronous parameter refresh handler function prototype.
+ *
+ * @param modem_param Pointer to the refreshed modem parameter structure.
+ * @param status Zero if all parameters were obtained, otherwise a
+ *               (negative) error code.
+ */
+typedef void (*modem_info_params_ready_cb_t)(
+	struct modem_param_info *modem_param, int status);
+
 /**@brief LTE link information data. */
 enum modem_info {
 	MODEM_INFO_RSRP,	/**< Signal strength. */
@@ -146,6 +157,20 @@ int modem_info_params_init(struct modem_param_info *modem_param);
  */
 int modem_info_rsrp_register(rsrp_cb_t cb);
 
+/** @brief Get the last RSRP value received from the modem.
+ *
+ * The value is maintained from the unsolicited %CESQ notifications that
+ * the subscription started by modem_info_rsrp_register() delivers, so
+ * reading it does not query the modem.
+ *
+ * @param value The variable where to store the RSRP value.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENODATA If no notification has been received yet.
+ * @retval -EINVAL If value is a NULL pointer.
+ */
+int modem_info_rsrp_get(uint16_t *value);
+
 /** @brief Request the current modem status of any predefined
  *         information value as a string.
  *
@@ -241,6 +266,25 @@ int modem_info_json_object_encode(struct modem_param_info *modem,
  */
 int modem_info_params_get(struct modem_param_info *modem_param);
 
+/** @brief Obtain the modem parameters asynchronously.
+ *
+ * The refresh runs from the system workqueue and @p cb is called once
+ * with the aggregate result when all parameters have been read, so the
+ * calling thread is not blocked for the duration of the refresh. Only
+ * one refresh can be in progress at a time.
+ * Requires CONFIG_MODEM_INFO_PARAMS_ASYNC.
+ *
+ * @param modem_param Pointer to the storage parameters. Must remain valid
+ *                    until @p cb is called.
+ * @param cb Handler called when the refresh has completed.
+ *
+ * @retval 0 If the refresh was started.
+ * @retval -EBUSY If a refresh is already in progress.
+ * @retval -EINVAL If one of the supplied parameters is a NULL pointer.
+ */
+int modem_info_params_get_async(struct modem_param_info *modem_param,
+				modem_info_params_ready_cb_t cb);
+
 /** @} */
 
 #ifdef __cplusplus
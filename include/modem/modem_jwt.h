@@ -76,6 +76,10 @@ struct jwt_data {
  * If sec_tag value is given as zero, JWT is signed with Nordic's own keys that
  * already exist in the modem.
  *
+ * If @kconfig{CONFIG_MODEM_JWT_CACHE} is enabled, a token generated with the
+ * same parameters may be returned from a cache instead of being freshly
+ * generated, with correspondingly less remaining validity time.
+ *
  * @param[in,out] jwt Pointer to struct containing JWT parameters and result.
  *
  * @retval 0 If the operation was successful.
@@ -73,6 +73,24 @@ int nrf_modem_lib_get_init_ret(void);
  */
 int nrf_modem_lib_shutdown(void);
 
+/**
+ * @brief Restart the Modem library and the modem.
+ *
+ * Performs a shutdown and initialization as one controlled cycle,
+ * intended for recovering from a modem fault. Unlike calling
+ * @ref nrf_modem_lib_shutdown followed by @ref nrf_modem_lib_init,
+ * no attempt is made to power the modem off gracefully first, as a
+ * faulted modem may not respond to AT commands.
+ *
+ * Threads sleeping in @ref nrf_modem_lib_shutdown_wait are woken up
+ * when initialization has completed. Link control must be initialized
+ * again after this function returns, as the modem has lost its
+ * configuration.
+ *
+ * @return int Zero on success, non-zero otherwise.
+ */
+int nrf_modem_lib_restart(void);
+
 /**
  * @brief Print diagnostic information for the TX heap.
  */
@@ -62,6 +62,26 @@ enum pdn_event {
 	PDN_EVENT_IPV6_DOWN,	/** PDN has lost IPv6 connectivity */
 };
 
+/** @brief Diagnostic information for a PDP context.
+ *
+ * Maintained by the library from the +CNEC and +CGEV AT notifications
+ * when CONFIG_PDN_DIAG is enabled.
+ */
+struct pdn_diag {
+	/** Whether the PDN connection is currently active. */
+	bool active;
+	/** Number of PDN activation events. */
+	uint32_t activations;
+	/** Number of PDN deactivation events. */
+	uint32_t deactivations;
+	/** Number of events for lost IPv6 connectivity. */
+	uint32_t ipv6_failures;
+	/** Last ESM error reason reported for the context. */
+	int last_esm;
+	/** Uptime of the last event, in milliseconds. */
+	int64_t last_event_uptime;
+};
+
 /** @brief PDN authentication method */
 enum pdn_auth {
 	PDN_AUTH_NONE = 0,	/** No authentication */
@@ -173,6 +193,28 @@ int pdn_deactivate(uint8_t cid);
  */
 int pdn_id_get(uint8_t cid);
 
+/**
+ * @brief Retrieve diagnostic information for a given PDP context.
+ *
+ * Requires CONFIG_PDN_DIAG.
+ *
+ * @param cid The context ID of the PDN connection.
+ * @param[out] diag The diagnostic information.
+ * @return int Zero on success or a negative errno otherwise.
+ */
+int pdn_diag_get(uint8_t cid, struct pdn_diag *diag);
+
+/**
+ * @brief Reset the diagnostic counters for a given PDP context.
+ *
+ * The connection state is not affected.
+ * Requires CONFIG_PDN_DIAG.
+ *
+ * @param cid The context ID of the PDN connection.
+ * @return int Zero on success or a negative errno otherwise.
+ */
+int pdn_diag_reset(uint8_t cid);
+
 /**
  * @brief Retrieve the default Access Point Name (APN).
  *
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef MPSL_FEM_GAIN_H__
+#define MPSL_FEM_GAIN_H__
+
+/**
+ * @file
+ * @defgroup mpsl_fem_gain MPSL FEM gain control
+ * @{
+ * @brief Runtime control of the front-end module gain state.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief nRF21540 transmit gain states, selected with the MODE pin. */
+enum mpsl_fem_gain_state {
+	/** Gain set associated with the POUTA production register page. */
+	MPSL_FEM_GAIN_POUTA,
+	/** Gain set associated with the POUTB production register page. */
+	MPSL_FEM_GAIN_POUTB,
+};
+
+/** @brief Select the transmit gain state of the nRF21540 front-end module.
+ *
+ * Drives the MODE pin of the nRF21540. The current state is cached, so
+ * calling this function with the already active state performs no GPIO
+ * access. The call must not be made while a radio operation is in
+ * progress; the new state applies to subsequent transmissions.
+ *
+ * Note that the PA gain communicated to the protocol stacks remains the
+ * value of CONFIG_MPSL_FEM_NRF21540_TX_GAIN_DB; the caller is responsible
+ * for accounting for the gain difference between the two states.
+ *
+ * @param[in] state  Gain state to select.
+ *
+ * @retval 0       The MODE pin drives the requested state.
+ * @retval -ENODEV No MODE pin is configured in the devicetree.
+ * @return Otherwise, a negative error code from the GPIO driver.
+ */
+int mpsl_fem_gain_state_set(enum mpsl_fem_gain_state state);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* MPSL_FEM_GAIN_H__ */
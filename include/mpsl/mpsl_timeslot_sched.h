@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef MPSL_TIMESLOT_SCHED_H__
+#define MPSL_TIMESLOT_SCHED_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @file
+ * @defgroup mpsl_timeslot_sched MPSL timeslot scheduler
+ * @{
+ * @brief High-level scheduler for periodic MPSL timeslot reservations.
+ *
+ * The scheduler maintains a periodic radio timeslot reservation on top of
+ * the raw MPSL timeslot API. It re-requests the next slot from within the
+ * timeslot callback, optionally extends a granted slot in increments for
+ * as long as the scheduler of the coexisting protocol allows, escalates
+ * the request priority after a denied slot and keeps statistics on
+ * granted and denied requests.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Timeslot statistics. */
+struct mpsl_timeslot_sched_stats {
+	/** Number of granted timeslots. */
+	uint32_t granted;
+	/** Number of blocked or cancelled timeslot requests. */
+	uint32_t denied;
+	/** Number of granted timeslot extensions. */
+	uint32_t extensions_granted;
+	/** Number of denied timeslot extensions. */
+	uint32_t extensions_denied;
+};
+
+/** @brief Timeslot callback.
+ *
+ * Called in the timeslot signal context, which is an interrupt context.
+ * The callback must return well before the end of the timeslot.
+ */
+typedef void (*mpsl_timeslot_sched_cb_t)(void);
+
+/** @brief Periodic timeslot reservation configuration. */
+struct mpsl_timeslot_sched_config {
+	/** Distance between the starts of two consecutive timeslots,
+	 *  in microseconds. Must be larger than @c max_length_us.
+	 */
+	uint32_t period_us;
+	/** Requested timeslot length, in microseconds. */
+	uint32_t length_us;
+	/** Extension increment, in microseconds. Set to zero to disable
+	 *  timeslot extension.
+	 */
+	uint32_t extension_us;
+	/** Upper bound of the extended timeslot length, in microseconds. */
+	uint32_t max_length_us;
+	/** If true, a denied timeslot escalates the next request to high
+	 *  priority. The priority drops back to normal once a slot is
+	 *  granted.
+	 */
+	bool high_prio_fallback;
+	/** Called when a timeslot starts and the radio is available. */
+	mpsl_timeslot_sched_cb_t start_cb;
+	/** Called shortly before the timeslot ends. The radio must not be
+	 *  used after this callback returns.
+	 */
+	mpsl_timeslot_sched_cb_t end_cb;
+};
+
+/** @brief Start the periodic timeslot reservation.
+ *
+ * Must be called from a thread context.
+ *
+ * @param[in] config  Reservation configuration. The content is copied.
+ *
+ * @retval 0         The reservation was started.
+ * @retval -EALREADY A reservation is already running.
+ * @retval -EINVAL   Invalid configuration.
+ * @return Otherwise, a negative error code reported by MPSL.
+ */
+int mpsl_timeslot_sched_start(const struct mpsl_timeslot_sched_config *config);
+
+/** @brief Stop the periodic timeslot reservation and close the session.
+ *
+ * Must be called from a thread context.
+ *
+ * @retval 0         The reservation was stopped.
+ * @retval -EALREADY No reservation is running.
+ * @return Otherwise, a negative error code reported by MPSL.
+ */
+int mpsl_timeslot_sched_stop(void);
+
+/** @brief Read the timeslot statistics.
+ *
+ * The counters accumulate since the last @ref mpsl_timeslot_sched_start.
+ *
+ * @param[out] stats  Structure to fill with the current counters.
+ */
+void mpsl_timeslot_sched_stats_get(struct mpsl_timeslot_sched_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* MPSL_TIMESLOT_SCHED_H__ */
@@ -281,6 +281,36 @@ static inline int cloud_disconnect(const struct cloud_backend *const backend)
 	return backend->api->disconnect(backend);
 }
 
+#if defined(CONFIG_CLOUD_STORE)
+/**@brief Initialize the flash-backed message store.
+ *
+ * @param storage_base Flash address of the storage region. Must be aligned
+ *		       to CONFIG_CLOUD_STORE_PAGE_SIZE.
+ * @param storage_size Size of the storage region in bytes. Must be a
+ *		       multiple of CONFIG_CLOUD_STORE_PAGE_SIZE and hold at
+ *		       least two pages.
+ *
+ * @return 0 or a negative error code indicating reason of failure.
+ */
+int cloud_store_init(uint32_t storage_base, uint32_t storage_size);
+
+/**@brief Store a message for later delivery. Called by cloud_send when the
+ *	  backend send fails with a connection-related error.
+ *
+ * @param msg Pointer to cloud message structure.
+ *
+ * @return 0 or a negative error code indicating reason of failure.
+ */
+int cloud_store_save(const struct cloud_msg *const msg);
+
+/**@brief Schedule replay of stored messages to the given backend. Called
+ *	  from cloud_notify_event when the backend reports ready.
+ *
+ * @param backend Pointer to a cloud backend structure.
+ */
+void cloud_store_replay_schedule(const struct cloud_backend *const backend);
+#endif /* defined(CONFIG_CLOUD_STORE) */
+
 /**@brief Send data to a cloud.
  *
  * @param backend Pointer to a cloud backend structure.
@@ -291,14 +321,82 @@ static inline int cloud_disconnect(const struct cloud_backend *const backend)
 static inline int cloud_send(const struct cloud_backend *const backend,
 			     struct cloud_msg *msg)
 {
+	int err;
+
 	if (backend == NULL || backend->api == NULL ||
 	    backend->api->send == NULL) {
 		return -ENOTSUP;
 	}
 
-	return backend->api->send(backend, msg);
+	err = backend->api->send(backend, msg);
+
+#if defined(CONFIG_CLOUD_STORE)
+	switch (err) {
+	case -EACCES:
+	case -ENOTCONN:
+	case -ENETDOWN:
+	case -ENETUNREACH:
+	case -ECONNRESET:
+	case -EPIPE:
+		/* No connection to the cloud; keep the message in the
+		 * store so it is replayed on reconnect.
+		 */
+		if (cloud_store_save(msg) == 0) {
+			err = 0;
+		}
+		break;
+	default:
+		break;
+	}
+#endif
+
+	return err;
 }
 
+#if defined(CONFIG_CLOUD_ASYNC)
+/**
+ * @brief Send completion callback function type.
+ *
+ * @param backend   Pointer to cloud backend.
+ * @param err       Result of the send; 0 on success or a negative error
+ *		       code indicating reason of failure.
+ * @param user_data Pointer to user defined data passed to cloud_send_async.
+ */
+typedef void (*cloud_send_cb_t)(const struct cloud_backend *const backend,
+				int err, void *user_data);
+
+/**@brief Send data to a cloud without blocking.
+ *
+ * @details The message is copied to a bounded queue and sent from the
+ *	    system workqueue, in the order it was queued relative to other
+ *	    asynchronous sends. The caller's buffers may be reused as soon
+ *	    as this function returns. The completion callback is executed
+ *	    from the system workqueue.
+ *
+ * @param backend   Pointer to a cloud backend structure.
+ * @param msg       Pointer to cloud message structure.
+ * @param cb        Completion callback. Can be NULL.
+ * @param user_data Pointer to user defined data passed to the callback.
+ *
+ * @retval 0 If the message was queued.
+ * @retval -ENOBUFS If the queue is full.
+ *	    Otherwise, a (negative) error code is returned.
+ */
+int cloud_send_async(const struct cloud_backend *const backend,
+		     const struct cloud_msg *const msg,
+		     cloud_send_cb_t cb, void *user_data);
+
+/**@brief Get the number of asynchronous sends queued but not yet
+ *	  completed, including the message currently being sent.
+ *
+ * @details Can be used by the application to adapt its sampling or
+ *	    publishing rate to network backpressure.
+ *
+ * @return Queue depth.
+ */
+uint32_t cloud_send_queue_depth(void);
+#endif /* defined(CONFIG_CLOUD_ASYNC) */
+
 /**
  * @brief Optional API to ping the cloud's remote endpoint periodically.
  *
@@ -451,6 +549,12 @@ static inline void cloud_notify_event(struct cloud_backend *backend,
 				      struct cloud_event *evt,
 				      void *user_data)
 {
+#if defined(CONFIG_CLOUD_STORE)
+	if (evt->type == CLOUD_EVT_READY) {
+		cloud_store_replay_schedule(backend);
+	}
+#endif
+
 	if (backend->config->handler) {
 		backend->config->handler(backend, evt, user_data);
 	}
@@ -39,6 +39,41 @@ int coap_send_request(enum coap_method method, const struct sockaddr *addr,
 		      const char *const *uri_path_options, uint8_t *payload,
 		      uint16_t payload_size, coap_reply_t reply_cb);
 
+/** @brief Register a CoAP observation of a resource.
+ *
+ * The reply callback is called for the response and for every
+ * notification until the observation is cancelled. The number of
+ * observations and pending replies that can be matched concurrently is
+ * set by CONFIG_COAP_UTILS_MAX_REPLIES.
+ *
+ * @param[in] addr             pointer to socket address struct for IPv6.
+ * @param[in] uri_path_options pointer to CoAP URI schemes option.
+ * @param[in] reply_cb         function to call for every notification.
+ *
+ * @retval >= 0 On success.
+ * @retval < 0 On failure.
+ */
+int coap_send_observe_request(const struct sockaddr *addr,
+			      const char *const *uri_path_options,
+			      coap_reply_t reply_cb);
+
+/** @brief Cancel a CoAP observation of a resource.
+ *
+ * Sends a deregistration request with the token of the original
+ * registration and stops matching notifications to the callback.
+ *
+ * @param[in] addr             pointer to socket address struct for IPv6.
+ * @param[in] uri_path_options pointer to CoAP URI schemes option.
+ * @param[in] reply_cb         callback the observation was registered with.
+ *
+ * @retval >= 0 On success.
+ * @retval -ENOENT If no observation matches the callback.
+ * @retval < 0 On other failures.
+ */
+int coap_cancel_observe_request(const struct sockaddr *addr,
+				const char *const *uri_path_options,
+				coap_reply_t reply_cb);
+
 #endif
 
 /**
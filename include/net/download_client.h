@@ -132,8 +132,17 @@ typedef int (*download_client_callback_t)(
 struct download_client {
 	/** Socket descriptor. */
 	int fd;
+#ifdef CONFIG_DOWNLOAD_CLIENT_EXTERNAL_BUF
+	/** Response buffer, provided by the application
+	 * via @ref download_client_buf_set.
+	 */
+	char *buf;
+	/** Size of the response buffer. */
+	size_t buf_size;
+#else
 	/** Response buffer. */
 	char buf[CONFIG_DOWNLOAD_CLIENT_BUF_SIZE];
+#endif
 	/** Buffer offset. */
 	size_t offset;
 
@@ -152,6 +161,11 @@ struct download_client {
 	/** Protocol for current download. */
 	int proto;
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_ADAPTIVE_FRAG_SIZE
+	/** Current HTTP fragment size, adapted to the link quality. */
+	size_t frag_size;
+#endif
+
 	struct  {
 		/** Whether the HTTP header for
 		 * the current fragment has been processed.
@@ -159,11 +173,58 @@ struct download_client {
 		bool has_header;
 		/** The server has closed the connection. */
 		bool connection_close;
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+		/** Payload length of the range response being parsed. */
+		size_t payload_len;
+		/** Bytes of the next pipelined response
+		 * already received into the buffer.
+		 */
+		size_t extra;
+		/** File offset of the next range to request. */
+		size_t requested;
+		/** Number of range requests in flight. */
+		int pending;
+		/** Request scratch buffer, so that requests can be sent
+		 * while the response buffer holds fragment data.
+		 */
+		char request[CONFIG_DOWNLOAD_CLIENT_MAX_HOSTNAME_SIZE +
+			     CONFIG_DOWNLOAD_CLIENT_MAX_FILENAME_SIZE + 128];
+#endif
 	} http;
 
 	struct {
 		/** CoAP block context. */
 		struct coap_block_context block_ctx;
+#ifdef CONFIG_DOWNLOAD_CLIENT_COAP_PIPELINING
+		/** Block requests in flight. */
+		struct {
+			/** Block number requested. */
+			uint32_t block;
+			/** Request token. */
+			uint8_t token[8];
+			/** Token length. */
+			uint8_t tkl;
+			/** Whether a response is outstanding. */
+			bool busy;
+		} pending[CONFIG_DOWNLOAD_CLIENT_COAP_NSTART];
+		/** Blocks received out of order, awaiting delivery. */
+		struct {
+			/** Block number held. */
+			uint32_t block;
+			/** Payload length. */
+			uint16_t len;
+			/** Whether the entry holds a block. */
+			bool valid;
+			/** Block payload. */
+			uint8_t data[1 << (CONFIG_DOWNLOAD_CLIENT_COAP_BLOCK_SIZE + 4)];
+		} window[CONFIG_DOWNLOAD_CLIENT_COAP_NSTART - 1];
+		/** Next block number to deliver to the application. */
+		uint32_t block_deliver;
+		/** Next block number to request. */
+		uint32_t block_request;
+		/** Requests in flight must be sent again (timeout). */
+		bool retransmit;
+#endif
 	} coap;
 
 	/** Internal thread ID. */
@@ -178,6 +239,41 @@ struct download_client {
 	download_client_callback_t callback;
 };
 
+/**
+ * @brief Size of the client's response buffer, in bytes.
+ *
+ * @param[in] client	Client instance.
+ *
+ * @return Size of the response buffer.
+ */
+static inline size_t download_client_buf_size(
+	const struct download_client *client)
+{
+#ifdef CONFIG_DOWNLOAD_CLIENT_EXTERNAL_BUF
+	return client->buf_size;
+#else
+	return CONFIG_DOWNLOAD_CLIENT_BUF_SIZE;
+#endif
+}
+
+#ifdef CONFIG_DOWNLOAD_CLIENT_EXTERNAL_BUF
+/**
+ * @brief Register the buffer to download into.
+ *
+ * The fragments delivered via @ref DOWNLOAD_CLIENT_EVT_FRAGMENT point
+ * into this buffer. It must be registered before connecting and must
+ * remain valid until the client is no longer used.
+ *
+ * @param[in] client	Client instance.
+ * @param[in] buf	Buffer to receive into.
+ * @param[in] size	Size of the buffer, in bytes.
+ *
+ * @retval int Zero on success, otherwise a negative error code.
+ */
+int download_client_buf_set(struct download_client *client, void *buf,
+			    size_t size);
+#endif
+
 /**
  * @brief Initialize the download client.
  *
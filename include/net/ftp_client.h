@@ -370,6 +370,17 @@ int ftp_delete(const char *file);
  */
 int ftp_get(const char *file);
 
+/**@brief Resume getting a file from the specified offset
+ * Use after an interrupted transfer to fetch the remainder of the file
+ * instead of starting over. The server must support the REST command.
+ *
+ * @param file Target file name
+ * @param offset File offset, in bytes, to restart the transfer from
+ *
+ * @retval ftp_reply_code or negative if error
+ */
+int ftp_get_resume(const char *file, uint32_t offset);
+
 /**@brief Put data to a file
  * If file does not exist, create the file
  *
@@ -104,12 +104,22 @@ typedef int (*icalendar_parser_callback_t)(
  * @brief iCalendar parser instance.
  */
 struct icalendar_parser {
-	/** Internal Buffer for parsing incoming data stream */
-	char buf[CONFIG_ICAL_PARSER_BUFFER_SIZE + 1];
-	/** Offset of unparsed data in buf. */
+	/** Internal buffer holding the content line being assembled. */
+	char buf[CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE + 1];
+	/** Length of the content line being assembled. */
 	size_t offset;
 	/** begin of iCalendar object delimiter pair */
 	bool icalobject_begin;
+	/** Inside a calendar component. */
+	bool in_component;
+	/** Content line overflowed the line buffer. */
+	bool overflow;
+	/** Nesting depth of unparsed sub-components. */
+	uint8_t depth;
+	/** Content line assembly state. */
+	uint8_t line_state;
+	/** Component event being assembled. */
+	struct ical_parser_evt evt;
 	/** Event handler. */
 	icalendar_parser_callback_t callback;
 };
@@ -128,6 +138,10 @@ int ical_parser_init(struct icalendar_parser *ical,
 /**
  * @brief Parse the iCalendar data stream. Return the parsed bytes.
  *
+ * Each input fragment is consumed in full, and the parser retains only the
+ * content line currently being assembled. Component events are delivered
+ * through the callback as soon as their end delimiter is parsed.
+ *
  * @param[in,out] ical iCalendar parser instance.
  * @param[in] data Input data to be parsed.
  * @param[in] len  Length of input data stream.
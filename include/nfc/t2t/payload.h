@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NFC_T2T_PAYLOAD_H_
+#define NFC_T2T_PAYLOAD_H_
+
+#include <stddef.h>
+#include <zephyr/types.h>
+#include <nfc/ndef/msg.h>
+
+/**
+ * @file
+ * @defgroup nfc_t2t_payload Type 2 Tag double-buffered payload
+ * @{
+ * @brief Double-buffered NDEF payload updates for Type 2 Tag emulation.
+ *
+ * Encodes NDEF messages into one of two application-provided buffers and
+ * hands the inactive buffer to the Type 2 Tag library, so the tag content
+ * can be replaced while emulation is running. The emulation is not stopped,
+ * and the previous payload stays valid for reads that are in progress when
+ * the new payload is set.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Register the payload buffer pair.
+ *
+ * Must be called before the first call to @ref nfc_t2t_payload_publish.
+ * Both buffers must stay valid for as long as the tag is emulated.
+ *
+ * @param[in] buf      First payload buffer.
+ * @param[in] swap_buf Second payload buffer.
+ * @param[in] len      Size of each of the buffers in bytes.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_t2t_payload_buf_register(uint8_t *buf, uint8_t *swap_buf, size_t len);
+
+/** @brief Encode and publish a new NDEF message as the tag content.
+ *
+ * The message is encoded into the buffer that is not exposed to the NFC
+ * reader, and the Type 2 Tag library is then pointed at it. Can be called
+ * at any time after the buffers are registered, also while emulation is
+ * running.
+ *
+ * @param[in] msg NDEF message to publish.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_t2t_payload_publish(const struct nfc_ndef_msg_desc *msg);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* NFC_T2T_PAYLOAD_H_ */
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_802154_CONFIGURATOR_H__
+#define NRF_802154_CONFIGURATOR_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @file
+ * @defgroup nrf_802154_configurator nRF 802.15.4 Radio Driver configurator
+ * @{
+ * @brief Runtime configuration of the nRF 802.15.4 Radio Driver.
+ *
+ * The functions below wrap the live configuration interface of the radio
+ * driver. The driver applies new values between frames, so the receiver
+ * is not stopped and no frames are lost while reconfiguring.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Set the CCA energy detection and correlator thresholds.
+ *
+ * The thresholds are expressed as for a radio without a front-end module.
+ * The RX track gain of the configured front-end module is compensated
+ * internally, in the same way as during the boot-time configuration.
+ *
+ * @param[in] ed_threshold    Energy detection threshold, in driver units.
+ * @param[in] corr_threshold  Correlator events threshold.
+ */
+void nrf_802154_configurator_cca_threshold_set(uint8_t ed_threshold,
+					       uint8_t corr_threshold);
+
+/** @brief Set the transmit power used for subsequent transmissions.
+ *
+ * @param[in] power_dbm  Transmit power, in dBm.
+ */
+void nrf_802154_configurator_tx_power_set(int8_t power_dbm);
+
+/** @brief Enable or disable the automatic frame pending bit procedure.
+ *
+ * @param[in] enabled  If true, the frame pending bit in acknowledgments is
+ *                     set based on the pending data address list. If false,
+ *                     the frame pending bit is set in every acknowledgment.
+ */
+void nrf_802154_configurator_auto_pending_bit_set(bool enabled);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* NRF_802154_CONFIGURATOR_H__ */
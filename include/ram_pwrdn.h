@@ -28,6 +28,15 @@ extern "C" {
  */
 void power_down_unused_ram(void);
 
+/** Request powering up all RAM sections.
+ *
+ * Reverts the effects of @ref power_down_unused_ram.
+ * Powered-up sections contain undefined data.
+ *
+ * Not all devices support this feature.
+ */
+void power_up_unused_ram(void);
+
 #ifdef __cplusplus
 }
 #endif
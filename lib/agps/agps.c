@@ -18,6 +18,9 @@
 #include <supl_os_client.h>
 #elif defined(CONFIG_AGPS_SRC_NRF_CLOUD)
 #include <net/nrf_cloud_agps.h>
+#if defined(CONFIG_AGPS_FRAGMENT_PROCESSING)
+#include "nrf_cloud_agps_schema_v1.h"
+#endif
 #endif
 
 LOG_MODULE_REGISTER(agps, CONFIG_AGPS_LOG_LEVEL);
@@ -354,6 +357,192 @@ int agps_request_send(struct nrf_modem_gnss_agps_data_frame request, int socket)
 	return 0;
 }
 
+#if defined(CONFIG_AGPS_FRAGMENT_PROCESSING)
+/* The nRF Cloud A-GPS payload is a stream of element arrays, each
+ * prefixed with a type and count header. Elements are injected into the
+ * modem as soon as they are complete, so only the bytes of one
+ * incomplete element are held back and the application does not need a
+ * buffer for the whole payload. Time-of-week elements are an exception:
+ * they are flushed together with the system clock element that follows
+ * them, as the two are merged on injection.
+ */
+
+#define FRAG_HDR_SIZE (NRF_CLOUD_AGPS_BIN_TYPE_SIZE + \
+		       NRF_CLOUD_AGPS_BIN_COUNT_SIZE)
+/* The parser reads a system clock element without the TOW array, but
+ * with the four bytes of the satellite mask.
+ */
+#define FRAG_SYSTEM_CLOCK_SIZE \
+	(sizeof(struct nrf_cloud_agps_system_time) - \
+	 sizeof(((struct nrf_cloud_agps_system_time *)0)->sv_tow) + 4)
+#define FRAG_BUF_SIZE (NRF_CLOUD_AGPS_BIN_SCHEMA_VERSION_SIZE + \
+		       FRAG_HDR_SIZE + \
+		       NRF_CLOUD_AGPS_MAX_SV_TOW * \
+				sizeof(struct nrf_cloud_agps_tow_element) + \
+		       FRAG_HDR_SIZE + FRAG_SYSTEM_CLOCK_SIZE)
+
+enum frag_state {
+	FRAG_STATE_VERSION,
+	FRAG_STATE_HEADER,
+	FRAG_STATE_ELEMENT,
+	FRAG_STATE_TOW_HEADER,
+};
+
+static uint8_t frag_buf[FRAG_BUF_SIZE];
+static size_t frag_len;
+static size_t frag_need = NRF_CLOUD_AGPS_BIN_SCHEMA_VERSION_SIZE;
+static enum frag_state frag_state;
+static enum nrf_cloud_agps_type frag_type;
+static uint16_t frag_elements_left;
+
+static size_t frag_element_size(enum nrf_cloud_agps_type type)
+{
+	switch (type) {
+	case NRF_CLOUD_AGPS_UTC_PARAMETERS:
+		return sizeof(struct nrf_cloud_agps_utc);
+	case NRF_CLOUD_AGPS_EPHEMERIDES:
+		return sizeof(struct nrf_cloud_agps_ephemeris);
+	case NRF_CLOUD_AGPS_ALMANAC:
+		return sizeof(struct nrf_cloud_agps_almanac);
+	case NRF_CLOUD_AGPS_KLOBUCHAR_CORRECTION:
+		return sizeof(struct nrf_cloud_agps_klobuchar);
+	case NRF_CLOUD_AGPS_GPS_SYSTEM_CLOCK:
+		return FRAG_SYSTEM_CLOCK_SIZE;
+	case NRF_CLOUD_AGPS_GPS_TOWS:
+		return sizeof(struct nrf_cloud_agps_tow_element);
+	case NRF_CLOUD_AGPS_LOCATION:
+		return sizeof(struct nrf_cloud_agps_location);
+	case NRF_CLOUD_AGPS_INTEGRITY:
+		return sizeof(struct nrf_cloud_agps_integrity);
+	default:
+		return 0;
+	}
+}
+
+static int frag_flush(void)
+{
+	int err;
+
+	err = nrf_cloud_agps_process(frag_buf, frag_len, NULL);
+
+	/* Keep the schema version prefix for the next chunk */
+	frag_len = NRF_CLOUD_AGPS_BIN_SCHEMA_VERSION_SIZE;
+
+	return err;
+}
+#endif /* CONFIG_AGPS_FRAGMENT_PROCESSING */
+
+void agps_cloud_data_reset(void)
+{
+#if defined(CONFIG_AGPS_FRAGMENT_PROCESSING)
+	frag_len = 0;
+	frag_need = NRF_CLOUD_AGPS_BIN_SCHEMA_VERSION_SIZE;
+	frag_state = FRAG_STATE_VERSION;
+	frag_elements_left = 0;
+#endif
+}
+
+int agps_cloud_data_process_fragment(const uint8_t *buf, size_t len)
+{
+#if defined(CONFIG_AGPS_FRAGMENT_PROCESSING)
+	int err;
+	uint16_t count;
+	size_t element_size;
+	size_t copy;
+
+	while (len > 0) {
+		copy = MIN(len, frag_need);
+		if ((frag_len + copy) > sizeof(frag_buf)) {
+			agps_cloud_data_reset();
+			return -EBADMSG;
+		}
+
+		memcpy(&frag_buf[frag_len], buf, copy);
+		frag_len += copy;
+		frag_need -= copy;
+		buf += copy;
+		len -= copy;
+
+		if (frag_need > 0) {
+			/* Wait for the next fragment */
+			return 0;
+		}
+
+		switch (frag_state) {
+		case FRAG_STATE_VERSION:
+			if (frag_buf[0] != NRF_CLOUD_AGPS_BIN_SCHEMA_VERSION) {
+				LOG_ERR("Cannot parse schema version: %d",
+					frag_buf[0]);
+				agps_cloud_data_reset();
+				return -EBADMSG;
+			}
+			frag_state = FRAG_STATE_HEADER;
+			frag_need = FRAG_HDR_SIZE;
+			break;
+		case FRAG_STATE_HEADER:
+		case FRAG_STATE_TOW_HEADER:
+			frag_type = (enum nrf_cloud_agps_type)
+				frag_buf[frag_len - FRAG_HDR_SIZE];
+			memcpy(&count,
+			       &frag_buf[frag_len - NRF_CLOUD_AGPS_BIN_COUNT_SIZE],
+			       sizeof(count));
+			element_size = frag_element_size(frag_type);
+			if ((element_size == 0) || (count == 0)) {
+				LOG_ERR("Cannot parse A-GPS data type: %d",
+					frag_type);
+				agps_cloud_data_reset();
+				return -EBADMSG;
+			}
+
+			if ((frag_state == FRAG_STATE_HEADER) &&
+			    (frag_type == NRF_CLOUD_AGPS_GPS_TOWS)) {
+				/* Gather the whole TOW array, it is held
+				 * back until the system clock element that
+				 * follows it is complete.
+				 */
+				frag_need = count * element_size;
+				frag_elements_left = 0;
+			} else {
+				frag_need = element_size;
+				frag_elements_left = count - 1;
+			}
+			frag_state = FRAG_STATE_ELEMENT;
+			break;
+		case FRAG_STATE_ELEMENT:
+			if (frag_type == NRF_CLOUD_AGPS_GPS_TOWS) {
+				frag_state = FRAG_STATE_TOW_HEADER;
+				frag_need = FRAG_HDR_SIZE;
+				break;
+			}
+
+			err = frag_flush();
+			if (err) {
+				LOG_ERR("A-GPS failed, error: %d", err);
+				agps_cloud_data_reset();
+				return err;
+			}
+
+			if (frag_elements_left > 0) {
+				frag_elements_left--;
+				frag_need = frag_element_size(frag_type);
+			} else {
+				frag_state = FRAG_STATE_HEADER;
+				frag_need = FRAG_HDR_SIZE;
+			}
+			break;
+		}
+	}
+
+	return 0;
+#else /* CONFIG_AGPS_FRAGMENT_PROCESSING */
+	ARG_UNUSED(buf);
+	ARG_UNUSED(len);
+
+	LOG_WRN("Fragment processing of A-GPS data is not enabled");
+	return -EOPNOTSUPP;
+#endif
+}
+
 int agps_cloud_data_process(const uint8_t *buf, size_t len)
 {
 	int err = 0;
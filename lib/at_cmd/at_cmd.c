@@ -68,6 +68,12 @@ K_MUTEX_DEFINE(current_cmd_mutex);
 /* Queue for queued command metadata */
 K_MSGQ_DEFINE(commands, sizeof(struct cmd_item), CONFIG_AT_CMD_QUEUE_LEN, 4);
 
+#if defined(CONFIG_AT_CMD_PRIORITY_QUEUE)
+/* Queue for priority commands, drained before the normal queue */
+K_MSGQ_DEFINE(commands_prio, sizeof(struct cmd_item),
+	      CONFIG_AT_CMD_PRIORITY_QUEUE_LEN, 4);
+#endif
+
 /* Message queue to return the result in the case of a synchronous call */
 K_MSGQ_DEFINE(response_sync, sizeof(struct resp_item), 1, 4);
 K_MUTEX_DEFINE(response_sync_get);
@@ -201,11 +207,23 @@ static void load_cmd_and_write(void)
 	do {
 		ret = 0;
 
-		/* Do not load a new command if already loaded or none queued */
-		if (current_cmd.cmd != NULL ||
+		/* Do not load a new command if already loaded */
+		if (current_cmd.cmd != NULL) {
+			break;
+		}
+
+#if defined(CONFIG_AT_CMD_PRIORITY_QUEUE)
+		/* Stop if no command is queued */
+		if (k_msgq_get(&commands_prio, &current_cmd, K_NO_WAIT) != 0 &&
 		    k_msgq_get(&commands, &current_cmd, K_NO_WAIT) != 0) {
 			break;
 		}
+#else
+		/* Stop if no command is queued */
+		if (k_msgq_get(&commands, &current_cmd, K_NO_WAIT) != 0) {
+			break;
+		}
+#endif
 
 		ret = at_write(current_cmd.cmd);
 
@@ -339,8 +357,9 @@ next:
 	}
 }
 
-int at_cmd_write_with_callback(const char *const cmd,
-			       at_cmd_handler_t  handler)
+static int write_with_callback_to_queue(struct k_msgq *queue,
+					const char *const cmd,
+					at_cmd_handler_t handler)
 {
 	struct cmd_item command;
 	int ret;
@@ -369,7 +388,7 @@ int at_cmd_write_with_callback(const char *const cmd,
 	command.callback = handler;
 	command.flags = AT_CMD_BUF_CMD;
 
-	ret = k_msgq_put(&commands, &command, K_FOREVER);
+	ret = k_msgq_put(queue, &command, K_FOREVER);
 	if (ret) {
 		return ret;
 	}
@@ -378,10 +397,17 @@ int at_cmd_write_with_callback(const char *const cmd,
 	return 0;
 }
 
-int at_cmd_write(const char *const cmd,
-		 char *buf,
-		 size_t buf_len,
-		 enum at_cmd_state *state)
+int at_cmd_write_with_callback(const char *const cmd,
+			       at_cmd_handler_t  handler)
+{
+	return write_with_callback_to_queue(&commands, cmd, handler);
+}
+
+static int write_to_queue(struct k_msgq *queue,
+			  const char *const cmd,
+			  char *buf,
+			  size_t buf_len,
+			  enum at_cmd_state *state)
 {
 	struct cmd_item command;
 	struct resp_item ret;
@@ -420,7 +446,7 @@ int at_cmd_write(const char *const cmd,
 	k_mutex_lock(&response_sync_get, K_FOREVER);
 
 	/* We borrow the return code field from the currently unused response */
-	ret.code = k_msgq_put(&commands, &command, K_FOREVER);
+	ret.code = k_msgq_put(queue, &command, K_FOREVER);
 	if (ret.code) {
 		LOG_ERR("Could not enqueue cmd, error %d", ret.code);
 		if (state) {
@@ -442,6 +468,30 @@ int at_cmd_write(const char *const cmd,
 	return ret.code;
 }
 
+int at_cmd_write(const char *const cmd,
+		 char *buf,
+		 size_t buf_len,
+		 enum at_cmd_state *state)
+{
+	return write_to_queue(&commands, cmd, buf, buf_len, state);
+}
+
+#if defined(CONFIG_AT_CMD_PRIORITY_QUEUE)
+int at_cmd_write_with_callback_prio(const char *const cmd,
+				    at_cmd_handler_t handler)
+{
+	return write_with_callback_to_queue(&commands_prio, cmd, handler);
+}
+
+int at_cmd_write_prio(const char *const cmd,
+		      char *buf,
+		      size_t buf_len,
+		      enum at_cmd_state *state)
+{
+	return write_to_queue(&commands_prio, cmd, buf, buf_len, state);
+}
+#endif /* CONFIG_AT_CMD_PRIORITY_QUEUE */
+
 void at_cmd_set_notification_handler(at_cmd_handler_t handler)
 {
 	LOG_DBG("Setting notification handler to %p", handler);
@@ -432,3 +432,234 @@ enum at_cmd_type at_parser_cmd_type_get(const char *at_cmd)
 
 	return type;
 }
+
+/* Internal function. Classify an unquoted span as number or string. */
+static enum at_param_type at_span_classify(const char *str, size_t len)
+{
+	if (!is_number(str[0])) {
+		return AT_PARAM_TYPE_STRING;
+	}
+
+	if ((len == 1) && !isdigit((int)str[0])) {
+		/* A lone sign character is not a number. */
+		return AT_PARAM_TYPE_STRING;
+	}
+
+	for (size_t i = 1; i < len; ++i) {
+		if (!isdigit((int)str[i])) {
+			return AT_PARAM_TYPE_STRING;
+		}
+	}
+
+	return AT_PARAM_TYPE_NUM_INT;
+}
+
+int at_parser_spans_from_str(const char *at_params_str,
+			     const char **next_param_str,
+			     struct at_span *spans, size_t max_spans)
+{
+	const char *str = at_params_str;
+	const char *start;
+	size_t count = 0;
+
+	if ((at_params_str == NULL) || (spans == NULL) || (max_spans == 0)) {
+		return -EINVAL;
+	}
+
+	while (is_lfcr(*str)) {
+		str++;
+	}
+
+	/* Notification identifier, if any. */
+	if (is_notification(*str)) {
+		start = str++;
+
+		while (is_valid_notification_char(*str)) {
+			str++;
+		}
+
+		spans[count].str = start;
+		spans[count].len = str - start;
+		spans[count].type = AT_PARAM_TYPE_STRING;
+		count++;
+
+		if (*str == AT_RSP_SEPARATOR) {
+			str++;
+		}
+	}
+
+	while (*str == ' ') {
+		str++;
+	}
+
+	while (!is_terminated(*str) && !is_lfcr(*str)) {
+		if (count == max_spans) {
+			return -E2BIG;
+		}
+
+		if (is_dblquote(*str)) {
+			start = ++str;
+
+			while (!is_dblquote(*str) && !is_terminated(*str)) {
+				str++;
+			}
+
+			spans[count].str = start;
+			spans[count].len = str - start;
+			spans[count].type = AT_PARAM_TYPE_STRING;
+
+			if (is_dblquote(*str)) {
+				str++;
+			}
+		} else if (*str == AT_PARAM_SEPARATOR) {
+			spans[count].str = str;
+			spans[count].len = 0;
+			spans[count].type = AT_PARAM_TYPE_EMPTY;
+		} else {
+			start = str;
+
+			while ((*str != AT_PARAM_SEPARATOR) &&
+			       !is_lfcr(*str) && !is_terminated(*str)) {
+				str++;
+			}
+
+			spans[count].str = start;
+			spans[count].len = str - start;
+
+			/* Trim trailing spaces. */
+			while ((spans[count].len > 0) &&
+			       (start[spans[count].len - 1] == ' ')) {
+				spans[count].len--;
+			}
+
+			spans[count].type =
+				at_span_classify(start, spans[count].len);
+		}
+		count++;
+
+		while (*str == ' ') {
+			str++;
+		}
+
+		if (*str != AT_PARAM_SEPARATOR) {
+			break;
+		}
+
+		str++;
+
+		while (*str == ' ') {
+			str++;
+		}
+
+		/* A separator followed by the end of the line is a trailing
+		 * empty parameter.
+		 */
+		if (is_terminated(*str) || is_lfcr(*str)) {
+			if (count == max_spans) {
+				return -E2BIG;
+			}
+
+			spans[count].str = str;
+			spans[count].len = 0;
+			spans[count].type = AT_PARAM_TYPE_EMPTY;
+			count++;
+			break;
+		}
+	}
+
+	while (is_lfcr(*str)) {
+		str++;
+	}
+
+	if (next_param_str != NULL) {
+		*next_param_str = is_terminated(*str) ? NULL : str;
+	}
+
+	return count;
+}
+
+int at_span_int64_get(const struct at_span *span, int64_t *value)
+{
+	uint64_t num = 0;
+	bool negative = false;
+	size_t i = 0;
+
+	if ((span == NULL) || (span->str == NULL) || (value == NULL)) {
+		return -EINVAL;
+	}
+
+	if (span->len == 0) {
+		return -EINVAL;
+	}
+
+	if ((span->str[0] == '-') || (span->str[0] == '+')) {
+		negative = (span->str[0] == '-');
+		i = 1;
+
+		if (span->len == 1) {
+			return -EINVAL;
+		}
+	}
+
+	for (; i < span->len; ++i) {
+		char chr = span->str[i];
+
+		if (!isdigit((int)chr)) {
+			return -EINVAL;
+		}
+
+		if (num > ((UINT64_MAX - 9) / 10)) {
+			return -EINVAL;
+		}
+
+		num = (num * 10) + (chr - '0');
+	}
+
+	if (num > (uint64_t)INT64_MAX) {
+		return -EINVAL;
+	}
+
+	*value = negative ? -(int64_t)num : (int64_t)num;
+
+	return 0;
+}
+
+int at_span_int_get(const struct at_span *span, int32_t *value)
+{
+	int64_t num;
+	int err;
+
+	if (value == NULL) {
+		return -EINVAL;
+	}
+
+	err = at_span_int64_get(span, &num);
+	if (err) {
+		return err;
+	}
+
+	if ((num > INT32_MAX) || (num < INT32_MIN)) {
+		return -EINVAL;
+	}
+
+	*value = (int32_t)num;
+
+	return 0;
+}
+
+int at_span_string_get(const struct at_span *span, char *value, size_t *len)
+{
+	if ((span == NULL) || (span->str == NULL) || (value == NULL) ||
+	    (len == NULL)) {
+		return -EINVAL;
+	}
+
+	if (*len < span->len) {
+		return -ENOMEM;
+	}
+
+	memcpy(value, span->str, span->len);
+	*len = span->len;
+
+	return 0;
+}
@@ -11,6 +11,7 @@
 #include <drivers/uart.h>
 #include <string.h>
 #include <init.h>
+#include <sys/ring_buffer.h>
 #include <modem/at_cmd.h>
 #include <modem/at_notif.h>
 
@@ -60,6 +61,21 @@ static char at_buf[AT_BUF_SIZE]; /* AT command and modem response buffer */
 static struct k_work_q at_host_work_q;
 static struct k_work cmd_send_work;
 
+#if defined(CONFIG_AT_HOST_CMD_PIPELINE)
+/* With command pipelining, UART reception continues while a command is
+ * processed. Received commands are accumulated in a separate line buffer
+ * and queued in a ring buffer, each prefixed with its length, so at_buf
+ * can be used for the command in progress and its response.
+ */
+static char rx_line_buf[CONFIG_AT_HOST_CMD_MAX_LEN];
+static char *const rx_buf = rx_line_buf;
+RING_BUF_DECLARE(cmd_ring, CONFIG_AT_HOST_CMD_PIPELINE_BUF_SIZE);
+#define RX_BUF_SIZE sizeof(rx_line_buf)
+#else
+static char *const rx_buf = at_buf;
+#define RX_BUF_SIZE sizeof(at_buf)
+#endif
+
 
 
 static inline void write_uart_string(const char *str)
@@ -78,14 +94,12 @@ static void response_handler(void *context, const char *response)
 	write_uart_string(response);
 }
 
-static void cmd_send(struct k_work *work)
+static void cmd_execute(void)
 {
 	char              str[25];
 	enum at_cmd_state state;
 	int               err;
 
-	ARG_UNUSED(work);
-
 	err = at_cmd_write(at_buf, at_buf,
 			   sizeof(at_buf), &state);
 	if (err < 0) {
@@ -113,9 +127,53 @@ static void cmd_send(struct k_work *work)
 	default:
 		break;
 	}
+}
+
+static void cmd_send(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+#if defined(CONFIG_AT_HOST_CMD_PIPELINE)
+	uint16_t len;
+
+	/* Drain all queued commands. Commands execute one at a time, so
+	 * responses are emitted in the order the commands were received.
+	 */
+	while (ring_buf_get(&cmd_ring, (uint8_t *)&len, sizeof(len)) ==
+	       sizeof(len)) {
+		uint32_t read = ring_buf_get(&cmd_ring, (uint8_t *)at_buf, len);
+
+		__ASSERT_NO_MSG(read == len);
+		ARG_UNUSED(read);
+
+		cmd_execute();
+	}
+#else
+	cmd_execute();
 	at_buf_busy = false;
 	uart_irq_rx_enable(uart_dev);
+#endif
+}
+
+#if defined(CONFIG_AT_HOST_CMD_PIPELINE)
+static void cmd_enqueue(void)
+{
+	uint16_t len = strlen(rx_buf) + 1; /* Include null terminator */
+
+	/* The length prefix and command must be inserted back-to-back,
+	 * so check for space up front.
+	 */
+	if (ring_buf_space_get(&cmd_ring) < (sizeof(len) + len)) {
+		LOG_ERR("Command queue full, dropping command");
+		return;
+	}
+
+	ring_buf_put(&cmd_ring, (uint8_t *)&len, sizeof(len));
+	ring_buf_put(&cmd_ring, (uint8_t *)rx_buf, len);
+
+	k_work_submit_to_queue(&at_host_work_q, &cmd_send_work);
 }
+#endif
 
 static void uart_rx_handler(uint8_t character)
 {
@@ -153,7 +211,7 @@ static void uart_rx_handler(uint8_t character)
 			}
 			if (term_mode == MODE_CR_LF &&
 			    at_cmd_len > 0 &&
-			    at_buf[at_cmd_len - 1] == '\r') {
+			    rx_buf[at_cmd_len - 1] == '\r') {
 				goto send;
 			}
 			break;
@@ -161,13 +219,13 @@ static void uart_rx_handler(uint8_t character)
 	}
 
 	/* Detect AT command buffer overflow, leaving space for null */
-	if (at_cmd_len + 1 > sizeof(at_buf) - 1) {
+	if (at_cmd_len + 1 > RX_BUF_SIZE - 1) {
 		LOG_ERR("Buffer overflow, dropping '%c'\n", character);
 		return;
 	}
 
 	/* Write character to AT buffer */
-	at_buf[at_cmd_len] = character;
+	rx_buf[at_cmd_len] = character;
 	at_cmd_len++;
 
 	/* Handle special written character */
@@ -177,14 +235,14 @@ static void uart_rx_handler(uint8_t character)
 
 	return;
 send:
-	at_buf[at_cmd_len] = '\0'; /* Terminate the command string */
+	rx_buf[at_cmd_len] = '\0'; /* Terminate the command string */
 
 	/* Reset UART handler state */
 	inside_quotes = false;
 	at_cmd_len = 0;
 
 	/* Check for the presence of one printable non-whitespace character */
-	for (const char *c = at_buf;; c++) {
+	for (const char *c = rx_buf;; c++) {
 		if (*c > ' ') {
 			break;
 		} else if (*c == '\0') {
@@ -193,10 +251,15 @@ send:
 	}
 
 	/* Send the command, if there is one to send */
-	if (at_buf[0]) {
+	if (rx_buf[0]) {
+#if defined(CONFIG_AT_HOST_CMD_PIPELINE)
+		/* UART reception continues while the command is processed. */
+		cmd_enqueue();
+#else
 		uart_irq_rx_disable(uart_dev); /* Stop UART to protect at_buf */
 		at_buf_busy = true;
 		k_work_submit_to_queue(&at_host_work_q, &cmd_send_work);
+#endif
 	}
 }
 
@@ -21,6 +21,9 @@ struct notif_handler {
 	sys_snode_t        node;
 	void               *ctx;
 	at_notif_handler_t handler;
+	/* Notification prefix the handler subscribes to, NULL for all. */
+	const char         *prefix;
+	size_t             prefix_len;
 };
 
 static sys_slist_t handler_list;
@@ -47,15 +50,20 @@ static struct notif_handler *find_node(struct notif_handler **prev_out,
 }
 
 /**@brief Add the handler in the notification list if not already present. */
-static int append_notif_handler(void *ctx, at_notif_handler_t handler)
+static int append_notif_handler(void *ctx, at_notif_handler_t handler,
+				const char *prefix)
 {
 	struct notif_handler *to_ins;
+	struct notif_handler *curr;
 
 	k_mutex_lock(&list_mtx, K_FOREVER);
 
 	/* Check if handler is already registered. */
-	if (find_node(&to_ins, ctx, handler) != NULL) {
-		LOG_DBG("Handler already registered. Nothing to do");
+	curr = find_node(&to_ins, ctx, handler);
+	if (curr != NULL) {
+		LOG_DBG("Handler already registered. Updating filter");
+		curr->prefix = prefix;
+		curr->prefix_len = prefix ? strlen(prefix) : 0;
 		k_mutex_unlock(&list_mtx);
 		return 0;
 	}
@@ -69,6 +77,8 @@ static int append_notif_handler(void *ctx, at_notif_handler_t handler)
 	memset(to_ins, 0, sizeof(struct notif_handler));
 	to_ins->ctx     = ctx;
 	to_ins->handler = handler;
+	to_ins->prefix  = prefix;
+	to_ins->prefix_len = prefix ? strlen(prefix) : 0;
 
 	/* Insert handler in the list. */
 	sys_slist_append(&handler_list, &to_ins->node);
@@ -103,12 +113,27 @@ static int remove_notif_handler(void *ctx, at_notif_handler_t handler)
 static void notif_dispatch(const char *response)
 {
 	struct notif_handler *curr, *tmp;
+	const char *notif = response;
+
+	/* Skip leading line shifts once, so that the prefix filters are
+	 * matched against the notification identifier itself.
+	 */
+	while (*notif == '\r' || *notif == '\n') {
+		notif++;
+	}
 
 	k_mutex_lock(&list_mtx, K_FOREVER);
 
-	/* Dispatch notifications to all registered handlers */
+	/* Dispatch notifications to the registered handlers whose prefix
+	 * filter, if any, matches.
+	 */
 	LOG_DBG("Dispatching events:");
 	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&handler_list, curr, tmp, node) {
+		if (curr->prefix != NULL &&
+		    (curr->prefix[0] != notif[0] ||
+		     strncmp(curr->prefix, notif, curr->prefix_len) != 0)) {
+			continue;
+		}
 		LOG_DBG(" - ctx=0x%08X, handler=0x%08X", (uint32_t)curr->ctx,
 			(uint32_t)curr->handler);
 		curr->handler(curr->ctx, response);
@@ -151,7 +176,23 @@ int at_notif_register_handler(void *context, at_notif_handler_t handler)
 			(uint32_t)context, (uint32_t)handler);
 		return -EINVAL;
 	}
-	return append_notif_handler(context, handler);
+	return append_notif_handler(context, handler, NULL);
+}
+
+int at_notif_register_handler_filtered(void *context,
+				       at_notif_handler_t handler,
+				       const char *prefix)
+{
+	if (!initialized) {
+		LOG_ERR("Module not initialized yet");
+		return -EINVAL;
+	}
+	if (handler == NULL || prefix == NULL || prefix[0] == '\0') {
+		LOG_ERR("Invalid handler (context=0x%08X, handler=0x%08X)",
+			(uint32_t)context, (uint32_t)handler);
+		return -EINVAL;
+	}
+	return append_notif_handler(context, handler, prefix);
 }
 
 int at_notif_deregister_handler(void *context, at_notif_handler_t handler)
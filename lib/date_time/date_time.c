@@ -73,11 +73,40 @@ static struct time_aux {
 	int64_t last_date_time_update;
 } time_aux;
 
+/**
+ * @brief Offset between uptime and UTC time, in milliseconds.
+ *
+ * @details Derived from time_aux whenever it is updated. Kept as a single
+ * value so that time conversions can take a consistent snapshot with
+ * interrupts locked for a couple of instructions, instead of reading the
+ * two time_aux fields while an update may be modifying them.
+ */
+static int64_t date_time_offset_ms;
+
 static bool initial_valid_time;
 static date_time_evt_handler_t app_evt_handler;
 
 static struct date_time_evt evt;
 
+static void date_time_offset_update(void)
+{
+	unsigned int key = irq_lock();
+
+	date_time_offset_ms =
+		time_aux.date_time_utc - time_aux.last_date_time_update;
+	irq_unlock(key);
+}
+
+static int64_t date_time_offset_get(void)
+{
+	unsigned int key = irq_lock();
+	int64_t offset = date_time_offset_ms;
+
+	irq_unlock(key);
+
+	return offset;
+}
+
 static void date_time_notify_event(const struct date_time_evt *evt)
 {
 	__ASSERT(evt != NULL, "Library event not found");
@@ -136,6 +165,7 @@ static int time_modem_get(void)
 
 	time_aux.date_time_utc = (int64_t)timeutil_timegm64(&date_time) * 1000;
 	time_aux.last_date_time_update = k_uptime_get();
+	date_time_offset_update();
 
 	return 0;
 }
@@ -246,6 +276,7 @@ static int time_NTP_server_get(void)
 			log_strdup(servers[i].server_str));
 		time_aux.date_time_utc = (int64_t)sntp_time.seconds * 1000;
 		time_aux.last_date_time_update = k_uptime_get();
+		date_time_offset_update();
 		return 0;
 	}
 
@@ -414,9 +445,10 @@ int date_time_set(const struct tm *new_date_time)
 		return err;
 	}
 
-	initial_valid_time = true;
 	time_aux.last_date_time_update = k_uptime_get();
 	time_aux.date_time_utc = (int64_t)timeutil_timegm64(new_date_time) * 1000;
+	date_time_offset_update();
+	initial_valid_time = true;
 
 	evt.type = DATE_TIME_OBTAINED_EXT;
 	date_time_notify_event(&evt);
@@ -427,6 +459,7 @@ int date_time_set(const struct tm *new_date_time)
 int date_time_uptime_to_unix_time_ms(int64_t *uptime)
 {
 	int64_t uptime_prev;
+	int64_t offset;
 
 	if (uptime == NULL) {
 		LOG_ERR("The passed in pointer cannot be NULL");
@@ -440,14 +473,15 @@ int date_time_uptime_to_unix_time_ms(int64_t *uptime)
 		return -ENODATA;
 	}
 
-	*uptime += time_aux.date_time_utc - time_aux.last_date_time_update;
+	offset = date_time_offset_get();
+
+	*uptime += offset;
 
 	/** Check if the passed in uptime was allready converted,
 	 * meaning that after a second conversion it is greater than the
 	 * current date time UTC.
 	 */
-	if (*uptime > time_aux.date_time_utc +
-	    (k_uptime_get() - time_aux.last_date_time_update)) {
+	if (*uptime > k_uptime_get() + offset) {
 		LOG_WRN("Uptime to large or previously converted");
 		LOG_WRN("Clear variable or set a new uptime");
 		*uptime = uptime_prev;
@@ -459,25 +493,19 @@ int date_time_uptime_to_unix_time_ms(int64_t *uptime)
 
 int date_time_now(int64_t *unix_time_ms)
 {
-	int err;
-	int64_t unix_time_ms_prev;
-
 	if (unix_time_ms == NULL) {
 		LOG_ERR("The passed in pointer cannot be NULL");
 		return -EINVAL;
 	}
 
-	unix_time_ms_prev = *unix_time_ms;
-
-	*unix_time_ms = k_uptime_get();
-
-	err = date_time_uptime_to_unix_time_ms(unix_time_ms);
-	if (err) {
-		LOG_WRN("date_time_uptime_to_unix_time_ms, error: %d", err);
-		*unix_time_ms = unix_time_ms_prev;
+	if (!initial_valid_time) {
+		LOG_WRN("Valid time not currently available");
+		return -ENODATA;
 	}
 
-	return err;
+	*unix_time_ms = k_uptime_get() + date_time_offset_get();
+
+	return 0;
 }
 
 bool date_time_is_valid(void)
@@ -516,9 +544,10 @@ int date_time_update_async(date_time_evt_handler_t evt_handler)
 
 int date_time_clear(void)
 {
+	initial_valid_time = false;
 	time_aux.date_time_utc = 0;
 	time_aux.last_date_time_update = 0;
-	initial_valid_time = false;
+	date_time_offset_update();
 
 	return 0;
 }
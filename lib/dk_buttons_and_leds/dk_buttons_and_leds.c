@@ -88,6 +88,15 @@ static int callback_ctrl(bool enable)
 			flags = (IS_ENABLED(CONFIG_DK_LIBRARY_INVERT_BUTTONS) ?
 				(GPIO_INT_LEVEL_LOW) : (GPIO_INT_LEVEL_HIGH));
 
+			if (IS_ENABLED(CONFIG_DK_LIBRARY_BUTTON_NO_HOLD_POLLING) &&
+			    (atomic_get(&my_buttons) & BIT(i))) {
+				/* Held buttons wake up on the release level
+				 * instead of being polled.
+				 */
+				flags = (IS_ENABLED(CONFIG_DK_LIBRARY_INVERT_BUTTONS) ?
+					(GPIO_INT_LEVEL_HIGH) : (GPIO_INT_LEVEL_LOW));
+			}
+
 			err = gpio_pin_interrupt_configure(button_devs[i],
 				button_pins[i].number, flags);
 		} else {
@@ -155,9 +164,19 @@ static void buttons_scan_fn(struct k_work *work)
 		initial_run = false;
 	}
 
+	bool keep_scanning = (button_scan != 0);
+
+	if (IS_ENABLED(CONFIG_DK_LIBRARY_BUTTON_NO_HOLD_POLLING)) {
+		/* Held buttons are waited on with a level interrupt of the
+		 * opposite polarity, so scanning only needs to continue
+		 * until the reading has settled.
+		 */
+		keep_scanning = (button_scan != last_button_scan);
+	}
+
 	last_button_scan = button_scan;
 
-	if (button_scan != 0) {
+	if (keep_scanning) {
 		k_work_reschedule(&buttons_scan,
 		  K_MSEC(CONFIG_DK_LIBRARY_BUTTON_SCAN_INTERVAL));
 
@@ -7,6 +7,9 @@
 #include <assert.h>
 #include <ei_run_classifier.h>
 #include <ei_wrapper.h>
+#if defined(CONFIG_EI_WRAPPER_PREPROCESS)
+#include <arm_math.h>
+#endif
 
 #include <logging/log.h>
 LOG_MODULE_REGISTER(ei_wrapper, CONFIG_EI_WRAPPER_LOG_LEVEL);
@@ -35,6 +38,10 @@ struct data_buffer {
 	size_t process_idx;
 	size_t append_idx;
 	size_t wait_data_size;
+#if defined(CONFIG_EI_WRAPPER_PREDICTION_PIPELINE)
+	size_t pending_shift;
+	bool pending;
+#endif
 	struct k_spinlock lock;
 	enum state state;
 };
@@ -73,13 +80,44 @@ static size_t buf_calc_free_space(const struct data_buffer *b)
 	return ARRAY_SIZE(b->buf) - buf_get_collected_data_count(b) - 1;
 }
 
-static void buf_processing_end(struct data_buffer *b)
+static void buf_processing_move_locked(struct data_buffer *b, size_t move,
+				       bool *process_buf)
 {
+	b->state = STATE_WAITING_FOR_DATA;
+
+	size_t max_move = buf_get_collected_data_count(b);
+
+	b->process_idx += move;
+	if (b->process_idx >= ARRAY_SIZE(b->buf)) {
+		b->process_idx -= ARRAY_SIZE(b->buf);
+	}
+
+	size_t processing_end_move = move + INPUT_WINDOW_SIZE;
+
+	if (processing_end_move > max_move) {
+		b->wait_data_size = processing_end_move - max_move;
+	} else {
+		b->state = STATE_PROCESSING;
+		*process_buf = true;
+	}
+}
+
+static void buf_processing_end(struct data_buffer *b, bool *process_buf)
+{
+	*process_buf = false;
+
 	k_spinlock_key_t key = k_spin_lock(&b->lock);
 
 	__ASSERT_NO_MSG(b->state == STATE_PROCESSING);
 	b->state = STATE_READY;
 
+#if defined(CONFIG_EI_WRAPPER_PREDICTION_PIPELINE)
+	if (b->pending) {
+		b->pending = false;
+		buf_processing_move_locked(b, b->pending_shift, process_buf);
+	}
+#endif
+
 	k_spin_unlock(&b->lock, key);
 }
 
@@ -100,6 +138,9 @@ static int buf_cleanup(struct data_buffer *b, bool *cancelled)
 		b->process_idx = 0;
 		b->append_idx = 0;
 		b->wait_data_size = 0;
+#if defined(CONFIG_EI_WRAPPER_PREDICTION_PIPELINE)
+		b->pending = false;
+#endif
 		b->state = STATE_READY;
 	}
 
@@ -190,29 +231,19 @@ static int buf_processing_move(struct data_buffer *b, size_t move,
 	k_spinlock_key_t key = k_spin_lock(&b->lock);
 
 	if (b->state == STATE_READY) {
-		b->state = STATE_WAITING_FOR_DATA;
+		buf_processing_move_locked(b, move, process_buf);
+#if defined(CONFIG_EI_WRAPPER_PREDICTION_PIPELINE)
+	} else if ((b->state == STATE_PROCESSING) && !b->pending) {
+		/* Queue the shift, applied when the ongoing prediction ends */
+		b->pending_shift = move;
+		b->pending = true;
+#endif
 	} else {
 		__ASSERT_NO_MSG(b->state != STATE_DISABLED);
 		k_spin_unlock(&b->lock, key);
 		return -EBUSY;
 	}
 
-	size_t max_move = buf_get_collected_data_count(b);
-
-	b->process_idx += move;
-	if (b->process_idx >= ARRAY_SIZE(b->buf)) {
-		b->process_idx -= ARRAY_SIZE(b->buf);
-	}
-
-	size_t processing_end_move = move + INPUT_WINDOW_SIZE;
-
-	if (processing_end_move > max_move) {
-		b->wait_data_size = processing_end_move - max_move;
-	} else {
-		b->state = STATE_PROCESSING;
-		*process_buf = true;
-	}
-
 	k_spin_unlock(&b->lock, key);
 
 	return 0;
@@ -233,12 +264,102 @@ size_t ei_wrapper_get_window_size(void)
 	return INPUT_WINDOW_SIZE;
 }
 
+#if defined(CONFIG_EI_WRAPPER_PREPROCESS)
+/* Frames per preprocessing chunk, sized for effective vectorization. */
+#define PREPROCESS_CHUNK_FRAMES	MAX(1, 64 / INPUT_FRAME_SIZE)
+
+static float preprocess_scale = 1.0f;
+static float preprocess_offset;
+static size_t preprocess_decimation = 1;
+static size_t preprocess_frame_cnt;
+
+int ei_wrapper_set_preprocessing(float scale, float offset, size_t decimation)
+{
+	if (decimation == 0) {
+		return -EINVAL;
+	}
+
+	preprocess_scale = scale;
+	preprocess_offset = offset;
+	preprocess_decimation = decimation;
+	preprocess_frame_cnt = 0;
+
+	return 0;
+}
+
+static int preprocess_chunk_append(float *chunk, size_t len, bool *process_buf)
+{
+	bool process;
+	int err;
+
+	arm_scale_f32(chunk, preprocess_scale, chunk, len);
+	arm_offset_f32(chunk, preprocess_offset, chunk, len);
+
+	err = buf_append(&ei_input, chunk, len, &process);
+	if (!err && process) {
+		*process_buf = true;
+	}
+
+	return err;
+}
+
+static int add_data_preprocessed(const float *data, size_t data_size)
+{
+	float chunk[PREPROCESS_CHUNK_FRAMES * INPUT_FRAME_SIZE];
+	size_t chunk_len = 0;
+	bool process_buf = false;
+	int err = 0;
+
+	for (size_t i = 0; i < data_size; i += INPUT_FRAME_SIZE) {
+		preprocess_frame_cnt++;
+		if (preprocess_frame_cnt < preprocess_decimation) {
+			continue;
+		}
+		preprocess_frame_cnt = 0;
+
+		memcpy(&chunk[chunk_len], &data[i],
+		       INPUT_FRAME_SIZE * sizeof(chunk[0]));
+		chunk_len += INPUT_FRAME_SIZE;
+
+		if (chunk_len == ARRAY_SIZE(chunk)) {
+			err = preprocess_chunk_append(chunk, chunk_len, &process_buf);
+			if (err) {
+				break;
+			}
+			chunk_len = 0;
+		}
+	}
+
+	if (!err && (chunk_len > 0)) {
+		err = preprocess_chunk_append(chunk, chunk_len, &process_buf);
+	}
+
+	if (!err && process_buf) {
+		k_sem_give(&ei_sem);
+	}
+
+	return err;
+}
+#else
+int ei_wrapper_set_preprocessing(float scale, float offset, size_t decimation)
+{
+	ARG_UNUSED(scale);
+	ARG_UNUSED(offset);
+	ARG_UNUSED(decimation);
+
+	return -ENOSYS;
+}
+#endif /* CONFIG_EI_WRAPPER_PREPROCESS */
+
 int ei_wrapper_add_data(const float *data, size_t data_size)
 {
 	if (data_size % INPUT_FRAME_SIZE) {
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_EI_WRAPPER_PREPROCESS)
+	return add_data_preprocessed(data, data_size);
+#else
 	bool process_buf;
 	int err = buf_append(&ei_input, data, data_size, &process_buf);
 
@@ -247,6 +368,7 @@ int ei_wrapper_add_data(const float *data, size_t data_size)
 	}
 
 	return err;
+#endif
 }
 
 int ei_wrapper_clear_data(bool *cancelled)
@@ -278,10 +400,16 @@ static int raw_feature_get_data(size_t offset, size_t length, float *out_ptr)
 
 static void processing_finished(int err)
 {
+	bool process_buf;
+
 	__ASSERT_NO_MSG(user_cb);
 
-	buf_processing_end(&ei_input);
+	buf_processing_end(&ei_input, &process_buf);
 	user_cb(err);
+
+	if (process_buf) {
+		k_sem_give(&ei_sem);
+	}
 }
 
 static void edge_impulse_thread_fn(void)
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <crash_journal.h>
+
+#define CRASH_JOURNAL_MAGIC 0x4352414a /* "CRAJ" */
+
+struct crash_journal {
+	uint32_t magic;
+	struct crash_journal_record record;
+};
+
+/* Kept in noinit RAM so the record survives the reset triggered by the
+ * fatal error handler. Garbage after a power cycle is filtered out by
+ * the magic word.
+ */
+static __noinit struct crash_journal journal;
+
+void crash_journal_capture(unsigned int reason, const void *esf)
+{
+	struct crash_journal_record *rec = &journal.record;
+	const char *name;
+
+	/* Raw copies only - no formatting or logging in fault context. */
+	rec->reason = reason;
+	rec->uptime = (uint32_t)k_uptime_get();
+
+	if (esf != NULL) {
+		/* The basic exception stack frame starts with r0-r3, r12,
+		 * lr, pc and xpsr, in that order.
+		 */
+		memcpy(rec->regs, esf, sizeof(rec->regs));
+
+		/* The frame sits at the top of the faulting stack, so a
+		 * copy starting at the frame captures the top of that
+		 * stack, including the frame itself. Clamp the copy to the
+		 * stack end so it cannot run into the guard region and
+		 * fault again inside the fatal error handler.
+		 */
+		rec->stack_words = 0;
+#if defined(CONFIG_THREAD_STACK_INFO)
+		{
+			struct k_thread *thread = k_current_get();
+			uintptr_t stack_end = thread->stack_info.start +
+					      thread->stack_info.size;
+			uintptr_t frame = (uintptr_t)esf;
+
+			if ((frame >= thread->stack_info.start) &&
+			    (frame < stack_end)) {
+				size_t avail = MIN(stack_end - frame,
+						   sizeof(rec->stack));
+
+				memcpy(rec->stack, esf, avail);
+				rec->stack_words = avail / sizeof(uint32_t);
+			}
+		}
+#endif
+	} else {
+		memset(rec->regs, 0, sizeof(rec->regs));
+		rec->stack_words = 0;
+	}
+
+	rec->thread_name[0] = '\0';
+	name = k_thread_name_get(k_current_get());
+	if (name != NULL) {
+		strncpy(rec->thread_name, name, sizeof(rec->thread_name) - 1);
+		rec->thread_name[sizeof(rec->thread_name) - 1] = '\0';
+	}
+
+	journal.magic = CRASH_JOURNAL_MAGIC;
+}
+
+bool crash_journal_present(void)
+{
+	return journal.magic == CRASH_JOURNAL_MAGIC;
+}
+
+int crash_journal_get(struct crash_journal_record *record)
+{
+	if (!crash_journal_present()) {
+		return -ENOENT;
+	}
+
+	*record = journal.record;
+
+	return 0;
+}
+
+void crash_journal_clear(void)
+{
+	journal.magic = 0;
+}
@@ -9,6 +9,10 @@
 #include <logging/log.h>
 #include <fatal.h>
 
+#if defined(CONFIG_CRASH_JOURNAL)
+#include <crash_journal.h>
+#endif
+
 #if defined(CONFIG_IS_SPM) && \
 	defined(CONFIG_SPM_SERVICE_NS_HANDLER_FROM_SPM_FAULT)
 #include <secure_services.h>
@@ -26,6 +30,10 @@ void k_sys_fatal_error_handler(unsigned int reason,
 
 	LOG_PANIC();
 
+#if defined(CONFIG_CRASH_JOURNAL)
+	crash_journal_capture(reason, esf);
+#endif
+
 #if defined(CONFIG_IS_SPM) && \
 	defined(CONFIG_SPM_SERVICE_NS_HANDLER_FROM_SPM_FAULT)
 	z_spm_ns_fatal_error_handler();
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <drivers/flash.h>
+#include <logging/log.h>
+#include <flash_read_cache.h>
+
+LOG_MODULE_REGISTER(flash_read_cache, CONFIG_FLASH_READ_CACHE_LOG_LEVEL);
+
+#define TAG_EMPTY ((off_t)-1)
+
+static uint8_t *line_buf(struct flash_read_cache *cache, size_t idx)
+{
+	return &cache->buf[idx * cache->line_size];
+}
+
+static int line_lookup(struct flash_read_cache *cache, off_t tag)
+{
+	for (size_t i = 0; i < cache->line_cnt; i++) {
+		if (cache->lines[i].tag == tag) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static int victim_pick(struct flash_read_cache *cache)
+{
+	int victim = -1;
+	uint32_t oldest = UINT32_MAX;
+
+	for (size_t i = 0; i < cache->line_cnt; i++) {
+		if (cache->lines[i].pinned) {
+			continue;
+		}
+		if (cache->lines[i].tag == TAG_EMPTY) {
+			return i;
+		}
+		if (cache->lines[i].stamp <= oldest) {
+			oldest = cache->lines[i].stamp;
+			victim = i;
+		}
+	}
+	return victim;
+}
+
+/* Get the index of the line holding tag, filling a victim line on a miss.
+ * Returns negative errno when no line can be filled.
+ */
+static int line_get(struct flash_read_cache *cache, off_t tag)
+{
+	int idx = line_lookup(cache, tag);
+	int err;
+
+	if (idx < 0) {
+		idx = victim_pick(cache);
+		if (idx < 0) {
+			return -ENOSPC;
+		}
+
+		err = flash_read(cache->fdev, tag, line_buf(cache, idx),
+				 cache->line_size);
+		if (err != 0) {
+			cache->lines[idx].tag = TAG_EMPTY;
+			return err;
+		}
+		cache->lines[idx].tag = tag;
+		cache->lines[idx].stale = false;
+	} else if (cache->lines[idx].stale) {
+		err = flash_read(cache->fdev, tag, line_buf(cache, idx),
+				 cache->line_size);
+		if (err != 0) {
+			/* Keep the line stale; the fetch is retried on the
+			 * next use.
+			 */
+			return err;
+		}
+		cache->lines[idx].stale = false;
+	}
+
+	cache->lines[idx].stamp = ++cache->stamp;
+	return idx;
+}
+
+int flash_read_cache_init(struct flash_read_cache *cache,
+			  const struct device *fdev, uint8_t *buf,
+			  size_t buf_size, size_t line_size)
+{
+	if ((cache == NULL) || (fdev == NULL) || (buf == NULL) ||
+	    (line_size == 0) || (buf_size < line_size)) {
+		return -EINVAL;
+	}
+
+	cache->fdev = fdev;
+	cache->buf = buf;
+	cache->line_size = line_size;
+	cache->line_cnt = MIN(buf_size / line_size,
+			      (size_t)CONFIG_FLASH_READ_CACHE_MAX_LINES);
+	cache->next_seq = TAG_EMPTY;
+	cache->stamp = 0;
+
+	for (size_t i = 0; i < cache->line_cnt; i++) {
+		cache->lines[i].tag = TAG_EMPTY;
+		cache->lines[i].pinned = false;
+		cache->lines[i].stale = false;
+	}
+
+	k_mutex_init(&cache->lock);
+
+	return 0;
+}
+
+int flash_read_cache_read(struct flash_read_cache *cache, off_t offset,
+			  void *data, size_t len)
+{
+	uint8_t *dst = data;
+	bool sequential;
+	int err = 0;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	sequential = (offset == cache->next_seq);
+	cache->next_seq = offset + len;
+
+	while (len > 0) {
+		off_t tag = ROUND_DOWN(offset, cache->line_size);
+		size_t line_off = offset - tag;
+		size_t chunk = MIN(len, cache->line_size - line_off);
+		int idx = line_get(cache, tag);
+
+		if (idx < 0) {
+			err = idx;
+			break;
+		}
+
+		memcpy(dst, line_buf(cache, idx) + line_off, chunk);
+		dst += chunk;
+		offset += chunk;
+		len -= chunk;
+	}
+
+	/* Prefetch the line following a sequential stream, so the next
+	 * read is served from RAM. A failed prefetch is not an error;
+	 * the line is fetched again on demand.
+	 */
+	if ((err == 0) && sequential &&
+	    (line_lookup(cache, ROUND_DOWN(cache->next_seq,
+					   cache->line_size)) < 0)) {
+		(void)line_get(cache, ROUND_DOWN(cache->next_seq,
+						 cache->line_size));
+	}
+
+	k_mutex_unlock(&cache->lock);
+
+	return err;
+}
+
+int flash_read_cache_pin(struct flash_read_cache *cache, off_t offset,
+			 size_t len)
+{
+	off_t tag = ROUND_DOWN(offset, cache->line_size);
+	off_t end = offset + len;
+	size_t pinned = 0;
+	int err = 0;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	for (size_t i = 0; i < cache->line_cnt; i++) {
+		if (cache->lines[i].pinned) {
+			pinned++;
+		}
+	}
+
+	for (; tag < end; tag += cache->line_size) {
+		int idx;
+
+		/* Keep at least one unpinned line for regular reads. */
+		if ((pinned + 1) >= cache->line_cnt) {
+			err = -ENOSPC;
+			break;
+		}
+
+		idx = line_get(cache, tag);
+		if (idx < 0) {
+			err = idx;
+			break;
+		}
+
+		if (!cache->lines[idx].pinned) {
+			cache->lines[idx].pinned = true;
+			pinned++;
+		}
+	}
+
+	k_mutex_unlock(&cache->lock);
+
+	return err;
+}
+
+void flash_read_cache_unpin(struct flash_read_cache *cache, off_t offset,
+			    size_t len)
+{
+	off_t tag = ROUND_DOWN(offset, cache->line_size);
+	off_t end = offset + len;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	for (; tag < end; tag += cache->line_size) {
+		int idx = line_lookup(cache, tag);
+
+		if (idx >= 0) {
+			cache->lines[idx].pinned = false;
+		}
+	}
+
+	k_mutex_unlock(&cache->lock);
+}
+
+void flash_read_cache_invalidate(struct flash_read_cache *cache)
+{
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	for (size_t i = 0; i < cache->line_cnt; i++) {
+		/* Pinned lines keep their tag so they can still be found
+		 * by unpin, and are refetched on the next use.
+		 */
+		if (cache->lines[i].pinned) {
+			cache->lines[i].stale = true;
+		} else {
+			cache->lines[i].tag = TAG_EMPTY;
+		}
+	}
+	cache->next_seq = TAG_EMPTY;
+
+	k_mutex_unlock(&cache->lock);
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr.h>
+#include <drivers/flash.h>
+#include <logging/log.h>
+#include <flash_scheduler.h>
+
+LOG_MODULE_REGISTER(flash_scheduler, CONFIG_FLASH_SCHEDULER_LOG_LEVEL);
+
+/* Maximum number of erase jobs merged into one erase operation. */
+#define ERASE_BATCH_MAX 8
+
+static sys_slist_t job_queue = SYS_SLIST_STATIC_INIT(&job_queue);
+static K_MUTEX_DEFINE(queue_lock);
+static K_SEM_DEFINE(job_sem, 0, K_SEM_MAX_LIMIT);
+
+static void job_complete(struct flash_scheduler_job *job, int result)
+{
+	if (result) {
+		LOG_ERR("Flash %s at 0x%lx failed: %d",
+			(job->data == NULL) ? "erase" : "write",
+			(long)job->offset, result);
+	}
+
+	if (job->cb) {
+		job->cb(job, result);
+	}
+}
+
+static struct flash_scheduler_job *job_pop_earliest(void)
+{
+	struct flash_scheduler_job *job = NULL;
+	struct flash_scheduler_job *it;
+
+	k_mutex_lock(&queue_lock, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&job_queue, it, node) {
+		if ((job == NULL) || (it->deadline < job->deadline)) {
+			job = it;
+		}
+	}
+
+	if (job) {
+		(void)sys_slist_find_and_remove(&job_queue, &job->node);
+	}
+
+	k_mutex_unlock(&queue_lock);
+
+	return job;
+}
+
+/* Remove a queued erase job on the given device that is contiguous with
+ * or overlaps the range, or NULL if there is none.
+ */
+static struct flash_scheduler_job *erase_neighbor_pop(
+					const struct device *fdev,
+					off_t start, off_t end)
+{
+	struct flash_scheduler_job *it;
+	struct flash_scheduler_job *found = NULL;
+
+	k_mutex_lock(&queue_lock, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&job_queue, it, node) {
+		if ((it->fdev == fdev) && (it->data == NULL) &&
+		    (it->offset <= end) &&
+		    ((it->offset + (off_t)it->len) >= start)) {
+			found = it;
+			break;
+		}
+	}
+
+	if (found) {
+		(void)sys_slist_find_and_remove(&job_queue, &found->node);
+	}
+
+	k_mutex_unlock(&queue_lock);
+
+	return found;
+}
+
+static void erase_batch_execute(struct flash_scheduler_job *job)
+{
+	struct flash_scheduler_job *batch[ERASE_BATCH_MAX];
+	size_t batch_cnt = 0;
+	off_t start = job->offset;
+	off_t end = job->offset + job->len;
+	int err;
+
+	batch[batch_cnt++] = job;
+
+	/* Collect queued erases adjacent to the accumulated range, so that
+	 * one erase operation covers them all.
+	 */
+	while (batch_cnt < ERASE_BATCH_MAX) {
+		struct flash_scheduler_job *neighbor =
+			erase_neighbor_pop(job->fdev, start, end);
+
+		if (neighbor == NULL) {
+			break;
+		}
+
+		start = MIN(start, neighbor->offset);
+		end = MAX(end, neighbor->offset + (off_t)neighbor->len);
+		batch[batch_cnt++] = neighbor;
+	}
+
+	err = flash_erase(job->fdev, start, end - start);
+
+	for (size_t i = 0; i < batch_cnt; i++) {
+		job_complete(batch[i], err);
+	}
+}
+
+static void flash_scheduler_thread_fn(void)
+{
+	struct flash_scheduler_job *job;
+
+	while (true) {
+		k_sem_take(&job_sem, K_FOREVER);
+
+		job = job_pop_earliest();
+		if (job == NULL) {
+			continue;
+		}
+
+		if (job->data == NULL) {
+			erase_batch_execute(job);
+		} else {
+			job_complete(job, flash_write(job->fdev, job->offset,
+						      job->data, job->len));
+		}
+	}
+}
+
+int flash_scheduler_submit(struct flash_scheduler_job *job,
+			   int32_t deadline_ms)
+{
+	if ((job == NULL) || (job->fdev == NULL) || (job->len == 0)) {
+		return -EINVAL;
+	}
+
+	job->deadline = k_uptime_get() + deadline_ms;
+
+	k_mutex_lock(&queue_lock, K_FOREVER);
+	sys_slist_append(&job_queue, &job->node);
+	k_mutex_unlock(&queue_lock);
+
+	k_sem_give(&job_sem);
+
+	return 0;
+}
+
+K_THREAD_DEFINE(flash_scheduler_thread,
+		CONFIG_FLASH_SCHEDULER_THREAD_STACK_SIZE,
+		flash_scheduler_thread_fn, NULL, NULL, NULL,
+		CONFIG_FLASH_SCHEDULER_THREAD_PRIO, 0, 0);
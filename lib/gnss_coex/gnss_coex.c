@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <logging/log.h>
+#include <modem/lte_lc.h>
+#include <modem/gnss_coex.h>
+
+LOG_MODULE_REGISTER(gnss_coex, CONFIG_GNSS_COEX_LOG_LEVEL);
+
+static struct gnss_coex_config config;
+static bool initialized;
+
+/* All state below is only touched from the configured work queue, with
+ * the exception of the statistics, which are guarded by stats_lock.
+ */
+static bool gnss_allowed = true;
+static bool lte_active;
+static bool in_window;
+
+static struct k_spinlock stats_lock;
+static struct gnss_coex_stats stats;
+static int64_t last_transition;
+static int64_t window_start;
+
+static struct k_work suspend_work;
+static struct k_work_delayable resume_work;
+static struct k_work_delayable window_work;
+
+static struct k_work_q *queue(void)
+{
+	return config.work_q != NULL ? config.work_q : &k_sys_work_q;
+}
+
+static void submit(struct k_work *work)
+{
+	k_work_submit_to_queue(queue(), work);
+}
+
+static void account_transition(bool allowed)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+	int64_t now = k_uptime_get();
+
+	if (gnss_allowed) {
+		stats.gnss_time_ms += now - last_transition;
+	} else {
+		stats.suspended_time_ms += now - last_transition;
+	}
+
+	if (!allowed) {
+		stats.suspend_count++;
+	}
+
+	last_transition = now;
+	k_spin_unlock(&stats_lock, key);
+
+	gnss_allowed = allowed;
+}
+
+static void suspend_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	if (!gnss_allowed || in_window) {
+		return;
+	}
+
+	account_transition(false);
+	LOG_DBG("Suspending GNSS, LTE is active");
+
+	if (config.gnss_suspend != NULL) {
+		config.gnss_suspend();
+	}
+}
+
+static void resume_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	if (gnss_allowed || lte_active) {
+		return;
+	}
+
+	account_transition(true);
+	LOG_DBG("Resuming GNSS");
+
+	if (config.gnss_resume != NULL) {
+		config.gnss_resume();
+	}
+}
+
+static void window_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+	k_spinlock_key_t key;
+
+	if (!in_window) {
+		in_window = true;
+		window_start = k_uptime_get();
+
+		/* GNSS has priority inside the window, resume it even
+		 * if LTE is active.
+		 */
+		if (!gnss_allowed) {
+			account_transition(true);
+			LOG_DBG("Resuming GNSS, priority window opened");
+
+			if (config.gnss_resume != NULL) {
+				config.gnss_resume();
+			}
+		}
+
+		k_work_reschedule_for_queue(
+			queue(), &window_work,
+			K_SECONDS(config.window_length_sec));
+	} else {
+		in_window = false;
+
+		key = k_spin_lock(&stats_lock);
+		stats.window_time_ms += k_uptime_get() - window_start;
+		k_spin_unlock(&stats_lock, key);
+
+		if (lte_active) {
+			submit(&suspend_work);
+		}
+
+		k_work_reschedule_for_queue(
+			queue(), &window_work,
+			K_SECONDS(config.window_period_sec -
+				  config.window_length_sec));
+	}
+}
+
+static void lte_handler(const struct lte_lc_evt *const evt)
+{
+	if (evt->type != LTE_LC_EVT_RRC_UPDATE) {
+		return;
+	}
+
+	if (evt->rrc_mode == LTE_LC_RRC_MODE_CONNECTED) {
+		lte_active = true;
+		k_work_cancel_delayable(&resume_work);
+		submit(&suspend_work);
+	} else {
+		lte_active = false;
+		k_work_reschedule_for_queue(
+			queue(), &resume_work,
+			K_SECONDS(config.resume_delay_sec));
+	}
+}
+
+int gnss_coex_init(const struct gnss_coex_config *cfg)
+{
+	if (cfg == NULL) {
+		return -EINVAL;
+	}
+
+	if (cfg->window_period_sec != 0 &&
+	    cfg->window_length_sec >= cfg->window_period_sec) {
+		return -EINVAL;
+	}
+
+	if (initialized) {
+		return -EALREADY;
+	}
+
+	config = *cfg;
+
+	k_work_init(&suspend_work, suspend_fn);
+	k_work_init_delayable(&resume_work, resume_fn);
+	k_work_init_delayable(&window_work, window_fn);
+
+	last_transition = k_uptime_get();
+
+	lte_lc_register_handler(lte_handler);
+
+	if (config.window_period_sec != 0) {
+		k_work_reschedule_for_queue(
+			queue(), &window_work,
+			K_SECONDS(config.window_period_sec -
+				  config.window_length_sec));
+	}
+
+	initialized = true;
+
+	return 0;
+}
+
+bool gnss_coex_gnss_allowed(void)
+{
+	return gnss_allowed;
+}
+
+int gnss_coex_stats_get(struct gnss_coex_stats *out)
+{
+	k_spinlock_key_t key;
+	int64_t now;
+
+	if (out == NULL) {
+		return -EINVAL;
+	}
+
+	if (!initialized) {
+		return -EACCES;
+	}
+
+	key = k_spin_lock(&stats_lock);
+	now = k_uptime_get();
+
+	*out = stats;
+
+	/* Include the time accumulated in the current state. */
+	if (gnss_allowed) {
+		out->gnss_time_ms += now - last_transition;
+	} else {
+		out->suspended_time_ms += now - last_transition;
+	}
+
+	if (in_window) {
+		out->window_time_ms += now - window_start;
+	}
+
+	k_spin_unlock(&stats_lock, key);
+
+	return 0;
+}
+
+void gnss_coex_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	memset(&stats, 0, sizeof(stats));
+	last_transition = k_uptime_get();
+	window_start = last_transition;
+
+	k_spin_unlock(&stats_lock, key);
+}
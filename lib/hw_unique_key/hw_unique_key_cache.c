@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr.h>
+#include <hw_unique_key.h>
+
+struct cache_entry {
+	bool in_use;
+	enum hw_unique_key_slot kmu_slot;
+	uint8_t label[CONFIG_HW_UNIQUE_KEY_CACHE_INFO_MAX_SIZE];
+	uint8_t context[CONFIG_HW_UNIQUE_KEY_CACHE_INFO_MAX_SIZE];
+	size_t label_size;
+	size_t context_size;
+	uint8_t key[CONFIG_HW_UNIQUE_KEY_CACHE_KEY_MAX_SIZE];
+	uint32_t key_size;
+	/* Tick of the last lookup that returned this entry, for LRU
+	 * eviction.
+	 */
+	uint32_t last_use;
+};
+
+static struct cache_entry entries[CONFIG_HW_UNIQUE_KEY_CACHE_ENTRIES];
+static uint32_t use_tick;
+static struct hw_unique_key_cache_stats stats;
+static K_MUTEX_DEFINE(cache_lock);
+
+static void entry_zeroize(struct cache_entry *entry)
+{
+	volatile uint8_t *key = entry->key;
+
+	for (size_t i = 0; i < sizeof(entry->key); i++) {
+		key[i] = 0;
+	}
+
+	memset(entry, 0, sizeof(*entry));
+}
+
+static bool entry_matches(const struct cache_entry *entry,
+			  enum hw_unique_key_slot kmu_slot,
+			  const uint8_t *context, size_t context_size,
+			  const uint8_t *label, size_t label_size,
+			  uint32_t output_size)
+{
+	return entry->in_use &&
+	       entry->kmu_slot == kmu_slot &&
+	       entry->key_size == output_size &&
+	       entry->label_size == label_size &&
+	       entry->context_size == context_size &&
+	       memcmp(entry->label, label, label_size) == 0 &&
+	       memcmp(entry->context, context, context_size) == 0;
+}
+
+static struct cache_entry *entry_alloc(void)
+{
+	struct cache_entry *victim = &entries[0];
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		if (!entries[i].in_use) {
+			return &entries[i];
+		}
+
+		if (entries[i].last_use < victim->last_use) {
+			victim = &entries[i];
+		}
+	}
+
+	stats.evictions++;
+	entry_zeroize(victim);
+
+	return victim;
+}
+
+int hw_unique_key_derive_key_cached(enum hw_unique_key_slot kmu_slot,
+	const uint8_t *context, size_t context_size,
+	uint8_t const *label, size_t label_size,
+	uint8_t *output, uint32_t output_size)
+{
+	struct cache_entry *entry;
+	int err;
+
+	/* Requests that do not fit in an entry are passed through. */
+	if (label_size > CONFIG_HW_UNIQUE_KEY_CACHE_INFO_MAX_SIZE ||
+	    context_size > CONFIG_HW_UNIQUE_KEY_CACHE_INFO_MAX_SIZE ||
+	    output_size > CONFIG_HW_UNIQUE_KEY_CACHE_KEY_MAX_SIZE) {
+		return hw_unique_key_derive_key(kmu_slot, context,
+						context_size, label,
+						label_size, output,
+						output_size);
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		if (entry_matches(&entries[i], kmu_slot, context,
+				  context_size, label, label_size,
+				  output_size)) {
+			entries[i].last_use = ++use_tick;
+			stats.hits++;
+			memcpy(output, entries[i].key, output_size);
+			k_mutex_unlock(&cache_lock);
+			return 0;
+		}
+	}
+
+	err = hw_unique_key_derive_key(kmu_slot, context, context_size,
+				       label, label_size, output,
+				       output_size);
+	if (err != 0) {
+		k_mutex_unlock(&cache_lock);
+		return err;
+	}
+
+	entry = entry_alloc();
+
+	entry->in_use = true;
+	entry->kmu_slot = kmu_slot;
+	memcpy(entry->label, label, label_size);
+	memcpy(entry->context, context, context_size);
+	entry->label_size = label_size;
+	entry->context_size = context_size;
+	memcpy(entry->key, output, output_size);
+	entry->key_size = output_size;
+	entry->last_use = ++use_tick;
+	stats.derivations++;
+
+	k_mutex_unlock(&cache_lock);
+
+	return 0;
+}
+
+void hw_unique_key_cache_flush(void)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		entry_zeroize(&entries[i]);
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+void hw_unique_key_cache_stats_get(struct hw_unique_key_cache_stats *out)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	*out = stats;
+	k_mutex_unlock(&cache_lock);
+}
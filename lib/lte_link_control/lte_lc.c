@@ -97,6 +97,42 @@ static const char rai_disable[] = "AT+%XRAI=0";
 /* Default RAI setting */
 static char rai_param[2] = CONFIG_LTE_RAI_REQ_VALUE;
 
+#if defined(CONFIG_LTE_NEIGHBOR_CELL_MEAS_CACHE)
+/* Result of the most recent neighbor cell measurement, so that periodic
+ * readers can be served without starting a new measurement.
+ */
+static struct lte_lc_cells_info ncellmeas_cache;
+static struct lte_lc_ncell ncellmeas_cache_neighbors[CONFIG_LTE_NEIGHBOR_CELLS_MAX];
+static int64_t ncellmeas_cache_uptime = -1;
+static K_MUTEX_DEFINE(ncellmeas_cache_mutex);
+
+static void ncellmeas_cache_update(const struct lte_lc_cells_info *cells)
+{
+	uint8_t count = MIN(cells->ncells_count,
+			    ARRAY_SIZE(ncellmeas_cache_neighbors));
+
+	k_mutex_lock(&ncellmeas_cache_mutex, K_FOREVER);
+
+	ncellmeas_cache = *cells;
+	ncellmeas_cache.neighbor_cells = ncellmeas_cache_neighbors;
+	ncellmeas_cache.ncells_count = count;
+
+	if (count > 0) {
+		memcpy(ncellmeas_cache_neighbors, cells->neighbor_cells,
+		       count * sizeof(struct lte_lc_ncell));
+	}
+
+	ncellmeas_cache_uptime = k_uptime_get();
+
+	k_mutex_unlock(&ncellmeas_cache_mutex);
+}
+#else
+static void ncellmeas_cache_update(const struct lte_lc_cells_info *cells)
+{
+	ARG_UNUSED(cells);
+}
+#endif /* CONFIG_LTE_NEIGHBOR_CELL_MEAS_CACHE */
+
 static const enum lte_lc_system_mode sys_mode_preferred = SYS_MODE_PREFERRED;
 
 /* System mode to use when connecting to LTE network, which can be changed in
@@ -392,7 +428,8 @@ static void at_handler(void *context, const char *response)
 		LOG_DBG("%%NCELLMEAS notification");
 		LOG_DBG("Neighbor cell count: %d", ncell_count);
 
-		if (!evt_handler) {
+		if (!evt_handler &&
+		    !IS_ENABLED(CONFIG_LTE_NEIGHBOR_CELL_MEAS_CACHE)) {
 			/* No need to parse the response if there is no handler
 			 * to receive the parsed data.
 			 */
@@ -419,8 +456,11 @@ static void at_handler(void *context, const char *response)
 			/* Fall through */
 		case 0: /* Fall through */
 		case 1:
-			evt.type = LTE_LC_EVT_NEIGHBOR_CELL_MEAS;
-			evt_handler(&evt);
+			ncellmeas_cache_update(&evt.cells_info);
+			if (evt_handler) {
+				evt.type = LTE_LC_EVT_NEIGHBOR_CELL_MEAS;
+				evt_handler(&evt);
+			}
 			break;
 		default:
 			LOG_ERR("Parsing of neighbour cells failed, err: %d", err);
@@ -1493,6 +1533,47 @@ int lte_lc_neighbor_cell_measurement_cancel(void)
 	return at_cmd_write(AT_NCELLMEAS_STOP, NULL, 0, NULL);
 }
 
+int lte_lc_neighbor_cell_data_get(struct lte_lc_cells_info *cells_info,
+				  struct lte_lc_ncell *neighbor_cells,
+				  uint8_t max_cells, uint64_t *age_ms)
+{
+#if defined(CONFIG_LTE_NEIGHBOR_CELL_MEAS_CACHE)
+	if ((cells_info == NULL) || (neighbor_cells == NULL)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&ncellmeas_cache_mutex, K_FOREVER);
+
+	if (ncellmeas_cache_uptime < 0) {
+		k_mutex_unlock(&ncellmeas_cache_mutex);
+		return -ENODATA;
+	}
+
+	*cells_info = ncellmeas_cache;
+	cells_info->neighbor_cells = neighbor_cells;
+	cells_info->ncells_count = MIN(ncellmeas_cache.ncells_count,
+				       max_cells);
+
+	memcpy(neighbor_cells, ncellmeas_cache_neighbors,
+	       cells_info->ncells_count * sizeof(struct lte_lc_ncell));
+
+	if (age_ms != NULL) {
+		*age_ms = k_uptime_get() - ncellmeas_cache_uptime;
+	}
+
+	k_mutex_unlock(&ncellmeas_cache_mutex);
+
+	return 0;
+#else
+	ARG_UNUSED(cells_info);
+	ARG_UNUSED(neighbor_cells);
+	ARG_UNUSED(max_cells);
+	ARG_UNUSED(age_ms);
+
+	return -ENOTSUP;
+#endif
+}
+
 int lte_lc_conn_eval_params_get(struct lte_lc_conn_eval_params *params)
 {
 	int err;
@@ -453,6 +453,62 @@ cleanup:
 	return err;
 }
 
+#if defined(CONFIG_MODEM_ATTEST_TOKEN_CACHE)
+/* The device and modem firmware UUIDs embedded in the attestation data
+ * are stable for the lifetime of a boot, so they are cached after the
+ * first successful parse. The token itself is not cached: each token
+ * carries a modem-generated nonce and must stay fresh.
+ */
+static struct {
+	bool valid;
+	struct nrf_device_uuid dev;
+	struct nrf_modem_fw_uuid mfw;
+} uuid_cache;
+
+static K_MUTEX_DEFINE(uuid_cache_lock);
+
+void modem_attest_token_cache_invalidate(void)
+{
+	k_mutex_lock(&uuid_cache_lock, K_FOREVER);
+	uuid_cache.valid = false;
+	k_mutex_unlock(&uuid_cache_lock);
+}
+
+static bool uuid_cache_get(struct nrf_device_uuid *dev,
+			   struct nrf_modem_fw_uuid *mfw)
+{
+	bool hit = false;
+
+	k_mutex_lock(&uuid_cache_lock, K_FOREVER);
+
+	if (uuid_cache.valid) {
+		if (dev) {
+			memcpy(dev->str, uuid_cache.dev.str, sizeof(dev->str));
+		}
+		if (mfw) {
+			memcpy(mfw->str, uuid_cache.mfw.str, sizeof(mfw->str));
+		}
+		hit = true;
+	}
+
+	k_mutex_unlock(&uuid_cache_lock);
+
+	return hit;
+}
+
+static void uuid_cache_put(const struct nrf_device_uuid *const dev,
+			   const struct nrf_modem_fw_uuid *const mfw)
+{
+	k_mutex_lock(&uuid_cache_lock, K_FOREVER);
+
+	memcpy(uuid_cache.dev.str, dev->str, sizeof(uuid_cache.dev.str));
+	memcpy(uuid_cache.mfw.str, mfw->str, sizeof(uuid_cache.mfw.str));
+	uuid_cache.valid = true;
+
+	k_mutex_unlock(&uuid_cache_lock);
+}
+#endif /* CONFIG_MODEM_ATTEST_TOKEN_CACHE */
+
 static int format_uuid(const char * const bytes_in, const size_t bytes_sz,
 		       char * const str_out, const size_t str_sz)
 {
@@ -491,6 +547,15 @@ int modem_attest_token_get_uuids(struct nrf_device_uuid *dev,
 	struct nrf_attestation_token a_tok;
 	struct nrf_attestation_data a_data;
 
+#if defined(CONFIG_MODEM_ATTEST_TOKEN_CACHE)
+	struct nrf_device_uuid dev_local;
+	struct nrf_modem_fw_uuid mfw_local;
+
+	if (uuid_cache_get(dev, mfw)) {
+		return 0;
+	}
+#endif
+
 	memset(&a_tok, 0, sizeof(a_tok));
 	err = modem_attest_token_get(&a_tok);
 	if (err) {
@@ -503,6 +568,31 @@ int modem_attest_token_get_uuids(struct nrf_device_uuid *dev,
 		goto cleanup;
 	}
 
+#if defined(CONFIG_MODEM_ATTEST_TOKEN_CACHE)
+	/* Format both UUIDs so the cache entry is complete regardless of
+	 * which ones the caller asked for.
+	 */
+	err = format_uuid(a_data.device_uuid, sizeof(a_data.device_uuid),
+			  dev_local.str, sizeof(dev_local.str));
+	if (err) {
+		goto cleanup;
+	}
+
+	err = format_uuid(a_data.fw_uuid, sizeof(a_data.fw_uuid),
+			  mfw_local.str, sizeof(mfw_local.str));
+	if (err) {
+		goto cleanup;
+	}
+
+	uuid_cache_put(&dev_local, &mfw_local);
+
+	if (dev) {
+		memcpy(dev->str, dev_local.str, sizeof(dev->str));
+	}
+	if (mfw) {
+		memcpy(mfw->str, mfw_local.str, sizeof(mfw->str));
+	}
+#else
 	if (dev) {
 		err = format_uuid(a_data.device_uuid, sizeof(a_data.device_uuid),
 				  dev->str, sizeof(dev->str));
@@ -518,6 +608,7 @@ int modem_attest_token_get_uuids(struct nrf_device_uuid *dev,
 			goto cleanup;
 		}
 	}
+#endif
 
 cleanup:
 	modem_attest_token_free(&a_tok);
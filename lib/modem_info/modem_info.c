@@ -343,6 +343,66 @@ static const struct modem_info_data *const modem_data[] = {
 static rsrp_cb_t modem_info_rsrp_cb;
 static struct at_param_list m_param_list;
 
+static uint16_t rsrp_cache_value;
+static bool rsrp_cache_valid;
+
+#if defined(CONFIG_MODEM_INFO_QUERY_CACHE)
+/* Cache of the last AT response, so that parameters that are read from
+ * the same command, such as AT+CEREG? or AT%XSYSTEMMODE?, do not each
+ * cost a modem round trip during a refresh.
+ */
+static char query_cache_buf[CONFIG_MODEM_INFO_BUFFER_SIZE];
+static const char *query_cache_cmd;
+static int64_t query_cache_uptime;
+
+static bool query_cache_get(const char *cmd, char *buf, size_t buf_size)
+{
+	if (query_cache_cmd != cmd ||
+	    (k_uptime_get() - query_cache_uptime) >
+		    CONFIG_MODEM_INFO_QUERY_CACHE_AGE_MS) {
+		return false;
+	}
+
+	strncpy(buf, query_cache_buf, buf_size);
+
+	return true;
+}
+
+static void query_cache_put(const char *cmd, const char *buf)
+{
+	strncpy(query_cache_buf, buf, sizeof(query_cache_buf));
+	query_cache_buf[sizeof(query_cache_buf) - 1] = '\0';
+	query_cache_cmd = cmd;
+	query_cache_uptime = k_uptime_get();
+}
+#endif /* CONFIG_MODEM_INFO_QUERY_CACHE */
+
+/**@brief Issue the AT command for an information type, using the response
+ *        cache when enabled.
+ */
+static int modem_info_query(const struct modem_info_data *modem_data,
+			    char *buf, size_t buf_size)
+{
+	int err;
+
+#if defined(CONFIG_MODEM_INFO_QUERY_CACHE)
+	if (query_cache_get(modem_data->cmd, buf, buf_size)) {
+		return 0;
+	}
+#endif
+
+	err = at_cmd_write(modem_data->cmd, buf, buf_size, NULL);
+	if (err != 0) {
+		return -EIO;
+	}
+
+#if defined(CONFIG_MODEM_INFO_QUERY_CACHE)
+	query_cache_put(modem_data->cmd, buf);
+#endif
+
+	return 0;
+}
+
 static bool is_cesq_notification(const char *buf, size_t len)
 {
 	return strstr(buf, AT_CMD_CESQ_RESP) ? true : false;
@@ -431,13 +491,10 @@ int modem_info_short_get(enum modem_info info, uint16_t *buf)
 		return -EINVAL;
 	}
 
-	err = at_cmd_write(modem_data[info]->cmd,
-			   recv_buf,
-			   CONFIG_MODEM_INFO_BUFFER_SIZE,
-			   NULL);
-
+	err = modem_info_query(modem_data[info], recv_buf,
+			       CONFIG_MODEM_INFO_BUFFER_SIZE);
 	if (err != 0) {
-		return -EIO;
+		return err;
 	}
 
 	err = modem_info_parse(modem_data[info], &recv_buf[cmd_length]);
@@ -588,12 +645,10 @@ int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size
 
 	buf[0] = '\0';
 
-	err = at_cmd_write(modem_data[info]->cmd,
-			  recv_buf,
-			  CONFIG_MODEM_INFO_BUFFER_SIZE,
-			  NULL);
+	err = modem_info_query(modem_data[info], recv_buf,
+			       CONFIG_MODEM_INFO_BUFFER_SIZE);
 	if (err != 0) {
-		return -EIO;
+		return err;
 	}
 
 	/* modem_info does not yet support array objects, so here we handle
@@ -710,15 +765,33 @@ static void modem_info_rsrp_subscribe_handler(void *context, const char *respons
 		return;
 	}
 
+	rsrp_cache_value = param_value;
+	rsrp_cache_valid = true;
+
 	modem_info_rsrp_cb(param_value);
 }
 
+int modem_info_rsrp_get(uint16_t *value)
+{
+	if (value == NULL) {
+		return -EINVAL;
+	}
+
+	if (!rsrp_cache_valid) {
+		return -ENODATA;
+	}
+
+	*value = rsrp_cache_value;
+
+	return 0;
+}
+
 int modem_info_rsrp_register(rsrp_cb_t cb)
 {
 	modem_info_rsrp_cb = cb;
 
-	int rc = at_notif_register_handler(NULL,
-		modem_info_rsrp_subscribe_handler);
+	int rc = at_notif_register_handler_filtered(NULL,
+		modem_info_rsrp_subscribe_handler, AT_CMD_CESQ_RESP);
 	if (rc != 0) {
 		LOG_ERR("Can't register handler rc=%d", rc);
 		return rc;
@@ -191,3 +191,47 @@ int modem_info_params_get(struct modem_param_info *modem)
 
 	return 0;
 }
+
+#if defined(CONFIG_MODEM_INFO_PARAMS_ASYNC)
+static struct modem_param_info *async_modem;
+static modem_info_params_ready_cb_t async_cb;
+
+static void params_get_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	struct modem_param_info *modem = async_modem;
+	modem_info_params_ready_cb_t cb = async_cb;
+	int ret;
+
+	ret = modem_info_params_get(modem);
+
+	/* Release the request before the callback, so that a new refresh
+	 * can be started from the callback itself.
+	 */
+	async_modem = NULL;
+
+	cb(modem, ret);
+}
+
+static K_WORK_DEFINE(params_get_work, params_get_work_fn);
+
+int modem_info_params_get_async(struct modem_param_info *modem,
+				modem_info_params_ready_cb_t cb)
+{
+	if (modem == NULL || cb == NULL) {
+		return -EINVAL;
+	}
+
+	if (async_modem != NULL) {
+		return -EBUSY;
+	}
+
+	async_modem = modem;
+	async_cb = cb;
+
+	k_work_submit(&params_get_work);
+
+	return 0;
+}
+#endif /* CONFIG_MODEM_INFO_PARAMS_ASYNC */
@@ -85,18 +85,11 @@ static void base64_url_format(char *const base64_string)
 	}
 }
 
-int modem_jwt_generate(struct jwt_data *const jwt)
+static int jwt_fetch(const struct jwt_data *const jwt, char *const cmd_resp)
 {
-	if (!jwt) {
-		return -EINVAL;
-	} else if ((jwt->jwt_buf) && (jwt->jwt_sz == 0)) {
-		return -EMSGSIZE;
-	}
-
-	int ret = 0;
+	int ret;
 	enum at_cmd_state state;
 	char *cmd;
-	char *cmd_resp = NULL;
 	size_t cmd_sz = sizeof(JWT_CMD_TEMPLATE_SEC_TAG) + JWT_CMD_PRINT_INT_SZ +
 			(jwt->subject ? strlen(jwt->subject) : 0) +
 			(jwt->audience ? strlen(jwt->audience) : 0);
@@ -133,13 +126,6 @@ int modem_jwt_generate(struct jwt_data *const jwt)
 		goto cleanup;
 	}
 
-	/* Allocate response buffer and send cmd */
-	cmd_resp = k_calloc(CONFIG_MODEM_JWT_MAX_LEN, 1);
-	if (!cmd_resp) {
-		ret = -ENOMEM;
-		goto cleanup;
-	}
-
 	ret = at_cmd_write(cmd, cmd_resp, CONFIG_MODEM_JWT_MAX_LEN, &state);
 	if (ret) {
 		ret = -EBADMSG;
@@ -152,12 +138,179 @@ int modem_jwt_generate(struct jwt_data *const jwt)
 		goto cleanup;
 	}
 
+	/* Remove any non-base64url characters */
+	base64_url_format(cmd_resp);
+
 cleanup:
+	k_free(cmd);
+
+	return ret;
+}
+
+#if defined(CONFIG_MODEM_JWT_CACHE)
+/* Maximum cacheable length of the sub and aud claims */
+#define JWT_CACHE_CLAIM_MAX_LEN 128
+
+/* Single-entry cache holding the most recently generated token together
+ * with the parameters it was generated from.
+ */
+static struct {
+	bool valid;
+	int sec_tag;
+	enum jwt_key_type key;
+	enum jwt_alg_type alg;
+	uint32_t exp_delta_s;
+	char subject[JWT_CACHE_CLAIM_MAX_LEN + 1];
+	char audience[JWT_CACHE_CLAIM_MAX_LEN + 1];
+	char token[CONFIG_MODEM_JWT_MAX_LEN];
+	/* Uptime at which the token expires */
+	int64_t expiry_ms;
+} jwt_cache;
+
+static K_MUTEX_DEFINE(jwt_cache_lock);
+
+static void jwt_cache_refresh_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(jwt_cache_refresh_work, jwt_cache_refresh_fn);
+
+static bool jwt_cacheable(const struct jwt_data *const jwt)
+{
+	return (jwt->exp_delta_s > CONFIG_MODEM_JWT_CACHE_REFRESH_MARGIN_S) &&
+	       (!jwt->subject ||
+		(strlen(jwt->subject) <= JWT_CACHE_CLAIM_MAX_LEN)) &&
+	       (!jwt->audience ||
+		(strlen(jwt->audience) <= JWT_CACHE_CLAIM_MAX_LEN));
+}
+
+static bool jwt_cache_params_match(const struct jwt_data *const jwt)
+{
+	return (jwt_cache.sec_tag == jwt->sec_tag) &&
+	       (jwt_cache.key == jwt->key) &&
+	       (jwt_cache.alg == jwt->alg) &&
+	       (jwt_cache.exp_delta_s == jwt->exp_delta_s) &&
+	       (strcmp(jwt_cache.subject,
+		       jwt->subject ? jwt->subject : "") == 0) &&
+	       (strcmp(jwt_cache.audience,
+		       jwt->audience ? jwt->audience : "") == 0);
+}
+
+static bool jwt_cache_get(const struct jwt_data *const jwt, char *const token)
+{
+	bool hit = false;
+
+	k_mutex_lock(&jwt_cache_lock, K_FOREVER);
+
+	if (jwt_cache.valid && jwt_cache_params_match(jwt) &&
+	    ((k_uptime_get() +
+	      (CONFIG_MODEM_JWT_CACHE_REFRESH_MARGIN_S * MSEC_PER_SEC)) <
+	     jwt_cache.expiry_ms)) {
+		strcpy(token, jwt_cache.token);
+		hit = true;
+	}
+
+	k_mutex_unlock(&jwt_cache_lock);
+
+	return hit;
+}
+
+static void jwt_cache_put(const struct jwt_data *const jwt,
+			  const char *const token)
+{
+	uint32_t refresh_s =
+		jwt->exp_delta_s - CONFIG_MODEM_JWT_CACHE_REFRESH_MARGIN_S;
+
+	k_mutex_lock(&jwt_cache_lock, K_FOREVER);
+
+	jwt_cache.sec_tag = jwt->sec_tag;
+	jwt_cache.key = jwt->key;
+	jwt_cache.alg = jwt->alg;
+	jwt_cache.exp_delta_s = jwt->exp_delta_s;
+	strcpy(jwt_cache.subject, jwt->subject ? jwt->subject : "");
+	strcpy(jwt_cache.audience, jwt->audience ? jwt->audience : "");
+	strcpy(jwt_cache.token, token);
+	jwt_cache.expiry_ms =
+		k_uptime_get() + ((int64_t)jwt->exp_delta_s * MSEC_PER_SEC);
+	jwt_cache.valid = true;
+
+	k_mutex_unlock(&jwt_cache_lock);
+
+	/* Refresh the token ahead of expiry so that subsequent requests
+	 * do not block on modem-side signing.
+	 */
+	k_work_reschedule(&jwt_cache_refresh_work, K_SECONDS(refresh_s));
+}
+
+static void jwt_cache_refresh_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	int ret;
+	char *token;
+	struct jwt_data jwt = { 0 };
+	char subject[JWT_CACHE_CLAIM_MAX_LEN + 1];
+	char audience[JWT_CACHE_CLAIM_MAX_LEN + 1];
+
+	k_mutex_lock(&jwt_cache_lock, K_FOREVER);
+
+	if (!jwt_cache.valid) {
+		k_mutex_unlock(&jwt_cache_lock);
+		return;
+	}
+
+	jwt.sec_tag = jwt_cache.sec_tag;
+	jwt.key = jwt_cache.key;
+	jwt.alg = jwt_cache.alg;
+	jwt.exp_delta_s = jwt_cache.exp_delta_s;
+	strcpy(subject, jwt_cache.subject);
+	strcpy(audience, jwt_cache.audience);
+	jwt.subject = subject[0] ? subject : NULL;
+	jwt.audience = audience[0] ? audience : NULL;
+
+	k_mutex_unlock(&jwt_cache_lock);
+
+	token = k_calloc(CONFIG_MODEM_JWT_MAX_LEN, 1);
+	if (!token) {
+		return;
+	}
+
+	ret = jwt_fetch(&jwt, token);
+	if (ret == 0) {
+		jwt_cache_put(&jwt, token);
+	}
+
+	k_free(token);
+}
+#endif /* CONFIG_MODEM_JWT_CACHE */
 
-	if (cmd) {
-		k_free(cmd);
+int modem_jwt_generate(struct jwt_data *const jwt)
+{
+	if (!jwt) {
+		return -EINVAL;
+	} else if ((jwt->jwt_buf) && (jwt->jwt_sz == 0)) {
+		return -EMSGSIZE;
+	}
+
+	int ret = 0;
+	char *cmd_resp;
+
+	/* Allocate response buffer */
+	cmd_resp = k_calloc(CONFIG_MODEM_JWT_MAX_LEN, 1);
+	if (!cmd_resp) {
+		return -ENOMEM;
 	}
 
+#if defined(CONFIG_MODEM_JWT_CACHE)
+	bool cacheable = jwt_cacheable(jwt);
+
+	if (!cacheable || !jwt_cache_get(jwt, cmd_resp)) {
+		ret = jwt_fetch(jwt, cmd_resp);
+		if ((ret == 0) && cacheable) {
+			jwt_cache_put(jwt, cmd_resp);
+		}
+	}
+#else
+	ret = jwt_fetch(jwt, cmd_resp);
+#endif
+
 	if (ret == 0) {
 		size_t jwt_sz = strlen(cmd_resp) + 1;
 
@@ -173,15 +326,11 @@ cleanup:
 		}
 
 		if (ret == 0) {
-			/* Remove any non-base64url characters */
-			base64_url_format(cmd_resp);
 			memcpy(jwt->jwt_buf, cmd_resp, jwt_sz);
 		}
 	}
 
-	if (cmd_resp) {
-		k_free(cmd_resp);
-	}
+	k_free(cmd_resp);
 
 	return ret;
 }
@@ -206,16 +206,110 @@ clean_up:
 	return err;
 }
 
-int multicell_location_get(const struct lte_lc_cells_info *cell_data,
-			   const char * const device_id,
-			   struct multicell_location *location)
+#if defined(CONFIG_MULTICELL_LOCATION_CACHE)
+struct cache_entry {
+	bool used;
+	uint32_t fingerprint;
+	int64_t expiry_uptime;
+	struct multicell_location location;
+};
+
+static struct cache_entry cache[CONFIG_MULTICELL_LOCATION_CACHE_ENTRIES];
+static uint32_t cache_insert_idx;
+static K_MUTEX_DEFINE(cache_mutex);
+
+static uint32_t hash_fold(uint32_t hash, uint32_t value)
 {
-	int err;
+	return hash * 31 + value;
+}
 
-	if ((cell_data == NULL) || (location == NULL)) {
-		return -EINVAL;
+/* Fingerprint of the measured cell environment. The neighbor cell keys
+ * are sorted before hashing, so the fingerprint does not depend on the
+ * order the cells were reported in.
+ */
+static uint32_t cell_fingerprint(const struct lte_lc_cells_info *cell_data)
+{
+	uint32_t keys[CONFIG_MULTICELL_LOCATION_MAX_NEIGHBORS];
+	uint8_t count = MIN(cell_data->ncells_count,
+			    CONFIG_MULTICELL_LOCATION_MAX_NEIGHBORS);
+	uint32_t hash = 5381;
+
+	hash = hash_fold(hash, cell_data->current_cell.mcc);
+	hash = hash_fold(hash, cell_data->current_cell.mnc);
+	hash = hash_fold(hash, cell_data->current_cell.id);
+	hash = hash_fold(hash, cell_data->current_cell.tac);
+
+	for (uint8_t i = 0; i < count; i++) {
+		uint32_t key = (cell_data->neighbor_cells[i].earfcn << 16) ^
+			       cell_data->neighbor_cells[i].phys_cell_id;
+		uint8_t j = i;
+
+		while ((j > 0) && (keys[j - 1] > key)) {
+			keys[j] = keys[j - 1];
+			j--;
+		}
+		keys[j] = key;
+	}
+
+	for (uint8_t i = 0; i < count; i++) {
+		hash = hash_fold(hash, keys[i]);
+	}
+
+	return hash;
+}
+
+static bool cache_get(uint32_t fingerprint, struct multicell_location *location)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache); i++) {
+		struct cache_entry *entry = &cache[i];
+
+		if (!entry->used || (entry->fingerprint != fingerprint)) {
+			continue;
+		}
+
+		if (k_uptime_get() > entry->expiry_uptime) {
+			entry->used = false;
+			continue;
+		}
+
+		*location = entry->location;
+		return true;
+	}
+
+	return false;
+}
+
+static void cache_put(uint32_t fingerprint,
+		      const struct multicell_location *location)
+{
+	struct cache_entry *entry = &cache[cache_insert_idx];
+
+	/* Refresh an existing entry for the same cells if there is one */
+	for (size_t i = 0; i < ARRAY_SIZE(cache); i++) {
+		if (cache[i].used && (cache[i].fingerprint == fingerprint)) {
+			entry = &cache[i];
+			break;
+		}
 	}
 
+	if (entry == &cache[cache_insert_idx]) {
+		cache_insert_idx = (cache_insert_idx + 1) % ARRAY_SIZE(cache);
+	}
+
+	entry->used = true;
+	entry->fingerprint = fingerprint;
+	entry->expiry_uptime = k_uptime_get() +
+		(int64_t)CONFIG_MULTICELL_LOCATION_CACHE_TTL_SECONDS * MSEC_PER_SEC;
+	entry->location = *location;
+}
+#endif /* CONFIG_MULTICELL_LOCATION_CACHE */
+
+static int location_resolve(const struct lte_lc_cells_info *cell_data,
+			    const char * const device_id,
+			    struct multicell_location *location)
+{
+	int err;
+
 	if (cell_data->ncells_count > CONFIG_MULTICELL_LOCATION_MAX_NEIGHBORS) {
 		LOG_WRN("Found %d neighbor cells, but %d cells will be used in location request",
 			cell_data->ncells_count, CONFIG_MULTICELL_LOCATION_MAX_NEIGHBORS);
@@ -253,6 +347,45 @@ int multicell_location_get(const struct lte_lc_cells_info *cell_data,
 	return 0;
 }
 
+int multicell_location_get(const struct lte_lc_cells_info *cell_data,
+			   const char * const device_id,
+			   struct multicell_location *location)
+{
+	int err;
+
+	if ((cell_data == NULL) || (location == NULL)) {
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_MULTICELL_LOCATION_CACHE)
+	uint32_t fingerprint = cell_fingerprint(cell_data);
+
+	/* Holding the mutex over the whole resolution coalesces rapid
+	 * repeat queries: a caller that arrives while a request for the
+	 * same cell environment is in flight waits for it and is then
+	 * served from the cache.
+	 */
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	if (cache_get(fingerprint, location)) {
+		LOG_DBG("Location served from cache");
+		k_mutex_unlock(&cache_mutex);
+		return 0;
+	}
+
+	err = location_resolve(cell_data, device_id, location);
+	if (err == 0) {
+		cache_put(fingerprint, location);
+	}
+
+	k_mutex_unlock(&cache_mutex);
+#else
+	err = location_resolve(cell_data, device_id, location);
+#endif
+
+	return err;
+}
+
 int multicell_location_provision_certificate(bool overwrite)
 {
 	int err;
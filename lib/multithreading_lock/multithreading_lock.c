@@ -8,12 +8,39 @@
 
 static K_MUTEX_DEFINE(mpsl_lock);
 
+/* Every domain maps to the same lock for now, as the SoftDevice Controller
+ * and MPSL require their APIs to be serialized against each other. Domains
+ * can be given separate locks here once the controller guarantees
+ * independence between the corresponding API groups.
+ */
+static struct k_mutex *const domain_lock[MULTITHREADING_LOCK_DOMAIN_COUNT] = {
+	[MULTITHREADING_LOCK_DOMAIN_CTRL] = &mpsl_lock,
+	[MULTITHREADING_LOCK_DOMAIN_DATA] = &mpsl_lock,
+	[MULTITHREADING_LOCK_DOMAIN_CRYPTO] = &mpsl_lock,
+};
+
+int multithreading_lock_domain_acquire(enum multithreading_lock_domain domain,
+				       k_timeout_t timeout)
+{
+	__ASSERT_NO_MSG(domain < MULTITHREADING_LOCK_DOMAIN_COUNT);
+
+	return k_mutex_lock(domain_lock[domain], timeout);
+}
+
+void multithreading_lock_domain_release(enum multithreading_lock_domain domain)
+{
+	__ASSERT_NO_MSG(domain < MULTITHREADING_LOCK_DOMAIN_COUNT);
+
+	k_mutex_unlock(domain_lock[domain]);
+}
+
 int multithreading_lock_acquire(k_timeout_t timeout)
 {
-	return k_mutex_lock(&mpsl_lock, timeout);
+	return multithreading_lock_domain_acquire(MULTITHREADING_LOCK_DOMAIN_CTRL,
+						  timeout);
 }
 
 void multithreading_lock_release(void)
 {
-	k_mutex_unlock(&mpsl_lock);
+	multithreading_lock_domain_release(MULTITHREADING_LOCK_DOMAIN_CTRL);
 }
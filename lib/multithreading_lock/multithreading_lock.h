@@ -19,7 +19,40 @@ extern "C" {
 
 #include <zephyr.h>
 
-/** Macro for acquiring a lock */
+/** @brief Lock domains for controller and MPSL API calls.
+ *
+ * Call sites take the lock for the domain their call belongs to. All
+ * domains are currently backed by the same lock, because the SoftDevice
+ * Controller and MPSL require their APIs to be serialized against each
+ * other. Once a controller release guarantees independence between API
+ * groups, domains can be given separate locks without touching the call
+ * sites.
+ */
+enum multithreading_lock_domain {
+	/** HCI commands, events and controller management. */
+	MULTITHREADING_LOCK_DOMAIN_CTRL,
+	/** Connection data path (ACL data in and out). */
+	MULTITHREADING_LOCK_DOMAIN_DATA,
+	/** Cryptographic operations. */
+	MULTITHREADING_LOCK_DOMAIN_CRYPTO,
+
+	/** Number of lock domains. */
+	MULTITHREADING_LOCK_DOMAIN_COUNT,
+};
+
+/** Macro for acquiring the lock of a domain. */
+#define MULTITHREADING_LOCK_ACQUIRE_DOMAIN(_domain) \
+	multithreading_lock_domain_acquire(_domain, K_FOREVER)
+
+/** Macro for releasing the lock of a domain. */
+#define MULTITHREADING_LOCK_RELEASE_DOMAIN(_domain) \
+	multithreading_lock_domain_release(_domain)
+
+/** Macro for acquiring a lock.
+ *
+ * Compatibility shim for call sites without a domain annotation. Equivalent
+ * to acquiring @ref MULTITHREADING_LOCK_DOMAIN_CTRL.
+ */
 #define MULTITHREADING_LOCK_ACQUIRE() \
 	multithreading_lock_acquire(K_FOREVER)
 
@@ -35,6 +68,30 @@ extern "C" {
 #define MULTITHREADING_LOCK_RELEASE() multithreading_lock_release()
 
 
+/** @brief Try to take the lock of a domain with the specified blocking
+ * behavior.
+ *
+ * This API call will be blocked for the time specified by @p timeout and
+ * then return error code.
+ *
+ * @param[in] domain      Lock domain the caller's API call belongs to.
+ * @param[in] timeout     Timeout value for the locking API.
+ *
+ * @retval 0              Success
+ * @retval -EBUSY         Returned without waiting.
+ * @retval -EAGAIN        Waiting period timed out.
+ */
+int multithreading_lock_domain_acquire(enum multithreading_lock_domain domain,
+				       k_timeout_t timeout);
+
+/** @brief Unlock the lock of a domain.
+ *
+ * @note This API is must be called only after lock is obtained.
+ *
+ * @param[in] domain      Lock domain passed on acquire.
+ */
+void multithreading_lock_domain_release(enum multithreading_lock_domain domain);
+
 /** @brief Try to take the lock with the specified blocking behavior.
  *
  * This API call will be blocked for the time specified by @p timeout and then
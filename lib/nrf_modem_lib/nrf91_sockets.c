@@ -43,6 +43,7 @@
 static struct nrf_sock_ctx {
 	int nrf_fd; /* nRF socket descriptior. */
 	struct k_mutex *lock; /* Mutex associated with the socket. */
+	int type; /* Socket type (SOCK_STREAM, SOCK_DGRAM or SOCK_RAW). */
 } offload_ctx[NRF_MODEM_MAX_SOCKET_COUNT];
 
 static K_MUTEX_DEFINE(ctx_lock);
@@ -642,6 +643,9 @@ static int nrf91_socket_offload_accept(void *obj, struct sockaddr *addr,
 		goto error;
 	}
 
+	/* Accepted sockets are always connection-mode. */
+	ctx->type = SOCK_STREAM;
+
 	if ((addr != NULL) && (addrlen != NULL)) {
 		if (nrf_addr_ptr->sa_family == NRF_AF_INET) {
 			*addrlen = sizeof(struct sockaddr_in);
@@ -841,6 +845,127 @@ error:
 	return retval;
 }
 
+#if defined(CONFIG_NRF91_SOCKET_SEND_AGGREGATION)
+/* Nagle-style aggregation of small sequential writes on a connected
+ * socket. One socket is aggregated at a time, using a single static
+ * buffer like sendmsg does.
+ */
+static K_MUTEX_DEFINE(send_agg_lock);
+static uint8_t send_agg_buf[CONFIG_NRF91_SOCKET_SEND_AGGREGATION_BUF_SIZE];
+static size_t send_agg_len;
+static int send_agg_sd = -1;
+static int send_agg_flags;
+/* Socket whose deferred flush failed, and the error to report on it. */
+static int send_agg_err_sd = -1;
+static int send_agg_errno;
+
+/* Send the aggregated data. Must be called with send_agg_lock held. */
+static void send_agg_flush_locked(void)
+{
+	size_t offset = 0;
+	ssize_t ret;
+
+	while (offset < send_agg_len) {
+		ret = nrf_sendto(send_agg_sd, &send_agg_buf[offset],
+				 send_agg_len - offset,
+				 z_to_nrf_flags(send_agg_flags), NULL, 0);
+		if (ret < 0) {
+			/* Report on the next operation on this socket. */
+			send_agg_err_sd = send_agg_sd;
+			send_agg_errno = errno;
+			break;
+		}
+		offset += ret;
+	}
+
+	send_agg_len = 0;
+	send_agg_sd = -1;
+}
+
+static void send_agg_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&send_agg_lock, K_FOREVER);
+	send_agg_flush_locked();
+	k_mutex_unlock(&send_agg_lock);
+}
+
+static K_WORK_DELAYABLE_DEFINE(send_agg_work, send_agg_work_fn);
+
+/* Flush pending aggregated data for a socket that is being read from or
+ * closed. A deferred error is kept for the next send on the socket, and
+ * forgotten when the socket is closed.
+ */
+static void send_agg_drain(int sd, bool closing)
+{
+	k_mutex_lock(&send_agg_lock, K_FOREVER);
+
+	if (send_agg_sd == sd) {
+		send_agg_flush_locked();
+	}
+
+	if (closing && (send_agg_err_sd == sd)) {
+		send_agg_err_sd = -1;
+	}
+
+	k_mutex_unlock(&send_agg_lock);
+}
+
+/* Aggregate a write on a connected socket. Returns true if the write was
+ * consumed and @p retval is set, false if it should be sent directly.
+ */
+static bool send_agg_send(int sd, const void *buf, size_t len, int flags,
+			  ssize_t *retval)
+{
+	bool consumed = false;
+
+	k_mutex_lock(&send_agg_lock, K_FOREVER);
+
+	/* Report a failed deferred flush on this socket. */
+	if (send_agg_err_sd == sd) {
+		send_agg_err_sd = -1;
+		errno = send_agg_errno;
+		*retval = -1;
+		consumed = true;
+		goto out;
+	}
+
+	/* Pending data for another socket, with other flags, or followed by
+	 * a write too large to aggregate, is flushed first to keep the byte
+	 * stream ordered.
+	 */
+	if ((send_agg_len > 0) &&
+	    ((send_agg_sd != sd) || (send_agg_flags != flags) ||
+	     (len >= sizeof(send_agg_buf)))) {
+		send_agg_flush_locked();
+	}
+
+	if (len >= sizeof(send_agg_buf)) {
+		/* Too large to profit from aggregation, send directly. */
+		goto out;
+	}
+
+	if (send_agg_len + len > sizeof(send_agg_buf)) {
+		send_agg_flush_locked();
+	}
+
+	memcpy(&send_agg_buf[send_agg_len], buf, len);
+	send_agg_len += len;
+	send_agg_sd = sd;
+	send_agg_flags = flags;
+	*retval = len;
+	consumed = true;
+
+	k_work_schedule(&send_agg_work,
+			K_MSEC(CONFIG_NRF91_SOCKET_SEND_AGGREGATION_DELAY_MS));
+
+out:
+	k_mutex_unlock(&send_agg_lock);
+	return consumed;
+}
+#endif /* CONFIG_NRF91_SOCKET_SEND_AGGREGATION */
+
 static ssize_t nrf91_socket_offload_recvfrom(void *obj, void *buf, size_t len,
 					     int flags, struct sockaddr *from,
 					     socklen_t *fromlen)
@@ -850,6 +975,13 @@ static ssize_t nrf91_socket_offload_recvfrom(void *obj, void *buf, size_t len,
 
 	k_mutex_unlock(ctx->lock);
 
+#if defined(CONFIG_NRF91_SOCKET_SEND_AGGREGATION)
+	/* Request/response protocols read right after writing; push out
+	 * pending data instead of waiting for the aggregation window.
+	 */
+	send_agg_drain(ctx->nrf_fd, false);
+#endif
+
 	if (from == NULL) {
 		retval = nrf_recvfrom(ctx->nrf_fd, buf, len, z_to_nrf_flags(flags),
 				      NULL, NULL);
@@ -888,6 +1020,16 @@ static ssize_t nrf91_socket_offload_sendto(void *obj, const void *buf,
 		len = MIN(len, CONFIG_NRF91_SOCKET_BLOCK_LIMIT);
 	}
 
+#if defined(CONFIG_NRF91_SOCKET_SEND_AGGREGATION)
+	/* Only byte streams can be coalesced; datagram boundaries must be
+	 * preserved.
+	 */
+	if ((to == NULL) && (OBJ_TO_CTX(obj)->type == SOCK_STREAM) &&
+	    send_agg_send(sd, buf, len, flags, &retval)) {
+		return retval;
+	}
+#endif
+
 	if (to == NULL) {
 		retval = nrf_sendto(sd, buf, len, z_to_nrf_flags(flags), NULL,
 				    0);
@@ -1271,6 +1413,10 @@ static int nrf91_socket_offload_close(void *obj)
 	struct nrf_sock_ctx *ctx = OBJ_TO_CTX(obj);
 	int retval;
 
+#if defined(CONFIG_NRF91_SOCKET_SEND_AGGREGATION)
+	send_agg_drain(ctx->nrf_fd, true);
+#endif
+
 	retval = nrf_close(ctx->nrf_fd);
 	if (retval == 0) {
 		release_ctx(ctx);
@@ -1341,6 +1487,8 @@ static int nrf91_socket_create(int family, int type, int proto)
 		return -1;
 	}
 
+	ctx->type = type;
+
 	z_finalize_fd(fd, ctx,
 		      (const struct fd_op_vtable *)&nrf91_socket_fd_op_vtable);
 
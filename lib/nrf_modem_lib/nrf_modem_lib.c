@@ -12,6 +12,7 @@
 #include <nrf_modem.h>
 #include <nrf_modem_platform.h>
 #include <pm_config.h>
+#include <debug/boot_trace.h>
 
 #ifdef CONFIG_LTE_LINK_CONTROL
 #include <modem/lte_lc.h>
@@ -33,6 +34,12 @@ static struct k_mutex slist_mutex;
 
 static int init_ret;
 
+/* Whether the library is currently initialized. Lets shutdown_wait return
+ * immediately if the library has already been initialized again, so that a
+ * fast shutdown-init cycle cannot leave a late waiter sleeping forever.
+ */
+static atomic_t modem_up;
+
 static const nrf_modem_init_params_t init_params = {
 	.ipc_irq_prio = NRF_MODEM_NETWORK_IRQ_PRIORITY,
 	.shmem.ctrl = {
@@ -69,8 +76,14 @@ static int _nrf_modem_lib_init(const struct device *unused)
 	IRQ_CONNECT(NRF_MODEM_NETWORK_IRQ, NRF_MODEM_NETWORK_IRQ_PRIORITY,
 		    nrfx_isr, nrfx_ipc_irq_handler, 0);
 
+	boot_trace_mark("nrf_modem_lib: init");
+
 	init_ret = nrf_modem_init(&init_params, NORMAL_MODE);
 
+	boot_trace_mark("nrf_modem_lib: init done");
+
+	atomic_set(&modem_up, init_ret == 0);
+
 	k_mutex_lock(&slist_mutex, K_FOREVER);
 	if (sys_slist_peek_head(&shutdown_threads) != NULL) {
 		struct shutdown_thread *thread, *next_thread;
@@ -99,6 +112,11 @@ void nrf_modem_lib_shutdown_wait(void)
 {
 	struct shutdown_thread thread;
 
+	if (atomic_get(&modem_up)) {
+		/* Already initialized again. */
+		return;
+	}
+
 	k_sem_init(&thread.sem, 0, 1);
 
 	k_mutex_lock(&slist_mutex, K_FOREVER);
@@ -128,6 +146,8 @@ int nrf_modem_lib_get_init_ret(void)
 
 int nrf_modem_lib_shutdown(void)
 {
+	atomic_clear(&modem_up);
+
 #ifdef CONFIG_LTE_LINK_CONTROL
 	lte_lc_deinit();
 #endif
@@ -136,6 +156,29 @@ int nrf_modem_lib_shutdown(void)
 	return 0;
 }
 
+int nrf_modem_lib_restart(void)
+{
+	atomic_clear(&modem_up);
+
+	/* Shut the library down before deinitializing link control, so
+	 * that no graceful power-off command is sent to a modem that is
+	 * about to be restarted anyway and, after a fault, may not
+	 * respond to AT commands at all.
+	 */
+	nrf_modem_shutdown();
+
+#ifdef CONFIG_LTE_LINK_CONTROL
+	/* Only drops link control state at this point; the AT command it
+	 * attempts cannot reach the modem anymore.
+	 */
+	(void)lte_lc_deinit();
+#endif
+
+	(void)_nrf_modem_lib_init(NULL);
+
+	return init_ret;
+}
+
 #if defined(CONFIG_NRF_MODEM_LIB_SYS_INIT)
 /* Initialize during SYS_INIT */
 SYS_INIT(_nrf_modem_lib_init, POST_KERNEL, 0);
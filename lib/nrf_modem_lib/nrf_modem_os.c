@@ -25,6 +25,10 @@
 #include <SEGGER_RTT.h>
 #endif
 
+#ifdef CONFIG_NRF_MODEM_LIB_TRACE_BUFFERED
+#include <sys/ring_buffer.h>
+#endif
+
 #ifndef ENOKEY
 #define ENOKEY 2001
 #endif
@@ -52,6 +56,19 @@
 static const nrfx_uarte_t uarte_inst = NRFX_UARTE_INSTANCE(1);
 #endif
 
+#ifdef CONFIG_NRF_MODEM_LIB_TRACE_BUFFERED
+/* Traces are copied into a RAM ring buffer from the trace IRQ and written
+ * to the trace medium from a dedicated low-priority workqueue, so that the
+ * slow medium write does not delay the modem.
+ */
+RING_BUF_DECLARE(trace_ring, CONFIG_NRF_MODEM_LIB_TRACE_BUFFER_SIZE);
+static atomic_t trace_dropped_bytes;
+static K_THREAD_STACK_DEFINE(trace_drain_stack_area, 768);
+static struct k_work_q trace_drain_q;
+static struct k_work trace_drain_work;
+static void trace_drain_fn(struct k_work *work);
+#endif
+
 #define THREAD_MONITOR_ENTRIES 10
 
 LOG_MODULE_REGISTER(nrf_modem_lib, CONFIG_NRF_MODEM_LIB_LOG_LEVEL);
@@ -643,6 +660,13 @@ void nrf_modem_os_init(void)
 	trace_rtt_init();
 	trace_task_create();
 
+#ifdef CONFIG_NRF_MODEM_LIB_TRACE_BUFFERED
+	k_work_init(&trace_drain_work, trace_drain_fn);
+	k_work_queue_start(&trace_drain_q, trace_drain_stack_area,
+			   K_THREAD_STACK_SIZEOF(trace_drain_stack_area),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+#endif
+
 	memset(&heap_diag, 0x00, sizeof(heap_diag));
 	memset(&shmem_diag, 0x00, sizeof(shmem_diag));
 
@@ -671,7 +695,7 @@ void nrf_modem_os_init(void)
 #endif
 }
 
-int32_t nrf_modem_os_trace_put(const uint8_t * const data, uint32_t len)
+static void trace_medium_write(const uint8_t *const data, uint32_t len)
 {
 #ifdef CONFIG_NRF_MODEM_LIB_TRACE_MEDIUM_UART
 	/* Max DMA transfers are 255 bytes.
@@ -694,7 +718,7 @@ int32_t nrf_modem_os_trace_put(const uint8_t * const data, uint32_t len)
 	 * allocated for the modem trace
 	 */
 	if (trace_rtt_channel < 0) {
-		return 0;
+		return;
 	}
 
 	uint32_t remaining_bytes = len;
@@ -707,6 +731,41 @@ int32_t nrf_modem_os_trace_put(const uint8_t * const data, uint32_t len)
 			transfer_len);
 		remaining_bytes -= transfer_len;
 	}
+#endif
+}
+
+#ifdef CONFIG_NRF_MODEM_LIB_TRACE_BUFFERED
+static void trace_drain_fn(struct k_work *work)
+{
+	uint8_t *data;
+	uint32_t len;
+	uint32_t dropped = atomic_set(&trace_dropped_bytes, 0);
+
+	if (dropped) {
+		LOG_WRN("Modem trace buffer full, dropped %u bytes", dropped);
+	}
+
+	/* Drain in bulk, straight out of the ring buffer. */
+	while ((len = ring_buf_get_claim(&trace_ring, &data,
+					 CONFIG_NRF_MODEM_LIB_TRACE_BUFFER_SIZE)) > 0) {
+		trace_medium_write(data, len);
+		ring_buf_get_finish(&trace_ring, len);
+	}
+}
+#endif
+
+int32_t nrf_modem_os_trace_put(const uint8_t *const data, uint32_t len)
+{
+#ifdef CONFIG_NRF_MODEM_LIB_TRACE_BUFFERED
+	uint32_t written = ring_buf_put(&trace_ring, data, len);
+
+	if (written < len) {
+		atomic_add(&trace_dropped_bytes, len - written);
+	}
+
+	k_work_submit_to_queue(&trace_drain_q, &trace_drain_work);
+#else
+	trace_medium_write(data, len);
 #endif
 	return 0;
 }
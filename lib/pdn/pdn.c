@@ -33,6 +33,9 @@ static char at_buf[AT_BUF_SIZE];
 struct pdn {
 	pdn_event_handler_t callback;
 	int8_t context_id;
+#if defined(CONFIG_PDN_DIAG)
+	struct pdn_diag diag;
+#endif
 };
 
 static int esm_from_notif;
@@ -58,6 +61,41 @@ static struct pdn *pdn_avail_get(void)
 	return pdn_find(CID_UNASSIGNED);
 }
 
+#if defined(CONFIG_PDN_DIAG)
+static void pdn_diag_update(struct pdn *pdn, enum pdn_event event, int esm)
+{
+	struct pdn_diag *diag = &pdn->diag;
+
+	switch (event) {
+	case PDN_EVENT_CNEC_ESM:
+		diag->last_esm = esm;
+		break;
+	case PDN_EVENT_ACTIVATED:
+		diag->active = true;
+		diag->activations++;
+		break;
+	case PDN_EVENT_DEACTIVATED:
+		diag->active = false;
+		diag->deactivations++;
+		break;
+	case PDN_EVENT_IPV6_UP:
+		break;
+	case PDN_EVENT_IPV6_DOWN:
+		diag->ipv6_failures++;
+		break;
+	}
+
+	diag->last_event_uptime = k_uptime_get();
+}
+#else
+static void pdn_diag_update(struct pdn *pdn, enum pdn_event event, int esm)
+{
+	ARG_UNUSED(pdn);
+	ARG_UNUSED(event);
+	ARG_UNUSED(esm);
+}
+#endif /* CONFIG_PDN_DIAG */
+
 static void at_notif_handler(void *context, const char *notif)
 {
 	char *p;
@@ -92,6 +130,8 @@ static void at_notif_handler(void *context, const char *notif)
 			return;
 		}
 
+		pdn_diag_update(pdn, PDN_EVENT_CNEC_ESM, esm_err);
+
 		if (pdn->callback) {
 			pdn->callback((intptr_t)cid, PDN_EVENT_CNEC_ESM,
 				      esm_err);
@@ -122,12 +162,16 @@ static void at_notif_handler(void *context, const char *notif)
 
 		cid = strtoul(p + strlen(map[i].notif), NULL, 10);
 
+		pdn = pdn_find(cid);
+		if (pdn) {
+			pdn_diag_update(pdn, map[i].event, 0);
+		}
+
 		if (default_callback && cid == 0) {
 			default_callback(0, map[i].event, 0);
 			return;
 		}
 
-		pdn = pdn_find(cid);
 		if (!pdn) {
 			return;
 		}
@@ -208,6 +252,10 @@ int pdn_ctx_create(uint8_t *cid, pdn_event_handler_t cb)
 
 	pdn->context_id = strtoul(p + 1, NULL, 10);
 
+#if defined(CONFIG_PDN_DIAG)
+	memset(&pdn->diag, 0, sizeof(pdn->diag));
+#endif
+
 	*cid = pdn->context_id;
 
 	if (cb) {
@@ -372,6 +420,44 @@ int pdn_deactivate(uint8_t cid)
 	return 0;
 }
 
+#if defined(CONFIG_PDN_DIAG)
+int pdn_diag_get(uint8_t cid, struct pdn_diag *diag)
+{
+	struct pdn *pdn;
+
+	if (!diag) {
+		return -EFAULT;
+	}
+
+	pdn = pdn_find(cid);
+	if (!pdn) {
+		return -EINVAL;
+	}
+
+	*diag = pdn->diag;
+
+	return 0;
+}
+
+int pdn_diag_reset(uint8_t cid)
+{
+	struct pdn *pdn;
+	bool active;
+
+	pdn = pdn_find(cid);
+	if (!pdn) {
+		return -EINVAL;
+	}
+
+	/* Clear the counters, but not the connection state. */
+	active = pdn->diag.active;
+	memset(&pdn->diag, 0, sizeof(pdn->diag));
+	pdn->diag.active = active;
+
+	return 0;
+}
+#endif /* CONFIG_PDN_DIAG */
+
 int pdn_id_get(uint8_t cid)
 {
 	int err;
@@ -71,50 +71,96 @@ static uint32_t ram_sect_bank_bottom_addr(uint8_t bank_id, uint8_t section_id)
 
 	return section_addr;
 }
+
+/**@brief Get number of sections of RAM bank with given ID.
+ *
+ * @param[in] bank_id  ID of RAM bank to get section count of.
+ *
+ * @return    Number of sections of RAM bank.
+ */
+static inline uint8_t ram_bank_sections_nbr(uint8_t bank_id)
+{
+	return (bank_id == 8) ? RAM_BANK_8_SECTIONS_NBR :
+				RAM_BANK_0_7_SECTIONS_NBR;
+}
+
+#if defined(CONFIG_RAM_POWER_ADJUST_ON_HEAP_RESIZE)
+/* Top of the libc heap observed so far. Sections below this address must
+ * stay powered even if the image footprint ends lower.
+ */
+static uint32_t heap_end_addr;
+#else
+#define heap_end_addr 0UL
+#endif
+
+/**@brief Power RAM sections on or off so that exactly the sections
+ *        containing addresses below the given limit are powered.
+ *
+ * @param[in] required_end_addr  End of the RAM range that must stay powered.
+ */
+static void ram_power_update(uint32_t required_end_addr)
+{
+	uint32_t mask;
+
+	for (uint8_t bank_id = 0; bank_id <= RAM_BANKS_NBR; bank_id++) {
+		for (uint8_t section_id = 0;
+		     section_id < ram_bank_sections_nbr(bank_id);
+		     section_id++) {
+			mask = ((1 << section_id) << NRF_POWER_RAMPOWER_S0POWER);
+
+			if (ram_sect_bank_bottom_addr(bank_id, section_id) >=
+			    required_end_addr) {
+				nrf_power_rampower_mask_off(NRF_POWER, bank_id,
+							    mask);
+			} else {
+				nrf_power_rampower_mask_on(NRF_POWER, bank_id,
+							   mask);
+			}
+		}
+	}
+}
 #endif /* ifndef UNUSED_RAM_POWER_OFF_UNSUPPORTED */
 
 void power_down_unused_ram(void)
 {
 #ifndef UNUSED_RAM_POWER_OFF_UNSUPPORTED
-	/* ID of top RAM bank. Depends of amount of RAM available at SoC. */
-	uint8_t     bank_id                 = RAM_BANKS_NBR;
-	uint8_t     section_id              = 5;
-	uint32_t    section_size            = 0;
-	/* Mask to power down whole RAM bank. */
-	uint32_t    ram_bank_power_off_mask = 0x0000FFFF;
-	/* Mask to select sections of RAM bank to power off. */
-	uint32_t    mask_off;
-
-	/* Power off banks with unused RAM only. */
-	while (ram_bank_bottom_addr(bank_id) >= RAM_END_ADDR) {
-		LOG_DBG("Powering off bank: %d.", bank_id);
-		nrf_power_rampower_mask_off(NRF_POWER,
-					    bank_id,
-					    ram_bank_power_off_mask);
-		bank_id--;
-	}
+	uint32_t required_end_addr = MAX(RAM_END_ADDR, heap_end_addr);
 
-	/* Set ID of top section and section size for given bank. */
-	if (bank_id == 8) {
-		section_id = RAM_BANK_8_SECTIONS_NBR - 1;
-		section_size = RAM_BANK_8_SECTION_SIZE;
-	} else {
-		section_id = RAM_BANK_0_7_SECTIONS_NBR - 1;
-		section_size = RAM_BANK_0_7_SECTION_SIZE;
-	}
+	LOG_DBG("Powering off RAM above 0x%08x.", required_end_addr);
+	ram_power_update(required_end_addr);
+#else
+	LOG_INF("RAM power off unsupported.");
+#endif /* UNUSED_RAM_POWER_OFF_UNSUPPORTED */
+}
+
+void power_up_unused_ram(void)
+{
+#ifndef UNUSED_RAM_POWER_OFF_UNSUPPORTED
+	LOG_DBG("Powering on all RAM.");
+	ram_power_update(UINT32_MAX);
+#else
+	LOG_INF("RAM power off unsupported.");
+#endif /* UNUSED_RAM_POWER_OFF_UNSUPPORTED */
+}
 
-	/* Power off remaining sections of unused RAM. */
-	while (ram_sect_bank_bottom_addr(bank_id, section_id) >= RAM_END_ADDR) {
-		LOG_DBG("Powering off section %d of bank %d.",
-			section_id,
-			bank_id);
+#if defined(CONFIG_RAM_POWER_ADJUST_ON_HEAP_RESIZE)
+void *__real__sbrk(intptr_t count);
 
-		mask_off = ((1 << section_id) << NRF_POWER_RAMPOWER_S0POWER);
+/* Wrapper for the newlib sbrk function. Powers RAM sections up and down
+ * as the high-watermark of the libc heap moves, so that a heap growing
+ * above the image footprint never reaches into powered-off RAM.
+ */
+void *__wrap__sbrk(intptr_t count)
+{
+	void *ret = __real__sbrk(count);
 
-		nrf_power_rampower_mask_off(NRF_POWER, bank_id, mask_off);
-		section_id--;
+#ifndef UNUSED_RAM_POWER_OFF_UNSUPPORTED
+	if (ret != (void *)-1) {
+		heap_end_addr = (uint32_t)ret + count;
+		ram_power_update(MAX(RAM_END_ADDR, heap_end_addr));
 	}
-#else
-	LOG_INF("RAM power off unsupported.");
 #endif /* UNUSED_RAM_POWER_OFF_UNSUPPORTED */
+
+	return ret;
 }
+#endif /* CONFIG_RAM_POWER_ADJUST_ON_HEAP_RESIZE */
@@ -42,6 +42,26 @@ static struct sms_data sms_data_info;
 /** @brief Worker handling SMS acknowledgements */
 static struct k_work sms_ack_work;
 
+#if defined(CONFIG_SMS_DEFERRED_PROCESSING)
+/** @brief Worker parsing queued SMS notifications. */
+static struct k_work sms_process_work;
+
+/**
+ * @brief Ring of unprocessed AT notifications.
+ *
+ * @details Written in the AT notification context and consumed by the system work queue,
+ * so that a burst of messages, such as the parts of a concatenated SMS, does not block
+ * delivery of other AT notifications for the duration of the parsing.
+ */
+static char sms_notif_ring[CONFIG_SMS_DEFERRED_PROCESSING_CNT][SMS_BUF_TMP_LEN];
+/** @brief Index of the oldest unprocessed notification in the ring. */
+static uint8_t sms_notif_ring_tail;
+/** @brief Number of unprocessed notifications in the ring. */
+static uint8_t sms_notif_ring_cnt;
+/** @brief Protects the ring indexes. */
+static K_MUTEX_DEFINE(sms_notif_ring_mutex);
+#endif
+
 /**
  * @brief Response list used for AT command parsing.
  * @details This is a global variable so that we can use the same structure requiring memory and
@@ -84,6 +104,92 @@ static void sms_ack(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_SMS_DEFERRED_PROCESSING)
+/**
+ * @brief Process queued SMS notifications.
+ *
+ * @details Each message is acknowledged before it is parsed, so that the network is not
+ * kept waiting for the duration of the parsing.
+ *
+ * @param[in] work Unused k_work instance required for k_work_submit signature.
+ */
+static void sms_process(struct k_work *work)
+{
+	int err;
+
+	while (true) {
+		const char *at_notif;
+
+		k_mutex_lock(&sms_notif_ring_mutex, K_FOREVER);
+		if (sms_notif_ring_cnt == 0) {
+			k_mutex_unlock(&sms_notif_ring_mutex);
+			return;
+		}
+		/* The tail slot is not overwritten while it's counted as unprocessed,
+		 * so it can be parsed in place without holding the mutex.
+		 */
+		at_notif = sms_notif_ring[sms_notif_ring_tail];
+		k_mutex_unlock(&sms_notif_ring_mutex);
+
+		err = at_cmd_write(AT_SMS_PDU_ACK, NULL, 0, NULL);
+		if (err != 0) {
+			LOG_ERR("Unable to ACK the SMS PDU");
+		}
+
+		err = sms_at_parse(at_notif, &sms_data_info, &resp_list);
+		if (err == 0) {
+			LOG_DBG("Valid SMS notification decoded");
+			for (size_t i = 0; i < ARRAY_SIZE(subscribers); i++) {
+				if (subscribers[i].listener != NULL) {
+					subscribers[i].listener(&sms_data_info,
+								subscribers[i].ctx);
+				}
+			}
+		}
+
+		k_mutex_lock(&sms_notif_ring_mutex, K_FOREVER);
+		sms_notif_ring_tail =
+			(sms_notif_ring_tail + 1) % ARRAY_SIZE(sms_notif_ring);
+		sms_notif_ring_cnt--;
+		k_mutex_unlock(&sms_notif_ring_mutex);
+	}
+}
+
+/**
+ * @brief Queue an SMS notification for processing in the system work queue.
+ *
+ * @param[in] at_notif AT notification string.
+ */
+static void sms_notif_enqueue(const char *at_notif)
+{
+	size_t len = strlen(at_notif);
+	uint8_t head;
+
+	k_mutex_lock(&sms_notif_ring_mutex, K_FOREVER);
+
+	if (sms_notif_ring_cnt >= ARRAY_SIZE(sms_notif_ring) ||
+	    len >= SMS_BUF_TMP_LEN) {
+		k_mutex_unlock(&sms_notif_ring_mutex);
+		LOG_ERR("SMS notification dropped, len=%d, queued=%d",
+			len, sms_notif_ring_cnt);
+		/* The message must still be acknowledged or the modem
+		 * would not deliver further messages.
+		 */
+		k_work_submit(&sms_ack_work);
+		return;
+	}
+
+	head = (sms_notif_ring_tail + sms_notif_ring_cnt) %
+	       ARRAY_SIZE(sms_notif_ring);
+	memcpy(sms_notif_ring[head], at_notif, len + 1);
+	sms_notif_ring_cnt++;
+
+	k_mutex_unlock(&sms_notif_ring_mutex);
+
+	k_work_submit(&sms_process_work);
+}
+#endif /* CONFIG_SMS_DEFERRED_PROCESSING */
+
 /**
  * @brief Callback handler for AT notification library callback.
  *
@@ -100,6 +206,14 @@ void sms_at_handler(void *context, const char *at_notif)
 		return;
 	}
 
+#if defined(CONFIG_SMS_DEFERRED_PROCESSING)
+	if (!sms_at_is_sms_notif(at_notif)) {
+		return;
+	}
+	sms_notif_enqueue(at_notif);
+	return;
+#endif
+
 	/* Parse AT command and SMS PDU */
 	err = sms_at_parse(at_notif, &sms_data_info, &resp_list);
 	if (err) {
@@ -136,6 +250,9 @@ static int sms_init(void)
 	int ret;
 
 	k_work_init(&sms_ack_work, &sms_ack);
+#if defined(CONFIG_SMS_DEFERRED_PROCESSING)
+	k_work_init(&sms_process_work, &sms_process);
+#endif
 
 	ret = at_params_list_init(&resp_list, AT_SMS_PARAMS_COUNT_MAX);
 	if (ret) {
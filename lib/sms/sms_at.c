@@ -83,6 +83,12 @@ static int sms_notif_at_parse(const char *const buf, char *pdu, size_t pdu_len,
 	return 0;
 }
 
+bool sms_at_is_sms_notif(const char *at_notif)
+{
+	return strncmp(at_notif, AT_SMS_DELIVER, AT_SMS_DELIVER_LEN) == 0 ||
+	       strncmp(at_notif, AT_SMS_STATUS_REPORT, AT_SMS_STATUS_REPORT_LEN) == 0;
+}
+
 int sms_at_parse(const char *at_notif, struct sms_data *sms_data_info,
 	struct at_param_list *temp_resp_list)
 {
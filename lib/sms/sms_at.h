@@ -23,4 +23,12 @@
 int sms_at_parse(const char *at_notif, struct sms_data *sms_data_info,
 	struct at_param_list *temp_resp_list);
 
+/**
+ * @brief Check whether an AT notification is relevant for SMS.
+ *
+ * @param[in] at_notif AT notication string.
+ * @return True if the notification is an incoming SMS or an SMS status report.
+ */
+bool sms_at_is_sms_notif(const char *at_notif);
+
 #endif
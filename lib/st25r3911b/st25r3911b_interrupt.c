@@ -129,18 +129,30 @@ int st25r3911b_irq_modify(uint32_t clr_mask, uint32_t set_mask)
 
 	irq_mask = old_mask;
 
-	for (size_t i = 0; i < IRQ_REG_CNT; i++) {
-		if (!((mask >> (8 * i)) & 0xFF)) {
-			continue;
+	if (mask) {
+		uint8_t val[IRQ_REG_CNT];
+		size_t first = 0;
+		size_t last = IRQ_REG_CNT - 1;
+
+		/* The mask registers are consecutive, so write the span
+		 * covering all changed bytes in one transaction. Rewriting
+		 * an unchanged byte in between is harmless.
+		 */
+		while (!((mask >> (8 * first)) & 0xFF)) {
+			first++;
 		}
 
-		uint8_t val = (uint8_t)(old_mask >> (8 * i));
+		while (!((mask >> (8 * last)) & 0xFF)) {
+			last--;
+		}
 
-		err = st25r3911b_reg_write(ST25R3911B_REG_MASK_MAIN_INT + i,
-					   val);
-		if (err) {
-			break;
+		for (size_t i = first; i <= last; i++) {
+			val[i - first] = (uint8_t)(old_mask >> (8 * i));
 		}
+
+		err = st25r3911b_multiple_reg_write(
+					ST25R3911B_REG_MASK_MAIN_INT + first,
+					val, last - first + 1);
 	}
 
 	k_spin_unlock(&spinlock, key);
@@ -382,27 +382,25 @@ static uint8_t bcc_calculate(uint8_t *buf, uint8_t len)
 static int read_rx_data(uint8_t *data, size_t len)
 {
 	int err;
-	uint8_t fifo_status;
+	uint8_t fifo_status[2];
 	uint32_t received;
 
-	/* Check number of bytes in FIFO */
-	err = st25r3911b_reg_read(ST25R3911B_REG_FIFO_STATUS_1, &fifo_status);
+	/* Check number of bytes in FIFO, number of incomplete bits and
+	 * parity missing. The status registers are consecutive, so both
+	 * are read in one transaction.
+	 */
+	err = st25r3911b_multiple_reg_read(ST25R3911B_REG_FIFO_STATUS_1,
+					   fifo_status, sizeof(fifo_status));
 	if (err) {
 		return err;
 	}
 
-	nfca.fifo.bytes_to_read = fifo_status;
+	nfca.fifo.bytes_to_read = fifo_status[0];
 	received = nfca.transfer.received_byte;
 
-	/* Check number of incomplete bit in FIFO and parity missing */
-	err = st25r3911b_reg_read(ST25R3911B_REG_FIFO_STATUS_2, &fifo_status);
-	if (err) {
-		return err;
-	}
-
-	nfca.fifo.incomplete_bits = (fifo_status & ST25R3911B_REG_FIFO_STATUS_2_FIFO_LB_MASK) >>
+	nfca.fifo.incomplete_bits = (fifo_status[1] & ST25R3911B_REG_FIFO_STATUS_2_FIFO_LB_MASK) >>
 				     ST25R3911B_REG_FIFO_STATUS_2_FIFO_LB0;
-	nfca.fifo.parity_miss    = fifo_status & ST25R3911B_REG_FIFO_STATUS_2_NP_LB;
+	nfca.fifo.parity_miss    = fifo_status[1] & ST25R3911B_REG_FIFO_STATUS_2_NP_LB;
 
 	/* Check buffer size */
 	if (len - received < nfca.fifo.bytes_to_read) {
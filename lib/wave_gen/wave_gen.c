@@ -27,6 +27,76 @@ static double generate_pseudo_random(void)
 	return rand() / (RAND_MAX / 2.0) - 1.0;
 }
 
+#if defined(CONFIG_WAVE_GEN_LIB_SINE_LUT)
+
+#define SINE_LUT_SIZE 64
+
+/* Quarter-wave sine table in Q15, covering angles from 0 to pi/2
+ * inclusive. Generated with:
+ * python3 -c "import math; \
+ *   print([round(math.sin(i*math.pi/128)*32767) for i in range(65)])"
+ */
+static const int16_t sine_lut[SINE_LUT_SIZE + 1] = {
+	0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+	6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+	12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+	18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+	23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+	27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+	30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+	32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+	32767,
+};
+
+/**
+ * @brief Get full-wave sine sample from the quarter-wave table.
+ *
+ * @param[in]	idx	Index into the unrolled full wave.
+ *
+ * @return Sine value in Q15 for given index.
+ */
+static int32_t sine_lut_sample(uint32_t idx)
+{
+	idx %= 4 * SINE_LUT_SIZE;
+
+	if (idx < SINE_LUT_SIZE) {
+		return sine_lut[idx];
+	} else if (idx < 2 * SINE_LUT_SIZE) {
+		return sine_lut[2 * SINE_LUT_SIZE - idx];
+	} else if (idx < 3 * SINE_LUT_SIZE) {
+		return -sine_lut[idx - 2 * SINE_LUT_SIZE];
+	}
+
+	return -sine_lut[4 * SINE_LUT_SIZE - idx];
+}
+
+/**
+ * @brief Calculate sine wave value using the lookup table.
+ *
+ * Linear interpolation between table entries keeps the error below
+ * 0.012% of the amplitude. Only the final scaling uses floating point.
+ *
+ * @param[in]	time	Time for generated value (lower than the sine wave period).
+ * @param[in]	period	Sine wave period.
+ *
+ * @return Sine wave value for given time.
+ */
+static double sine_val(uint32_t time, uint32_t period)
+{
+	/* Fixed-point phase: index into the unrolled table in the upper
+	 * bits, 8-bit interpolation fraction in the lower bits.
+	 */
+	uint64_t pos = ((uint64_t)time << 8) * 4 * SINE_LUT_SIZE / period;
+	uint32_t idx = pos >> 8;
+	int32_t frac = pos & 0xFF;
+	int32_t a = sine_lut_sample(idx);
+	int32_t b = sine_lut_sample(idx + 1);
+
+	return (a + (((b - a) * frac) >> 8)) / 32768.0;
+}
+
+#else
+
 /**
  * @brief Calculate sine wave value.
  *
@@ -42,6 +112,8 @@ static double sine_val(uint32_t time, uint32_t period)
 	return sin(angle);
 }
 
+#endif /* CONFIG_WAVE_GEN_LIB_SINE_LUT */
+
 /**
  * @brief Calculate triangle wave value.
  *
@@ -7,6 +7,7 @@
 #include <zephyr.h>
 #include <supl_session.h>
 #include <stdio.h>
+#include <string.h>
 #include <logging/log.h>
 #include <net/socket.h>
 
@@ -18,22 +19,87 @@
 
 static int supl_fd;
 
+/* Server address resolved during a previous session. Reused for subsequent
+ * sessions to skip hostname resolution.
+ */
+static struct sockaddr_in server_addr;
+static bool server_addr_valid;
+
+static int server_connect(void)
+{
+	int err;
+	char ip[INET_ADDRSTRLEN] = { 0 };
+
+	/* Create socket */
+	supl_fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (supl_fd < 0) {
+		printk("Failed to create socket, errno %d\n", errno);
+		return -1;
+	}
+
+	struct timeval timeout = {
+		.tv_sec = 1,
+		.tv_usec = 0,
+	};
+
+	err = setsockopt(supl_fd,
+			 SOL_SOCKET,
+			 SO_RCVTIMEO,
+			 &timeout,
+			 sizeof(timeout));
+	if (err) {
+		printk("Failed to setup socket timeout, errno %d\n", errno);
+		goto cleanup;
+	}
+
+	inet_ntop(AF_INET,
+		  (void *)&server_addr.sin_addr,
+		  ip,
+		  INET_ADDRSTRLEN);
+	printk("Connecting to %s port %d\n",
+		ip,
+		ntohs(server_addr.sin_port));
+
+	err = connect(supl_fd,
+		      (struct sockaddr *)&server_addr,
+		      sizeof(server_addr));
+	if (err) {
+		printk("Unable to connect, errno %d\n", errno);
+		goto cleanup;
+	}
+
+	return 0;
+
+cleanup:
+	close(supl_fd);
+	supl_fd = -1;
+	return -1;
+}
+
 int open_supl_socket(void)
 {
 	int err = -1;
-	int proto;
 	int gai_cnt = 0;
 	uint16_t port;
 	struct addrinfo *addr;
 	struct addrinfo *info;
 
-	proto = IPPROTO_TCP;
+	/* Reuse the server address resolved during a previous session. */
+	if (server_addr_valid) {
+		if (server_connect() == 0) {
+			return 0;
+		}
+
+		/* The address may have gone stale, fall back to resolution. */
+		server_addr_valid = false;
+	}
+
 	port = htons(SUPL_SERVER_PORT);
 
 	struct addrinfo hints = {
 		.ai_family = AF_INET,
 		.ai_socktype = SOCK_STREAM,
-		.ai_protocol = proto,
+		.ai_protocol = IPPROTO_TCP,
 		/* Either a valid,
 		 * NULL-terminated access point name or NULL.
 		 */
@@ -59,33 +125,10 @@ int open_supl_socket(void)
 		}
 	} while (err);
 
-	/* Create socket */
-	supl_fd = socket(AF_INET, SOCK_STREAM, proto);
-	if (supl_fd < 0) {
-		printk("Failed to create socket, errno %d\n", errno);
-		goto cleanup;
-	}
-
-	struct timeval timeout = {
-		.tv_sec = 1,
-		.tv_usec = 0,
-	};
-
-	err = setsockopt(supl_fd,
-			 SOL_SOCKET,
-			 SO_RCVTIMEO,
-			 &timeout,
-			 sizeof(timeout));
-	if (err) {
-		printk("Failed to setup socket timeout, errno %d\n", errno);
-		return -1;
-	}
-
 	/* Not connected */
 	err = -1;
 
 	for (addr = info; addr != NULL; addr = addr->ai_next) {
-		char ip[INET_ADDRSTRLEN] = { 0 };
 		struct sockaddr *const sa = addr->ai_addr;
 
 		if (sa->sa_family != AF_INET) {
@@ -94,36 +137,21 @@ int open_supl_socket(void)
 		}
 
 		((struct sockaddr_in *)sa)->sin_port = port;
+		memcpy(&server_addr, sa, sizeof(server_addr));
 
-		inet_ntop(AF_INET,
-			  (void *)&((struct sockaddr_in *)sa)->sin_addr,
-			  ip,
-			  INET_ADDRSTRLEN);
-		printk("Connecting to %s port %d\n",
-			ip,
-			ntohs(port));
-
-		err = connect(supl_fd, sa, addr->ai_addrlen);
-		if (err) {
-			/* Try the next address */
-			printk("Unable to connect, errno %d\n", errno);
-		} else {
+		err = server_connect();
+		if (err == 0) {
 			/* Connected */
+			server_addr_valid = true;
 			break;
 		}
+
+		/* Try the next address */
 	}
 
-cleanup:
 	freeaddrinfo(info);
 
-	if (err) {
-		/* Unable to connect, close socket */
-		close(supl_fd);
-		supl_fd = -1;
-		return -1;
-	}
-
-	return 0;
+	return err ? -1 : 0;
 }
 
 void close_supl_socket(void)
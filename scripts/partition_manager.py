@@ -872,6 +872,10 @@ This file contains all addresses and sizes of all partitions.
                             choices=[START_TO_END, END_TO_START, COMPLEX], default=START_TO_END)
         parser.add_argument(f'--{x}-device', required=False, type=str, default='')
         parser.add_argument(f'--{x}-dynamic-partition', required=False, type=str, help='Name of dynamic partition')
+        parser.add_argument(f'--{x}-erase-block-size', required=False, type=lambda z: int(z, 0), default=0,
+                            help='Erase block size of the region, for compile-time geometry output')
+        parser.add_argument(f'--{x}-write-block-size', required=False, type=lambda z: int(z, 0), default=0,
+                            help='Write block size of the region, for compile-time geometry output')
 
     ranges_configuration = parser.parse_args(region_args)
 
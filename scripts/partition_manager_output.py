@@ -78,6 +78,15 @@ def get_config_lines(gpm_config, greg_config, head, split, dest, current_domain=
             if dest is DEST_HEADER:
                 if partition_has_device(partition):
                     add_line(f'{name_upper}_DEV_NAME', f"\"{region['device']}\"")
+                    # Flash geometry of the region backing the partition, so
+                    # that stream_flash buffer sizes and erase batches can be
+                    # derived at compile time.
+                    if region.get('erase_block_size'):
+                        add_line(f'{name_upper}_ERASE_BLOCK_SIZE',
+                                 hex(region['erase_block_size']))
+                    if region.get('write_block_size'):
+                        add_line(f'{name_upper}_WRITE_BLOCK_SIZE',
+                                 hex(region['write_block_size']))
             elif dest is DEST_KCONFIG:
                 if 'span' in partition.keys():
                     add_line(f'{name_upper}_SPAN', string_of_strings(partition['span']))
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2021 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+
+import argparse
+from os import path
+
+HEADER = '''/* File generated by {0} from {1}, do not modify */
+
+#include <stddef.h>
+
+const double sensor_sim_trace[][3] = {{
+'''
+
+FOOTER = '''};
+
+const size_t sensor_sim_trace_len =
+\tsizeof(sensor_sim_trace) / sizeof(sensor_sim_trace[0]);
+'''
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description='Compile a recorded sensor capture into a const C table '
+                    'replayed by the sensor_sim driver.',
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+
+    parser.add_argument('--input', required=True,
+                        help='CSV file with one "x,y,z" sample per line. '
+                             'Lines starting with "#" and a non-numeric '
+                             'header line are skipped.')
+    parser.add_argument('--output', required=True,
+                        help='C file to generate.')
+
+    return parser.parse_args()
+
+
+def parse_samples(csv_file):
+    samples = list()
+
+    with open(csv_file, 'r') as f:
+        for lineno, line in enumerate(f, start=1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+
+            fields = line.split(',')
+            if len(fields) != 3:
+                raise RuntimeError(
+                    f'{csv_file}:{lineno}: expected 3 fields, '
+                    f'got {len(fields)}')
+
+            try:
+                samples.append(tuple(float(field) for field in fields))
+            except ValueError:
+                if lineno == 1:
+                    # Allow a header line.
+                    continue
+                raise RuntimeError(
+                    f'{csv_file}:{lineno}: non-numeric sample')
+
+    if not samples:
+        raise RuntimeError(f'{csv_file}: no samples found')
+
+    return samples
+
+
+def main():
+    args = parse_args()
+    samples = parse_samples(args.input)
+
+    with open(args.output, 'w') as out:
+        out.write(HEADER.format(path.basename(__file__),
+                                path.basename(args.input)))
+        for x, y, z in samples:
+            out.write(f'\t{{{x!r}, {y!r}, {z!r}}},\n')
+        out.write(FOOTER)
+
+
+if __name__ == '__main__':
+    main()
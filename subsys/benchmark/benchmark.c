@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <logging/log.h>
+#include <sys/byteorder.h>
+#include <benchmark.h>
+
+LOG_MODULE_REGISTER(benchmark, CONFIG_BENCHMARK_LOG_LEVEL);
+
+/* Frame layout: | seq (4 B) | tx timestamp (4 B) | payload pattern |. */
+#define FRAME_SEQ_OFFSET 0
+#define FRAME_TS_OFFSET  4
+
+BUILD_ASSERT(BENCHMARK_FRAME_OVERHEAD == (FRAME_TS_OFFSET + 4));
+
+static struct {
+	struct benchmark_config config;
+	struct benchmark_stats stats;
+	struct k_work_delayable send_work;
+	int64_t start_time;
+	uint32_t seq;
+	uint32_t latency_sum_ms;
+	uint32_t interval_ms;
+	bool running;
+} bm;
+
+static uint8_t frame_buf[CONFIG_BENCHMARK_MAX_FRAME_LEN];
+
+static void stats_finalize(void)
+{
+	bm.stats.duration_ms = (uint32_t)(k_uptime_get() - bm.start_time);
+
+	if (bm.stats.duration_ms > 0) {
+		bm.stats.goodput_bps = (uint32_t)
+			(((uint64_t)bm.stats.bytes_sent * 8U * MSEC_PER_SEC) /
+			 bm.stats.duration_ms);
+	}
+
+	if (bm.stats.frames_echoed > 0) {
+		bm.stats.latency_avg_ms =
+			bm.latency_sum_ms / bm.stats.frames_echoed;
+	}
+}
+
+static void frame_send(void)
+{
+	int err;
+
+	sys_put_le32(bm.seq, &frame_buf[FRAME_SEQ_OFFSET]);
+	sys_put_le32((uint32_t)k_uptime_get(), &frame_buf[FRAME_TS_OFFSET]);
+	bm.seq++;
+
+	err = bm.config.send(frame_buf, bm.config.frame_len);
+	if (err) {
+		bm.stats.frames_failed++;
+	} else {
+		bm.stats.frames_sent++;
+		bm.stats.bytes_sent += bm.config.frame_len;
+	}
+}
+
+static void send_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	int64_t elapsed = k_uptime_get() - bm.start_time;
+
+	if (!bm.running) {
+		return;
+	}
+
+	if (elapsed >= bm.config.duration_ms) {
+		bm.running = false;
+		stats_finalize();
+		LOG_INF("Benchmark finished: %u frames, %u bps",
+			bm.stats.frames_sent, bm.stats.goodput_bps);
+		return;
+	}
+
+	switch (bm.config.workload) {
+	case BENCHMARK_WORKLOAD_BURST:
+		for (uint16_t i = 0; i < bm.config.burst_frames; i++) {
+			frame_send();
+		}
+		break;
+
+	case BENCHMARK_WORKLOAD_RAMP:
+		/* Shrink the interval linearly with the elapsed time. */
+		bm.interval_ms = bm.config.interval_ms -
+			(uint32_t)((uint64_t)bm.config.interval_ms * elapsed /
+				   bm.config.duration_ms);
+		frame_send();
+		break;
+
+	case BENCHMARK_WORKLOAD_FIXED_RATE:
+	default:
+		frame_send();
+		break;
+	}
+
+	k_work_reschedule(&bm.send_work, K_MSEC(MAX(bm.interval_ms, 1U)));
+}
+
+int benchmark_start(const struct benchmark_config *config)
+{
+	if ((config == NULL) || (config->send == NULL) ||
+	    (config->frame_len < BENCHMARK_FRAME_OVERHEAD) ||
+	    (config->frame_len > sizeof(frame_buf)) ||
+	    (config->duration_ms == 0) ||
+	    ((config->workload == BENCHMARK_WORKLOAD_BURST) &&
+	     (config->burst_frames == 0))) {
+		return -EINVAL;
+	}
+
+	if (bm.running) {
+		return -EALREADY;
+	}
+
+	bm.config = *config;
+	memset(&bm.stats, 0, sizeof(bm.stats));
+	bm.latency_sum_ms = 0;
+	bm.seq = 0;
+	bm.interval_ms = config->interval_ms;
+
+	/* Fill the payload with a fixed pattern after the frame header. */
+	for (size_t i = BENCHMARK_FRAME_OVERHEAD; i < config->frame_len; i++) {
+		frame_buf[i] = (uint8_t)i;
+	}
+
+	bm.start_time = k_uptime_get();
+	bm.running = true;
+
+	k_work_init_delayable(&bm.send_work, send_work_handler);
+	k_work_reschedule(&bm.send_work, K_NO_WAIT);
+
+	return 0;
+}
+
+void benchmark_stop(void)
+{
+	if (!bm.running) {
+		return;
+	}
+
+	bm.running = false;
+	(void)k_work_cancel_delayable(&bm.send_work);
+	stats_finalize();
+}
+
+void benchmark_received(const uint8_t *buf, size_t len)
+{
+	uint32_t seq;
+	uint32_t tx_ts;
+	uint32_t latency;
+
+	if ((buf == NULL) || (len < BENCHMARK_FRAME_OVERHEAD)) {
+		return;
+	}
+
+	seq = sys_get_le32(&buf[FRAME_SEQ_OFFSET]);
+	if (seq >= bm.seq) {
+		/* Not a frame generated by this run. */
+		return;
+	}
+
+	tx_ts = sys_get_le32(&buf[FRAME_TS_OFFSET]);
+	latency = (uint32_t)k_uptime_get() - tx_ts;
+
+	bm.stats.frames_echoed++;
+	bm.latency_sum_ms += latency;
+	bm.stats.latency_max_ms = MAX(bm.stats.latency_max_ms, latency);
+}
+
+void benchmark_stats_get(struct benchmark_stats *stats)
+{
+	if (bm.running) {
+		stats_finalize();
+	}
+
+	*stats = bm.stats;
+}
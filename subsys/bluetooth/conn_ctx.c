@@ -15,6 +15,76 @@ static void bt_conn_ctx_mem_free(struct k_mem_slab *mem_slab, void **data)
 	*data = NULL;
 }
 
+static size_t conn_hash(const struct bt_conn *conn)
+{
+	/* Connection objects are elements of a static array, drop the bits
+	 * that are constant for all of them.
+	 */
+	return (((uintptr_t)conn) >> 4) % BT_CONN_CTX_HASH_SLOTS;
+}
+
+/* Must be called with the library mutex locked. */
+static void hash_map_rebuild(struct bt_conn_ctx_lib *ctx_lib)
+{
+	memset(ctx_lib->hash_map, 0, sizeof(ctx_lib->hash_map));
+
+	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
+		const struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
+
+		if (ctx->conn) {
+			size_t slot = conn_hash(ctx->conn);
+
+			while (ctx_lib->hash_map[slot] != 0) {
+				slot = (slot + 1) % BT_CONN_CTX_HASH_SLOTS;
+			}
+			ctx_lib->hash_map[slot] = i + 1;
+		}
+	}
+}
+
+/* Looks the connection up without taking the library mutex. The result is
+ * verified against the entry contents after its lock is taken.
+ */
+static struct bt_conn_ctx *hash_map_find(struct bt_conn_ctx_lib *ctx_lib,
+					 const struct bt_conn *conn)
+{
+	size_t slot = conn_hash(conn);
+
+	for (size_t n = 0; n < BT_CONN_CTX_HASH_SLOTS; n++) {
+		uint8_t idx = ctx_lib->hash_map[slot];
+
+		if (idx == 0) {
+			return NULL;
+		}
+
+		if (ctx_lib->ctx[idx - 1].conn == conn) {
+			return &ctx_lib->ctx[idx - 1];
+		}
+
+		slot = (slot + 1) % BT_CONN_CTX_HASH_SLOTS;
+	}
+
+	return NULL;
+}
+
+static void ctx_lib_init(struct bt_conn_ctx_lib *ctx_lib)
+{
+	if (atomic_get(&ctx_lib->initialized)) {
+		return;
+	}
+
+	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+
+	if (!atomic_get(&ctx_lib->initialized)) {
+		for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
+			k_mutex_init(&ctx_lib->ctx[i].lock);
+		}
+		atomic_set(&ctx_lib->initialized, 1);
+	}
+
+	k_mutex_unlock(ctx_lib->mutex);
+}
+
 void *bt_conn_ctx_alloc(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 {
 	__ASSERT_NO_MSG(conn != NULL);
@@ -23,6 +93,8 @@ void *bt_conn_ctx_alloc(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	int err = -ENOMEM;
 	struct bt_conn_ctx *ctx;
 
+	ctx_lib_init(ctx_lib);
+
 	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
 	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
@@ -34,6 +106,13 @@ void *bt_conn_ctx_alloc(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 					       K_NO_WAIT);
 			if (!err) {
 				ctx->conn = conn;
+				hash_map_rebuild(ctx_lib);
+
+				/* The entry is returned locked, its free
+				 * lock is taken without waiting.
+				 */
+				k_mutex_lock(&ctx->lock, K_FOREVER);
+				k_mutex_unlock(ctx_lib->mutex);
 
 				LOG_DBG("The memory for the connection context "
 					"has been allocated, conn %p, index: %u",
@@ -59,15 +138,23 @@ int bt_conn_ctx_free(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
+	ctx_lib_init(ctx_lib);
+
 	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
 	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
 		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
 
 		if (ctx->conn == conn) {
+			/* Wait until the current user releases the entry. */
+			k_mutex_lock(&ctx->lock, K_FOREVER);
+
 			bt_conn_ctx_mem_free(ctx_lib->mem_slab, &ctx->data);
 			ctx->conn = NULL;
 			ctx->data = NULL;
+			hash_map_rebuild(ctx_lib);
+
+			k_mutex_unlock(&ctx->lock);
 
 			LOG_DBG("The context memory for the connection "
 				"has been released, conn %p index %u",
@@ -89,18 +176,26 @@ void bt_conn_ctx_free_all(struct bt_conn_ctx_lib *ctx_lib)
 {
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
+	ctx_lib_init(ctx_lib);
+
 	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
 	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
 		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
 
 		if (ctx->data != NULL) {
+			k_mutex_lock(&ctx->lock, K_FOREVER);
+
 			k_mem_slab_free(ctx_lib->mem_slab, &ctx->data);
 			ctx->conn = NULL;
 			ctx->data = NULL;
+
+			k_mutex_unlock(&ctx->lock);
 		}
 	}
 
+	hash_map_rebuild(ctx_lib);
+
 	k_mutex_unlock(ctx_lib->mutex);
 
 	LOG_DBG("All allocated memory has been released");
@@ -111,22 +206,47 @@ void *bt_conn_ctx_get(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
+	struct bt_conn_ctx *ctx;
+
+	ctx_lib_init(ctx_lib);
+
+	/* Fast path: the lookup table is read without the library mutex and
+	 * the result is verified after the entry lock is taken.
+	 */
+	ctx = hash_map_find(ctx_lib, conn);
+	if (ctx) {
+		k_mutex_lock(&ctx->lock, K_FOREVER);
+
+		if (ctx->conn == conn) {
+			LOG_DBG("Memory block found for the connection");
+
+			return ctx->data;
+		}
+
+		/* The entry was reassigned in the meantime. */
+		k_mutex_unlock(&ctx->lock);
+	}
+
+	/* Slow path: the lookup raced with a table change. */
 	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
 	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
+		ctx = &ctx_lib->ctx[i];
 
 		if (ctx->conn == conn) {
+			k_mutex_lock(&ctx->lock, K_FOREVER);
+			k_mutex_unlock(ctx_lib->mutex);
+
 			LOG_DBG("Memory block found for the connection");
 
 			return ctx->data;
 		}
 	}
 
-	LOG_WRN("No memory block for connection");
-
 	k_mutex_unlock(ctx_lib->mutex);
 
+	LOG_WRN("No memory block for connection");
+
 	return NULL;
 }
 
@@ -135,15 +255,17 @@ const struct bt_conn_ctx *bt_conn_ctx_get_by_id(struct bt_conn_ctx_lib *ctx_lib,
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 	__ASSERT_NO_MSG(id < bt_conn_ctx_count(ctx_lib));
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+	ctx_lib_init(ctx_lib);
 
 	struct bt_conn_ctx *ctx = &ctx_lib->ctx[id];
 
-	if (ctx_lib->ctx[id].conn != NULL) {
+	k_mutex_lock(&ctx->lock, K_FOREVER);
+
+	if (ctx->conn != NULL) {
 		return ctx;
 	}
 
-	k_mutex_unlock(ctx_lib->mutex);
+	k_mutex_unlock(&ctx->lock);
 
 	return NULL;
 }
@@ -157,7 +279,7 @@ void bt_conn_ctx_release(struct bt_conn_ctx_lib *ctx_lib, void *ctx_data)
 		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
 
 		if (ctx->data == ctx_data) {
-			k_mutex_unlock(ctx_lib->mutex);
+			k_mutex_unlock(&ctx->lock);
 
 			return;
 		}
@@ -50,11 +50,11 @@ int bt_encrypt_le(const uint8_t key[BT_ECB_BLOCK_SIZE],
 	sys_memcpy_swap(key_le, key, BT_ECB_BLOCK_SIZE);
 	sys_memcpy_swap(plaintext_le, plaintext, BT_ECB_BLOCK_SIZE);
 
-	int errcode = MULTITHREADING_LOCK_ACQUIRE();
+	int errcode = MULTITHREADING_LOCK_ACQUIRE_DOMAIN(MULTITHREADING_LOCK_DOMAIN_CRYPTO);
 
 	if (!errcode) {
 		errcode = sdc_soc_ecb_block_encrypt(key_le, plaintext_le, enc_data_le);
-		MULTITHREADING_LOCK_RELEASE();
+		MULTITHREADING_LOCK_RELEASE_DOMAIN(MULTITHREADING_LOCK_DOMAIN_CRYPTO);
 	}
 
 	if (!errcode) {
@@ -73,11 +73,11 @@ int bt_encrypt_be(const uint8_t key[BT_ECB_BLOCK_SIZE],
 	BT_HEXDUMP_DBG(key, BT_ECB_BLOCK_SIZE, "key");
 	BT_HEXDUMP_DBG(plaintext, BT_ECB_BLOCK_SIZE, "plaintext");
 
-	int errcode = MULTITHREADING_LOCK_ACQUIRE();
+	int errcode = MULTITHREADING_LOCK_ACQUIRE_DOMAIN(MULTITHREADING_LOCK_DOMAIN_CRYPTO);
 
 	if (!errcode) {
 		errcode = sdc_soc_ecb_block_encrypt(key, plaintext, enc_data);
-		MULTITHREADING_LOCK_RELEASE();
+		MULTITHREADING_LOCK_RELEASE_DOMAIN(MULTITHREADING_LOCK_DOMAIN_CRYPTO);
 	}
 
 	if (!errcode) {
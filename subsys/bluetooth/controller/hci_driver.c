@@ -160,11 +160,11 @@ static int acl_handle(struct net_buf *acl)
 {
 	BT_DBG("");
 
-	int errcode = MULTITHREADING_LOCK_ACQUIRE();
+	int errcode = MULTITHREADING_LOCK_ACQUIRE_DOMAIN(MULTITHREADING_LOCK_DOMAIN_DATA);
 
 	if (!errcode) {
 		errcode = sdc_hci_data_put(acl->data);
-		MULTITHREADING_LOCK_RELEASE();
+		MULTITHREADING_LOCK_RELEASE_DOMAIN(MULTITHREADING_LOCK_DOMAIN_DATA);
 
 		if (errcode) {
 			/* Likely buffer overflow event */
@@ -337,10 +337,10 @@ static bool fetch_and_process_acl_data(uint8_t *p_hci_buffer)
 {
 	int errcode;
 
-	errcode = MULTITHREADING_LOCK_ACQUIRE();
+	errcode = MULTITHREADING_LOCK_ACQUIRE_DOMAIN(MULTITHREADING_LOCK_DOMAIN_DATA);
 	if (!errcode) {
 		errcode = sdc_hci_data_get(p_hci_buffer);
-		MULTITHREADING_LOCK_RELEASE();
+		MULTITHREADING_LOCK_RELEASE_DOMAIN(MULTITHREADING_LOCK_DOMAIN_DATA);
 	}
 
 	if (errcode) {
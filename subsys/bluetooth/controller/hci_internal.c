@@ -981,6 +981,44 @@ int hci_internal_cmd_put(uint8_t *cmd_in)
 	return 0;
 }
 
+int hci_internal_cmds_put(uint8_t *cmds_in, size_t len,
+			  hci_internal_evt_cb_t evt_cb, void *context)
+{
+	while (len > 0) {
+		struct bt_hci_cmd_hdr *cmd_hdr = (void *)cmds_in;
+		size_t cmd_len;
+		int err;
+
+		if (len < BT_HCI_CMD_HDR_SIZE) {
+			return -EINVAL;
+		}
+
+		cmd_len = BT_HCI_CMD_HDR_SIZE + cmd_hdr->param_len;
+		if (cmd_len > len) {
+			return -EINVAL;
+		}
+
+		err = hci_internal_cmd_put(cmds_in);
+		if (err) {
+			return err;
+		}
+
+		/* Hand the completion event to the transport before the next
+		 * command runs, so the batch keeps the same ordering
+		 * guarantees as individually submitted commands.
+		 */
+		if (cmd_complete_or_status.occurred) {
+			cmd_complete_or_status.occurred = false;
+			evt_cb(&cmd_complete_or_status.raw_event[0], context);
+		}
+
+		cmds_in += cmd_len;
+		len -= cmd_len;
+	}
+
+	return 0;
+}
+
 int hci_internal_evt_get(uint8_t *evt_out)
 {
 	if (cmd_complete_or_status.occurred) {
@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifndef HCI_INTERNAL_H__
 #define HCI_INTERNAL_H__
@@ -24,6 +25,38 @@
  */
 int hci_internal_cmd_put(uint8_t *cmd_in);
 
+/** @brief Completion event callback for @ref hci_internal_cmds_put.
+ *
+ * @param[in] evt     HCI event packet. The first byte corresponds to Event
+ *                    Code, as specified by the Bluetooth Core Specification.
+ * @param[in] context Context pointer given to @ref hci_internal_cmds_put.
+ */
+typedef void (*hci_internal_evt_cb_t)(uint8_t *evt, void *context);
+
+/** @brief Send a batch of HCI command packets to the SoftDevice Controller.
+ *
+ * Processes a sequence of concatenated HCI command packets from a single
+ * buffer, for transports that deliver more than one command per exchange.
+ * Each command's Command Complete or Command Status event is delivered
+ * through the event callback, in command order, before the next command in
+ * the batch is processed. Commands that complete without an immediate event
+ * do not trigger the callback.
+ *
+ * Processing stops at the first malformed or rejected command.
+ *
+ * @param[in] cmds_in Buffer of concatenated HCI Command packets. The first
+ *                    byte of each packet should correspond to OpCode, as
+ *                    specified by the Bluetooth Core Specification.
+ * @param[in] len     Total length of the command packets in bytes.
+ * @param[in] evt_cb  Callback invoked with each command's completion event.
+ *                    The event buffer is only valid during the callback.
+ * @param[in] context Context pointer passed to the callback.
+ *
+ * @return Zero on success or (negative) error code otherwise.
+ */
+int hci_internal_cmds_put(uint8_t *cmds_in, size_t len,
+			  hci_internal_evt_cb_t evt_cb, void *context);
+
 /** @brief Retrieve an HCI event packet from the SoftDevice Controller.
  *
  * This API is non-blocking.
@@ -11,6 +11,12 @@
 #include <bluetooth/hci.h>
 #include <bluetooth/crypto.h>
 
+#ifdef CONFIG_BT_ENOCEAN_KEY_CACHE
+#include <tinycrypt/aes.h>
+#include <tinycrypt/ccm_mode.h>
+#include <tinycrypt/constants.h>
+#endif
+
 #define BT_DBG_ENABLED IS_ENABLED(CONFIG_BT_ENOCEAN_DEBUG)
 #define LOG_MODULE_NAME bt_enocean
 #include "common/log.h"
@@ -50,6 +56,19 @@ static const struct bt_enocean_callbacks *cb;
 static struct k_work_delayable work;
 static bool commissioning;
 
+#ifdef CONFIG_BT_ENOCEAN_KEY_CACHE
+/* Expanded key schedules, built lazily on the first authentication: */
+static struct tc_aes_key_sched_struct key_sched[CONFIG_BT_ENOCEAN_DEVICES_MAX];
+static ATOMIC_DEFINE(key_sched_valid, CONFIG_BT_ENOCEAN_DEVICES_MAX);
+#endif
+
+static void key_sched_invalidate(const struct bt_enocean_device *dev)
+{
+#ifdef CONFIG_BT_ENOCEAN_KEY_CACHE
+	atomic_clear_bit(key_sched_valid, dev - &devices[0]);
+#endif
+}
+
 static struct bt_enocean_device *device_find(const bt_addr_le_t *addr)
 {
 	for (int i = 0; i < ARRAY_SIZE(devices); ++i) {
@@ -72,6 +91,7 @@ static struct bt_enocean_device *device_alloc(const bt_addr_le_t *addr,
 			devices[i].seq = seq;
 			memcpy(devices[i].key, key, sizeof(devices[i].key));
 			devices[i].flags = 0;
+			key_sched_invalidate(&devices[i]);
 			return &devices[i];
 		}
 	}
@@ -121,6 +141,42 @@ static int store_new_dev(const struct bt_enocean_device *dev)
 	return settings_save_one(tag, &dev->seq, 4);
 }
 
+#ifdef CONFIG_BT_ENOCEAN_KEY_CACHE
+static int auth_cached(const struct bt_enocean_device *dev,
+		       struct nonce *nonce, const uint8_t *signature,
+		       const uint8_t *payload, uint8_t len)
+{
+	int index = dev - &devices[0];
+	struct tc_ccm_mode_struct ccm;
+	uint8_t plain[1];
+
+	if (!atomic_test_bit(key_sched_valid, index)) {
+		if (tc_aes128_set_encrypt_key(&key_sched[index], dev->key) !=
+		    TC_CRYPTO_SUCCESS) {
+			return -EIO;
+		}
+
+		atomic_set_bit(key_sched_valid, index);
+	}
+
+	if (tc_ccm_config(&ccm, &key_sched[index], (uint8_t *)nonce,
+			  sizeof(*nonce), SIGNATURE_LEN) != TC_CRYPTO_SUCCESS) {
+		return -EINVAL;
+	}
+
+	/* Zero length ciphertext: The signature is only a MIC over the
+	 * payload, which goes in as associated data.
+	 */
+	if (tc_ccm_decryption_verification(plain, sizeof(plain), payload, len,
+					   signature, SIGNATURE_LEN,
+					   &ccm) != TC_CRYPTO_SUCCESS) {
+		return -EBADMSG;
+	}
+
+	return 0;
+}
+#endif
+
 static int auth(const struct bt_enocean_device *dev, uint32_t seq,
 		const uint8_t *signature, const uint8_t *payload, uint8_t len)
 {
@@ -131,8 +187,12 @@ static int auth(const struct bt_enocean_device *dev, uint32_t seq,
 	nonce.seq = seq;
 	memset(nonce.padding, 0, sizeof(nonce.padding));
 
+#ifdef CONFIG_BT_ENOCEAN_KEY_CACHE
+	err = auth_cached(dev, &nonce, signature, payload, len);
+#else
 	err = bt_ccm_decrypt(dev->key, (uint8_t *)&nonce, signature, 0, payload,
 			     len, NULL, SIGNATURE_LEN);
+#endif
 	if (err) {
 		return err;
 	}
@@ -490,6 +550,7 @@ static int settings_set(const char *key, size_t len, settings_read_cb read_cb,
 		bt_addr_le_copy(&dev->addr, &entry.addr);
 		memcpy(dev->key, entry.key, sizeof(dev->key));
 		dev->flags |= FLAG_ACTIVE;
+		key_sched_invalidate(dev);
 
 		BT_DBG("Loaded %s", bt_addr_le_str(&dev->addr));
 		return 0;
@@ -604,6 +665,7 @@ void bt_enocean_decommission(struct bt_enocean_device *dev)
 	}
 
 	dev->flags = 0;
+	key_sched_invalidate(dev);
 }
 
 uint32_t bt_enocean_foreach(bt_enocean_foreach_cb_t cb, void *user_data)
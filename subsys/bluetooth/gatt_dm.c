@@ -10,6 +10,11 @@
 
 #include <bluetooth/gatt_dm.h>
 
+#ifdef CONFIG_BT_GATT_DM_DATA_CACHE
+#include <sys/byteorder.h>
+#include <settings/settings.h>
+#endif
+
 LOG_MODULE_REGISTER(bt_gatt_dm, CONFIG_BT_GATT_DM_LOG_LEVEL);
 
 /* Available sizes: 128, 512, 2048... */
@@ -60,6 +65,17 @@ struct bt_gatt_dm {
 
 	/* The pointer to callback structure */
 	const struct bt_gatt_dm_cb *callback;
+
+#ifdef CONFIG_BT_GATT_DM_DATA_CACHE
+	/* Parameters of the Database Hash characteristic read */
+	struct bt_gatt_read_params hash_read_params;
+	/* Database Hash value reported by the peer */
+	uint8_t peer_hash[16];
+	/* The peer reported a valid Database Hash */
+	bool hash_valid;
+	/* Attributes were restored from the cache */
+	bool from_cache;
+#endif
 };
 
 /* Currently only one instance is supported */
@@ -236,9 +252,420 @@ static struct bt_gatt_dm_attr *attr_find_by_handle(
 	return NULL;
 }
 
+#ifdef CONFIG_BT_GATT_DM_DATA_CACHE
+
+static void discovery_complete(struct bt_gatt_dm *dm);
+static void discovery_complete_error(struct bt_gatt_dm *dm, int err);
+
+/* Settings subtree used by the discovery cache */
+#define CACHE_SETTINGS_BASE "bt_dm"
+/* Base + "/" + address in hex with type + "/" + UUID string */
+#define CACHE_KEY_LEN (sizeof(CACHE_SETTINGS_BASE) + 14 + BT_UUID_STR_LEN)
+/* Size of the Database Hash characteristic value */
+#define CACHE_HASH_SIZE 16
+/* Worst case serialized attribute: header, 128-bit declaration UUID,
+ * characteristic value handle and properties, 128-bit value UUID.
+ */
+#define CACHE_ATTR_MAX_SIZE (3 + 17 + 3 + 17)
+
+static size_t uuid_raw_size(uint8_t type)
+{
+	switch (type) {
+	case BT_UUID_TYPE_16:
+		return BT_UUID_SIZE_16;
+	case BT_UUID_TYPE_32:
+		return BT_UUID_SIZE_32;
+	case BT_UUID_TYPE_128:
+		return BT_UUID_SIZE_128;
+	default:
+		return 0;
+	}
+}
+
+static size_t cache_uuid_encode(uint8_t *buf, const struct bt_uuid *uuid)
+{
+	buf[0] = uuid->type;
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		sys_put_le16(BT_UUID_16(uuid)->val, &buf[1]);
+		break;
+	case BT_UUID_TYPE_32:
+		sys_put_le32(BT_UUID_32(uuid)->val, &buf[1]);
+		break;
+	case BT_UUID_TYPE_128:
+		memcpy(&buf[1], BT_UUID_128(uuid)->val, BT_UUID_SIZE_128);
+		break;
+	default:
+		__ASSERT_NO_MSG(false);
+		break;
+	}
+
+	return 1 + uuid_raw_size(uuid->type);
+}
+
+static size_t cache_uuid_decode(const uint8_t *buf, size_t len,
+				struct bt_uuid_128 *uuid)
+{
+	size_t raw_size;
+
+	if (len < 1) {
+		return 0;
+	}
+
+	raw_size = uuid_raw_size(buf[0]);
+	if ((raw_size == 0) || (len < 1 + raw_size)) {
+		return 0;
+	}
+
+	uuid->uuid.type = buf[0];
+	switch (buf[0]) {
+	case BT_UUID_TYPE_16:
+		((struct bt_uuid_16 *)&uuid->uuid)->val = sys_get_le16(&buf[1]);
+		break;
+	case BT_UUID_TYPE_32:
+		((struct bt_uuid_32 *)&uuid->uuid)->val = sys_get_le32(&buf[1]);
+		break;
+	case BT_UUID_TYPE_128:
+		memcpy(uuid->val, &buf[1], BT_UUID_SIZE_128);
+		break;
+	}
+
+	return 1 + raw_size;
+}
+
+static void cache_key_get(char *key, size_t size, const struct bt_gatt_dm *dm)
+{
+	const bt_addr_le_t *addr = bt_conn_get_dst(dm->conn);
+	int len;
+
+	len = snprintk(key, size,
+		       CACHE_SETTINGS_BASE "/%02x%02x%02x%02x%02x%02x%u/",
+		       addr->a.val[5], addr->a.val[4], addr->a.val[3],
+		       addr->a.val[2], addr->a.val[1], addr->a.val[0],
+		       addr->type);
+
+	if (dm->discover_params.uuid) {
+		bt_uuid_to_str(dm->discover_params.uuid,
+			       &key[len], size - len);
+	} else {
+		snprintk(&key[len], size - len, "any");
+	}
+}
+
+static size_t cache_attr_encode(uint8_t *buf, const struct bt_gatt_dm_attr *attr)
+{
+	struct bt_gatt_service_val *service_val;
+	struct bt_gatt_chrc *chrc;
+	size_t pos;
+
+	sys_put_le16(attr->handle, &buf[0]);
+	buf[2] = attr->perm;
+	pos = 3 + cache_uuid_encode(&buf[3], attr->uuid);
+
+	service_val = bt_gatt_dm_attr_service_val(attr);
+	chrc = bt_gatt_dm_attr_chrc_val(attr);
+
+	if (service_val) {
+		sys_put_le16(service_val->end_handle, &buf[pos]);
+		pos += 2;
+		pos += cache_uuid_encode(&buf[pos], service_val->uuid);
+	} else if (chrc) {
+		buf[pos++] = chrc->properties;
+		sys_put_le16(chrc->value_handle, &buf[pos]);
+		pos += 2;
+		pos += cache_uuid_encode(&buf[pos], chrc->uuid);
+	}
+
+	return pos;
+}
+
+static void cache_store(struct bt_gatt_dm *dm)
+{
+	char key[CACHE_KEY_LEN];
+	uint8_t *buf;
+	size_t len = CACHE_HASH_SIZE;
+	int err;
+
+	buf = k_malloc(CACHE_HASH_SIZE +
+		       dm->cur_attr_id * CACHE_ATTR_MAX_SIZE);
+	if (!buf) {
+		LOG_WRN("No memory to cache the discovery data.");
+		return;
+	}
+
+	memcpy(buf, dm->peer_hash, CACHE_HASH_SIZE);
+	for (size_t i = 0; i < dm->cur_attr_id; i++) {
+		len += cache_attr_encode(&buf[len], &dm->attrs[i]);
+	}
+
+	cache_key_get(key, sizeof(key), dm);
+	err = settings_save_one(key, buf, len);
+	if (err) {
+		LOG_WRN("Cannot store the discovery data, error: %d.", err);
+	} else {
+		LOG_DBG("Discovery data cached under %s", log_strdup(key));
+	}
+
+	k_free(buf);
+}
+
+static int cache_attrs_restore(struct bt_gatt_dm *dm,
+			       const uint8_t *buf, size_t len)
+{
+	while (len > 0) {
+		struct bt_gatt_dm_attr *cur_attr;
+		struct bt_uuid_128 uuid;
+		struct bt_uuid_128 val_uuid;
+		size_t uuid_len;
+		uint16_t handle;
+		uint8_t perm;
+		uint8_t *attr_data;
+		size_t uuid_size;
+
+		if (len < 3) {
+			return -EINVAL;
+		}
+
+		handle = sys_get_le16(&buf[0]);
+		perm = buf[2];
+		buf += 3;
+		len -= 3;
+
+		uuid_len = cache_uuid_decode(buf, len, &uuid);
+		if (!uuid_len) {
+			return -EINVAL;
+		}
+		buf += uuid_len;
+		len -= uuid_len;
+
+		if (dm->cur_attr_id >= ARRAY_SIZE(dm->attrs)) {
+			return -ENOMEM;
+		}
+
+		uuid_size = get_uuid_size(&uuid.uuid);
+
+		if (!bt_uuid_cmp(BT_UUID_GATT_PRIMARY, &uuid.uuid) ||
+		    !bt_uuid_cmp(BT_UUID_GATT_SECONDARY, &uuid.uuid)) {
+			struct bt_gatt_service_val *service_val;
+			uint16_t end_handle;
+
+			if (len < 2) {
+				return -EINVAL;
+			}
+			end_handle = sys_get_le16(&buf[0]);
+			buf += 2;
+			len -= 2;
+
+			uuid_len = cache_uuid_decode(buf, len, &val_uuid);
+			if (!uuid_len) {
+				return -EINVAL;
+			}
+			buf += uuid_len;
+			len -= uuid_len;
+
+			attr_data = user_data_alloc(dm,
+				sizeof(*service_val) + uuid_size);
+			if (!attr_data) {
+				return -ENOMEM;
+			}
+
+			service_val = (struct bt_gatt_service_val *)attr_data;
+			service_val->end_handle = end_handle;
+			service_val->uuid = uuid_store(dm, &val_uuid.uuid);
+			if (!service_val->uuid) {
+				return -ENOMEM;
+			}
+
+			cur_attr = &dm->attrs[dm->cur_attr_id++];
+			cur_attr->uuid = (struct bt_uuid *)
+				&attr_data[sizeof(*service_val)];
+		} else if (!bt_uuid_cmp(BT_UUID_GATT_CHRC, &uuid.uuid)) {
+			struct bt_gatt_chrc *chrc;
+			uint16_t value_handle;
+			uint8_t properties;
+
+			if (len < 3) {
+				return -EINVAL;
+			}
+			properties = buf[0];
+			value_handle = sys_get_le16(&buf[1]);
+			buf += 3;
+			len -= 3;
+
+			uuid_len = cache_uuid_decode(buf, len, &val_uuid);
+			if (!uuid_len) {
+				return -EINVAL;
+			}
+			buf += uuid_len;
+			len -= uuid_len;
+
+			attr_data = user_data_alloc(dm,
+				sizeof(*chrc) + uuid_size);
+			if (!attr_data) {
+				return -ENOMEM;
+			}
+
+			chrc = (struct bt_gatt_chrc *)attr_data;
+			chrc->properties = properties;
+			chrc->value_handle = value_handle;
+			chrc->uuid = uuid_store(dm, &val_uuid.uuid);
+			if (!chrc->uuid) {
+				return -ENOMEM;
+			}
+
+			cur_attr = &dm->attrs[dm->cur_attr_id++];
+			cur_attr->uuid = (struct bt_uuid *)
+				&attr_data[sizeof(*chrc)];
+		} else {
+			attr_data = user_data_alloc(dm, uuid_size);
+			if (!attr_data) {
+				return -ENOMEM;
+			}
+
+			cur_attr = &dm->attrs[dm->cur_attr_id++];
+			cur_attr->uuid = (struct bt_uuid *)attr_data;
+		}
+
+		cur_attr->handle = handle;
+		cur_attr->perm = perm;
+		memcpy(cur_attr->uuid, &uuid, uuid_size);
+	}
+
+	return 0;
+}
+
+struct cache_load_ctx {
+	struct bt_gatt_dm *dm;
+	bool found;
+	bool stale;
+	int err;
+};
+
+static int cache_load_direct_cb(const char *key, size_t len,
+				settings_read_cb read_cb, void *cb_arg,
+				void *param)
+{
+	struct cache_load_ctx *ctx = param;
+	uint8_t *buf;
+	ssize_t read_len;
+
+	ctx->found = true;
+
+	buf = k_malloc(len);
+	if (!buf) {
+		ctx->err = -ENOMEM;
+		return 0;
+	}
+
+	read_len = read_cb(cb_arg, buf, len);
+	if ((read_len < (ssize_t)CACHE_HASH_SIZE) ||
+	    (memcmp(buf, ctx->dm->peer_hash, CACHE_HASH_SIZE) != 0)) {
+		ctx->stale = true;
+	} else {
+		ctx->err = cache_attrs_restore(ctx->dm,
+					       &buf[CACHE_HASH_SIZE],
+					       read_len - CACHE_HASH_SIZE);
+	}
+
+	k_free(buf);
+
+	return 0;
+}
+
+static int cache_load(struct bt_gatt_dm *dm)
+{
+	char key[CACHE_KEY_LEN];
+	struct cache_load_ctx ctx = {
+		.dm = dm,
+	};
+	struct bt_gatt_service_val *service_val;
+
+	cache_key_get(key, sizeof(key), dm);
+	settings_load_subtree_direct(key, cache_load_direct_cb, &ctx);
+
+	if (!ctx.found) {
+		return -ENOENT;
+	}
+
+	if (ctx.stale) {
+		LOG_DBG("Cached discovery data is stale, dropping");
+		settings_delete(key);
+		return -ENOENT;
+	}
+
+	if (ctx.err || (dm->cur_attr_id == 0)) {
+		/* Chunk memory allocated while parsing is reclaimed together
+		 * with the results of the discovery that follows.
+		 */
+		dm->cur_attr_id = 0;
+		return ctx.err ? ctx.err : -ENOENT;
+	}
+
+	service_val = bt_gatt_dm_attr_service_val(&dm->attrs[0]);
+	if (service_val) {
+		/* Allow bt_gatt_dm_continue to resume after this service. */
+		dm->discover_params.end_handle = service_val->end_handle;
+	}
+
+	return 0;
+}
+
+static uint8_t cache_hash_read_cb(struct bt_conn *conn, uint8_t att_err,
+				  struct bt_gatt_read_params *params,
+				  const void *data, uint16_t length)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(params, struct bt_gatt_dm,
+					     hash_read_params);
+	int err;
+
+	if (!att_err && data && (length == CACHE_HASH_SIZE)) {
+		memcpy(dm->peer_hash, data, CACHE_HASH_SIZE);
+		dm->hash_valid = true;
+
+		if (!cache_load(dm)) {
+			LOG_DBG("Discovery data restored from the cache");
+			dm->from_cache = true;
+			discovery_complete(dm);
+			return BT_GATT_ITER_STOP;
+		}
+	}
+
+	err = bt_gatt_discover(dm->conn, &dm->discover_params);
+	if (err) {
+		LOG_ERR("Discover failed, error: %d.", err);
+		discovery_complete_error(dm, err);
+	}
+
+	return BT_GATT_ITER_STOP;
+}
+
+static int cache_hash_read(struct bt_gatt_dm *dm)
+{
+	dm->hash_valid = false;
+	dm->from_cache = false;
+
+	memset(&dm->hash_read_params, 0, sizeof(dm->hash_read_params));
+	dm->hash_read_params.func = cache_hash_read_cb;
+	dm->hash_read_params.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+	dm->hash_read_params.by_uuid.start_handle = 0x0001;
+	dm->hash_read_params.by_uuid.end_handle = 0xffff;
+
+	return bt_gatt_read(dm->conn, &dm->hash_read_params);
+}
+
+#endif /* CONFIG_BT_GATT_DM_DATA_CACHE */
+
 static void discovery_complete(struct bt_gatt_dm *dm)
 {
 	LOG_DBG("Discovery complete.");
+
+#ifdef CONFIG_BT_GATT_DM_DATA_CACHE
+	if (dm->hash_valid && !dm->from_cache) {
+		cache_store(dm);
+	}
+#endif
+
 	atomic_set_bit(dm->state_flags, STATE_ATTRS_RELEASE_PENDING);
 	if (dm->callback->completed) {
 		dm->callback->completed(dm, dm->context);
@@ -337,10 +764,28 @@ static uint8_t discovery_process_attribute(struct bt_gatt_dm *dm,
 	struct bt_gatt_dm_attr *cur_attr;
 
 	if (!attr) {
-		if (dm->cur_attr_id > 1) {
+		/* Limit the characteristic discovery to the span of the
+		 * characteristic declarations found. This skips the phase
+		 * entirely for services without characteristics and avoids
+		 * round trips over trailing descriptor ranges.
+		 */
+		const struct bt_gatt_dm_attr *first_chrc = NULL;
+		const struct bt_gatt_dm_attr *last_chrc = NULL;
+
+		for (size_t i = 1; i < dm->cur_attr_id; i++) {
+			if (!bt_uuid_cmp(BT_UUID_GATT_CHRC,
+					 dm->attrs[i].uuid)) {
+				if (!first_chrc) {
+					first_chrc = &dm->attrs[i];
+				}
+				last_chrc = &dm->attrs[i];
+			}
+		}
+
+		if (first_chrc) {
 			LOG_DBG("Starting characteristic discovery");
-			dm->discover_params.start_handle =
-				dm->attrs[0].handle + 1;
+			dm->discover_params.start_handle = first_chrc->handle;
+			dm->discover_params.end_handle = last_chrc->handle;
 			dm->discover_params.type =
 				BT_GATT_DISCOVER_CHARACTERISTIC;
 			int err = bt_gatt_discover(dm->conn,
@@ -388,6 +833,16 @@ static uint8_t discovery_process_characteristic(
 	struct bt_gatt_chrc *cur_gatt_chrc;
 
 	if (!attr) {
+		/* Restore the service end handle that was trimmed for the
+		 * characteristic discovery. It marks the position from which
+		 * bt_gatt_dm_continue resumes.
+		 */
+		struct bt_gatt_service_val *service_val =
+			bt_gatt_dm_attr_service_val(&dm->attrs[0]);
+
+		__ASSERT_NO_MSG(service_val != NULL);
+		dm->discover_params.end_handle = service_val->end_handle;
+
 		discovery_complete(dm);
 		return BT_GATT_ITER_STOP;
 	}
@@ -619,7 +1074,16 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->discover_params.end_handle = 0xffff;
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 
+#ifdef CONFIG_BT_GATT_DM_DATA_CACHE
+	err = cache_hash_read(dm);
+	if (err) {
+		LOG_DBG("Database Hash read failed (err %d), discovering",
+			err);
+		err = bt_gatt_discover(conn, &dm->discover_params);
+	}
+#else
 	err = bt_gatt_discover(conn, &dm->discover_params);
+#endif
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
 		atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
@@ -660,6 +1124,14 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context)
 	dm->discover_params.end_handle = 0xffff;
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 
+#ifdef CONFIG_BT_GATT_DM_DATA_CACHE
+	/* Only results of a discovery started from the first handle are
+	 * cached. The cache key could not tell the follow-up services apart.
+	 */
+	dm->hash_valid = false;
+	dm->from_cache = false;
+#endif
+
 	err = bt_gatt_discover(dm->conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
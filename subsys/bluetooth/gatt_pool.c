@@ -5,6 +5,7 @@
  */
 
 #include <errno.h>
+#include <sys/util.h>
 #include <bluetooth/gatt_pool.h>
 #include <logging/log.h>
 
@@ -14,6 +15,16 @@ LOG_MODULE_REGISTER(bt_gatt_pool, CONFIG_BT_GATT_POOL_LOG_LEVEL);
 struct svc_el_pool {
 	void *elements;
 	atomic_t *locks;
+	/* Lock word from which the next free element search starts */
+	atomic_t free_word_hint;
+#if CONFIG_BT_GATT_POOL_STATS != 0
+	/* Telemetry for pool sizing: current and peak occupancy, and
+	 * the number of failed allocations.
+	 */
+	atomic_t used;
+	atomic_t peak;
+	atomic_t failures;
+#endif
 };
 
 #if CONFIG_BT_GATT_UUID16_POOL_SIZE != 0
@@ -88,19 +99,91 @@ static struct bt_uuid const * const uuid_ccc = BT_UUID_GATT_CCC;
 #define ADDR_2_INDEX(pool, el)                                                 \
 	((((uint32_t)el) - ((uint32_t)pool)) / (sizeof(pool[0])))
 
+#if CONFIG_BT_GATT_POOL_STATS != 0
+static void stats_alloc(struct svc_el_pool *el_pool)
+{
+	atomic_val_t used = atomic_inc(&el_pool->used) + 1;
+	atomic_val_t peak = atomic_get(&el_pool->peak);
+
+	while (used > peak && !atomic_cas(&el_pool->peak, peak, used)) {
+		peak = atomic_get(&el_pool->peak);
+	}
+}
+
+static void stats_fail(struct svc_el_pool *el_pool)
+{
+	(void)atomic_inc(&el_pool->failures);
+}
+
+static void stats_release(struct svc_el_pool *el_pool)
+{
+	(void)atomic_dec(&el_pool->used);
+}
+#else
+static inline void stats_alloc(struct svc_el_pool *el_pool)
+{
+	ARG_UNUSED(el_pool);
+}
+
+static inline void stats_fail(struct svc_el_pool *el_pool)
+{
+	ARG_UNUSED(el_pool);
+}
+
+static inline void stats_release(struct svc_el_pool *el_pool)
+{
+	ARG_UNUSED(el_pool);
+}
+#endif /* CONFIG_BT_GATT_POOL_STATS */
+
+/* The search inspects whole lock words at a time and starts from the word
+ * recorded on the last allocation or release, so its cost does not grow
+ * with the pool occupancy.
+ */
 static size_t free_element_find(struct svc_el_pool *el_pool, size_t el_cnt)
 {
+	size_t word_cnt = ATOMIC_BITMAP_SIZE(el_cnt);
+	size_t start = atomic_get(&el_pool->free_word_hint);
+
 	__ASSERT((el_pool->elements != NULL) && (el_pool->locks != NULL),
 		 "Pool uninitialized");
 
-	for (size_t i = 0; i < el_cnt; i++) {
-		if (!atomic_test_and_set_bit(el_pool->locks, i)) {
-			return i;
+	if (start >= word_cnt) {
+		start = 0;
+	}
+
+	for (size_t n = 0; n < word_cnt; n++) {
+		size_t w = start + n;
+
+		if (w >= word_cnt) {
+			w -= word_cnt;
+		}
+
+		atomic_val_t val = atomic_get(&el_pool->locks[w]);
+
+		while (~val != 0) {
+			size_t i = w * ATOMIC_BITS + (find_lsb_set(~val) - 1);
+
+			if (i >= el_cnt) {
+				break;
+			}
+			if (!atomic_test_and_set_bit(el_pool->locks, i)) {
+				atomic_set(&el_pool->free_word_hint, w);
+				stats_alloc(el_pool);
+				return i;
+			}
+			val = atomic_get(&el_pool->locks[w]);
 		}
 	}
+	stats_fail(el_pool);
 	return el_cnt;
 }
 
+static void free_hint_update(struct svc_el_pool *el_pool, size_t index)
+{
+	atomic_set(&el_pool->free_word_hint, index / ATOMIC_BITS);
+}
+
 static int uuid_16_get(struct bt_uuid **uuid, struct svc_el_pool *uuid_pool)
 {
 	size_t ind = free_element_find(uuid_pool,
@@ -165,6 +248,8 @@ static void chrc_release(struct bt_gatt_chrc const *chrc)
 	EL_IN_POOL_VERIFY(BT_GATT_CHRC_TAB, chrc);
 	atomic_clear_bit(chrc_pool.locks,
 			 ADDR_2_INDEX(BT_GATT_CHRC_TAB, chrc));
+	free_hint_update(&chrc_pool, ADDR_2_INDEX(BT_GATT_CHRC_TAB, chrc));
+	stats_release(&chrc_pool);
 }
 
 static int uuid_register(struct bt_uuid **dest_uuid,
@@ -212,6 +297,9 @@ static void uuid_unregister(struct bt_uuid const *uuid)
 #if CONFIG_BT_GATT_UUID16_POOL_SIZE != 0
 		atomic_clear_bit(uuid_16_pool.locks,
 				 ADDR_2_INDEX(BT_UUID_16_TAB, uuid));
+		free_hint_update(&uuid_16_pool,
+				 ADDR_2_INDEX(BT_UUID_16_TAB, uuid));
+		stats_release(&uuid_16_pool);
 #endif
 		break;
 
@@ -220,6 +308,9 @@ static void uuid_unregister(struct bt_uuid const *uuid)
 #if CONFIG_BT_GATT_UUID32_POOL_SIZE != 0
 		atomic_clear_bit(uuid_32_pool.locks,
 				 ADDR_2_INDEX(BT_UUID_32_TAB, uuid));
+		free_hint_update(&uuid_32_pool,
+				 ADDR_2_INDEX(BT_UUID_32_TAB, uuid));
+		stats_release(&uuid_32_pool);
 #endif
 		break;
 
@@ -228,6 +319,9 @@ static void uuid_unregister(struct bt_uuid const *uuid)
 #if CONFIG_BT_GATT_UUID128_POOL_SIZE != 0
 		atomic_clear_bit(uuid_128_pool.locks,
 				 ADDR_2_INDEX(BT_UUID_128_TAB, uuid));
+		free_hint_update(&uuid_128_pool,
+				 ADDR_2_INDEX(BT_UUID_128_TAB, uuid));
+		stats_release(&uuid_128_pool);
 #endif
 		break;
 
@@ -443,8 +537,10 @@ void bt_gatt_pool_stats_print(void)
 	used_el_cnt = mask_print(BT_UUID_16_LOCKS,
 				 ARRAY_SIZE(BT_UUID_16_LOCKS));
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
+	printk("\nPool element usage: %d out of %d\n", used_el_cnt,
 	       CONFIG_BT_GATT_UUID16_POOL_SIZE);
+	printk("Peak usage: %ld, allocation failures: %ld\n\n",
+	       atomic_get(&uuid_16_pool.peak), atomic_get(&uuid_16_pool.failures));
 #endif
 
 #if CONFIG_BT_GATT_UUID32_POOL_SIZE != 0
@@ -453,8 +549,10 @@ void bt_gatt_pool_stats_print(void)
 	used_el_cnt = mask_print(BT_UUID_32_LOCKS,
 				 ARRAY_SIZE(BT_UUID_32_LOCKS));
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
+	printk("\nPool element usage: %d out of %d\n", used_el_cnt,
 	       CONFIG_BT_GATT_UUID32_POOL_SIZE);
+	printk("Peak usage: %ld, allocation failures: %ld\n\n",
+	       atomic_get(&uuid_32_pool.peak), atomic_get(&uuid_32_pool.failures));
 #endif
 
 #if CONFIG_BT_GATT_UUID128_POOL_SIZE != 0
@@ -463,8 +561,10 @@ void bt_gatt_pool_stats_print(void)
 	used_el_cnt = mask_print(BT_UUID_128_LOCKS,
 				 ARRAY_SIZE(BT_UUID_128_LOCKS));
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
+	printk("\nPool element usage: %d out of %d\n", used_el_cnt,
 	       CONFIG_BT_GATT_UUID128_POOL_SIZE);
+	printk("Peak usage: %ld, allocation failures: %ld\n\n",
+	       atomic_get(&uuid_128_pool.peak), atomic_get(&uuid_128_pool.failures));
 #endif
 
 #if CONFIG_BT_GATT_CHRC_POOL_SIZE != 0
@@ -473,8 +573,100 @@ void bt_gatt_pool_stats_print(void)
 	used_el_cnt = mask_print(BT_GATT_CHRC_LOCKS,
 				 ARRAY_SIZE(BT_GATT_CHRC_LOCKS));
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
+	printk("\nPool element usage: %d out of %d\n", used_el_cnt,
 	       CONFIG_BT_GATT_CHRC_POOL_SIZE);
+	printk("Peak usage: %ld, allocation failures: %ld\n\n",
+	       atomic_get(&chrc_pool.peak), atomic_get(&chrc_pool.failures));
 #endif
 }
 #endif /* CONFIG_BT_GATT_POOL_STATS */
+
+#if defined(CONFIG_BT_GATT_POOL_SHELL)
+#include <shell/shell.h>
+
+struct pool_report {
+	const char *kconfig;
+	struct svc_el_pool *pool;
+	size_t size;
+};
+
+static struct pool_report const pool_report_tab[] = {
+	{ "BT_GATT_UUID16_POOL_SIZE", &uuid_16_pool,
+	  CONFIG_BT_GATT_UUID16_POOL_SIZE },
+	{ "BT_GATT_UUID32_POOL_SIZE", &uuid_32_pool,
+	  CONFIG_BT_GATT_UUID32_POOL_SIZE },
+	{ "BT_GATT_UUID128_POOL_SIZE", &uuid_128_pool,
+	  CONFIG_BT_GATT_UUID128_POOL_SIZE },
+	{ "BT_GATT_CHRC_POOL_SIZE", &chrc_pool,
+	  CONFIG_BT_GATT_CHRC_POOL_SIZE },
+};
+
+static int cmd_pool_report(const struct shell *shell, size_t argc,
+			   char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(shell,
+		    "%-28s %6s %6s %6s %9s", "pool", "size", "now", "peak",
+		    "failures");
+
+	for (size_t i = 0; i < ARRAY_SIZE(pool_report_tab); i++) {
+		const struct pool_report *rep = &pool_report_tab[i];
+		atomic_val_t used = atomic_get(&rep->pool->used);
+		atomic_val_t peak = atomic_get(&rep->pool->peak);
+		atomic_val_t failures = atomic_get(&rep->pool->failures);
+
+		shell_print(shell, "%-28s %6u %6ld %6ld %9ld", rep->kconfig,
+			    rep->size, used, peak, failures);
+	}
+
+	shell_print(shell, "Recommended configuration for the observed "
+			   "workload:");
+
+	for (size_t i = 0; i < ARRAY_SIZE(pool_report_tab); i++) {
+		const struct pool_report *rep = &pool_report_tab[i];
+		atomic_val_t peak = atomic_get(&rep->pool->peak);
+		atomic_val_t failures = atomic_get(&rep->pool->failures);
+
+		if (failures > 0) {
+			shell_print(shell,
+				    "CONFIG_%s > %u (%ld allocations failed)",
+				    rep->kconfig, rep->size, failures);
+		} else {
+			shell_print(shell, "CONFIG_%s=%ld", rep->kconfig,
+				    peak);
+		}
+	}
+
+	return 0;
+}
+
+static int cmd_pool_reset(const struct shell *shell, size_t argc,
+			  char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	for (size_t i = 0; i < ARRAY_SIZE(pool_report_tab); i++) {
+		struct svc_el_pool *pool = pool_report_tab[i].pool;
+
+		atomic_set(&pool->peak, atomic_get(&pool->used));
+		atomic_set(&pool->failures, 0);
+	}
+
+	shell_print(shell, "Pool telemetry reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_gatt_pool,
+	SHELL_CMD(report, NULL,
+		  "Print pool telemetry and sizing recommendations",
+		  cmd_pool_report),
+	SHELL_CMD(reset, NULL, "Reset peak and failure counters",
+		  cmd_pool_reset),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(gatt_pool, &sub_gatt_pool, "GATT pool telemetry", NULL);
+#endif /* CONFIG_BT_GATT_POOL_SHELL */
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <sys/byteorder.h>
 #include <bluetooth/mesh/gen_lvl_cli.h>
 #include "model_utils.h"
 
@@ -137,6 +138,36 @@ int bt_mesh_lvl_cli_set_unack(struct bt_mesh_lvl_cli *cli,
 	return model_send(cli->model, ctx, &msg);
 }
 
+void bt_mesh_lvl_cli_set_unack_prepare(struct bt_mesh_lvl_cli *cli,
+				       const struct bt_mesh_lvl_set *set)
+{
+	struct net_buf_simple *msg = cli->pub.msg;
+
+	bt_mesh_model_msg_init(msg, BT_MESH_LVL_OP_SET_UNACK);
+
+	net_buf_simple_add_le16(msg, set->lvl);
+	net_buf_simple_add_u8(msg, cli->tid);
+	if (set->transition) {
+		model_transition_buf_add(msg, set->transition);
+	}
+}
+
+int bt_mesh_lvl_cli_set_unack_resend(struct bt_mesh_lvl_cli *cli,
+				     struct bt_mesh_msg_ctx *ctx)
+{
+	struct net_buf_simple *msg = cli->pub.msg;
+
+	if (msg->len < 2 + BT_MESH_LVL_MSG_MINLEN_SET ||
+	    sys_get_be16(msg->data) != BT_MESH_LVL_OP_SET_UNACK) {
+		return -EINVAL;
+	}
+
+	/* The TID follows the 2 byte opcode and the Level field: */
+	msg->data[4] = ++cli->tid;
+
+	return model_prepared_send(cli->model, ctx);
+}
+
 int bt_mesh_lvl_cli_delta_set(struct bt_mesh_lvl_cli *cli,
 			      struct bt_mesh_msg_ctx *ctx,
 			      const struct bt_mesh_lvl_delta_set *delta_set,
@@ -5,6 +5,7 @@
  */
 
 #include <string.h>
+#include <sys/byteorder.h>
 #include <bluetooth/mesh/gen_onoff_cli.h>
 #include "model_utils.h"
 
@@ -150,3 +151,33 @@ int bt_mesh_onoff_cli_set_unack(struct bt_mesh_onoff_cli *cli,
 
 	return model_send(cli->model, ctx, &msg);
 }
+
+void bt_mesh_onoff_cli_set_unack_prepare(struct bt_mesh_onoff_cli *cli,
+					 const struct bt_mesh_onoff_set *set)
+{
+	struct net_buf_simple *msg = cli->pub.msg;
+
+	bt_mesh_model_msg_init(msg, BT_MESH_ONOFF_OP_SET_UNACK);
+
+	net_buf_simple_add_u8(msg, set->on_off);
+	net_buf_simple_add_u8(msg, cli->tid);
+	if (set->transition) {
+		model_transition_buf_add(msg, set->transition);
+	}
+}
+
+int bt_mesh_onoff_cli_set_unack_resend(struct bt_mesh_onoff_cli *cli,
+				       struct bt_mesh_msg_ctx *ctx)
+{
+	struct net_buf_simple *msg = cli->pub.msg;
+
+	if (msg->len < 2 + BT_MESH_ONOFF_MSG_MINLEN_SET ||
+	    sys_get_be16(msg->data) != BT_MESH_ONOFF_OP_SET_UNACK) {
+		return -EINVAL;
+	}
+
+	/* The TID follows the 2 byte opcode and the OnOff field: */
+	msg->data[3] = cli->tid++;
+
+	return model_prepared_send(cli->model, ctx);
+}
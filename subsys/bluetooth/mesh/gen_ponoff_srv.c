@@ -61,13 +61,12 @@ static int store_data(struct bt_mesh_ponoff_srv *srv,
 
 }
 
-static void store_timeout(struct k_work *work)
+static void store_handler(struct bt_mesh_model_store *store)
 {
 	int err;
 
-	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
-	struct bt_mesh_ponoff_srv *srv = CONTAINER_OF(
-		dwork, struct bt_mesh_ponoff_srv, store_timer);
+	struct bt_mesh_ponoff_srv *srv =
+		CONTAINER_OF(store, struct bt_mesh_ponoff_srv, store);
 
 	struct bt_mesh_onoff_status onoff_status = {0};
 
@@ -86,10 +85,7 @@ static void store_timeout(struct k_work *work)
 static void store_state(struct bt_mesh_ponoff_srv *srv)
 {
 #if CONFIG_BT_SETTINGS
-	k_work_schedule(
-		&srv->store_timer,
-		K_SECONDS(CONFIG_BT_MESH_MODEL_SRV_STORE_TIMEOUT));
-
+	bt_mesh_model_store_schedule(&srv->store);
 #endif
 }
 
@@ -294,7 +290,7 @@ static int bt_mesh_ponoff_srv_init(struct bt_mesh_model *model)
 				      sizeof(srv->pub_data));
 
 #if CONFIG_BT_SETTINGS
-	k_work_init_delayable(&srv->store_timer, store_timeout);
+	srv->store.store = store_handler;
 #endif
 
 	return bt_mesh_model_extend(model, srv->onoff.model);
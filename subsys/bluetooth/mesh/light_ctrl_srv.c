@@ -5,6 +5,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <bluetooth/mesh/light_ctrl_srv.h>
 #include <bluetooth/mesh/sensor_types.h>
 #include <bluetooth/mesh/properties.h>
@@ -32,6 +33,8 @@ enum flags {
 	FLAG_OFF_PENDING,
 	FLAG_TRANSITION,
 	FLAG_STORE_CFG,
+	FLAG_STORE_CFG_REG,
+	FLAG_STORE_CFG_LEGACY,
 	FLAG_STORE_STATE,
 	FLAG_CTRL_SRV_MANUALLY_ENABLED,
 	FLAG_STARTED,
@@ -79,9 +82,7 @@ static void store(struct bt_mesh_light_ctrl_srv *srv, enum flags kind)
 #if CONFIG_BT_SETTINGS
 	atomic_set_bit(&srv->flags, kind);
 
-	k_work_schedule(
-		&srv->store_timer,
-		K_SECONDS(CONFIG_BT_MESH_MODEL_SRV_STORE_TIMEOUT));
+	bt_mesh_model_store_schedule(&srv->store);
 #endif
 }
 
@@ -306,8 +307,8 @@ static uint16_t light_get(struct bt_mesh_light_ctrl_srv *srv)
 	uint16_t start = srv->fade.initial_light;
 	uint16_t end = srv->cfg.light[srv->state];
 
-	/* Linear interpolation: */
-	return start + ((end - start) * curr) / srv->fade.duration;
+	return model_transition_interpolate(start, end, curr,
+					    srv->fade.duration);
 }
 
 #if CONFIG_BT_MESH_LIGHT_CTRL_SRV_REG
@@ -334,7 +335,8 @@ static void lux_get(struct bt_mesh_light_ctrl_srv *srv,
 	uint32_t delta = curr_fade_time(srv);
 	uint32_t init = to_centi_lux(&srv->fade.initial_lux);
 	uint32_t cfg = to_centi_lux(&srv->reg.cfg.lux[srv->state]);
-	uint32_t centi_lux = init + ((cfg - init) * delta) / srv->fade.duration;
+	uint32_t centi_lux = model_transition_interpolate(init, cfg, delta,
+							  srv->fade.duration);
 
 	from_centi_lux(centi_lux, lux);
 }
@@ -690,7 +692,34 @@ static void delayed_action_timeout(struct k_work *work)
 #if CONFIG_BT_SETTINGS
 static void store_cfg_data(struct bt_mesh_light_ctrl_srv *srv)
 {
+#if CONFIG_BT_MESH_LIGHT_CTRL_SRV_STORE_INCREMENTAL
 	if (atomic_test_and_clear_bit(&srv->flags, FLAG_STORE_CFG)) {
+		(void)bt_mesh_model_data_store(srv->setup_srv, false, "cfg",
+					       &srv->cfg, sizeof(srv->cfg));
+	}
+
+#if CONFIG_BT_MESH_LIGHT_CTRL_SRV_REG
+	if (atomic_test_and_clear_bit(&srv->flags, FLAG_STORE_CFG_REG)) {
+		(void)bt_mesh_model_data_store(srv->setup_srv, false, "reg",
+					       &srv->reg.cfg,
+					       sizeof(srv->reg.cfg));
+	}
+#endif
+
+	if (atomic_test_and_clear_bit(&srv->flags, FLAG_STORE_CFG_LEGACY)) {
+		/* Delete the old monolithic record, now that the incremental
+		 * records hold the full configuration.
+		 */
+		(void)bt_mesh_model_data_store(srv->setup_srv, false, NULL,
+					       NULL, 0);
+	}
+#else
+	bool dirty = atomic_test_and_clear_bit(&srv->flags, FLAG_STORE_CFG);
+
+	dirty = atomic_test_and_clear_bit(&srv->flags, FLAG_STORE_CFG_REG) ||
+		dirty;
+
+	if (dirty) {
 		struct setup_srv_storage_data data = {
 			.cfg = srv->cfg,
 #if CONFIG_BT_MESH_LIGHT_CTRL_SRV_REG
@@ -701,6 +730,7 @@ static void store_cfg_data(struct bt_mesh_light_ctrl_srv *srv)
 		(void)bt_mesh_model_data_store(srv->setup_srv, false, NULL,
 					       &data, sizeof(data));
 	}
+#endif /* CONFIG_BT_MESH_LIGHT_CTRL_SRV_STORE_INCREMENTAL */
 }
 
 static void store_state_data(struct bt_mesh_light_ctrl_srv *srv)
@@ -720,11 +750,10 @@ static void store_state_data(struct bt_mesh_light_ctrl_srv *srv)
 
 }
 
-static void store_timeout(struct k_work *work)
+static void store_handler(struct bt_mesh_model_store *store)
 {
-	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
 	struct bt_mesh_light_ctrl_srv *srv = CONTAINER_OF(
-		dwork, struct bt_mesh_light_ctrl_srv, store_timer);
+		store, struct bt_mesh_light_ctrl_srv, store);
 
 	store_cfg_data(srv);
 
@@ -1297,6 +1326,27 @@ static int handle_prop_get(struct bt_mesh_model *model, struct bt_mesh_msg_ctx *
 	return 0;
 }
 
+static enum flags prop_store_kind(uint16_t id)
+{
+	if (!IS_ENABLED(CONFIG_BT_MESH_LIGHT_CTRL_SRV_REG)) {
+		return FLAG_STORE_CFG;
+	}
+
+	switch (id) {
+	case BT_MESH_LIGHT_CTRL_COEFF_KID:
+	case BT_MESH_LIGHT_CTRL_COEFF_KIU:
+	case BT_MESH_LIGHT_CTRL_COEFF_KPD:
+	case BT_MESH_LIGHT_CTRL_COEFF_KPU:
+	case BT_MESH_LIGHT_CTRL_PROP_REG_ACCURACY:
+	case BT_MESH_LIGHT_CTRL_PROP_ILLUMINANCE_ON:
+	case BT_MESH_LIGHT_CTRL_PROP_ILLUMINANCE_PROLONG:
+	case BT_MESH_LIGHT_CTRL_PROP_ILLUMINANCE_STANDBY:
+		return FLAG_STORE_CFG_REG;
+	default:
+		return FLAG_STORE_CFG;
+	}
+}
+
 static int handle_prop_set(struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx,
 			   struct net_buf_simple *buf)
 {
@@ -1316,7 +1366,7 @@ static int handle_prop_set(struct bt_mesh_model *model, struct bt_mesh_msg_ctx *
 		bt_mesh_scene_invalidate(srv->model);
 	}
 
-	store(srv, FLAG_STORE_CFG);
+	store(srv, prop_store_kind(id));
 
 	return 0;
 }
@@ -1340,7 +1390,7 @@ static int handle_prop_set_unack(struct bt_mesh_model *model, struct bt_mesh_msg
 		bt_mesh_scene_invalidate(srv->model);
 	}
 
-	store(srv, FLAG_STORE_CFG);
+	store(srv, prop_store_kind(id));
 
 	return 0;
 }
@@ -1519,7 +1569,7 @@ static int light_ctrl_srv_init(struct bt_mesh_model *model)
 	k_work_init_delayable(&srv->action_delay, delayed_action_timeout);
 
 #if CONFIG_BT_SETTINGS
-	k_work_init_delayable(&srv->store_timer, store_timeout);
+	srv->store.store = store_handler;
 #endif
 
 #if CONFIG_BT_MESH_LIGHT_CTRL_SRV_REG
@@ -1700,6 +1750,28 @@ static int lc_setup_srv_settings_set(struct bt_mesh_model *model,
 	struct setup_srv_storage_data data;
 	ssize_t result;
 
+#if CONFIG_BT_MESH_LIGHT_CTRL_SRV_STORE_INCREMENTAL
+	if (name && !strcmp(name, "cfg")) {
+		result = read_cb(cb_arg, &srv->cfg, sizeof(srv->cfg));
+		if (result <= 0) {
+			return result;
+		}
+
+		return (result < sizeof(srv->cfg)) ? -EINVAL : 0;
+	}
+
+#if CONFIG_BT_MESH_LIGHT_CTRL_SRV_REG
+	if (name && !strcmp(name, "reg")) {
+		result = read_cb(cb_arg, &srv->reg.cfg, sizeof(srv->reg.cfg));
+		if (result <= 0) {
+			return result;
+		}
+
+		return (result < sizeof(srv->reg.cfg)) ? -EINVAL : 0;
+	}
+#endif
+#endif /* CONFIG_BT_MESH_LIGHT_CTRL_SRV_STORE_INCREMENTAL */
+
 	if (name) {
 		return -ENOENT;
 	}
@@ -1719,6 +1791,15 @@ static int lc_setup_srv_settings_set(struct bt_mesh_model *model,
 	srv->reg.cfg = data.reg_cfg;
 #endif
 
+	if (IS_ENABLED(CONFIG_BT_MESH_LIGHT_CTRL_SRV_STORE_INCREMENTAL)) {
+		/* Migrate the monolithic record to incremental records on the
+		 * next store.
+		 */
+		store(srv, FLAG_STORE_CFG);
+		store(srv, FLAG_STORE_CFG_REG);
+		store(srv, FLAG_STORE_CFG_LEGACY);
+	}
+
 	return 0;
 }
 
@@ -30,11 +30,10 @@ static const char *const repr_str[] = { "Actual", "Linear" };
 #endif
 
 #if CONFIG_BT_SETTINGS
-static void store_timeout(struct k_work *work)
+static void store_handler(struct bt_mesh_model_store *store)
 {
-	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
 	struct bt_mesh_lightness_srv *srv = CONTAINER_OF(
-		dwork, struct bt_mesh_lightness_srv, store_timer);
+		store, struct bt_mesh_lightness_srv, store);
 
 	struct bt_mesh_lightness_srv_settings_data data = {
 		.default_light = srv->default_light,
@@ -55,9 +54,7 @@ static void store_timeout(struct k_work *work)
 static void store_state(struct bt_mesh_lightness_srv *srv)
 {
 #if CONFIG_BT_SETTINGS
-	k_work_schedule(
-		&srv->store_timer,
-		K_SECONDS(CONFIG_BT_MESH_MODEL_SRV_STORE_TIMEOUT));
+	bt_mesh_model_store_schedule(&srv->store);
 #endif
 }
 
@@ -853,7 +850,7 @@ static int bt_mesh_lightness_srv_init(struct bt_mesh_model *model)
 				      sizeof(srv->pub_data));
 
 #if CONFIG_BT_SETTINGS
-	k_work_init_delayable(&srv->store_timer, store_timeout);
+	srv->store.store = store_handler;
 #endif
 
 	err = bt_mesh_model_extend(model, srv->ponoff.ponoff_model);
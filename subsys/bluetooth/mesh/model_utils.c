@@ -17,6 +17,58 @@
 /** Delay field step factor in milliseconds */
 #define DELAY_TIME_STEP_MS (5)
 
+#if defined(CONFIG_BT_SETTINGS)
+/* Storage coordinator: models that mark their state dirty within the same
+ * store timeout are stored back to back from a single work item, instead
+ * of each model keeping its own timer.
+ */
+static sys_slist_t store_list;
+static struct k_spinlock store_list_lock;
+
+static void store_timeout(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	sys_snode_t *node;
+	k_spinlock_key_t key = k_spin_lock(&store_list_lock);
+
+	while ((node = sys_slist_get(&store_list)) != NULL) {
+		struct bt_mesh_model_store *store = CONTAINER_OF(
+			node, struct bt_mesh_model_store, node);
+
+		/* Clear before the callback, so that state turning dirty
+		 * while it is being stored is queued again.
+		 */
+		store->queued = false;
+
+		k_spin_unlock(&store_list_lock, key);
+
+		store->store(store);
+
+		key = k_spin_lock(&store_list_lock);
+	}
+
+	k_spin_unlock(&store_list_lock, key);
+}
+
+static K_WORK_DELAYABLE_DEFINE(store_timer, store_timeout);
+
+void bt_mesh_model_store_schedule(struct bt_mesh_model_store *store)
+{
+	k_spinlock_key_t key = k_spin_lock(&store_list_lock);
+
+	if (!store->queued) {
+		store->queued = true;
+		sys_slist_append(&store_list, &store->node);
+	}
+
+	k_spin_unlock(&store_list_lock, key);
+
+	k_work_schedule(&store_timer,
+			K_SECONDS(CONFIG_BT_MESH_MODEL_SRV_STORE_TIMEOUT));
+}
+#endif /* defined(CONFIG_BT_SETTINGS) */
+
 int tid_check_and_update(struct bt_mesh_tid_ctx *prev_transaction, uint8_t tid,
 			 const struct bt_mesh_msg_ctx *ctx)
 {
@@ -102,6 +154,24 @@ int32_t model_delay_decode(uint8_t encoded_delay)
 	return encoded_delay * DELAY_TIME_STEP_MS;
 }
 
+uint32_t model_transition_interpolate(uint32_t start, uint32_t end,
+				      uint32_t elapsed, uint32_t duration)
+{
+	if (!duration || elapsed >= duration) {
+		return end;
+	}
+
+	if (end >= start) {
+		return start + (uint32_t)(((uint64_t)(end - start) * elapsed +
+					   duration / 2) /
+					  duration);
+	}
+
+	return start - (uint32_t)(((uint64_t)(start - end) * elapsed +
+				   duration / 2) /
+				  duration);
+}
+
 int model_send(struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx,
 	       struct net_buf_simple *buf)
 {
@@ -119,6 +189,21 @@ int model_send(struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx,
 	return bt_mesh_model_publish(model);
 }
 
+int model_prepared_send(struct bt_mesh_model *model,
+			struct bt_mesh_msg_ctx *ctx)
+{
+	if (!model->pub) {
+		return -ENOTSUP;
+	}
+
+	if (ctx) {
+		return bt_mesh_model_send(model, ctx, model->pub->msg, NULL,
+					  0);
+	}
+
+	return bt_mesh_model_publish(model);
+}
+
 int model_ackd_send(struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx,
 		    struct net_buf_simple *buf,
 		    struct bt_mesh_msg_ack_ctx *ack, uint32_t rsp_op,
@@ -88,11 +88,53 @@ int model_ackd_send(struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx,
 int tid_check_and_update(struct bt_mesh_tid_ctx *prev_transaction, uint8_t tid,
 			 const struct bt_mesh_msg_ctx *ctx);
 
+/** @brief Mark a model's persistent state dirty and schedule storage.
+ *
+ * The state is stored when the common store timeout expires, by calling the
+ * handle's store callback. All models marked dirty within the same timeout
+ * are stored back to back. Marking a handle that is already queued is a
+ * no-op.
+ *
+ * @param store Storage handle of the model.
+ */
+void bt_mesh_model_store_schedule(struct bt_mesh_model_store *store);
+
 uint8_t model_delay_encode(uint32_t delay);
 int32_t model_delay_decode(uint8_t encoded_delay);
 int32_t model_transition_decode(uint8_t encoded_transition);
 uint8_t model_transition_encode(int32_t transition_time);
 
+/** @brief Send a message prepared in the model's publication buffer.
+ *
+ * Sends the contents of the model's publication buffer as-is, without
+ * re-encoding or copying. The caller is responsible for having encoded a
+ * valid message into the buffer first.
+ *
+ * @param model Model to send on.
+ * @param ctx   Message context, or NULL to send with the configured publish
+ *              parameters.
+ *
+ * @return 0 on success, or (negative) error code otherwise.
+ */
+int model_prepared_send(struct bt_mesh_model *model,
+			struct bt_mesh_msg_ctx *ctx);
+
+/** @brief Linearly interpolate the current value of a running transition.
+ *
+ * Fixed point interpolation between @c start and @c end, with a single
+ * 64-bit multiply and divide, rounding to the nearest representable value.
+ * Handles downward transitions (@c end less than @c start) correctly.
+ *
+ * @param start    Value at the start of the transition.
+ * @param end      Target value of the transition.
+ * @param elapsed  Time since the transition started.
+ * @param duration Total transition time, in the same unit as @c elapsed.
+ *
+ * @return The interpolated value, or @c end if the transition has timed out.
+ */
+uint32_t model_transition_interpolate(uint32_t start, uint32_t end,
+				      uint32_t elapsed, uint32_t duration);
+
 static inline void
 model_transition_buf_add(struct net_buf_simple *buf,
 			 const struct bt_mesh_model_transition *transition)
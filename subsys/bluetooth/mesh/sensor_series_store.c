@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <bluetooth/mesh/sensor_series_store.h>
+
+static int value_cmp(const struct sensor_value *a, const struct sensor_value *b)
+{
+	if (a->val1 != b->val1) {
+		return (a->val1 < b->val1) ? -1 : 1;
+	}
+
+	if (a->val2 != b->val2) {
+		return (a->val2 < b->val2) ? -1 : 1;
+	}
+
+	return 0;
+}
+
+static uint32_t count_get(const struct bt_mesh_sensor_series_store *store)
+{
+	return store->sensor->series.column_count;
+}
+
+static uint32_t phys_idx(const struct bt_mesh_sensor_series_store *store,
+			 uint32_t logical)
+{
+	return (store->oldest + logical) % store->capacity;
+}
+
+/* Find the first logical index whose column start is not less than start. */
+static uint32_t lower_bound(const struct bt_mesh_sensor_series_store *store,
+			    const struct sensor_value *start)
+{
+	uint32_t lo = 0;
+	uint32_t hi = count_get(store);
+
+	while (lo < hi) {
+		uint32_t mid = lo + (hi - lo) / 2;
+		const struct bt_mesh_sensor_column *col =
+			&store->columns[phys_idx(store, mid)];
+
+		if (value_cmp(&col->start, start) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+void bt_mesh_sensor_series_store_init(struct bt_mesh_sensor_series_store *store,
+				      struct bt_mesh_sensor *sensor)
+{
+	store->sensor = sensor;
+	store->oldest = 0;
+	sensor->series.columns = store->columns;
+	sensor->series.column_count = 0;
+}
+
+int bt_mesh_sensor_series_store_add(struct bt_mesh_sensor_series_store *store,
+				    const struct bt_mesh_sensor_column *col,
+				    const struct sensor_value *value)
+{
+	uint32_t count = count_get(store);
+	uint32_t idx;
+
+	if (count > 0) {
+		const struct bt_mesh_sensor_column *newest =
+			&store->columns[phys_idx(store, count - 1)];
+
+		if (value_cmp(&col->start, &newest->start) <= 0) {
+			return -EINVAL;
+		}
+	}
+
+	if (count < store->capacity) {
+		idx = phys_idx(store, count);
+		store->sensor->series.column_count = count + 1;
+	} else {
+		idx = store->oldest;
+		store->oldest = (store->oldest + 1) % store->capacity;
+	}
+
+	store->columns[idx] = *col;
+	memcpy(&store->values[idx * store->channels], value,
+	       store->channels * sizeof(*value));
+
+	return 0;
+}
+
+int bt_mesh_sensor_series_store_get(
+	const struct bt_mesh_sensor_series_store *store,
+	const struct bt_mesh_sensor_column *col, struct sensor_value *value)
+{
+	uint32_t idx;
+
+	if (col >= store->columns && col < &store->columns[store->capacity]) {
+		idx = col - store->columns;
+	} else {
+		uint32_t logical = lower_bound(store, &col->start);
+
+		if (logical >= count_get(store)) {
+			return -ENOENT;
+		}
+
+		idx = phys_idx(store, logical);
+		if (value_cmp(&store->columns[idx].start, &col->start)) {
+			return -ENOENT;
+		}
+	}
+
+	/* Reject slots that aren't populated yet. */
+	if (((idx - store->oldest + store->capacity) % store->capacity) >=
+	    count_get(store)) {
+		return -ENOENT;
+	}
+
+	memcpy(value, &store->values[idx * store->channels],
+	       store->channels * sizeof(*value));
+
+	return 0;
+}
+
+int bt_mesh_sensor_series_store_range(
+	const struct bt_mesh_sensor_series_store *store,
+	const struct bt_mesh_sensor_column *range, uint32_t *first,
+	uint32_t *count)
+{
+	uint32_t start = lower_bound(store, &range->start);
+	uint32_t lo = start;
+	uint32_t hi = count_get(store);
+
+	/* Find the first logical index whose column start is beyond the end
+	 * of the range.
+	 */
+	while (lo < hi) {
+		uint32_t mid = lo + (hi - lo) / 2;
+		const struct bt_mesh_sensor_column *col =
+			&store->columns[phys_idx(store, mid)];
+
+		if (value_cmp(&col->start, &range->end) <= 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	uint32_t end = lo;
+
+	if (end == start) {
+		return -ENOENT;
+	}
+
+	*first = start;
+	*count = end - start;
+
+	return 0;
+}
+
+const struct bt_mesh_sensor_column *bt_mesh_sensor_series_store_col(
+	const struct bt_mesh_sensor_series_store *store, uint32_t idx,
+	struct sensor_value *value)
+{
+	uint32_t phys;
+
+	if (idx >= count_get(store)) {
+		return NULL;
+	}
+
+	phys = phys_idx(store, idx);
+
+	if (value) {
+		memcpy(value, &store->values[phys * store->channels],
+		       store->channels * sizeof(*value));
+	}
+
+	return &store->columns[phys];
+}
@@ -24,12 +24,24 @@
 static struct bt_mesh_sensor *sensor_get(struct bt_mesh_sensor_srv *srv,
 					 uint16_t id)
 {
-	struct bt_mesh_sensor *sensor;
+	uint8_t lo = 0;
+	uint8_t hi = srv->sensor_count;
+
+	/* The sensor order index is established at init, so the ID lookup
+	 * done for every received sensor message can run as a binary search
+	 * instead of a list walk.
+	 */
+	while (lo < hi) {
+		uint8_t mid = (lo + hi) / 2;
+		struct bt_mesh_sensor *sensor =
+			srv->sensor_array[srv->sensor_order[mid]];
 
-	SENSOR_FOR_EACH(&srv->sensors, sensor)
-	{
 		if (sensor->type->id == id) {
 			return sensor;
+		} else if (sensor->type->id < id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
 	}
 
@@ -850,6 +862,24 @@ static int update_handler(struct bt_mesh_model *model)
 	return (srv->pub.msg->len > original_len) ? 0 : -ENOENT;
 }
 
+#if CONFIG_BT_MESH_SENSOR_SRV_PUB_COALESCE
+static void pub_coalesce_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct bt_mesh_sensor_srv *srv =
+		CONTAINER_OF(dwork, struct bt_mesh_sensor_srv, pub_timer);
+	int err;
+
+	/* The update handler marshals every sensor value that passes its
+	 * delta threshold and publish interval checks into one message.
+	 */
+	err = bt_mesh_model_publish(srv->model);
+	if (err && err != -ENOENT) {
+		BT_WARN("Coalesced publish failed: %d", err);
+	}
+}
+#endif
+
 static int sensor_srv_init(struct bt_mesh_model *model)
 {
 	struct bt_mesh_sensor_srv *srv = model->user_data;
@@ -859,6 +889,9 @@ static int sensor_srv_init(struct bt_mesh_model *model)
 #if CONFIG_BT_SETTINGS
 	k_work_init_delayable(&srv->store_timer, store_timeout);
 #endif
+#if CONFIG_BT_MESH_SENSOR_SRV_PUB_COALESCE
+	k_work_init_delayable(&srv->pub_timer, pub_coalesce_timeout);
+#endif
 
 	/* Establish a sorted list of sensors, as this is a requirement when
 	 * sending multiple sensor values in one message.
@@ -867,12 +900,14 @@ static int sensor_srv_init(struct bt_mesh_model *model)
 
 	for (int count = 0; count < srv->sensor_count; ++count) {
 		struct bt_mesh_sensor *best = NULL;
+		uint8_t best_idx = 0;
 
 		for (int j = 0; j < srv->sensor_count; ++j) {
 			if (srv->sensor_array[j]->type->id >= min_id &&
 			    (!best ||
 			     srv->sensor_array[j]->type->id < best->type->id)) {
 				best = srv->sensor_array[j];
+				best_idx = j;
 			}
 		}
 
@@ -882,6 +917,7 @@ static int sensor_srv_init(struct bt_mesh_model *model)
 			break;
 		}
 
+		srv->sensor_order[count] = best_idx;
 		sys_slist_append(&srv->sensors, &best->state.node);
 		BT_DBG("Sensor 0x%04x", best->type->id);
 		min_id = best->type->id + 1;
@@ -1012,6 +1048,19 @@ int bt_mesh_sensor_srv_pub(struct bt_mesh_sensor_srv *srv,
 int bt_mesh_sensor_srv_sample(struct bt_mesh_sensor_srv *srv,
 			      struct bt_mesh_sensor *sensor)
 {
+#if CONFIG_BT_MESH_SENSOR_SRV_PUB_COALESCE
+	/* Defer to the publication update handler, which samples all sensors
+	 * and packs every value that is outside its delta threshold into a
+	 * single Sensor Status message. Holding the publication for a short
+	 * window lets samples from other sensors join the same message.
+	 */
+	BT_DBG("Deferring sample of 0x%04x", sensor->type->id);
+
+	k_work_schedule(
+		&srv->pub_timer,
+		K_MSEC(CONFIG_BT_MESH_SENSOR_SRV_PUB_COALESCE_WINDOW));
+	return 0;
+#else
 	struct sensor_value value[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX] = {};
 	int err;
 
@@ -1029,4 +1078,5 @@ int bt_mesh_sensor_srv_sample(struct bt_mesh_sensor_srv *srv,
 	BT_DBG("Publishing 0x%04x", sensor->type->id);
 
 	return bt_mesh_sensor_srv_pub(srv, NULL, sensor, value);
+#endif
 }
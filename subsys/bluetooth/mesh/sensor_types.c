@@ -5,6 +5,7 @@
  */
 #include <string.h>
 #include <stdio.h>
+#include <init.h>
 #include "sensor.h"
 #include <toolchain/common.h>
 #include <bluetooth/mesh/properties.h>
@@ -233,6 +234,65 @@ static int32_t scalar_min(const struct bt_mesh_sensor_format *format)
 	return 0;
 }
 
+static int scalar_raw_add(struct net_buf_simple *buf, size_t size, int64_t raw)
+{
+	switch (size) {
+	case 1:
+		net_buf_simple_add_u8(buf, raw);
+		break;
+	case 2:
+		net_buf_simple_add_le16(buf, raw);
+		break;
+	case 3:
+		net_buf_simple_add_le24(buf, raw);
+		break;
+	case 4:
+		net_buf_simple_add_le32(buf, raw);
+		break;
+	default:
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int scalar_raw_pull(const struct bt_mesh_sensor_format *format,
+			   struct net_buf_simple *buf, int64_t *raw)
+{
+	const struct scalar_repr *repr = format->user_data;
+
+	switch (format->size) {
+	case 1:
+		if (repr->flags & SIGNED) {
+			*raw = (int8_t) net_buf_simple_pull_u8(buf);
+		} else {
+			*raw = net_buf_simple_pull_u8(buf);
+		}
+		break;
+	case 2:
+		if (repr->flags & SIGNED) {
+			*raw = (int16_t) net_buf_simple_pull_le16(buf);
+		} else {
+			*raw = net_buf_simple_pull_le16(buf);
+		}
+		break;
+	case 3:
+		*raw = net_buf_simple_pull_le24(buf);
+
+		if ((repr->flags & SIGNED) && (*raw & BIT(24))) {
+			*raw |= (BIT_MASK(8) << 24);
+		}
+		break;
+	case 4:
+		*raw = net_buf_simple_pull_le32(buf);
+		break;
+	default:
+		return -ERANGE;
+	}
+
+	return 0;
+}
+
 static int scalar_encode(const struct bt_mesh_sensor_format *format,
 			 const struct sensor_value *val,
 			 struct net_buf_simple *buf)
@@ -269,30 +329,14 @@ static int scalar_encode(const struct bt_mesh_sensor_format *format,
 		}
 	}
 
-	switch (format->size) {
-	case 1:
-		net_buf_simple_add_u8(buf, raw);
-		break;
-	case 2:
-		net_buf_simple_add_le16(buf, raw);
-		break;
-	case 3:
-		net_buf_simple_add_le24(buf, raw);
-		break;
-	case 4:
-		net_buf_simple_add_le32(buf, raw);
-		break;
-	default:
-		return -EIO;
-	}
-
-	return 0;
+	return scalar_raw_add(buf, format->size, raw);
 }
 
 static int scalar_decode(const struct bt_mesh_sensor_format *format,
 			 struct net_buf_simple *buf, struct sensor_value *val)
 {
 	const struct scalar_repr *repr = format->user_data;
+	int err;
 
 	if (buf->len < format->size) {
 		return -ENOMEM;
@@ -300,33 +344,9 @@ static int scalar_decode(const struct bt_mesh_sensor_format *format,
 
 	int64_t raw;
 
-	switch (format->size) {
-	case 1:
-		if (repr->flags & SIGNED) {
-			raw = (int8_t) net_buf_simple_pull_u8(buf);
-		} else {
-			raw = net_buf_simple_pull_u8(buf);
-		}
-		break;
-	case 2:
-		if (repr->flags & SIGNED) {
-			raw = (int16_t) net_buf_simple_pull_le16(buf);
-		} else {
-			raw = net_buf_simple_pull_le16(buf);
-		}
-		break;
-	case 3:
-		raw = net_buf_simple_pull_le24(buf);
-
-		if ((repr->flags & SIGNED) && (raw & BIT(24))) {
-			raw |= (BIT_MASK(8) << 24);
-		}
-		break;
-	case 4:
-		raw = net_buf_simple_pull_le32(buf);
-		break;
-	default:
-		return -ERANGE;
+	err = scalar_raw_pull(format, buf, &raw);
+	if (err) {
+		return err;
 	}
 
 	int64_t max_value = scalar_max(format);
@@ -363,6 +383,51 @@ static int scalar_decode(const struct bt_mesh_sensor_format *format,
 	return 0;
 }
 
+#ifdef CONFIG_BT_MESH_SENSOR_RAW_CODEC
+int bt_mesh_sensor_ch_raw_encode(const struct bt_mesh_sensor_format *format,
+				 int64_t raw, struct net_buf_simple *buf)
+{
+	if (format->encode != scalar_encode) {
+		return -ENOTSUP;
+	}
+
+	if (net_buf_simple_tailroom(buf) < format->size) {
+		return -ENOMEM;
+	}
+
+	if (raw > scalar_max(format) || raw < scalar_min(format)) {
+		return -ERANGE;
+	}
+
+	return scalar_raw_add(buf, format->size, raw);
+}
+
+int bt_mesh_sensor_ch_raw_decode(const struct bt_mesh_sensor_format *format,
+				 struct net_buf_simple *buf, int64_t *raw)
+{
+	int err;
+
+	if (format->decode != scalar_decode) {
+		return -ENOTSUP;
+	}
+
+	if (buf->len < format->size) {
+		return -ENOMEM;
+	}
+
+	err = scalar_raw_pull(format, buf, raw);
+	if (err) {
+		return err;
+	}
+
+	if (*raw > scalar_max(format) || *raw < scalar_min(format)) {
+		return -ERANGE;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BT_MESH_SENSOR_RAW_CODEC */
+
 static int boolean_encode(const struct bt_mesh_sensor_format *format,
 			  const struct sensor_value *val,
 			  struct net_buf_simple *buf)
@@ -1202,6 +1267,102 @@ SENSOR_TYPE(rel_dev_runtime_in_a_generic_level_range) = {
 
 /******************************************************************************/
 
+#ifdef CONFIG_BT_MESH_SENSOR_TYPE_LOOKUP_INDEX
+
+extern const struct bt_mesh_sensor_type _bt_mesh_sensor_type_list_start[];
+extern const struct bt_mesh_sensor_type _bt_mesh_sensor_type_list_end[];
+
+/* The sensor types themselves stay in flash, sorted by variable name in the
+ * linker section. The index holds one byte per type, ordering them by ID.
+ * This file defines 92 types; leave some headroom for vendor additions.
+ */
+#define TYPE_INDEX_MAX 128
+
+static uint8_t type_index[TYPE_INDEX_MAX];
+static uint16_t type_count;
+static const struct bt_mesh_sensor_type *type_last;
+
+static const struct bt_mesh_sensor_type *type_at(uint16_t i)
+{
+	return &_bt_mesh_sensor_type_list_start[type_index[i]];
+}
+
+static int sensor_type_index_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	uint16_t count = _bt_mesh_sensor_type_list_end -
+			 _bt_mesh_sensor_type_list_start;
+
+	if (count > ARRAY_SIZE(type_index)) {
+		/* Leave the index unbuilt and fall back to a linear scan. */
+		return 0;
+	}
+
+	for (uint16_t i = 0; i < count; ++i) {
+		uint16_t id = _bt_mesh_sensor_type_list_start[i].id;
+		uint16_t pos = i;
+
+		while (pos > 0 && type_at(pos - 1)->id > id) {
+			type_index[pos] = type_index[pos - 1];
+			pos--;
+		}
+
+		type_index[pos] = i;
+	}
+
+	type_count = count;
+
+	return 0;
+}
+
+SYS_INIT(sensor_type_index_init, POST_KERNEL,
+	 CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+const struct bt_mesh_sensor_type *bt_mesh_sensor_type_get(uint16_t id)
+{
+	const struct bt_mesh_sensor_type *cached = type_last;
+
+	if (cached && cached->id == id) {
+		return cached;
+	}
+
+	if (!type_count) {
+		/* Index not built; scan the full list. */
+		for (const struct bt_mesh_sensor_type *type =
+			     _bt_mesh_sensor_type_list_start;
+		     type != _bt_mesh_sensor_type_list_end; type++) {
+			if (type->id == id) {
+				type_last = type;
+				return type;
+			}
+		}
+
+		return NULL;
+	}
+
+	uint16_t lo = 0;
+	uint16_t hi = type_count;
+
+	while (lo < hi) {
+		uint16_t mid = (lo + hi) / 2;
+		const struct bt_mesh_sensor_type *type = type_at(mid);
+
+		if (type->id == id) {
+			type_last = type;
+			return type;
+		} else if (type->id < id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return NULL;
+}
+
+#else /* !CONFIG_BT_MESH_SENSOR_TYPE_LOOKUP_INDEX */
+
 const struct bt_mesh_sensor_type *bt_mesh_sensor_type_get(uint16_t id)
 {
 	Z_STRUCT_SECTION_FOREACH(bt_mesh_sensor_type, type) {
@@ -1212,3 +1373,5 @@ const struct bt_mesh_sensor_type *bt_mesh_sensor_type_get(uint16_t id)
 
 	return NULL;
 }
+
+#endif /* CONFIG_BT_MESH_SENSOR_TYPE_LOOKUP_INDEX */
@@ -392,20 +392,23 @@ int bt_conn_get_remote_info(struct bt_conn *conn,
 	return result.result;
 }
 
+static const struct ser_struct_field bt_le_conn_param_fields[] = {
+	SER_STRUCT_FIELD(bt_le_conn_param, interval_min, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_conn_param, interval_max, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_conn_param, latency, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_conn_param, timeout, SER_TYPE_UINT),
+};
+
 void bt_le_conn_param_enc(CborEncoder *encoder, const struct bt_le_conn_param *data)
 {
-	ser_encode_uint(encoder, data->interval_min);
-	ser_encode_uint(encoder, data->interval_max);
-	ser_encode_uint(encoder, data->latency);
-	ser_encode_uint(encoder, data->timeout);
+	ser_encode_struct(encoder, data, bt_le_conn_param_fields,
+			  ARRAY_SIZE(bt_le_conn_param_fields));
 }
 
 void bt_le_conn_param_dec(CborValue *value, struct bt_le_conn_param *data)
 {
-	data->interval_min = ser_decode_uint(value);
-	data->interval_max = ser_decode_uint(value);
-	data->latency = ser_decode_uint(value);
-	data->timeout = ser_decode_uint(value);
+	ser_decode_struct(value, data, bt_le_conn_param_fields,
+			  ARRAY_SIZE(bt_le_conn_param_fields));
 }
 
 int bt_conn_le_param_update(struct bt_conn *conn,
@@ -427,11 +430,16 @@ int bt_conn_le_param_update(struct bt_conn *conn,
 }
 
 #if defined(CONFIG_BT_USER_DATA_LEN_UPDATE)
+static const struct ser_struct_field bt_conn_le_data_len_param_fields[] = {
+	SER_STRUCT_FIELD(bt_conn_le_data_len_param, tx_max_len, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_conn_le_data_len_param, tx_max_time, SER_TYPE_UINT),
+};
+
 void bt_conn_le_data_len_param_enc(CborEncoder *encoder,
 				   const struct bt_conn_le_data_len_param *data)
 {
-	ser_encode_uint(encoder, data->tx_max_len);
-	ser_encode_uint(encoder, data->tx_max_time);
+	ser_encode_struct(encoder, data, bt_conn_le_data_len_param_fields,
+			  ARRAY_SIZE(bt_conn_le_data_len_param_fields));
 }
 
 int bt_conn_le_data_len_update(struct bt_conn *conn,
@@ -454,11 +462,16 @@ int bt_conn_le_data_len_update(struct bt_conn *conn,
 #endif /* defined(CONFIG_BT_USER_DATA_LEN_UPDATE) */
 
 #if defined(CONFIG_BT_USER_PHY_UPDATE)
+static const struct ser_struct_field bt_conn_le_phy_param_fields[] = {
+	SER_STRUCT_FIELD(bt_conn_le_phy_param, options, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_conn_le_phy_param, pref_tx_phy, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_conn_le_phy_param, pref_rx_phy, SER_TYPE_UINT),
+};
+
 void bt_conn_le_phy_param_enc(CborEncoder *encoder, const struct bt_conn_le_phy_param *data)
 {
-	ser_encode_uint(encoder, data->options);
-	ser_encode_uint(encoder, data->pref_tx_phy);
-	ser_encode_uint(encoder, data->pref_rx_phy);
+	ser_encode_struct(encoder, data, bt_conn_le_phy_param_fields,
+			  ARRAY_SIZE(bt_conn_le_phy_param_fields));
 }
 
 int bt_conn_le_phy_update(struct bt_conn *conn,
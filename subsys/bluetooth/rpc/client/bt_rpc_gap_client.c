@@ -369,15 +369,20 @@ void bt_data_enc(CborEncoder *encoder, const struct bt_data *data)
 	ser_encode_buffer(encoder, data->data, sizeof(uint8_t) * data->data_len);
 }
 
+static const struct ser_struct_field bt_le_scan_param_fields[] = {
+	SER_STRUCT_FIELD(bt_le_scan_param, type, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, options, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, interval, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, window, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, timeout, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, interval_coded, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, window_coded, SER_TYPE_UINT),
+};
+
 void bt_le_scan_param_enc(CborEncoder *encoder, const struct bt_le_scan_param *data)
 {
-	ser_encode_uint(encoder, data->type);
-	ser_encode_uint(encoder, data->options);
-	ser_encode_uint(encoder, data->interval);
-	ser_encode_uint(encoder, data->window);
-	ser_encode_uint(encoder, data->timeout);
-	ser_encode_uint(encoder, data->interval_coded);
-	ser_encode_uint(encoder, data->window_coded);
+	ser_encode_struct(encoder, data, bt_le_scan_param_fields,
+			  ARRAY_SIZE(bt_le_scan_param_fields));
 }
 
 void net_buf_simple_dec(struct ser_scratchpad *scratchpad, struct net_buf_simple *data)
@@ -415,7 +420,9 @@ static void bt_le_scan_cb_t_callback_rpc_handler(CborValue *value, void *handler
 
 	callback_slot(addr, rssi, adv_type, &buf);
 
-	ser_rsp_send_void();
+	if (!IS_ENABLED(CONFIG_BT_RPC_SCAN_REPORT_FASTPATH)) {
+		ser_rsp_send_void();
+	}
 
 	return;
 decoding_error:
@@ -425,6 +432,12 @@ decoding_error:
 NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_scan_cb_t_callback, BT_LE_SCAN_CB_T_CALLBACK_RPC_CMD,
 			 bt_le_scan_cb_t_callback_rpc_handler, NULL);
 
+#if defined(CONFIG_BT_RPC_SCAN_REPORT_FASTPATH)
+NRF_RPC_CBOR_EVT_DECODER(bt_rpc_grp, bt_le_scan_cb_t_callback_evt,
+			 BT_LE_SCAN_CB_T_CALLBACK_RPC_EVT,
+			 bt_le_scan_cb_t_callback_rpc_handler, NULL);
+#endif /* defined(CONFIG_BT_RPC_SCAN_REPORT_FASTPATH) */
+
 size_t bt_le_adv_param_sp_size(const struct bt_le_adv_param *data)
 {
 	size_t scratchpad_size = 0;
@@ -443,14 +456,19 @@ size_t bt_le_adv_param_buf_size(const struct bt_le_adv_param *data)
 	return buffer_size_max;
 }
 
+static const struct ser_struct_field bt_le_adv_param_fields[] = {
+	SER_STRUCT_FIELD(bt_le_adv_param, id, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_adv_param, sid, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_adv_param, secondary_max_skip, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_adv_param, options, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_adv_param, interval_min, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_adv_param, interval_max, SER_TYPE_UINT),
+};
+
 void bt_le_adv_param_enc(CborEncoder *encoder, const struct bt_le_adv_param *data)
 {
-	ser_encode_uint(encoder, data->id);
-	ser_encode_uint(encoder, data->sid);
-	ser_encode_uint(encoder, data->secondary_max_skip);
-	ser_encode_uint(encoder, data->options);
-	ser_encode_uint(encoder, data->interval_min);
-	ser_encode_uint(encoder, data->interval_max);
+	ser_encode_struct(encoder, data, bt_le_adv_param_fields,
+			  ARRAY_SIZE(bt_le_adv_param_fields));
 	ser_encode_buffer(encoder, data->peer, sizeof(bt_addr_le_t));
 }
 
@@ -1582,7 +1600,9 @@ static void bt_le_scan_cb_recv_rpc_handler(CborValue *value, void *handler_data)
 
 	bt_le_scan_cb_recv(&info, &buf);
 
-	ser_rsp_send_void();
+	if (!IS_ENABLED(CONFIG_BT_RPC_SCAN_REPORT_FASTPATH)) {
+		ser_rsp_send_void();
+	}
 
 	return;
 decoding_error:
@@ -1592,6 +1612,12 @@ decoding_error:
 NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_le_scan_cb_recv, BT_LE_SCAN_CB_RECV_RPC_CMD,
 			 bt_le_scan_cb_recv_rpc_handler, NULL);
 
+#if defined(CONFIG_BT_RPC_SCAN_REPORT_FASTPATH)
+NRF_RPC_CBOR_EVT_DECODER(bt_rpc_grp, bt_le_scan_cb_recv_evt,
+			 BT_LE_SCAN_CB_RECV_RPC_EVT,
+			 bt_le_scan_cb_recv_rpc_handler, NULL);
+#endif /* defined(CONFIG_BT_RPC_SCAN_REPORT_FASTPATH) */
+
 static void bt_le_scan_cb_timeout(void)
 {
 	struct bt_le_scan_cb *listener;
@@ -218,7 +218,7 @@ static const CHECK_LIST_ENTRY_TYPE check_table[] = {
 		CONFIG_BT_SMP_SC_PAIR_ONLY,
 		CONFIG_BT_PER_ADV,
 		CONFIG_BT_PER_ADV_SYNC,
-		0,
+		CONFIG_BT_RPC_SCAN_REPORT_FASTPATH,
 		0,
 		0),
 	CHECK_UINT8(CONFIG_BT_MAX_CONN),
@@ -149,6 +149,8 @@ enum bt_rpc_cmd_from_host_to_cli {
 enum bt_rpc_evt_from_host_to_cli {
 	/* bluetooth.h API */
 	BT_READY_CB_T_CALLBACK_RPC_EVT,
+	BT_LE_SCAN_CB_T_CALLBACK_RPC_EVT,
+	BT_LE_SCAN_CB_RECV_RPC_EVT,
 };
 
 /** @brief Pairing flags IDs. Those flags are used to setup valid callback sets on
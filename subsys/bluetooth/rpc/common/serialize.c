@@ -629,3 +629,106 @@ void ser_rsp_send_void(void)
 
 	nrf_rpc_cbor_rsp_no_err(&ctx);
 }
+
+static uint32_t field_load_uint(const uint8_t *ptr, uint8_t size)
+{
+	switch (size) {
+	case sizeof(uint8_t):
+		return *(const uint8_t *)ptr;
+	case sizeof(uint16_t):
+		return *(const uint16_t *)ptr;
+	default:
+		return *(const uint32_t *)ptr;
+	}
+}
+
+static void field_store_uint(uint8_t *ptr, uint8_t size, uint32_t field)
+{
+	switch (size) {
+	case sizeof(uint8_t):
+		*(uint8_t *)ptr = field;
+		break;
+	case sizeof(uint16_t):
+		*(uint16_t *)ptr = field;
+		break;
+	default:
+		*(uint32_t *)ptr = field;
+		break;
+	}
+}
+
+static int32_t field_load_int(const uint8_t *ptr, uint8_t size)
+{
+	switch (size) {
+	case sizeof(int8_t):
+		return *(const int8_t *)ptr;
+	case sizeof(int16_t):
+		return *(const int16_t *)ptr;
+	default:
+		return *(const int32_t *)ptr;
+	}
+}
+
+void ser_encode_struct(CborEncoder *encoder, const void *data,
+		       const struct ser_struct_field *fields,
+		       size_t field_count)
+{
+	for (size_t i = 0; i < field_count; i++) {
+		const uint8_t *ptr = (const uint8_t *)data + fields[i].offset;
+
+		switch (fields[i].type) {
+		case SER_TYPE_BOOL:
+			ser_encode_bool(encoder, *(const bool *)ptr);
+			break;
+		case SER_TYPE_UINT:
+			ser_encode_uint(encoder,
+					field_load_uint(ptr, fields[i].size));
+			break;
+		case SER_TYPE_INT:
+			ser_encode_int(encoder,
+				       field_load_int(ptr, fields[i].size));
+			break;
+		case SER_TYPE_UINT64:
+			ser_encode_uint64(encoder, *(const uint64_t *)ptr);
+			break;
+		case SER_TYPE_INT64:
+			ser_encode_int64(encoder, *(const int64_t *)ptr);
+			break;
+		default:
+			set_encoder_invalid(encoder, CborUnknownError);
+			return;
+		}
+	}
+}
+
+void ser_decode_struct(CborValue *value, void *data,
+		       const struct ser_struct_field *fields,
+		       size_t field_count)
+{
+	for (size_t i = 0; i < field_count; i++) {
+		uint8_t *ptr = (uint8_t *)data + fields[i].offset;
+
+		switch (fields[i].type) {
+		case SER_TYPE_BOOL:
+			*(bool *)ptr = ser_decode_bool(value);
+			break;
+		case SER_TYPE_UINT:
+			field_store_uint(ptr, fields[i].size,
+					 ser_decode_uint(value));
+			break;
+		case SER_TYPE_INT:
+			field_store_uint(ptr, fields[i].size,
+					 (uint32_t)ser_decode_int(value));
+			break;
+		case SER_TYPE_UINT64:
+			*(uint64_t *)ptr = ser_decode_uint64(value);
+			break;
+		case SER_TYPE_INT64:
+			*(int64_t *)ptr = ser_decode_int64(value);
+			break;
+		default:
+			ser_decoder_invalid(value, CborUnknownError);
+			return;
+		}
+	}
+}
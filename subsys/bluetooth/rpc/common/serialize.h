@@ -15,6 +15,7 @@
 #ifndef SERIALIZE_H_
 #define SERIALIZE_H_
 
+#include <stddef.h>
 #include <tinycbor/cbor.h>
 #include <net/buf.h>
 #include <sys/util.h>
@@ -351,4 +352,68 @@ void ser_rsp_send_bool(bool response);
 /** @brief Sent response to a command as a void. */
 void ser_rsp_send_void(void);
 
+/** @brief Field types for table-driven structure serialization. */
+enum ser_struct_field_type {
+	/** Boolean field. */
+	SER_TYPE_BOOL,
+	/** Unsigned integer field of 1, 2 or 4 bytes. */
+	SER_TYPE_UINT,
+	/** Signed integer field of 1, 2 or 4 bytes. */
+	SER_TYPE_INT,
+	/** Unsigned 64-bit integer field. */
+	SER_TYPE_UINT64,
+	/** Signed 64-bit integer field. */
+	SER_TYPE_INT64,
+};
+
+/** @brief Descriptor of a single structure field.
+ *
+ * A structure is described once by an array of these descriptors, which
+ * @ref ser_encode_struct and @ref ser_decode_struct iterate over instead
+ * of a sequence of individual ser_encode/ser_decode calls. The wire
+ * format is identical to encoding each field separately, in table order.
+ */
+struct ser_struct_field {
+	/** Offset of the field inside the structure. */
+	uint16_t offset;
+	/** Size of the field, in bytes. */
+	uint8_t size;
+	/** Field type from @ref ser_struct_field_type. */
+	uint8_t type;
+};
+
+/** @brief Define one entry of a structure descriptor table.
+ *
+ * @param[in] _struct Structure type (without the struct keyword).
+ * @param[in] _member Field name.
+ * @param[in] _kind Field type from @ref ser_struct_field_type.
+ */
+#define SER_STRUCT_FIELD(_struct, _member, _kind) {			       \
+	.offset = offsetof(struct _struct, _member),			       \
+	.size = sizeof(((struct _struct *)0)->_member),			       \
+	.type = (_kind),						       \
+}
+
+/** @brief Encode structure fields described by a descriptor table.
+ *
+ * @param[in, out] encoder Structure used to encode CBOR stream.
+ * @param[in] data Structure to encode.
+ * @param[in] fields Descriptor table.
+ * @param[in] field_count Number of entries in the descriptor table.
+ */
+void ser_encode_struct(CborEncoder *encoder, const void *data,
+		       const struct ser_struct_field *fields,
+		       size_t field_count);
+
+/** @brief Decode structure fields described by a descriptor table.
+ *
+ * @param[in] value Value parsed from the CBOR stream.
+ * @param[out] data Structure to decode into.
+ * @param[in] fields Descriptor table.
+ * @param[in] field_count Number of entries in the descriptor table.
+ */
+void ser_decode_struct(CborValue *value, void *data,
+		       const struct ser_struct_field *fields,
+		       size_t field_count);
+
 #endif /* SERIALIZE_H_ */
@@ -380,21 +380,24 @@ decoding_error:
 NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_get_remote_info, BT_CONN_GET_REMOTE_INFO_RPC_CMD,
 			 bt_conn_get_remote_info_rpc_handler, NULL);
 
+static const struct ser_struct_field bt_le_conn_param_fields[] = {
+	SER_STRUCT_FIELD(bt_le_conn_param, interval_min, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_conn_param, interval_max, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_conn_param, latency, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_conn_param, timeout, SER_TYPE_UINT),
+};
+
 void bt_le_conn_param_enc(CborEncoder *encoder, const struct bt_le_conn_param *data)
 {
-	ser_encode_uint(encoder, data->interval_min);
-	ser_encode_uint(encoder, data->interval_max);
-	ser_encode_uint(encoder, data->latency);
-	ser_encode_uint(encoder, data->timeout);
+	ser_encode_struct(encoder, data, bt_le_conn_param_fields,
+			  ARRAY_SIZE(bt_le_conn_param_fields));
 }
 
 
 void bt_le_conn_param_dec(CborValue *value, struct bt_le_conn_param *data)
 {
-	data->interval_min = ser_decode_uint(value);
-	data->interval_max = ser_decode_uint(value);
-	data->latency = ser_decode_uint(value);
-	data->timeout = ser_decode_uint(value);
+	ser_decode_struct(value, data, bt_le_conn_param_fields,
+			  ARRAY_SIZE(bt_le_conn_param_fields));
 }
 
 static void bt_conn_le_param_update_rpc_handler(CborValue *value, void *handler_data)
@@ -423,10 +426,15 @@ NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_le_param_update, BT_CONN_LE_PARAM_U
 			 bt_conn_le_param_update_rpc_handler, NULL);
 
 #if defined(CONFIG_BT_USER_DATA_LEN_UPDATE)
+static const struct ser_struct_field bt_conn_le_data_len_param_fields[] = {
+	SER_STRUCT_FIELD(bt_conn_le_data_len_param, tx_max_len, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_conn_le_data_len_param, tx_max_time, SER_TYPE_UINT),
+};
+
 void bt_conn_le_data_len_param_dec(CborValue *value, struct bt_conn_le_data_len_param *data)
 {
-	data->tx_max_len = ser_decode_uint(value);
-	data->tx_max_time = ser_decode_uint(value);
+	ser_decode_struct(value, data, bt_conn_le_data_len_param_fields,
+			  ARRAY_SIZE(bt_conn_le_data_len_param_fields));
 }
 
 static void bt_conn_le_data_len_update_rpc_handler(CborValue *value, void *handler_data)
@@ -456,11 +464,16 @@ NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_conn_le_data_len_update, BT_CONN_LE_DATA
 #endif /* defined(CONFIG_BT_USER_DATA_LEN_UPDATE) */
 
 #if defined(CONFIG_BT_USER_PHY_UPDATE)
+static const struct ser_struct_field bt_conn_le_phy_param_fields[] = {
+	SER_STRUCT_FIELD(bt_conn_le_phy_param, options, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_conn_le_phy_param, pref_tx_phy, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_conn_le_phy_param, pref_rx_phy, SER_TYPE_UINT),
+};
+
 void bt_conn_le_phy_param_dec(CborValue *value, struct bt_conn_le_phy_param *data)
 {
-	data->options = ser_decode_uint(value);
-	data->pref_tx_phy = ser_decode_uint(value);
-	data->pref_rx_phy = ser_decode_uint(value);
+	ser_decode_struct(value, data, bt_conn_le_phy_param_fields,
+			  ARRAY_SIZE(bt_conn_le_phy_param_fields));
 }
 
 static void bt_conn_le_phy_update_rpc_handler(CborValue *value, void *handler_data)
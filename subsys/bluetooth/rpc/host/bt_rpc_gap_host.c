@@ -345,15 +345,20 @@ void bt_data_dec(struct ser_scratchpad *scratchpad, struct bt_data *data)
 	data->data = ser_decode_buffer_into_scratchpad(scratchpad);
 }
 
+static const struct ser_struct_field bt_le_scan_param_fields[] = {
+	SER_STRUCT_FIELD(bt_le_scan_param, type, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, options, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, interval, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, window, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, timeout, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, interval_coded, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_scan_param, window_coded, SER_TYPE_UINT),
+};
+
 void bt_le_scan_param_dec(CborValue *value, struct bt_le_scan_param *data)
 {
-	data->type = ser_decode_uint(value);
-	data->options = ser_decode_uint(value);
-	data->interval = ser_decode_uint(value);
-	data->window = ser_decode_uint(value);
-	data->timeout = ser_decode_uint(value);
-	data->interval_coded = ser_decode_uint(value);
-	data->window_coded = ser_decode_uint(value);
+	ser_decode_struct(value, data, bt_le_scan_param_fields,
+			  ARRAY_SIZE(bt_le_scan_param_fields));
 }
 
 
@@ -396,8 +401,15 @@ static inline void bt_le_scan_cb_t_callback(const bt_addr_le_t *addr,
 	net_buf_simple_enc(&ctx.encoder, buf);
 	ser_encode_callback_call(&ctx.encoder, callback_slot);
 
-	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_LE_SCAN_CB_T_CALLBACK_RPC_CMD,
-				&ctx, ser_rsp_decode_void, NULL);
+	if (IS_ENABLED(CONFIG_BT_RPC_SCAN_REPORT_FASTPATH)) {
+		nrf_rpc_cbor_evt_no_err(&bt_rpc_grp,
+					BT_LE_SCAN_CB_T_CALLBACK_RPC_EVT,
+					&ctx);
+	} else {
+		nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp,
+					BT_LE_SCAN_CB_T_CALLBACK_RPC_CMD,
+					&ctx, ser_rsp_decode_void, NULL);
+	}
 }
 
 
@@ -405,16 +417,21 @@ CBKPROXY_HANDLER(bt_le_scan_cb_t_encoder, bt_le_scan_cb_t_callback,
 		 (const bt_addr_le_t *addr, int8_t rssi, uint8_t adv_type,
 		  struct net_buf_simple *buf), (addr, rssi, adv_type, buf));
 
+static const struct ser_struct_field bt_le_adv_param_fields[] = {
+	SER_STRUCT_FIELD(bt_le_adv_param, id, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_adv_param, sid, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_adv_param, secondary_max_skip, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_adv_param, options, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_adv_param, interval_min, SER_TYPE_UINT),
+	SER_STRUCT_FIELD(bt_le_adv_param, interval_max, SER_TYPE_UINT),
+};
+
 void bt_le_adv_param_dec(struct ser_scratchpad *scratchpad, struct bt_le_adv_param *data)
 {
 	CborValue *value = scratchpad->value;
 
-	data->id = ser_decode_uint(value);
-	data->sid = ser_decode_uint(value);
-	data->secondary_max_skip = ser_decode_uint(value);
-	data->options = ser_decode_uint(value);
-	data->interval_min = ser_decode_uint(value);
-	data->interval_max = ser_decode_uint(value);
+	ser_decode_struct(value, data, bt_le_adv_param_fields,
+			  ARRAY_SIZE(bt_le_adv_param_fields));
 	data->peer = ser_decode_buffer_into_scratchpad(scratchpad);
 }
 
@@ -1080,8 +1097,13 @@ void bt_le_scan_cb_recv(const struct bt_le_scan_recv_info *info,
 	bt_le_scan_recv_info_enc(&ctx.encoder, info);
 	net_buf_simple_enc(&ctx.encoder, buf);
 
-	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_LE_SCAN_CB_RECV_RPC_CMD,
-				&ctx, ser_rsp_decode_void, NULL);
+	if (IS_ENABLED(CONFIG_BT_RPC_SCAN_REPORT_FASTPATH)) {
+		nrf_rpc_cbor_evt_no_err(&bt_rpc_grp, BT_LE_SCAN_CB_RECV_RPC_EVT,
+					&ctx);
+	} else {
+		nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_LE_SCAN_CB_RECV_RPC_CMD,
+					&ctx, ser_rsp_decode_void, NULL);
+	}
 }
 
 void bt_le_scan_cb_timeout(void)
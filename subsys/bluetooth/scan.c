@@ -110,6 +110,14 @@ struct bt_scan_uuid {
 		/* 128-bit UUID. */
 		struct bt_uuid_128 uuid_128;
 	} uuid_data;
+
+	/* UUID precomputed in the advertising data format (little-endian),
+	 * used to accelerate matching against raw advertising payload.
+	 */
+	uint8_t raw[BT_SCAN_UUID_128_SIZE];
+
+	/* Length of the precomputed UUID representation. */
+	uint8_t raw_len;
 };
 
 /* UUIDs filter structure.
@@ -219,6 +227,25 @@ struct conn_attempts_filter {
 };
 #endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
 
+#if CONFIG_BT_SCAN_DEDUP_FILTER
+/* Advertisement deduplication cache. Stores addresses of recently seen
+ * devices that did not match any filter.
+ */
+struct adv_dedup_cache {
+	/* Addresses of the cached devices. */
+	bt_addr_le_t addr[CONFIG_BT_SCAN_DEDUP_FILTER_LEN];
+
+	/* Time at which the given entry was cached. */
+	int64_t timestamp[CONFIG_BT_SCAN_DEDUP_FILTER_LEN];
+
+	/* Index of the oldest entry. */
+	uint32_t oldest_idx;
+
+	/* Count of the cached devices. */
+	size_t count;
+};
+#endif /* CONFIG_BT_SCAN_DEDUP_FILTER */
+
 #if CONFIG_BT_SCAN_BLOCKLIST
 /* Connection blocklist */
 struct conn_blocklist {
@@ -264,6 +291,11 @@ static struct bt_scan {
 	struct conn_blocklist blocklist;
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
+#if CONFIG_BT_SCAN_DEDUP_FILTER
+	/* Advertisement deduplication cache. */
+	struct adv_dedup_cache dedup_cache;
+#endif /* CONFIG_BT_SCAN_DEDUP_FILTER */
+
 } bt_scan;
 
 static sys_slist_t callback_list;
@@ -347,6 +379,92 @@ static bool blocklist_device_check(const bt_addr_le_t *addr)
 }
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
+#if CONFIG_BT_SCAN_DEDUP_FILTER
+static bool dedup_device_check(const bt_addr_le_t *addr)
+{
+	struct adv_dedup_cache *cache = &bt_scan.dedup_cache;
+	int64_t now = k_uptime_get();
+	bool cached = false;
+
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+
+	for (size_t i = 0; i < cache->count; i++) {
+		if (bt_addr_le_cmp(&cache->addr[i], addr) == 0) {
+			cached = (now - cache->timestamp[i]) <
+				 CONFIG_BT_SCAN_DEDUP_FILTER_TIMEOUT;
+			if (!cached) {
+				/* Refresh the expired entry - the device
+				 * is going to be processed again.
+				 */
+				cache->timestamp[i] = now;
+			}
+
+			break;
+		}
+	}
+
+	k_mutex_unlock(&scan_mutex);
+
+	return cached;
+}
+
+static void dedup_device_add(const bt_addr_le_t *addr)
+{
+	struct adv_dedup_cache *cache = &bt_scan.dedup_cache;
+	int64_t now = k_uptime_get();
+
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+
+	for (size_t i = 0; i < cache->count; i++) {
+		if (bt_addr_le_cmp(&cache->addr[i], addr) == 0) {
+			cache->timestamp[i] = now;
+			goto out;
+		}
+	}
+
+	if (cache->count >= ARRAY_SIZE(cache->addr)) {
+		/* Overwrite the oldest entry. */
+		bt_addr_le_copy(&cache->addr[cache->oldest_idx], addr);
+		cache->timestamp[cache->oldest_idx] = now;
+
+		cache->oldest_idx++;
+		if (cache->oldest_idx >= ARRAY_SIZE(cache->addr)) {
+			cache->oldest_idx = 0;
+		}
+	} else {
+		bt_addr_le_copy(&cache->addr[cache->count], addr);
+		cache->timestamp[cache->count] = now;
+		cache->count++;
+	}
+
+out:
+	k_mutex_unlock(&scan_mutex);
+}
+
+static void dedup_cache_clear(void)
+{
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+	memset(&bt_scan.dedup_cache, 0, sizeof(bt_scan.dedup_cache));
+	k_mutex_unlock(&scan_mutex);
+}
+#else
+static bool dedup_device_check(const bt_addr_le_t *addr)
+{
+	ARG_UNUSED(addr);
+
+	return false;
+}
+
+static void dedup_device_add(const bt_addr_le_t *addr)
+{
+	ARG_UNUSED(addr);
+}
+
+static void dedup_cache_clear(void)
+{
+}
+#endif /* CONFIG_BT_SCAN_DEDUP_FILTER */
+
 #if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
 static void attempts_filter_force_add(struct conn_attempts_filter *filter,
 				      const bt_addr_le_t *addr)
@@ -783,6 +901,20 @@ static bool find_uuid(const uint8_t *data,
 		return false;
 	}
 
+	if (target_uuid->raw_len == uuid_len) {
+		/* Fast path - the target UUID is precomputed in the
+		 * advertising data format, so a direct comparison against
+		 * the raw payload is enough.
+		 */
+		for (size_t i = 0; i < data_len; i += uuid_len) {
+			if (memcmp(&data[i], target_uuid->raw, uuid_len) == 0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	for (size_t i = 0; i < data_len; i += uuid_len) {
 		struct bt_uuid_128 uuid;
 
@@ -882,7 +1014,9 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		}
 	}
 
-	/* Add UUID to the filter. */
+	/* Add UUID to the filter. Precompute the advertising data
+	 * representation of the UUID to accelerate matching.
+	 */
 	switch (uuid->type) {
 	case BT_UUID_TYPE_16:
 		uuid_16 = BT_UUID_16(uuid);
@@ -890,6 +1024,8 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		uuid_filter[counter].uuid_data.uuid_16 = *uuid_16;
 		uuid_filter[counter].uuid =
 				(struct bt_uuid *)&uuid_filter[counter].uuid_data.uuid_16;
+		sys_put_le16(uuid_16->val, uuid_filter[counter].raw);
+		uuid_filter[counter].raw_len = sizeof(uint16_t);
 		break;
 
 	case BT_UUID_TYPE_32:
@@ -898,6 +1034,8 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		uuid_filter[counter].uuid_data.uuid_32 = *uuid_32;
 		uuid_filter[counter].uuid =
 				(struct bt_uuid *)&uuid_filter[counter].uuid_data.uuid_32;
+		sys_put_le32(uuid_32->val, uuid_filter[counter].raw);
+		uuid_filter[counter].raw_len = sizeof(uint32_t);
 		break;
 
 	case BT_UUID_TYPE_128:
@@ -906,6 +1044,9 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		uuid_filter[counter].uuid_data.uuid_128 = *uuid_128;
 		uuid_filter[counter].uuid =
 				(struct bt_uuid *)&uuid_filter[counter].uuid_data.uuid_128;
+		memcpy(uuid_filter[counter].raw, uuid_128->val,
+		       BT_SCAN_UUID_128_SIZE);
+		uuid_filter[counter].raw_len = BT_SCAN_UUID_128_SIZE;
 		break;
 
 	default:
@@ -1204,6 +1345,11 @@ int bt_scan_filter_add(enum bt_scan_filter_type type,
 		break;
 	}
 
+	if (!err) {
+		/* Filter configuration changed - drop cached verdicts. */
+		dedup_cache_clear();
+	}
+
 	k_mutex_unlock(&scan_mutex);
 
 	return err;
@@ -1237,6 +1383,8 @@ void bt_scan_filter_remove_all(void)
 		&bt_scan.scan_filters.manufacturer_data;
 	manufacturer_data_filter->cnt = 0;
 
+	dedup_cache_clear();
+
 	k_mutex_unlock(&scan_mutex);
 }
 
@@ -1249,6 +1397,8 @@ void bt_scan_filter_disable(void)
 	bt_scan.scan_filters.uuid.enabled = false;
 	bt_scan.scan_filters.appearance.enabled = false;
 	bt_scan.scan_filters.manufacturer_data.enabled = false;
+
+	dedup_cache_clear();
 }
 
 int bt_scan_filter_enable(uint8_t mode, bool match_all)
@@ -1472,6 +1622,10 @@ static void filter_state_check(struct bt_scan_control *control,
 				      control->connectable);
 		scan_connect_with_target(control, addr);
 	} else {
+		/* Cache the device so that its subsequent advertising
+		 * reports can be dropped early.
+		 */
+		dedup_device_add(addr);
 		notify_filter_no_match(&control->device_info,
 				       control->connectable);
 	}
@@ -1483,6 +1637,13 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 	struct bt_scan_control scan_control;
 	struct net_buf_simple_state state;
 
+	/* Skip processing of devices that recently did not match
+	 * any filter.
+	 */
+	if (dedup_device_check(info->addr)) {
+		return;
+	}
+
 	memset(&scan_control, 0, sizeof(scan_control));
 
 	scan_control.all_mode = bt_scan.scan_filters.all_mode;
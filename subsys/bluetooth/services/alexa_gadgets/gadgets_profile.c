@@ -72,38 +72,26 @@ BUILD_ASSERT(sizeof(GADGETS_CAP_DSN_PLACEHOLDER) ==
 BUILD_ASSERT(sizeof(GADGETS_CAP_DEV_TOKEN_PLACEHOLDER) ==
 	     (GADGETS_TOKEN_LEN_CHARS + 1));
 
-static int directive_handler_discovery(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len);
+static int directive_handler_discovery(struct bt_conn *conn, const char *name);
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_MUSICDATA
-static int directive_handler_musicdata(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len);
+static int directive_handler_tempo(struct bt_conn *conn, const char *name);
 #endif
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_SPEECHDATA
-static int directive_handler_speechdata(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len);
+static int directive_handler_speechmarks(struct bt_conn *conn, const char *name);
 #endif
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_STATELISTENER
-static int directive_handler_statelistener(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len);
+static int directive_handler_stateupdate(struct bt_conn *conn, const char *name);
 #endif
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_NOTIFICATIONS
-static int directive_handler_notifications(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len);
+static int directive_handler_setindicator(struct bt_conn *conn, const char *name);
+static int directive_handler_clearindicator(struct bt_conn *conn, const char *name);
 #endif
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_ALERTS
-static int directive_handler_alerts(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len);
+static int directive_handler_setalert(struct bt_conn *conn, const char *name);
+static int directive_handler_deletealert(struct bt_conn *conn, const char *name);
 #endif
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_CUSTOM
-static int directive_handler_custom(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len);
+static int directive_handler_custom(struct bt_conn *conn, const char *name);
 #endif
 
 
@@ -112,32 +100,73 @@ static int directive_handler_custom(
 #define CONFIG_BT_ALEXA_GADGETS_CAPABILITY_CUSTOM_NAMESPACE "-"
 #endif
 
-/* struct array containing directive namespaces with corresponding handlers */
-static const struct {
+/* struct array containing directive namespace/name pairs with corresponding
+ * handlers. Hashes of the namespace and name strings are computed once at
+ * initialization so that lookups only fall back to string comparison on a
+ * hash match. A NULL name matches any name within the namespace.
+ */
+static struct directive_entry {
 	const char *namespace;
-	int (*handler)(struct bt_conn *conn, const char *name,
-		       const uint8_t *data, uint16_t len);
-} namespace_handlers[] = {
-	{.namespace = "Alexa.Discovery", .handler = directive_handler_discovery},
+	const char *name;
+	int (*handler)(struct bt_conn *conn, const char *name);
+	uint8_t namespace_hash;
+	uint8_t name_hash;
+} directive_table[] = {
+	{
+		.namespace = "Alexa.Discovery",
+		.name = "Discover",
+		.handler = directive_handler_discovery
+	},
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_MUSICDATA
-	{.namespace = "Alexa.Gadget.MusicData", .handler = directive_handler_musicdata},
+	{
+		.namespace = "Alexa.Gadget.MusicData",
+		.name = "Tempo",
+		.handler = directive_handler_tempo
+	},
 #endif
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_SPEECHDATA
-	{.namespace = "Alexa.Gadget.SpeechData", .handler = directive_handler_speechdata},
+	{
+		.namespace = "Alexa.Gadget.SpeechData",
+		.name = "Speechmarks",
+		.handler = directive_handler_speechmarks
+	},
 #endif
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_STATELISTENER
-	{.namespace = "Alexa.Gadget.StateListener", .handler = directive_handler_statelistener},
+	{
+		.namespace = "Alexa.Gadget.StateListener",
+		.name = "StateUpdate",
+		.handler = directive_handler_stateupdate
+	},
 #endif
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_NOTIFICATIONS
-	{.namespace = "Notifications", .handler = directive_handler_notifications},
+	{
+		.namespace = "Notifications",
+		.name = "SetIndicator",
+		.handler = directive_handler_setindicator
+	},
+	{
+		.namespace = "Notifications",
+		.name = "ClearIndicator",
+		.handler = directive_handler_clearindicator
+	},
 #endif
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_ALERTS
-	{.namespace = "Alerts", .handler = directive_handler_alerts},
+	{
+		.namespace = "Alerts",
+		.name = "SetAlert",
+		.handler = directive_handler_setalert
+	},
+	{
+		.namespace = "Alerts",
+		.name = "DeleteAlert",
+		.handler = directive_handler_deletealert
+	},
 #endif
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_CUSTOM
 	{
 		.namespace =
 			CONFIG_BT_ALEXA_GADGETS_CAPABILITY_CUSTOM_NAMESPACE,
+		.name = NULL,
 		.handler = directive_handler_custom
 	},
 #endif
@@ -278,38 +307,50 @@ static union {
 	/* Top-level directive */
 	directive_DirectiveParserProto directive_parser;
 
+#if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_CUSTOM
+	custom_event_proto custom_event;
+#endif
+} protobuf_decoded;
+
+/* Buffer to hold decoded directive payloads, reused across directives.
+ * Payloads are decoded from the raw payload bytes captured by the directive
+ * parser, which reside in protobuf_decoded. The payload structs are
+ * therefore kept in a separate union so that source and destination of the
+ * payload decoding do not overlap.
+ */
+#if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_NOTIFICATIONS || \
+	CONFIG_BT_ALEXA_GADGETS_CAPABILITY_ALERTS || \
+	CONFIG_BT_ALEXA_GADGETS_CAPABILITY_STATELISTENER || \
+	CONFIG_BT_ALEXA_GADGETS_CAPABILITY_SPEECHDATA || \
+	CONFIG_BT_ALEXA_GADGETS_CAPABILITY_MUSICDATA
+static union {
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_NOTIFICATIONS
 	/* Indications */
-	notifications_ClearIndicatorDirectiveProto clear_indicator;
-	notifications_SetIndicatorDirectiveProto set_indicator;
+	notifications_SetIndicatorDirectivePayloadProto set_indicator;
 #endif
 
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_ALERTS
 	/* Alerts */
-	alerts_SetAlertDirectiveProto set_alert;
-	alerts_DeleteAlertDirectiveProto delete_alert;
+	alerts_SetAlertDirectivePayloadProto set_alert;
+	alerts_DeleteAlertDirectivePayloadProto delete_alert;
 #endif
 
-
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_STATELISTENER
 	/* State listener updates */
-	alexaGadgetStateListener_StateUpdateDirectiveProto state_update;
+	alexaGadgetStateListener_StateUpdateDirectivePayloadProto state_update;
 #endif
 
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_SPEECHDATA
 	/* Speech marks */
-	alexaGadgetSpeechData_SpeechmarksDirectiveProto speech_marks;
+	alexaGadgetSpeechData_SpeechmarksDirectivePayloadProto speech_marks;
 #endif
 
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_MUSICDATA
 	/* Music data */
-	alexaGadgetMusicData_TempoDirectiveProto music_tempo;
+	alexaGadgetMusicData_TempoDirectivePayloadProto music_tempo;
 #endif
-
-#if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_CUSTOM
-	custom_event_proto custom_event;
+} payload_decoded;
 #endif
-} protobuf_decoded;
 
 /* Advertising data format as described in Alexa Gadgets tech docs */
 
@@ -400,6 +441,53 @@ static char *strnstr(const char *str1, size_t len, const char *str2)
 	return NULL;
 }
 
+/* djb2 hash folded to 8 bits, used to index the directive dispatch table
+ * without comparing full strings for every entry.
+ */
+static uint8_t directive_str_hash(const char *str)
+{
+	uint32_t hash = 5381;
+
+	while (*str) {
+		hash = (hash * 33) + (uint8_t) *str++;
+	}
+
+	return (uint8_t) (hash ^ (hash >> 8) ^ (hash >> 16) ^ (hash >> 24));
+}
+
+/* Decode a directive payload from the raw payload bytes captured by the
+ * directive parser. This avoids a second decoding pass over the full
+ * directive message for every incoming directive.
+ *
+ * Returns 0 on success, -ENODATA when the directive carries no payload,
+ * and -EINVAL when the payload cannot be decoded.
+ */
+#if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_NOTIFICATIONS || \
+	CONFIG_BT_ALEXA_GADGETS_CAPABILITY_ALERTS || \
+	CONFIG_BT_ALEXA_GADGETS_CAPABILITY_STATELISTENER || \
+	CONFIG_BT_ALEXA_GADGETS_CAPABILITY_SPEECHDATA || \
+	CONFIG_BT_ALEXA_GADGETS_CAPABILITY_MUSICDATA
+static int directive_payload_decode(const pb_msgdesc_t *msg_desc, void *dest)
+{
+	const directive_DirectiveParserProto *parser =
+		&protobuf_decoded.directive_parser;
+
+	if (!parser->has_directive || parser->directive.payload.size == 0) {
+		return -ENODATA;
+	}
+
+	pb_istream_t stream_in = pb_istream_from_buffer(
+		parser->directive.payload.bytes,
+		parser->directive.payload.size);
+
+	if (!pb_decode(&stream_in, msg_desc, dest)) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+#endif
+
 static void serial_number_string_get(char *serial_number)
 {
 	uint8_t device_id[GADGETS_DSN_LENGTH_BYTES];
@@ -763,40 +851,54 @@ static bool gadgets_alexa_stream_cb(struct bt_conn *conn,
 
 	ret = false;
 
-	for (int i = 0; i < ARRAY_SIZE(namespace_handlers); ++i) {
-		if (strcmp(namespace, namespace_handlers[i].namespace) == 0) {
-			/* Reminder:
-			 * protobuf_encoded is re-used by handlers
-			 * for outoing messages.
-			 */
-			err = namespace_handlers[i].handler(
-				conn, name, protobuf_encoded, protobuf_offset);
-			if (err) {
-				LOG_ERR("Unsupported %s / %s", log_strdup(name),
-					log_strdup(namespace));
-			} else {
-				ret = true;
-			}
+	const struct directive_entry *entry = NULL;
+	bool namespace_known = false;
+	uint8_t namespace_hash = directive_str_hash(namespace);
+	uint8_t name_hash = directive_str_hash(name);
+
+	for (int i = 0; i < ARRAY_SIZE(directive_table); ++i) {
+		if ((directive_table[i].namespace_hash != namespace_hash) ||
+		    (strcmp(namespace, directive_table[i].namespace) != 0)) {
+			continue;
+		}
+
+		namespace_known = true;
+
+		if ((directive_table[i].name == NULL) ||
+		    ((directive_table[i].name_hash == name_hash) &&
+		     (strcmp(name, directive_table[i].name) == 0))) {
+			entry = &directive_table[i];
 			break;
 		}
 	}
 
+	if (entry) {
+		/* Reminder:
+		 * protobuf_encoded is re-used by handlers
+		 * for outoing messages.
+		 */
+		err = entry->handler(conn, name);
+		if (err) {
+			LOG_ERR("Unsupported %s / %s", log_strdup(name),
+				log_strdup(namespace));
+		} else {
+			ret = true;
+		}
+	} else if (namespace_known) {
+		LOG_ERR("Unsupported %s / %s", log_strdup(name),
+			log_strdup(namespace));
+	}
+
 cleanup:
 	encoded_data_reset();
 
 	return ret;
 }
 
-static int directive_handler_discovery(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len)
+static int directive_handler_discovery(struct bt_conn *conn, const char *name)
 {
 	int err;
 
-	if (strcmp(name, "Discover") != 0) {
-		return -EINVAL;
-	}
-
 	/* Construct response to discovery directive from hardcoded template.
 	 * Serial number and device token are device-unique values
 	 * that must be updated at runtime.
@@ -853,232 +955,160 @@ static int directive_handler_discovery(
 }
 
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_MUSICDATA
-static int directive_handler_musicdata(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len)
+static int directive_handler_tempo(struct bt_conn *conn, const char *name)
 {
-	bool success;
-	pb_istream_t stream_in;
-
-	stream_in = pb_istream_from_buffer(data, len);
-
-	if (strcmp(name, "Tempo") == 0) {
-		success = pb_decode(
-			&stream_in,
-			&alexaGadgetMusicData_TempoDirectiveProto_msg,
-			&protobuf_decoded.music_tempo);
-		if (!success) {
-			LOG_ERR("Music tempo decode error");
-			return -EINVAL;
-		}
-		struct bt_gadgets_evt evt = {
-			.type = BT_GADGETS_EVT_MUSICTEMPO,
-			.parameters.music_tempo = NULL,
-		};
-
-		if (protobuf_decoded.music_tempo.has_directive &&
-		    protobuf_decoded.music_tempo.directive.has_payload) {
-			evt.parameters.music_tempo =
-				&protobuf_decoded.music_tempo.directive.payload;
-		}
+	int err;
+	struct bt_gadgets_evt evt = {
+		.type = BT_GADGETS_EVT_MUSICTEMPO,
+		.parameters.music_tempo = NULL,
+	};
 
-		callback(&evt);
-		return 0;
+	err = directive_payload_decode(
+		&alexaGadgetMusicData_TempoDirectivePayloadProto_msg,
+		&payload_decoded.music_tempo);
+	if (err == -EINVAL) {
+		LOG_ERR("Music tempo decode error");
+		return err;
+	} else if (err == 0) {
+		evt.parameters.music_tempo = &payload_decoded.music_tempo;
 	}
 
-	return -ENOTSUP;
+	callback(&evt);
+	return 0;
 }
 #endif
 
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_SPEECHDATA
-static int directive_handler_speechdata(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len)
+static int directive_handler_speechmarks(struct bt_conn *conn, const char *name)
 {
-	bool success;
-	pb_istream_t stream_in;
-
-	stream_in = pb_istream_from_buffer(data, len);
-
-	if (strcmp(name, "Speechmarks") == 0) {
-		success = pb_decode(
-			&stream_in,
-			&alexaGadgetSpeechData_SpeechmarksDirectiveProto_msg,
-			&protobuf_decoded.speech_marks);
-		if (!success) {
-			LOG_ERR("Speechmarks decode error");
-			return -EINVAL;
-		}
-		struct bt_gadgets_evt evt = {
-			.type = BT_GADGETS_EVT_SPEECHMARKS,
-			.parameters.speech_marks = NULL,
-		};
-
-		if (protobuf_decoded.speech_marks.has_directive &&
-		    protobuf_decoded.speech_marks.directive.has_payload) {
-			evt.parameters.speech_marks =
-				&protobuf_decoded.speech_marks.directive.payload;
-		}
+	int err;
+	struct bt_gadgets_evt evt = {
+		.type = BT_GADGETS_EVT_SPEECHMARKS,
+		.parameters.speech_marks = NULL,
+	};
 
-		callback(&evt);
-		return 0;
+	err = directive_payload_decode(
+		&alexaGadgetSpeechData_SpeechmarksDirectivePayloadProto_msg,
+		&payload_decoded.speech_marks);
+	if (err == -EINVAL) {
+		LOG_ERR("Speechmarks decode error");
+		return err;
+	} else if (err == 0) {
+		evt.parameters.speech_marks = &payload_decoded.speech_marks;
 	}
 
-	return -ENOTSUP;
+	callback(&evt);
+	return 0;
 }
 #endif
 
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_STATELISTENER
-static int directive_handler_statelistener(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len)
+static int directive_handler_stateupdate(struct bt_conn *conn, const char *name)
 {
-	bool success;
-	pb_istream_t stream_in;
-
-	stream_in = pb_istream_from_buffer(data, len);
-
-	if (strcmp(name, "StateUpdate") == 0) {
-		success = pb_decode(
-			&stream_in,
-			&alexaGadgetStateListener_StateUpdateDirectiveProto_msg,
-			&protobuf_decoded.state_update);
-		if (!success) {
-			LOG_ERR("StateUpdate decode error");
-			return -EINVAL;
-		}
-
-		struct bt_gadgets_evt evt = {
-			.type = BT_GADGETS_EVT_STATEUPDATE,
-			.parameters.state_update = NULL,
-		};
-
-		if (protobuf_decoded.state_update.has_directive &&
-		    protobuf_decoded.state_update.directive.has_payload) {
-			evt.parameters.state_update =
-				&protobuf_decoded.state_update.directive.payload;
-		}
+	int err;
+	struct bt_gadgets_evt evt = {
+		.type = BT_GADGETS_EVT_STATEUPDATE,
+		.parameters.state_update = NULL,
+	};
 
-		callback(&evt);
-		return 0;
+	err = directive_payload_decode(
+		&alexaGadgetStateListener_StateUpdateDirectivePayloadProto_msg,
+		&payload_decoded.state_update);
+	if (err == -EINVAL) {
+		LOG_ERR("StateUpdate decode error");
+		return err;
+	} else if (err == 0) {
+		evt.parameters.state_update = &payload_decoded.state_update;
 	}
 
-	return -ENOTSUP;
+	callback(&evt);
+	return 0;
 }
 #endif
 
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_NOTIFICATIONS
-static int directive_handler_notifications(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len)
+static int directive_handler_setindicator(struct bt_conn *conn, const char *name)
 {
-	bool success;
-	pb_istream_t stream_in;
-
-	stream_in = pb_istream_from_buffer(data, len);
-
-	if (strcmp(name, "SetIndicator") == 0) {
-		success = pb_decode(
-			&stream_in,
-			&notifications_SetIndicatorDirectiveProto_msg,
-			&protobuf_decoded.set_indicator);
-		if (!success) {
-			LOG_ERR("SetIndicator decode error");
-			return -EINVAL;
-		}
-
-		struct bt_gadgets_evt evt = {
-			.type = BT_GADGETS_EVT_SETINDICATOR,
-			.parameters.set_indicator = NULL,
-		};
+	int err;
+	struct bt_gadgets_evt evt = {
+		.type = BT_GADGETS_EVT_SETINDICATOR,
+		.parameters.set_indicator = NULL,
+	};
 
-		if (protobuf_decoded.set_indicator.has_directive &&
-		    protobuf_decoded.set_indicator.directive.has_payload) {
-			evt.parameters.set_indicator =
-				&protobuf_decoded.set_indicator.directive.payload;
-		}
+	err = directive_payload_decode(
+		&notifications_SetIndicatorDirectivePayloadProto_msg,
+		&payload_decoded.set_indicator);
+	if (err == -EINVAL) {
+		LOG_ERR("SetIndicator decode error");
+		return err;
+	} else if (err == 0) {
+		evt.parameters.set_indicator = &payload_decoded.set_indicator;
+	}
 
-		callback(&evt);
-		return 0;
-	} else if (strcmp(name, "ClearIndicator") == 0) {
-		/* No data in payload: don't do protobuf decode */
-		struct bt_gadgets_evt evt = {
-			.type = BT_GADGETS_EVT_CLEARINDICATOR,
-		};
+	callback(&evt);
+	return 0;
+}
 
-		callback(&evt);
-		return 0;
-	}
+static int directive_handler_clearindicator(struct bt_conn *conn, const char *name)
+{
+	/* No data in payload: don't do protobuf decode */
+	struct bt_gadgets_evt evt = {
+		.type = BT_GADGETS_EVT_CLEARINDICATOR,
+	};
 
-	return -ENOTSUP;
+	callback(&evt);
+	return 0;
 }
 #endif
 
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_ALERTS
-static int directive_handler_alerts(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len)
+static int directive_handler_setalert(struct bt_conn *conn, const char *name)
 {
-	bool success;
-	pb_istream_t stream_in;
-
-	stream_in = pb_istream_from_buffer(data, len);
-
-	if (strcmp(name, "SetAlert") == 0) {
-		success = pb_decode(
-			&stream_in,
-			&alerts_SetAlertDirectiveProto_msg,
-			&protobuf_decoded.set_alert);
-		if (!success) {
-			LOG_ERR("SetAlert decode error");
-			return -EINVAL;
-		}
-
-		struct bt_gadgets_evt evt = {
-			.type = BT_GADGETS_EVT_SETALERT,
-			.parameters.set_alert = NULL,
-		};
-
-		if (protobuf_decoded.set_alert.has_directive &&
-		    protobuf_decoded.set_alert.directive.has_payload) {
-			evt.parameters.set_alert = &protobuf_decoded.set_alert.directive.payload;
-		}
+	int err;
+	struct bt_gadgets_evt evt = {
+		.type = BT_GADGETS_EVT_SETALERT,
+		.parameters.set_alert = NULL,
+	};
 
-		callback(&evt);
-		return 0;
-	} else if (strcmp(name, "DeleteAlert") == 0) {
-		success = pb_decode(
-			&stream_in,
-			&alerts_DeleteAlertDirectiveProto_msg,
-			&protobuf_decoded.delete_alert);
-		if (!success) {
-			LOG_ERR("DeleteAlert decode error");
-			return -EINVAL;
-		}
+	err = directive_payload_decode(
+		&alerts_SetAlertDirectivePayloadProto_msg,
+		&payload_decoded.set_alert);
+	if (err == -EINVAL) {
+		LOG_ERR("SetAlert decode error");
+		return err;
+	} else if (err == 0) {
+		evt.parameters.set_alert = &payload_decoded.set_alert;
+	}
 
-		struct bt_gadgets_evt evt = {
-			.type = BT_GADGETS_EVT_DELETEALERT,
-			.parameters.delete_alert = NULL,
-		};
+	callback(&evt);
+	return 0;
+}
 
-		if (protobuf_decoded.delete_alert.has_directive &&
-		    protobuf_decoded.delete_alert.directive.has_payload) {
-			evt.parameters.delete_alert =
-				&protobuf_decoded.delete_alert.directive.payload;
-		}
+static int directive_handler_deletealert(struct bt_conn *conn, const char *name)
+{
+	int err;
+	struct bt_gadgets_evt evt = {
+		.type = BT_GADGETS_EVT_DELETEALERT,
+		.parameters.delete_alert = NULL,
+	};
 
-		callback(&evt);
-		return 0;
+	err = directive_payload_decode(
+		&alerts_DeleteAlertDirectivePayloadProto_msg,
+		&payload_decoded.delete_alert);
+	if (err == -EINVAL) {
+		LOG_ERR("DeleteAlert decode error");
+		return err;
+	} else if (err == 0) {
+		evt.parameters.delete_alert = &payload_decoded.delete_alert;
 	}
 
-	return -ENOTSUP;
+	callback(&evt);
+	return 0;
 }
 #endif
 
 #if CONFIG_BT_ALEXA_GADGETS_CAPABILITY_CUSTOM
-static int directive_handler_custom(
-	struct bt_conn *conn, const char *name,
-	const uint8_t *data, uint16_t len)
+static int directive_handler_custom(struct bt_conn *conn, const char *name)
 {
 	if (!protobuf_decoded.directive_parser.has_directive) {
 		LOG_DBG("Empty custom directive");
@@ -1163,6 +1193,15 @@ int bt_gadgets_profile_init(bt_gadgets_profile_cb_t evt_handler)
 
 	callback = evt_handler;
 
+	for (int i = 0; i < ARRAY_SIZE(directive_table); ++i) {
+		directive_table[i].namespace_hash =
+			directive_str_hash(directive_table[i].namespace);
+		if (directive_table[i].name != NULL) {
+			directive_table[i].name_hash =
+				directive_str_hash(directive_table[i].name);
+		}
+	}
+
 	encoded_buffer_release();
 
 	bt_conn_cb_register(&conn_callbacks);
@@ -10,6 +10,7 @@
  * time by Apple and may cause this client implementation to stop working.
  */
 
+#include <kernel.h>
 #include <sys/byteorder.h>
 #include <bluetooth/conn.h>
 #include <bluetooth/uuid.h>
@@ -34,6 +35,69 @@ LOG_MODULE_REGISTER(ancs_c, CONFIG_BT_ANCS_CLIENT_LOG_LEVEL);
 /**< Index of the Notification UID field when parsing notifications. */
 #define BT_ANCS_NOTIF_NOTIF_UID 4
 
+#if defined(CONFIG_BT_ANCS_CLIENT_ATTR_QUEUE)
+static void attr_request_next(struct bt_ancs_client *ancs_c);
+
+/* Protects the attribute request queues of all client instances. */
+static struct k_spinlock attr_queue_lock;
+
+static bool attr_queue_put(struct bt_ancs_client *ancs_c, uint32_t uid,
+			   bt_ancs_write_cb func)
+{
+	bool queued = false;
+	k_spinlock_key_t key = k_spin_lock(&attr_queue_lock);
+
+	if (ancs_c->attr_queue_cnt < ARRAY_SIZE(ancs_c->attr_queue)) {
+		size_t idx = (ancs_c->attr_queue_head + ancs_c->attr_queue_cnt) %
+			     ARRAY_SIZE(ancs_c->attr_queue);
+
+		ancs_c->attr_queue[idx].notif_uid = uid;
+		ancs_c->attr_queue[idx].func = func;
+		ancs_c->attr_queue_cnt++;
+		queued = true;
+	}
+
+	k_spin_unlock(&attr_queue_lock, key);
+
+	return queued;
+}
+
+static bool attr_queue_get(struct bt_ancs_client *ancs_c, uint32_t *uid,
+			   bt_ancs_write_cb *func)
+{
+	bool dequeued = false;
+	k_spinlock_key_t key = k_spin_lock(&attr_queue_lock);
+
+	if (ancs_c->attr_queue_cnt > 0) {
+		*uid = ancs_c->attr_queue[ancs_c->attr_queue_head].notif_uid;
+		*func = ancs_c->attr_queue[ancs_c->attr_queue_head].func;
+		ancs_c->attr_queue_head = (ancs_c->attr_queue_head + 1) %
+					  ARRAY_SIZE(ancs_c->attr_queue);
+		ancs_c->attr_queue_cnt--;
+		dequeued = true;
+	}
+
+	k_spin_unlock(&attr_queue_lock, key);
+
+	return dequeued;
+}
+
+static void attr_queue_put_front(struct bt_ancs_client *ancs_c, uint32_t uid,
+				 bt_ancs_write_cb func)
+{
+	k_spinlock_key_t key = k_spin_lock(&attr_queue_lock);
+
+	ancs_c->attr_queue_head = (ancs_c->attr_queue_head +
+				   ARRAY_SIZE(ancs_c->attr_queue) - 1) %
+				  ARRAY_SIZE(ancs_c->attr_queue);
+	ancs_c->attr_queue[ancs_c->attr_queue_head].notif_uid = uid;
+	ancs_c->attr_queue[ancs_c->attr_queue_head].func = func;
+	ancs_c->attr_queue_cnt++;
+
+	k_spin_unlock(&attr_queue_lock, key);
+}
+#endif /* CONFIG_BT_ANCS_CLIENT_ATTR_QUEUE */
+
 /**@brief Function for checking whether the data in an iOS notification is out of bounds.
  *
  * @param[in] notif  An iOS notification.
@@ -134,6 +198,13 @@ static uint8_t on_received_ds(struct bt_conn *conn,
 
 	bt_ancs_parse_get_attrs_response(ancs_c, data, length);
 
+#if defined(CONFIG_BT_ANCS_CLIENT_ATTR_QUEUE)
+	if (atomic_test_bit(&ancs_c->state, ANCS_ATTR_REQUEST_ACTIVE) &&
+	    (ancs_c->parse_info.parse_state == BT_ANCS_PARSE_STATE_DONE)) {
+		attr_request_next(ancs_c);
+	}
+#endif
+
 	return BT_GATT_ITER_CONTINUE;
 }
 
@@ -157,6 +228,10 @@ static void ancs_reinit(struct bt_ancs_client *ancs_c)
 	ancs_c->handle_ds = 0;
 	ancs_c->handle_ds_ccc = 0;
 	ancs_c->state = ATOMIC_INIT(0);
+#if defined(CONFIG_BT_ANCS_CLIENT_ATTR_QUEUE)
+	ancs_c->attr_queue_head = 0;
+	ancs_c->attr_queue_cnt = 0;
+#endif
 }
 
 int bt_ancs_handles_assign(struct bt_gatt_dm *dm,
@@ -368,6 +443,17 @@ static void bt_ancs_cp_write_callback(struct bt_conn *conn, uint8_t err,
 	if (write_cb) {
 		write_cb(ancs_c, err);
 	}
+
+#if defined(CONFIG_BT_ANCS_CLIENT_ATTR_QUEUE)
+	/* An attribute request that lost the Control Point to a concurrent
+	 * write (for example a notification action) is retried once that
+	 * write completes.
+	 */
+	if (atomic_test_bit(&ancs_c->state, ANCS_ATTR_REQUEST_ACTIVE) &&
+	    (ancs_c->parse_info.parse_state == BT_ANCS_PARSE_STATE_DONE)) {
+		attr_request_next(ancs_c);
+	}
+#endif
 }
 
 int bt_ancs_cp_write(struct bt_ancs_client *ancs_c, uint16_t len,
@@ -452,6 +538,53 @@ static int bt_ancs_get_notif_attrs(struct bt_ancs_client *ancs_c,
 	return bt_ancs_cp_write(ancs_c, index, func);
 }
 
+#if defined(CONFIG_BT_ANCS_CLIENT_ATTR_QUEUE)
+/**@brief Function for issuing the next queued attribute request.
+ *
+ * Called when the attribute response for the request in flight has been
+ * fully parsed. Keeps the pipeline running until the queue is drained.
+ *
+ * @param[in] ancs_c  ANCS client instance.
+ */
+static void attr_request_next(struct bt_ancs_client *ancs_c)
+{
+	uint32_t uid;
+	bt_ancs_write_cb func;
+	int err;
+
+	do {
+		while (attr_queue_get(ancs_c, &uid, &func)) {
+			ancs_c->parse_info.parse_state =
+				BT_ANCS_PARSE_STATE_COMMAND_ID;
+
+			err = bt_ancs_get_notif_attrs(ancs_c, uid, func);
+			if (!err) {
+				return;
+			}
+
+			if (err == -EBUSY) {
+				/* Another Control Point write is in flight.
+				 * The request is retried when it completes.
+				 */
+				attr_queue_put_front(ancs_c, uid, func);
+				return;
+			}
+
+			LOG_ERR("Queued attribute request failed (err %d)",
+				err);
+		}
+
+		atomic_clear_bit(&ancs_c->state, ANCS_ATTR_REQUEST_ACTIVE);
+
+		/* Cover a request that was queued while the queue was being
+		 * drained.
+		 */
+	} while ((ancs_c->attr_queue_cnt > 0) &&
+		 !atomic_test_and_set_bit(&ancs_c->state,
+					  ANCS_ATTR_REQUEST_ACTIVE));
+}
+#endif /* CONFIG_BT_ANCS_CLIENT_ATTR_QUEUE */
+
 int bt_ancs_request_attrs(struct bt_ancs_client *ancs_c,
 			  const struct bt_ancs_evt_notif *notif,
 			  bt_ancs_write_cb func)
@@ -463,9 +596,36 @@ int bt_ancs_request_attrs(struct bt_ancs_client *ancs_c,
 		return err;
 	}
 
+#if defined(CONFIG_BT_ANCS_CLIENT_ATTR_QUEUE)
+	if (atomic_test_and_set_bit(&ancs_c->state, ANCS_ATTR_REQUEST_ACTIVE)) {
+		if (!attr_queue_put(ancs_c, notif->notif_uid, func)) {
+			return -ENOBUFS;
+		}
+
+		/* If the request in flight finished draining the queue
+		 * before the new entry was added, restart the pipeline.
+		 */
+		if (!atomic_test_and_set_bit(&ancs_c->state,
+					     ANCS_ATTR_REQUEST_ACTIVE)) {
+			attr_request_next(ancs_c);
+		}
+
+		return 0;
+	}
+
+	ancs_c->parse_info.parse_state = BT_ANCS_PARSE_STATE_COMMAND_ID;
+
+	err = bt_ancs_get_notif_attrs(ancs_c, notif->notif_uid, func);
+	if (err) {
+		atomic_clear_bit(&ancs_c->state, ANCS_ATTR_REQUEST_ACTIVE);
+	}
+
+	return err;
+#else
 	ancs_c->parse_info.parse_state = BT_ANCS_PARSE_STATE_COMMAND_ID;
 
 	return bt_ancs_get_notif_attrs(ancs_c, notif->notif_uid, func);
+#endif
 }
 
 int bt_ancs_register_attr(struct bt_ancs_client *ancs_c,
@@ -16,7 +16,8 @@ extern "C" {
 enum {
 	ANCS_NS_NOTIF_ENABLED,
 	ANCS_DS_NOTIF_ENABLED,
-	ANCS_CP_WRITE_PENDING
+	ANCS_CP_WRITE_PENDING,
+	ANCS_ATTR_REQUEST_ACTIVE
 };
 
 /**@brief Call Notification Source notification callback function.
@@ -765,6 +765,9 @@ hids_input_reports_register(struct bt_hids *hids_obj,
 		hids_inp_rep->att_ind = hids_obj->gp.svc.attr_count - 1;
 		hids_inp_rep->offset = offset;
 		hids_inp_rep->idx = i;
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+		hids_inp_rep->hids_obj = hids_obj;
+#endif
 
 		BT_GATT_POOL_CCC(&hids_obj->gp, hids_inp_rep->ccc,
 				 hids_input_report_ccc_changed,  wperm | rperm);
@@ -1031,6 +1034,112 @@ static void store_input_report(struct bt_hids_inp_rep *hids_inp_rep,
 	}
 }
 
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+BUILD_ASSERT(CONFIG_BT_HIDS_INPUT_REP_MAX <= 32,
+	     "Coalescing bitmasks hold up to 32 Input Reports");
+
+static void inp_rep_send_complete(struct bt_conn *conn, void *user_data);
+
+/**
+ * @brief Notify the stored value of an Input Report
+ *
+ * Sends the newest report data stored in the connection context, with
+ * the completion callback used to flush a pending update.
+ * Must be called with the connection context held.
+ *
+ * @param hids_obj HIDS instance.
+ * @param hids_inp_rep Input Report.
+ * @param conn Connection Object.
+ * @param conn_data Connection context data.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error
+ *	     code is returned.
+ */
+static int inp_rep_stored_notify(struct bt_hids *hids_obj,
+				 struct bt_hids_inp_rep *hids_inp_rep,
+				 struct bt_conn *conn,
+				 struct bt_hids_conn_data *conn_data)
+{
+	struct bt_gatt_notify_params params = {0};
+
+	params.attr = &hids_obj->gp.svc.attrs[hids_inp_rep->att_ind];
+	params.data = conn_data->inp_rep_ctx + hids_inp_rep->offset;
+	params.len = hids_inp_rep->size;
+	params.func = inp_rep_send_complete;
+	params.user_data = hids_inp_rep;
+
+	return bt_gatt_notify_cb(conn, &params);
+}
+
+static void inp_rep_send_complete(struct bt_conn *conn, void *user_data)
+{
+	struct bt_hids_inp_rep *hids_inp_rep = user_data;
+	struct bt_hids *hids_obj = hids_inp_rep->hids_obj;
+	struct bt_hids_conn_data *conn_data =
+		bt_conn_ctx_get(hids_obj->conn_ctx, conn);
+
+	if (!conn_data) {
+		return;
+	}
+
+	conn_data->inp_rep_in_flight &= ~BIT(hids_inp_rep->idx);
+
+	if (conn_data->inp_rep_pending & BIT(hids_inp_rep->idx)) {
+		conn_data->inp_rep_pending &= ~BIT(hids_inp_rep->idx);
+
+		if (!inp_rep_stored_notify(hids_obj, hids_inp_rep, conn,
+					   conn_data)) {
+			conn_data->inp_rep_in_flight |=
+				BIT(hids_inp_rep->idx);
+		}
+	}
+
+	bt_conn_ctx_release(hids_obj->conn_ctx, (void *)conn_data);
+}
+
+/**
+ * @brief Coalescing Input Report send
+ *
+ * Keeps at most one notification per report and connection in transit.
+ * If the previous notification has not completed, only the stored report
+ * data is updated; the newest value is sent right after the transmission
+ * in transit completes.
+ * Must be called with the connection context held, after the new report
+ * value has been stored in it.
+ *
+ * @param hids_obj HIDS instance.
+ * @param hids_inp_rep Input Report.
+ * @param conn Connection Object.
+ * @param conn_data Connection context data.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error
+ *	     code is returned.
+ */
+static int inp_rep_coalesced_send(struct bt_hids *hids_obj,
+				  struct bt_hids_inp_rep *hids_inp_rep,
+				  struct bt_conn *conn,
+				  struct bt_hids_conn_data *conn_data)
+{
+	int err = 0;
+
+	if (conn_data->inp_rep_in_flight & BIT(hids_inp_rep->idx)) {
+		/* The stored data is already updated. It is sent when the
+		 * notification in transit completes.
+		 */
+		conn_data->inp_rep_pending |= BIT(hids_inp_rep->idx);
+	} else {
+		err = inp_rep_stored_notify(hids_obj, hids_inp_rep, conn,
+					    conn_data);
+		if (!err) {
+			conn_data->inp_rep_in_flight |=
+				BIT(hids_inp_rep->idx);
+		}
+	}
+
+	return err;
+}
+#endif /* CONFIG_BT_HIDS_INP_REP_COALESCE */
+
 static int inp_rep_notify_all(struct bt_hids *hids_obj,
 			      struct bt_hids_inp_rep *hids_inp_rep,
 			      uint8_t const *rep, uint8_t len,
@@ -1115,6 +1224,20 @@ int bt_hids_inp_rep_send(struct bt_hids *hids_obj,
 
 	store_input_report(hids_inp_rep, rep_data, rep, len);
 
+#if defined(CONFIG_BT_HIDS_INP_REP_COALESCE)
+	/* Sends with a completion callback cannot be merged, as each of
+	 * them expects its own completion call.
+	 */
+	if (cb == NULL) {
+		int ret = inp_rep_coalesced_send(hids_obj, hids_inp_rep,
+						 conn, conn_data);
+
+		bt_conn_ctx_release(hids_obj->conn_ctx, (void *)conn_data);
+
+		return ret;
+	}
+#endif
+
 	struct bt_gatt_notify_params params = {0};
 
 	params.attr = &hids_obj->gp.svc.attrs[hids_inp_rep->att_ind];
@@ -583,8 +583,48 @@ static int post_discovery_start(struct bt_hogp *hogp)
  *
  * @sa bt_hogp_handles_assign
  */
+/**
+ * @brief Apply cached preparation data
+ *
+ * Applies values normally read from the peer after discovery.
+ * The cached data is validated against the discovered reports.
+ *
+ * @param hogp HOGP object.
+ * @param prep Cached preparation data.
+ *
+ * @return 0 or negative error code.
+ */
+static int prep_data_apply(struct bt_hogp *hogp,
+			   const struct bt_hogp_prep_data *prep)
+{
+	size_t i;
+
+	if (prep->rep_count != hogp->rep_count) {
+		LOG_ERR("Cached report count mismatch");
+		return -EINVAL;
+	}
+
+	for (i = 0; i < hogp->rep_count; i++) {
+		if (prep->rep_ref[i].type !=
+		    (uint8_t)hogp->rep_info[i]->ref.type) {
+			LOG_ERR("Cached report type mismatch (idx: %u)", i);
+			return -EINVAL;
+		}
+	}
+
+	for (i = 0; i < hogp->rep_count; i++) {
+		hogp->rep_info[i]->ref.id = prep->rep_ref[i].id;
+	}
+
+	hogp->info_val = prep->info_val;
+	hogp->pm = (hogp->handlers.pm != 0) ? prep->pm : BT_HIDS_PM_REPORT;
+
+	return 0;
+}
+
 static int handles_assign_internal(struct bt_gatt_dm *dm,
-				   struct bt_hogp *hogp)
+				   struct bt_hogp *hogp,
+				   const struct bt_hogp_prep_data *prep)
 {
 	const struct bt_gatt_dm_attr *gatt_service_attr =
 			bt_gatt_dm_service_get(dm);
@@ -751,6 +791,18 @@ static int handles_assign_internal(struct bt_gatt_dm *dm,
 	/* Finally - save connection object */
 	hogp->conn = bt_gatt_dm_conn_get(dm);
 
+	if (prep) {
+		/* All the values that would be read from the peer are
+		 * supplied by the cache - no GATT transfers are needed.
+		 */
+		ret = prep_data_apply(hogp, prep);
+		if (ret) {
+			return ret;
+		}
+		hids_mark_ready(hogp);
+		return 0;
+	}
+
 	return post_discovery_start(hogp);
 }
 
@@ -767,7 +819,7 @@ void bt_hogp_init(struct bt_hogp *hogp,
 int bt_hogp_handles_assign(struct bt_gatt_dm *dm,
 			   struct bt_hogp *hogp)
 {
-	int ret = handles_assign_internal(dm, hogp);
+	int ret = handles_assign_internal(dm, hogp, NULL);
 
 	if (ret) {
 		bt_hogp_release(hogp);
@@ -775,6 +827,46 @@ int bt_hogp_handles_assign(struct bt_gatt_dm *dm,
 	return ret;
 }
 
+int bt_hogp_handles_assign_prepped(struct bt_gatt_dm *dm,
+				   struct bt_hogp *hogp,
+				   const struct bt_hogp_prep_data *prep)
+{
+	int ret;
+
+	if (!prep) {
+		return -EINVAL;
+	}
+
+	ret = handles_assign_internal(dm, hogp, prep);
+
+	if (ret) {
+		bt_hogp_release(hogp);
+	}
+	return ret;
+}
+
+int bt_hogp_prep_data_get(const struct bt_hogp *hogp,
+			  struct bt_hogp_prep_data *prep)
+{
+	if (!hogp || !prep) {
+		return -EINVAL;
+	}
+	if (!hogp->ready) {
+		return -EAGAIN;
+	}
+
+	memset(prep, 0, sizeof(*prep));
+	prep->info_val = hogp->info_val;
+	prep->pm = hogp->pm;
+	prep->rep_count = hogp->rep_count;
+	for (size_t i = 0; i < hogp->rep_count; i++) {
+		prep->rep_ref[i].id = hogp->rep_info[i]->ref.id;
+		prep->rep_ref[i].type = (uint8_t)hogp->rep_info[i]->ref.type;
+	}
+
+	return 0;
+}
+
 void bt_hogp_release(struct bt_hogp *hogp)
 {
 	if (hogp->rep_info) {
@@ -1074,6 +1166,48 @@ int bt_hogp_rep_subscribe(struct bt_hogp *hogp,
 	return err;
 }
 
+int bt_hogp_rep_resubscribe(struct bt_hogp *hogp,
+			    struct bt_hogp_rep_info *rep,
+			    bt_hogp_read_cb func)
+{
+	int err;
+	struct bt_conn_info info;
+
+	if (!hogp || !rep || !func) {
+		return -EINVAL;
+	}
+	if (rep->ref.type != BT_HIDS_REPORT_TYPE_INPUT) {
+		return -ENOTSUP;
+	}
+	if (rep->notify_cb) {
+		return -EALREADY;
+	}
+
+	err = bt_conn_get_info(hogp->conn, &info);
+	if (err) {
+		return err;
+	}
+
+	rep->notify_cb = func;
+
+	rep->notify_params.notify = rep_notify_process;
+	rep->notify_params.value = BT_GATT_CCC_NOTIFY;
+	rep->notify_params.value_handle = rep->handlers.val;
+	rep->notify_params.ccc_handle = rep->handlers.ccc;
+
+	LOG_DBG("Resubscribe: val: %u, ccc: %u",
+		rep->notify_params.value_handle,
+		rep->notify_params.ccc_handle);
+	err = bt_gatt_resubscribe(info.id, info.le.dst, &rep->notify_params);
+	if (err) {
+		LOG_ERR("Report notification resubscribe error: %d.", err);
+		rep->notify_cb = NULL;
+		return err;
+	}
+	LOG_DBG("Report resubscribed.");
+	return err;
+}
+
 int bt_hogp_rep_unsubscribe(struct bt_hogp *hogp,
 			    struct bt_hogp_rep_info *rep)
 {
@@ -38,12 +38,39 @@ static ssize_t received_latency_request(struct bt_conn *conn,
 	return len;
 }
 
+#ifdef CONFIG_BT_LATENCY_STATS
+
+static struct bt_latency_stats latency_stats;
+
+static ssize_t read_latency_stats(struct bt_conn *conn,
+				  const struct bt_gatt_attr *attr, void *buf,
+				  uint16_t len, uint16_t offset)
+{
+	return bt_gatt_attr_read(conn, attr, buf, len, offset,
+				 attr->user_data, sizeof(latency_stats));
+}
+
+void bt_latency_stats_update(const struct bt_latency_stats *stats)
+{
+	latency_stats = *stats;
+}
+
+#define LATENCY_STATS_CHAR				\
+	, BT_GATT_CHARACTERISTIC(BT_UUID_LATENCY_STATS_CHAR,	\
+		BT_GATT_CHRC_READ,			\
+		BT_GATT_PERM_READ,			\
+		read_latency_stats, NULL, &latency_stats)
+#else
+#define LATENCY_STATS_CHAR
+#endif /* CONFIG_BT_LATENCY_STATS */
+
 BT_GATT_SERVICE_DEFINE(latency_svc,
 BT_GATT_PRIMARY_SERVICE(BT_UUID_LATENCY),
 	BT_GATT_CHARACTERISTIC(BT_UUID_LATENCY_CHAR,
 		BT_GATT_CHRC_WRITE,
 		BT_GATT_PERM_WRITE,
-		NULL, received_latency_request, NULL),
+		NULL, received_latency_request, NULL)
+	LATENCY_STATS_CHAR
 );
 
 int bt_latency_init(struct bt_latency *latency, const struct bt_latency_cb *cb)
@@ -5,7 +5,9 @@
  */
 
 #include <string.h>
+#include <zephyr.h>
 #include <sys/printk.h>
+#include <sys/byteorder.h>
 #include <zephyr/types.h>
 #include <logging/log.h>
 
@@ -26,6 +28,203 @@ enum {
 
 static const struct bt_latency_client_cb *callbacks;
 
+#ifdef CONFIG_BT_LATENCY_CLIENT_STATS
+
+/* Log2 bucket count, covers round trips of up to about 16 seconds. */
+#define HIST_BUCKETS 22
+/* Linear sub-buckets per bucket. */
+#define HIST_SUB 8
+
+static struct {
+	/* Instance that is being measured; only one at a time. */
+	struct bt_latency_client *latency;
+	struct k_work_delayable work;
+	struct k_spinlock lock;
+	uint32_t interval_ms;
+	uint32_t start_cycles;
+	bool in_flight;
+	uint8_t payload[4];
+
+	uint32_t hist[HIST_BUCKETS][HIST_SUB];
+	uint32_t count;
+	uint32_t max_us;
+} stats_ctx;
+
+static void hist_record(uint32_t us)
+{
+	uint32_t bucket;
+	uint32_t sub;
+	k_spinlock_key_t key;
+
+	if (us < HIST_SUB) {
+		bucket = 0;
+		sub = us;
+	} else {
+		uint32_t msb = 31 - __builtin_clz(us);
+
+		bucket = msb - 2;
+		if (bucket >= HIST_BUCKETS) {
+			bucket = HIST_BUCKETS - 1;
+			sub = HIST_SUB - 1;
+		} else {
+			sub = (us >> (msb - 3)) & (HIST_SUB - 1);
+		}
+	}
+
+	key = k_spin_lock(&stats_ctx.lock);
+	stats_ctx.hist[bucket][sub]++;
+	stats_ctx.count++;
+	if (us > stats_ctx.max_us) {
+		stats_ctx.max_us = us;
+	}
+	k_spin_unlock(&stats_ctx.lock, key);
+}
+
+/* Representative round-trip time of a histogram cell in microseconds. */
+static uint32_t hist_cell_value(uint32_t bucket, uint32_t sub)
+{
+	if (bucket == 0) {
+		return sub;
+	}
+	return (HIST_SUB + sub) << (bucket - 1);
+}
+
+static uint32_t hist_percentile(uint64_t target)
+{
+	uint64_t cumulative = 0;
+
+	for (uint32_t b = 0; b < HIST_BUCKETS; b++) {
+		for (uint32_t s = 0; s < HIST_SUB; s++) {
+			cumulative += stats_ctx.hist[b][s];
+			if (cumulative >= target) {
+				return hist_cell_value(b, s);
+			}
+		}
+	}
+
+	return stats_ctx.max_us;
+}
+
+static void ping_work_handler(struct k_work *work)
+{
+	int err;
+
+	ARG_UNUSED(work);
+
+	if (!stats_ctx.latency) {
+		return;
+	}
+
+	if (!stats_ctx.in_flight) {
+		stats_ctx.start_cycles = k_cycle_get_32();
+		sys_put_le32(stats_ctx.start_cycles, stats_ctx.payload);
+		stats_ctx.in_flight = true;
+
+		err = bt_latency_request(stats_ctx.latency, stats_ctx.payload,
+					 sizeof(stats_ctx.payload));
+		if (err) {
+			stats_ctx.in_flight = false;
+		}
+	}
+
+	k_work_reschedule(&stats_ctx.work, K_MSEC(stats_ctx.interval_ms));
+}
+
+/* Consumes responses to the internal pings. Returns true when handled. */
+static bool stats_response_handle(struct bt_latency_client *latency,
+				  uint8_t err,
+				  const struct bt_gatt_write_params *params)
+{
+	if (!stats_ctx.in_flight || (latency != stats_ctx.latency) ||
+	    (params->data != stats_ctx.payload)) {
+		return false;
+	}
+
+	stats_ctx.in_flight = false;
+
+	if (!err) {
+		uint32_t delta = k_cycle_get_32() - stats_ctx.start_cycles;
+
+		hist_record((uint32_t)k_cyc_to_us_floor64(delta));
+	}
+
+	return true;
+}
+
+int bt_latency_client_measure_start(struct bt_latency_client *latency,
+				    uint32_t interval_ms)
+{
+	if (!latency || !interval_ms) {
+		return -EINVAL;
+	}
+
+	if (stats_ctx.latency && (stats_ctx.latency != latency)) {
+		return -EBUSY;
+	}
+
+	stats_ctx.latency = latency;
+	stats_ctx.interval_ms = interval_ms;
+
+	k_work_reschedule(&stats_ctx.work, K_NO_WAIT);
+
+	return 0;
+}
+
+int bt_latency_client_measure_stop(struct bt_latency_client *latency)
+{
+	if (!latency || (stats_ctx.latency != latency)) {
+		return -EINVAL;
+	}
+
+	k_work_cancel_delayable(&stats_ctx.work);
+	stats_ctx.latency = NULL;
+	stats_ctx.in_flight = false;
+
+	return 0;
+}
+
+int bt_latency_client_stats_get(struct bt_latency_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	if (!stats) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&stats_ctx.lock);
+
+	stats->count = stats_ctx.count;
+	stats->max_us = stats_ctx.max_us;
+	if (stats_ctx.count) {
+		uint64_t count = stats_ctx.count;
+
+		stats->p50_us = hist_percentile((count * 50 + 99) / 100);
+		stats->p95_us = hist_percentile((count * 95 + 99) / 100);
+		stats->p99_us = hist_percentile((count * 99 + 99) / 100);
+	} else {
+		stats->p50_us = 0;
+		stats->p95_us = 0;
+		stats->p99_us = 0;
+	}
+
+	k_spin_unlock(&stats_ctx.lock, key);
+
+	return 0;
+}
+
+void bt_latency_client_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_ctx.lock);
+
+	memset(stats_ctx.hist, 0, sizeof(stats_ctx.hist));
+	stats_ctx.count = 0;
+	stats_ctx.max_us = 0;
+
+	k_spin_unlock(&stats_ctx.lock, key);
+}
+
+#endif /* CONFIG_BT_LATENCY_CLIENT_STATS */
+
 static void received_latency_response(struct bt_conn *conn, uint8_t err,
 				      struct bt_gatt_write_params *params)
 {
@@ -43,6 +242,12 @@ static void received_latency_response(struct bt_conn *conn, uint8_t err,
 
 	atomic_clear_bit(&latency->state, LATENCY_ASYNC_WRITE_PENDING);
 
+#ifdef CONFIG_BT_LATENCY_CLIENT_STATS
+	if (stats_response_handle(latency, err, params)) {
+		return;
+	}
+#endif
+
 	if (err) {
 		LOG_ERR("Received invalid Latency response (err %d)", err);
 		return;
@@ -66,6 +271,10 @@ int bt_latency_client_init(struct bt_latency_client *latency,
 		return -EALREADY;
 	}
 
+#ifdef CONFIG_BT_LATENCY_CLIENT_STATS
+	k_work_init_delayable(&stats_ctx.work, ping_work_handler);
+#endif
+
 	callbacks = cb;
 	return 0;
 }
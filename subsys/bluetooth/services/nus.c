@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <zephyr.h>
 #include <bluetooth/conn.h>
 #include <bluetooth/uuid.h>
 #include <bluetooth/gatt.h>
@@ -68,14 +69,249 @@ BT_GATT_PRIMARY_SERVICE(BT_UUID_NUS_SERVICE),
 			       NULL, on_receive, NULL),
 );
 
+/* Largest payload that bt_nus_send_sg can serialize. Matches the payload
+ * of a notification at the largest commonly negotiated ATT MTU (247).
+ */
+#define NUS_SG_GATHER_SIZE 244
+
+int bt_nus_send_sg(struct bt_conn *conn, const struct bt_nus_sg_elem *elems,
+		   size_t elem_cnt)
+{
+	uint8_t buf[NUS_SG_GATHER_SIZE];
+	size_t len = 0;
+
+	if (!elems || !elem_cnt) {
+		return -EINVAL;
+	}
+
+	/* The stack serializes the payload into the ATT PDU on its own,
+	 * so the fragments are gathered once into a PDU-sized buffer here
+	 * instead of a caller-maintained assembly buffer.
+	 */
+	for (size_t i = 0; i < elem_cnt; i++) {
+		if (elems[i].len > (sizeof(buf) - len)) {
+			return -EMSGSIZE;
+		}
+		memcpy(&buf[len], elems[i].data, elems[i].len);
+		len += elems[i].len;
+	}
+
+	if (conn && (len > bt_nus_get_mtu(conn))) {
+		return -EMSGSIZE;
+	}
+
+	return bt_nus_send(conn, buf, len);
+}
+
+#ifdef CONFIG_BT_NUS_STREAM
+
+#define STREAM_SEG_CNT CONFIG_BT_NUS_STREAM_SEG_COUNT
+#define STREAM_SEG_SIZE CONFIG_BT_NUS_STREAM_SEG_SIZE
+/* Queue level below which a starved writer is asked to resume */
+#define STREAM_RESUME_WATERMARK (STREAM_SEG_CNT / 2)
+
+struct stream_seg {
+	uint16_t len;
+	uint8_t data[STREAM_SEG_SIZE];
+};
+
+static struct {
+	struct bt_conn *conn;
+	struct stream_seg segs[STREAM_SEG_CNT];
+	/* Index of the next segment to transmit */
+	uint16_t head;
+	/* Number of queued segments */
+	uint16_t count;
+	/* A bt_nus_stream_send call could not queue all of its data */
+	bool starved;
+	struct k_work_delayable work;
+	struct k_spinlock lock;
+} stream;
+
+static void stream_notify_sent(struct bt_conn *conn, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	k_work_schedule(&stream.work, K_NO_WAIT);
+}
+
+static void stream_drop_queue(void)
+{
+	struct bt_conn *conn;
+	k_spinlock_key_t key = k_spin_lock(&stream.lock);
+
+	conn = stream.conn;
+	stream.head = 0;
+	stream.count = 0;
+	stream.starved = false;
+	stream.conn = NULL;
+
+	k_spin_unlock(&stream.lock, key);
+
+	if (conn) {
+		bt_conn_unref(conn);
+	}
+}
+
+static void stream_disconnected(struct bt_conn *conn, uint8_t reason)
+{
+	ARG_UNUSED(reason);
+
+	if (conn != stream.conn) {
+		return;
+	}
+
+	/* Drop the queue so the rearming flush work cannot notify a
+	 * connection object reused for a new peer, and release the slot
+	 * and the connection reference.
+	 */
+	k_work_cancel_delayable(&stream.work);
+	stream_drop_queue();
+}
+
+static struct bt_conn_cb stream_conn_callbacks = {
+	.disconnected = stream_disconnected,
+};
+
+static void stream_flush(struct k_work *work)
+{
+	struct bt_gatt_notify_params params;
+	struct bt_conn *conn = NULL;
+	k_spinlock_key_t key;
+	bool resumed = false;
+
+	ARG_UNUSED(work);
+
+	for (;;) {
+		struct stream_seg *seg;
+		int err;
+
+		key = k_spin_lock(&stream.lock);
+		conn = stream.conn;
+		if ((stream.count == 0) || (conn == NULL)) {
+			if (stream.starved) {
+				stream.starved = false;
+				resumed = true;
+			}
+			k_spin_unlock(&stream.lock, key);
+			break;
+		}
+		seg = &stream.segs[stream.head];
+		k_spin_unlock(&stream.lock, key);
+
+		memset(&params, 0, sizeof(params));
+		params.attr = &nus_svc.attrs[2];
+		params.data = seg->data;
+		params.len = seg->len;
+		params.func = stream_notify_sent;
+
+		err = bt_gatt_notify_cb(conn, &params);
+		if (err == -ENOMEM) {
+			/* No ATT buffer available. The completion of an
+			 * in-flight notification reschedules this work, the
+			 * timeout covers buffers held by other users.
+			 */
+			k_work_schedule(&stream.work, K_MSEC(2));
+			return;
+		} else if (err) {
+			LOG_WRN("Stream notification failed, error: %d. "
+				"Dropping queued data", err);
+			stream_drop_queue();
+			return;
+		}
+
+		/* The notification payload is copied by the stack, the
+		 * segment can be reused immediately.
+		 */
+		key = k_spin_lock(&stream.lock);
+		stream.head = (stream.head + 1) % STREAM_SEG_CNT;
+		stream.count--;
+		if (stream.starved &&
+		    (stream.count <= STREAM_RESUME_WATERMARK)) {
+			stream.starved = false;
+			resumed = true;
+		}
+		k_spin_unlock(&stream.lock, key);
+	}
+
+	if (resumed && conn && nus_cb.stream_resumed) {
+		nus_cb.stream_resumed(conn);
+	}
+}
+
+int bt_nus_stream_send(struct bt_conn *conn, const uint8_t *data, uint16_t len)
+{
+	k_spinlock_key_t key;
+	uint16_t max_seg;
+	uint16_t queued = 0;
+
+	if (!conn || !data || !len) {
+		return -EINVAL;
+	}
+
+	if (!bt_gatt_is_subscribed(conn, &nus_svc.attrs[2],
+				   BT_GATT_CCC_NOTIFY)) {
+		return -EINVAL;
+	}
+
+	max_seg = MIN(STREAM_SEG_SIZE, bt_gatt_get_mtu(conn) - 3);
+
+	key = k_spin_lock(&stream.lock);
+
+	if (stream.conn && (stream.conn != conn)) {
+		k_spin_unlock(&stream.lock, key);
+		return -EBUSY;
+	}
+	if (stream.conn == NULL) {
+		/* The reference is released when the queue is dropped,
+		 * on disconnection at the latest.
+		 */
+		stream.conn = bt_conn_ref(conn);
+	}
+
+	while ((len > 0) && (stream.count < STREAM_SEG_CNT)) {
+		struct stream_seg *seg =
+			&stream.segs[(stream.head + stream.count) %
+				     STREAM_SEG_CNT];
+
+		seg->len = MIN(len, max_seg);
+		memcpy(seg->data, data, seg->len);
+		stream.count++;
+
+		data += seg->len;
+		len -= seg->len;
+		queued += seg->len;
+	}
+
+	if (len > 0) {
+		stream.starved = true;
+	}
+
+	k_spin_unlock(&stream.lock, key);
+
+	k_work_schedule(&stream.work, K_NO_WAIT);
+
+	return queued;
+}
+
+#endif /* CONFIG_BT_NUS_STREAM */
+
 int bt_nus_init(struct bt_nus_cb *callbacks)
 {
 	if (callbacks) {
 		nus_cb.received = callbacks->received;
 		nus_cb.sent = callbacks->sent;
 		nus_cb.send_enabled = callbacks->send_enabled;
+#ifdef CONFIG_BT_NUS_STREAM
+		nus_cb.stream_resumed = callbacks->stream_resumed;
+#endif
 	}
 
+#ifdef CONFIG_BT_NUS_STREAM
+	k_work_init_delayable(&stream.work, stream_flush);
+	bt_conn_cb_register(&stream_conn_callbacks);
+#endif
+
 	return 0;
 }
 
@@ -110,6 +110,50 @@ int bt_nus_client_send(struct bt_nus_client *nus_c, const uint8_t *data,
 	return err;
 }
 
+int bt_nus_client_send_sg(struct bt_nus_client *nus_c,
+			  const struct bt_nus_sg_elem *elems, size_t elem_cnt)
+{
+	int err;
+	size_t len = 0;
+
+	if (!elems || !elem_cnt) {
+		return -EINVAL;
+	}
+
+	if (!nus_c->conn) {
+		return -ENOTCONN;
+	}
+
+	if (atomic_test_and_set_bit(&nus_c->state, NUS_C_RX_WRITE_PENDING)) {
+		return -EALREADY;
+	}
+
+	/* The write is serialized by the NUS_C_RX_WRITE_PENDING bit, so the
+	 * instance buffer stays untouched until the operation completes.
+	 */
+	for (size_t i = 0; i < elem_cnt; i++) {
+		if (elems[i].len > (sizeof(nus_c->sg_buf) - len)) {
+			atomic_clear_bit(&nus_c->state, NUS_C_RX_WRITE_PENDING);
+			return -EMSGSIZE;
+		}
+		memcpy(&nus_c->sg_buf[len], elems[i].data, elems[i].len);
+		len += elems[i].len;
+	}
+
+	nus_c->rx_write_params.func = on_sent;
+	nus_c->rx_write_params.handle = nus_c->handles.rx;
+	nus_c->rx_write_params.offset = 0;
+	nus_c->rx_write_params.data = nus_c->sg_buf;
+	nus_c->rx_write_params.length = len;
+
+	err = bt_gatt_write(nus_c->conn, &nus_c->rx_write_params);
+	if (err) {
+		atomic_clear_bit(&nus_c->state, NUS_C_RX_WRITE_PENDING);
+	}
+
+	return err;
+}
+
 int bt_nus_handles_assign(struct bt_gatt_dm *dm,
 			  struct bt_nus_client *nus_c)
 {
@@ -181,3 +181,173 @@ int bt_throughput_write(struct bt_throughput *throughput,
 					      throughput->char_handle,
 					      data, len, false);
 }
+
+#ifdef CONFIG_BT_THROUGHPUT_SWEEP
+
+/* Time the link is given to apply new parameters before a step starts. */
+#define SWEEP_SETTLE_TIME_MS 500
+/* Largest test pattern written in one operation. */
+#define SWEEP_PATTERN_SIZE 244
+
+static K_SEM_DEFINE(sweep_read_sem, 0, 1);
+static struct bt_throughput_metrics sweep_metrics;
+
+static uint8_t sweep_read_fn(struct bt_conn *conn, uint8_t err,
+			     struct bt_gatt_read_params *params,
+			     const void *data, uint16_t len)
+{
+	if (!err && data) {
+		len = MIN(len, sizeof(sweep_metrics));
+		memcpy(&sweep_metrics, data, len);
+	}
+
+	k_sem_give(&sweep_read_sem);
+
+	return BT_GATT_ITER_STOP;
+}
+
+static int sweep_params_apply(struct bt_throughput *throughput,
+			      const struct bt_throughput_sweep_config *config)
+{
+	int err;
+	const struct bt_le_conn_param conn_param = {
+		.interval_min = config->conn_interval,
+		.interval_max = config->conn_interval,
+		.latency = 0,
+		.timeout = 400,
+	};
+	const struct bt_conn_le_phy_param phy_param = {
+		.options = BT_CONN_LE_PHY_OPT_NONE,
+		.pref_tx_phy = config->phy,
+		.pref_rx_phy = config->phy,
+	};
+	const struct bt_conn_le_data_len_param data_len_param = {
+		.tx_max_len = CLAMP(config->data_len + 4,
+				    BT_GAP_DATA_LEN_DEFAULT,
+				    BT_GAP_DATA_LEN_MAX),
+		.tx_max_time = BT_GAP_DATA_TIME_MAX,
+	};
+
+	err = bt_conn_le_param_update(throughput->conn, &conn_param);
+	if (err && (err != -EALREADY)) {
+		LOG_ERR("Connection parameter update failed, error: %d", err);
+		return err;
+	}
+
+	err = bt_conn_le_phy_update(throughput->conn, &phy_param);
+	if (err && (err != -EALREADY)) {
+		LOG_ERR("PHY update failed, error: %d", err);
+		return err;
+	}
+
+	err = bt_conn_le_data_len_update(throughput->conn, &data_len_param);
+	if (err && (err != -EALREADY)) {
+		LOG_ERR("Data length update failed, error: %d", err);
+		return err;
+	}
+
+	return 0;
+}
+
+int bt_throughput_sweep(struct bt_throughput *throughput,
+			const struct bt_throughput_sweep_config *configs,
+			size_t config_cnt,
+			uint32_t step_duration_ms,
+			struct bt_throughput_sweep_result *results,
+			size_t *best)
+{
+	static uint8_t pattern[SWEEP_PATTERN_SIZE];
+	uint8_t reset_byte = 0;
+	size_t best_idx = 0;
+	int err;
+
+	if (!throughput || !configs || !config_cnt || !results) {
+		return -EINVAL;
+	}
+
+	if (!throughput->conn) {
+		return -ENOTCONN;
+	}
+
+	for (size_t i = 0; i < sizeof(pattern); i++) {
+		pattern[i] = (uint8_t)i;
+	}
+
+	for (size_t i = 0; i < config_cnt; i++) {
+		const struct bt_throughput_sweep_config *config = &configs[i];
+		int64_t end;
+
+		if ((config->data_len == 0) ||
+		    (config->data_len > sizeof(pattern))) {
+			return -EINVAL;
+		}
+
+		LOG_INF("Sweep step %u: interval %u units, len %u, phy %u",
+			i, config->conn_interval, config->data_len,
+			config->phy);
+
+		err = sweep_params_apply(throughput, config);
+		if (err) {
+			return err;
+		}
+
+		k_sleep(K_MSEC(SWEEP_SETTLE_TIME_MS));
+
+		/* A one byte write resets the metrics on the peer. */
+		err = bt_throughput_write(throughput, &reset_byte, 1);
+		if (err) {
+			return err;
+		}
+
+		end = k_uptime_get() + step_duration_ms;
+		while (k_uptime_get() < end) {
+			err = bt_throughput_write(throughput, pattern,
+						  config->data_len);
+			if (err == -ENOMEM) {
+				/* All ATT buffers in use, let them drain. */
+				k_sleep(K_MSEC(1));
+				continue;
+			} else if (err) {
+				return err;
+			}
+		}
+
+		memset(&sweep_metrics, 0, sizeof(sweep_metrics));
+		k_sem_reset(&sweep_read_sem);
+
+		throughput->read_params.single.handle =
+			throughput->char_handle;
+		throughput->read_params.single.offset = 0;
+		throughput->read_params.handle_count = 1;
+		throughput->read_params.func = sweep_read_fn;
+
+		err = bt_gatt_read(throughput->conn, &throughput->read_params);
+		if (err) {
+			LOG_ERR("Characteristic read failed.");
+			return err;
+		}
+
+		err = k_sem_take(&sweep_read_sem, K_SECONDS(5));
+		if (err) {
+			return -ETIMEDOUT;
+		}
+
+		results[i].metrics = sweep_metrics;
+
+		LOG_INF("Sweep step %u: %u bits/s",
+			i, results[i].metrics.write_rate);
+
+		if (results[i].metrics.write_rate >
+		    results[best_idx].metrics.write_rate) {
+			best_idx = i;
+		}
+	}
+
+	if (best) {
+		*best = best_idx;
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_BT_THROUGHPUT_SWEEP */
@@ -43,10 +43,29 @@ static uint32_t __noinit ram_buffer
 
 static inline void *memcpy32(void *restrict d, const void *restrict s, size_t n)
 {
+	uint32_t *restrict dst = d;
+	const uint32_t *restrict src = s;
 	size_t len_words = ROUND_UP(n, 4) / 4;
 
-	for (size_t i = 0; i < len_words; i++) {
-		((uint32_t *)d)[i] = ((uint32_t *)s)[i];
+	/* Every flash-resident byte is staged through this copy before
+	 * hashing, so it is on the critical path of boot-time validation.
+	 * Unrolling lets the compiler emit multi-word load/store sequences.
+	 */
+	while (len_words >= 8) {
+		dst[0] = src[0];
+		dst[1] = src[1];
+		dst[2] = src[2];
+		dst[3] = src[3];
+		dst[4] = src[4];
+		dst[5] = src[5];
+		dst[6] = src[6];
+		dst[7] = src[7];
+		dst += 8;
+		src += 8;
+		len_words -= 8;
+	}
+	while (len_words-- > 0) {
+		*dst++ = *src++;
 	}
 	return d;
 }
@@ -27,6 +27,10 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_CAF_BLE_ADV_LOG_LEVEL);
 #define CONFIG_CAF_BLE_ADV_SWIFT_PAIR_GRACE_PERIOD 0
 #endif
 
+#ifndef CONFIG_CAF_BLE_ADV_FAST_ADV_TIMEOUT_MIN
+#define CONFIG_CAF_BLE_ADV_FAST_ADV_TIMEOUT_MIN 0
+#endif
+
 #define SWIFT_PAIR_SECTION_SIZE 1 /* number of struct bt_data objects */
 
 #define MAX_KEY_LEN 30
@@ -71,6 +75,36 @@ enum peer_rpa {
 
 static enum peer_rpa peer_is_rpa[CONFIG_BT_ID_MAX];
 
+static uint16_t fast_adv_timeout = CONFIG_CAF_BLE_ADV_FAST_ADV_TIMEOUT;
+
+
+static void fast_adv_connected(void)
+{
+	if (!IS_ENABLED(CONFIG_CAF_BLE_ADV_FAST_ADV_ADAPTIVE)) {
+		return;
+	}
+
+	/* The peer connected while fast advertising was running. Keep
+	 * spending on quick discovery, as the peer tends to return within
+	 * the fast advertising period.
+	 */
+	fast_adv_timeout = CONFIG_CAF_BLE_ADV_FAST_ADV_TIMEOUT;
+}
+
+static void fast_adv_timed_out(void)
+{
+	if (!IS_ENABLED(CONFIG_CAF_BLE_ADV_FAST_ADV_ADAPTIVE)) {
+		return;
+	}
+
+	/* Fast advertising ended without a connection. Shorten the next
+	 * fast advertising period to cut the average current until peers
+	 * start connecting again.
+	 */
+	fast_adv_timeout = MAX(fast_adv_timeout / 2,
+			       CONFIG_CAF_BLE_ADV_FAST_ADV_TIMEOUT_MIN);
+	LOG_INF("Fast advertising timeout reduced to %u s", fast_adv_timeout);
+}
 
 static int settings_set(const char *key, size_t len_rd, settings_read_cb read_cb, void *cb_arg)
 {
@@ -297,7 +331,7 @@ static int ble_adv_start(bool can_fast_adv)
 	} else {
 		if (fast_adv) {
 			k_work_reschedule(&adv_update,
-					  K_SECONDS(CONFIG_CAF_BLE_ADV_FAST_ADV_TIMEOUT));
+					  K_SECONDS(fast_adv_timeout));
 			state = STATE_ACTIVE_FAST;
 		} else {
 			state = STATE_ACTIVE_SLOW;
@@ -362,6 +396,9 @@ static void ble_adv_update_fn(struct k_work *work)
 		break;
 
 	case STATE_ACTIVE_FAST:
+		fast_adv_timed_out();
+		break;
+
 	case STATE_DELAYED_ACTIVE_SLOW:
 		break;
 
@@ -507,6 +544,10 @@ static bool handle_ble_peer_event(const struct ble_peer_event *event)
 
 	switch (event->state) {
 	case PEER_STATE_CONNECTED:
+		if ((state == STATE_ACTIVE_FAST) ||
+		    (state == STATE_ACTIVE_FAST_DIRECT)) {
+			fast_adv_connected();
+		}
 		err = ble_adv_stop();
 		break;
 
@@ -162,6 +162,32 @@ static int callback_ctrl(bool enable)
 	return err;
 }
 
+/* Arm level interrupts matching the settled button state, so that the next
+ * interrupt fires on any state change - release of a pressed button or
+ * press of a released one. Used only for directly connected buttons.
+ */
+static int callback_ctrl_state(uint32_t settled)
+{
+	int err = 0;
+
+	for (size_t i = 0; (i < ARRAY_SIZE(row)) && !err; i++) {
+		bool is_pressed = settled & BIT(i);
+		gpio_flags_t flag_irq;
+
+		if (IS_ENABLED(CONFIG_CAF_BUTTONS_POLARITY_INVERSED)) {
+			flag_irq = is_pressed ? GPIO_INT_LEVEL_HIGH : GPIO_INT_LEVEL_LOW;
+		} else {
+			flag_irq = is_pressed ? GPIO_INT_LEVEL_LOW : GPIO_INT_LEVEL_HIGH;
+		}
+
+		err = gpio_pin_interrupt_configure(gpio_devs[row[i].port],
+						   row[i].pin,
+						   flag_irq);
+	}
+
+	return err;
+}
+
 static int suspend(void)
 {
 	int err = -EBUSY;
@@ -305,8 +331,21 @@ static void scan_fn(struct k_work *work)
 	}
 
 	if (any_pressed) {
-		/* Schedule next scan */
-		k_work_reschedule(&matrix_scan, K_MSEC(SCAN_INTERVAL));
+		if (IS_ENABLED(CONFIG_CAF_BUTTONS_INTERRUPT_DRIVEN) &&
+		    (ARRAY_SIZE(col) == 0) &&
+		    (state == STATE_SCANNING)) {
+			/* Directly connected buttons - instead of polling,
+			 * wait for an interrupt on any button state change.
+			 */
+			state = STATE_ACTIVE;
+			if (callback_ctrl_state(settled_state[0])) {
+				LOG_ERR("Cannot enable callbacks");
+				goto error;
+			}
+		} else {
+			/* Schedule next scan */
+			k_work_reschedule(&matrix_scan, K_MSEC(SCAN_INTERVAL));
+		}
 	} else {
 		/* If no button is pressed module can switch to callbacks */
 
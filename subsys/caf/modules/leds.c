@@ -106,6 +106,22 @@ static void set_off(struct led *led)
 	set_color(led, &nocolor);
 }
 
+static bool steady_color_reached(const struct led *led,
+				 const struct led_effect_step *effect_step)
+{
+	if (!led->effect->loop_forever || (led->effect->step_count != 1)) {
+		return false;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(led->color.c); i++) {
+		if (led->color.c[i] != effect_step->color.c[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 static void work_handler(struct k_work *work)
 {
 	struct led *led = CONTAINER_OF(work, struct led, work);
@@ -142,6 +158,13 @@ static void work_handler(struct k_work *work)
 		}
 	}
 
+	if (steady_color_reached(led, effect_step)) {
+		/* The LED driver holds the color in hardware. Skip further
+		 * periodic updates until a new effect arrives.
+		 */
+		return;
+	}
+
 	if (led->effect_step < led->effect->step_count) {
 		int32_t next_delay =
 			led->effect->steps[led->effect_step].substep_time;
@@ -28,6 +28,8 @@ struct sensor_data {
 	int sampling_period;
 	int64_t sample_timeout;
 	float *prev;
+	float *batch;
+	uint8_t batch_fill;
 	atomic_t state;
 	unsigned int sleep_cnt;
 	atomic_t event_cnt;
@@ -226,7 +228,23 @@ static void sample_sensor(struct sensor_data *sd, const struct sensor_config *sc
 		LOG_ERR("Sensor sampling error (err %d)", err);
 		update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
 	} else {
-		if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
+		if (sc->sample_batch_cnt > 1) {
+			/* Accumulate the whole burst and send it as one event. */
+			memcpy(&sd->batch[sd->batch_fill * data_cnt], curr, sizeof(curr));
+			sd->batch_fill++;
+
+			if (sd->batch_fill >= sc->sample_batch_cnt) {
+				if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
+					send_sensor_event(sc->event_descr, sd->batch,
+							  sc->sample_batch_cnt * data_cnt,
+							  &sd->event_cnt);
+				} else {
+					LOG_WRN("Did not send event due to too many active events on sensor: %s",
+						sc->dev_name);
+				}
+				sd->batch_fill = 0;
+			}
+		} else if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
 			send_sensor_event(sc->event_descr, curr, ARRAY_SIZE(curr),
 					  &sd->event_cnt);
 		} else {
@@ -322,6 +340,19 @@ static int sensor_init(void)
 		sd->sampling_period = sc->sampling_period_ms;
 		sd->sample_timeout = cur_uptime + sc->sampling_period_ms;
 
+		if (sc->sample_batch_cnt > 1) {
+			size_t data_cnt = get_sensor_data_cnt(sc);
+
+			sd->batch = k_malloc(sc->sample_batch_cnt * data_cnt * sizeof(float));
+			if (!sd->batch) {
+				LOG_ERR("Failed to allocate memory");
+				__ASSERT_NO_MSG(false);
+				update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+				err = -ENOMEM;
+				break;
+			}
+		}
+
 		if (sc->trigger) {
 			err = sensor_trigger_init(sc, sd);
 			if (err) {
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <debug/boot_trace.h>
+#include <zephyr.h>
+#include <init.h>
+#include <shell/shell.h>
+#include <string.h>
+
+/* Magic word marking a ring as containing valid entries. */
+#define BOOT_TRACE_MAGIC 0x42547263 /* "BTrc" */
+
+struct boot_trace_ring {
+	uint32_t magic;
+	uint32_t cnt;
+	struct boot_trace_entry entries[CONFIG_BOOT_TRACE_ENTRIES];
+};
+
+/* Kept in noinit RAM so that the previous boot can be inspected after a
+ * reset. On power-up the content is garbage, which the magic word filters
+ * out.
+ */
+static __noinit struct boot_trace_ring cur;
+static __noinit struct boot_trace_ring prev;
+
+void boot_trace_mark(const char *name)
+{
+	unsigned int key = irq_lock();
+
+	if ((cur.magic == BOOT_TRACE_MAGIC) &&
+	    (cur.cnt < ARRAY_SIZE(cur.entries))) {
+		cur.entries[cur.cnt].name = name;
+		cur.entries[cur.cnt].cycles = k_cycle_get_32();
+		cur.cnt++;
+	}
+
+	irq_unlock(key);
+}
+
+static size_t ring_get(const struct boot_trace_ring *ring,
+		       struct boot_trace_entry *buf, size_t cnt)
+{
+	size_t copied;
+
+	if ((ring->magic != BOOT_TRACE_MAGIC) ||
+	    (ring->cnt > ARRAY_SIZE(ring->entries))) {
+		return 0;
+	}
+
+	copied = MIN(cnt, ring->cnt);
+	memcpy(buf, ring->entries, copied * sizeof(*buf));
+
+	return copied;
+}
+
+size_t boot_trace_get(struct boot_trace_entry *buf, size_t cnt)
+{
+	return ring_get(&cur, buf, cnt);
+}
+
+size_t boot_trace_previous_get(struct boot_trace_entry *buf, size_t cnt)
+{
+	return ring_get(&prev, buf, cnt);
+}
+
+static int boot_trace_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	/* Preserve the trace of the previous boot before starting a new
+	 * one. After a power cycle the magic does not match and the
+	 * previous-boot ring is marked empty.
+	 */
+	if ((cur.magic == BOOT_TRACE_MAGIC) &&
+	    (cur.cnt <= ARRAY_SIZE(cur.entries))) {
+		prev = cur;
+	} else {
+		prev.magic = 0;
+		prev.cnt = 0;
+	}
+
+	cur.magic = BOOT_TRACE_MAGIC;
+	cur.cnt = 0;
+
+	boot_trace_mark("boot");
+
+	return 0;
+}
+
+SYS_INIT(boot_trace_init, PRE_KERNEL_1, 0);
+
+#ifdef CONFIG_BOOT_TRACE_CMDS
+static void ring_print(const struct shell *shell,
+		       const struct boot_trace_entry *entries, size_t cnt)
+{
+	uint32_t cps = sys_clock_hw_cycles_per_sec();
+
+	for (size_t i = 0; i < cnt; i++) {
+		uint64_t us = ((uint64_t)entries[i].cycles * USEC_PER_SEC) /
+			      cps;
+		uint64_t delta_us = (i > 0) ?
+			((uint64_t)(entries[i].cycles -
+				    entries[i - 1].cycles) * USEC_PER_SEC) /
+			cps : 0;
+
+		shell_print(shell, "%10lld us (+%lld us): %s",
+			    us, delta_us, entries[i].name);
+	}
+}
+
+static int cmd_boot_trace_dump(const struct shell *shell,
+			       size_t argc, char **argv)
+{
+	struct boot_trace_entry buf[CONFIG_BOOT_TRACE_ENTRIES];
+	size_t cnt;
+
+	cnt = boot_trace_get(buf, ARRAY_SIZE(buf));
+	ring_print(shell, buf, cnt);
+
+	return 0;
+}
+
+static int cmd_boot_trace_prev(const struct shell *shell,
+			       size_t argc, char **argv)
+{
+	struct boot_trace_entry buf[CONFIG_BOOT_TRACE_ENTRIES];
+	size_t cnt;
+
+	cnt = boot_trace_previous_get(buf, ARRAY_SIZE(buf));
+	if (cnt == 0) {
+		shell_print(shell, "No previous-boot trace.");
+		return 0;
+	}
+
+	ring_print(shell, buf, cnt);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_cmd_boot_trace,
+	SHELL_CMD_ARG(dump, NULL, "Dump markers of the current boot",
+			cmd_boot_trace_dump, 1, 0),
+	SHELL_CMD_ARG(prev, NULL, "Dump markers of the previous boot",
+			cmd_boot_trace_prev, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_COND_CMD_ARG_REGISTER(CONFIG_BOOT_TRACE_CMDS, boot_trace,
+			&sub_cmd_boot_trace, "Boot trace",
+			cmd_boot_trace_dump, 1, 1);
+#endif /* CONFIG_BOOT_TRACE_CMDS */
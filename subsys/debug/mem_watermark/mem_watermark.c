@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <debug/mem_watermark.h>
+#include <shell/shell.h>
+#include <logging/log.h>
+
+LOG_MODULE_REGISTER(mem_watermark, CONFIG_MEM_WATERMARK_LOG_LEVEL);
+
+static struct mem_watermark_sample history[CONFIG_MEM_WATERMARK_HISTORY_LEN];
+static size_t history_head;
+static size_t history_cnt;
+
+static struct k_work_delayable sample_work;
+static mem_watermark_heap_sampler_t heap_sampler;
+static mem_watermark_export_t export_hook;
+static uint32_t heap_min_free = UINT32_MAX;
+static bool ready;
+
+static void stack_check(const struct k_thread *thread, void *user_data)
+{
+	struct mem_watermark_sample *sample = user_data;
+	size_t unused;
+	int err;
+
+	err = k_thread_stack_space_get(thread, &unused);
+	if (err) {
+		return;
+	}
+
+	if (unused < sample->stack_min_unused) {
+		sample->stack_min_unused = unused;
+		sample->stack_min_thread = (k_tid_t)thread;
+	}
+}
+
+static void sample_take(struct mem_watermark_sample *sample)
+{
+	sample->uptime = k_uptime_get();
+	sample->heap_free = 0;
+	sample->stack_min_unused = UINT32_MAX;
+	sample->stack_min_thread = NULL;
+
+	if (heap_sampler) {
+		heap_sampler(&sample->heap_free);
+		heap_min_free = MIN(heap_min_free, sample->heap_free);
+	}
+
+	sample->heap_min_free = (heap_min_free == UINT32_MAX) ?
+				0 : heap_min_free;
+
+	k_thread_foreach(stack_check, sample);
+}
+
+static void sample_record(const struct mem_watermark_sample *sample)
+{
+	history[history_head] = *sample;
+	history_head = (history_head + 1) % ARRAY_SIZE(history);
+	history_cnt = MIN(history_cnt + 1, ARRAY_SIZE(history));
+}
+
+static void sample_work_handler(struct k_work *work)
+{
+	struct mem_watermark_sample sample;
+
+	ARG_UNUSED(work);
+
+	sample_take(&sample);
+	sample_record(&sample);
+
+	if (export_hook) {
+		export_hook(&sample);
+	}
+
+	k_work_reschedule(&sample_work,
+			  K_MSEC(CONFIG_MEM_WATERMARK_SAMPLE_INTERVAL));
+}
+
+int mem_watermark_init(void)
+{
+	if (ready) {
+		return -EALREADY;
+	}
+
+	k_work_init_delayable(&sample_work, sample_work_handler);
+	k_work_reschedule(&sample_work,
+			  K_MSEC(CONFIG_MEM_WATERMARK_SAMPLE_INTERVAL));
+	ready = true;
+
+	return 0;
+}
+
+void mem_watermark_heap_sampler_set(mem_watermark_heap_sampler_t sampler)
+{
+	heap_sampler = sampler;
+}
+
+void mem_watermark_export_hook_set(mem_watermark_export_t hook)
+{
+	export_hook = hook;
+}
+
+void mem_watermark_sample_now(struct mem_watermark_sample *sample)
+{
+	struct mem_watermark_sample local;
+
+	sample_take(&local);
+	sample_record(&local);
+
+	if (sample) {
+		*sample = local;
+	}
+}
+
+size_t mem_watermark_history_get(struct mem_watermark_sample *buf, size_t cnt)
+{
+	size_t copied = MIN(cnt, history_cnt);
+
+	for (size_t i = 0; i < copied; i++) {
+		size_t idx = (history_head + ARRAY_SIZE(history) - 1 - i) %
+			     ARRAY_SIZE(history);
+
+		buf[i] = history[idx];
+	}
+
+	return copied;
+}
+
+#ifdef CONFIG_MEM_WATERMARK_CMDS
+static void sample_print(const struct shell *shell,
+			 const struct mem_watermark_sample *sample)
+{
+	const char *name = sample->stack_min_thread ?
+		k_thread_name_get(sample->stack_min_thread) : NULL;
+
+	shell_print(shell,
+		    "%8lld ms: heap free:%u min:%u, tightest stack:%u B (%s)",
+		    sample->uptime, sample->heap_free, sample->heap_min_free,
+		    sample->stack_min_unused, name ? name : "unknown");
+}
+
+static int cmd_mem_watermark_now(const struct shell *shell,
+				 size_t argc, char **argv)
+{
+	struct mem_watermark_sample sample;
+
+	mem_watermark_sample_now(&sample);
+	sample_print(shell, &sample);
+
+	return 0;
+}
+
+static int cmd_mem_watermark_history(const struct shell *shell,
+				     size_t argc, char **argv)
+{
+	struct mem_watermark_sample buf[CONFIG_MEM_WATERMARK_HISTORY_LEN];
+	size_t cnt;
+
+	cnt = mem_watermark_history_get(buf, ARRAY_SIZE(buf));
+	if (cnt == 0) {
+		shell_print(shell, "No samples recorded.");
+		return 0;
+	}
+
+	for (size_t i = 0; i < cnt; i++) {
+		sample_print(shell, &buf[i]);
+	}
+
+	return 0;
+}
+
+static void stack_print(const struct k_thread *thread, void *user_data)
+{
+	const struct shell *shell = user_data;
+	const char *name = k_thread_name_get((k_tid_t)thread);
+	size_t unused;
+	int err;
+
+	err = k_thread_stack_space_get(thread, &unused);
+	if (err) {
+		return;
+	}
+
+	shell_print(shell, "%-20s size:%4zu unused:%4zu",
+		    name ? name : "unknown",
+		    (size_t)thread->stack_info.size, unused);
+}
+
+static int cmd_mem_watermark_stacks(const struct shell *shell,
+				    size_t argc, char **argv)
+{
+	k_thread_foreach(stack_print, (void *)shell);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_cmd_mem_watermark,
+	SHELL_CMD_ARG(now, NULL, "Take and print a sample",
+			cmd_mem_watermark_now, 1, 0),
+	SHELL_CMD_ARG(history, NULL, "Print recorded samples, newest first",
+			cmd_mem_watermark_history, 1, 0),
+	SHELL_CMD_ARG(stacks, NULL, "Print per-thread stack usage",
+			cmd_mem_watermark_stacks, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_COND_CMD_ARG_REGISTER(CONFIG_MEM_WATERMARK_CMDS, mem_watermark,
+			&sub_cmd_mem_watermark, "Memory watermarks",
+			cmd_mem_watermark_now, 1, 1);
+#endif /* CONFIG_MEM_WATERMARK_CMDS */
@@ -28,6 +28,14 @@ DEF_DFU_TARGET(mcuboot);
 #include "dfu/dfu_target_full_modem.h"
 DEF_DFU_TARGET(full_modem);
 #endif
+#ifdef CONFIG_DFU_TARGET_LZSS
+#include "dfu/dfu_target_lzss.h"
+DEF_DFU_TARGET(lzss);
+#endif
+#ifdef CONFIG_DFU_TARGET_PATCH
+#include "dfu/dfu_target_patch.h"
+DEF_DFU_TARGET(patch);
+#endif
 
 #define MIN_SIZE_IDENTIFY_BUF 32
 
@@ -54,6 +62,16 @@ int dfu_target_img_type(const void *const buf, size_t len)
 	if (dfu_target_full_modem_identify(buf)) {
 		return DFU_TARGET_IMAGE_TYPE_FULL_MODEM;
 	}
+#endif
+#ifdef CONFIG_DFU_TARGET_LZSS
+	if (dfu_target_lzss_identify(buf)) {
+		return DFU_TARGET_IMAGE_TYPE_LZSS;
+	}
+#endif
+#ifdef CONFIG_DFU_TARGET_PATCH
+	if (dfu_target_patch_identify(buf)) {
+		return DFU_TARGET_IMAGE_TYPE_PATCH;
+	}
 #endif
 	LOG_ERR("No supported image type found");
 	return -ENOTSUP;
@@ -77,6 +95,16 @@ int dfu_target_init(int img_type, size_t file_size, dfu_target_callback_t cb)
 	if (img_type == DFU_TARGET_IMAGE_TYPE_FULL_MODEM) {
 		new_target = &dfu_target_full_modem;
 	}
+#endif
+#ifdef CONFIG_DFU_TARGET_LZSS
+	if (img_type == DFU_TARGET_IMAGE_TYPE_LZSS) {
+		new_target = &dfu_target_lzss;
+	}
+#endif
+#ifdef CONFIG_DFU_TARGET_PATCH
+	if (img_type == DFU_TARGET_IMAGE_TYPE_PATCH) {
+		new_target = &dfu_target_patch;
+	}
 #endif
 	if (new_target == NULL) {
 		LOG_ERR("Unknown image type");
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr.h>
+#include <logging/log.h>
+#include <sys/byteorder.h>
+#include <dfu/dfu_target.h>
+#include <dfu/dfu_target_mcuboot.h>
+#include <dfu/dfu_target_lzss.h>
+
+LOG_MODULE_REGISTER(dfu_target_lzss, CONFIG_DFU_TARGET_LOG_LEVEL);
+
+#define LZSS_HEADER_MAGIC 0x4c5a5331
+#define LZSS_HEADER_SIZE 12
+
+#define WINDOW_BITS CONFIG_DFU_TARGET_LZSS_WINDOW_BITS
+#define LOOKAHEAD_BITS CONFIG_DFU_TARGET_LZSS_LOOKAHEAD_BITS
+#define WINDOW_SIZE (1 << WINDOW_BITS)
+#define WINDOW_MASK (WINDOW_SIZE - 1)
+
+/* Back-references encode the length with an offset of MIN_MATCH. */
+#define MIN_MATCH 2
+
+/* Worst case bits needed for one token: flag + distance + length. */
+#define BACKREF_TOKEN_BITS (1 + WINDOW_BITS + LOOKAHEAD_BITS)
+#define LITERAL_TOKEN_BITS (1 + 8)
+
+struct lzss_ctx {
+	/* Sliding window holding the last WINDOW_SIZE produced bytes. */
+	uint8_t window[WINDOW_SIZE];
+	/* MSB-first bit accumulator for the input stream. */
+	uint32_t bitbuf;
+	uint32_t bitcnt;
+	/* Decompressed bytes produced and expected in total. */
+	size_t produced;
+	size_t expected;
+	/* Compressed bytes consumed, including the header. */
+	size_t consumed;
+	/* Number of header bytes received so far. */
+	size_t header_len;
+	uint8_t header[LZSS_HEADER_SIZE];
+	/* Output staging towards the MCUBoot target. */
+	uint8_t outbuf[CONFIG_DFU_TARGET_LZSS_OUT_BUF_SIZE];
+	size_t outlen;
+};
+
+static struct lzss_ctx ctx;
+
+static int flush_out(void)
+{
+	int err;
+
+	if (ctx.outlen == 0) {
+		return 0;
+	}
+
+	err = dfu_target_mcuboot_write(ctx.outbuf, ctx.outlen);
+	if (err != 0) {
+		return err;
+	}
+
+	ctx.outlen = 0;
+
+	return 0;
+}
+
+static int emit(uint8_t byte)
+{
+	ctx.window[ctx.produced & WINDOW_MASK] = byte;
+	ctx.produced++;
+
+	ctx.outbuf[ctx.outlen++] = byte;
+	if (ctx.outlen == sizeof(ctx.outbuf)) {
+		return flush_out();
+	}
+
+	return 0;
+}
+
+static uint32_t take_bits(uint32_t count)
+{
+	uint32_t val;
+
+	val = (ctx.bitbuf >> (ctx.bitcnt - count)) & ((1 << count) - 1);
+	ctx.bitcnt -= count;
+
+	return val;
+}
+
+static int parse_header(void)
+{
+	uint32_t magic = sys_get_le32(&ctx.header[0]);
+
+	if (magic != LZSS_HEADER_MAGIC) {
+		LOG_ERR("Invalid LZSS header magic");
+		return -EINVAL;
+	}
+
+	ctx.expected = sys_get_le32(&ctx.header[4]);
+
+	if (ctx.header[8] != WINDOW_BITS || ctx.header[9] != LOOKAHEAD_BITS) {
+		LOG_ERR("Compressor used %d/%d bit window/look-ahead, "
+			"device is configured for %d/%d",
+			ctx.header[8], ctx.header[9],
+			WINDOW_BITS, LOOKAHEAD_BITS);
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Decode as many tokens as the accumulated bits and the given input
+ *	  allow, refilling the bit accumulator from the input as needed.
+ */
+static int decode(const uint8_t *in, size_t len)
+{
+	int err;
+
+	while (ctx.produced < ctx.expected) {
+		while (ctx.bitcnt <= 24 && len > 0) {
+			ctx.bitbuf = (ctx.bitbuf << 8) | *in++;
+			ctx.bitcnt += 8;
+			len--;
+		}
+
+		if (ctx.bitcnt < 1) {
+			break;
+		}
+
+		/* Peek at the flag bit to see how many bits the token
+		 * needs; if the rest has not arrived yet, wait for the
+		 * next fragment.
+		 */
+		if (ctx.bitbuf & BIT(ctx.bitcnt - 1)) {
+			if (ctx.bitcnt < LITERAL_TOKEN_BITS && len == 0) {
+				break;
+			}
+
+			(void)take_bits(1);
+			err = emit(take_bits(8));
+			if (err != 0) {
+				return err;
+			}
+		} else {
+			uint32_t distance;
+			uint32_t length;
+
+			if (ctx.bitcnt < BACKREF_TOKEN_BITS && len == 0) {
+				break;
+			}
+
+			(void)take_bits(1);
+			distance = take_bits(WINDOW_BITS) + 1;
+			length = take_bits(LOOKAHEAD_BITS) + MIN_MATCH;
+
+			if (distance > ctx.produced) {
+				LOG_ERR("Invalid back-reference in stream");
+				return -EINVAL;
+			}
+
+			for (uint32_t i = 0; i < length; i++) {
+				uint8_t byte = ctx.window[(ctx.produced -
+							   distance) &
+							  WINDOW_MASK];
+
+				err = emit(byte);
+				if (err != 0) {
+					return err;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+bool dfu_target_lzss_identify(const void *const buf)
+{
+	return sys_get_le32(buf) == LZSS_HEADER_MAGIC;
+}
+
+int dfu_target_lzss_init(size_t file_size, dfu_target_callback_t cb)
+{
+	memset(&ctx, 0, sizeof(ctx));
+
+	/* Only the compressed size is known at this point. The
+	 * decompressed size from the header is bounds checked by the
+	 * stream flash instance of the MCUBoot target.
+	 */
+	return dfu_target_mcuboot_init(file_size, cb);
+}
+
+int dfu_target_lzss_offset_get(size_t *out)
+{
+	*out = ctx.consumed;
+
+	return 0;
+}
+
+int dfu_target_lzss_write(const void *const buf, size_t len)
+{
+	const uint8_t *data = buf;
+	int err;
+
+	ctx.consumed += len;
+
+	if (ctx.header_len < LZSS_HEADER_SIZE) {
+		size_t copy = MIN(len, LZSS_HEADER_SIZE - ctx.header_len);
+
+		memcpy(&ctx.header[ctx.header_len], data, copy);
+		ctx.header_len += copy;
+		data += copy;
+		len -= copy;
+
+		if (ctx.header_len < LZSS_HEADER_SIZE) {
+			return 0;
+		}
+
+		err = parse_header();
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	return decode(data, len);
+}
+
+int dfu_target_lzss_done(bool successful)
+{
+	int err;
+
+	if (successful) {
+		if (ctx.produced != ctx.expected) {
+			LOG_ERR("Decompressed %u of %u bytes",
+				(unsigned int)ctx.produced,
+				(unsigned int)ctx.expected);
+			(void)dfu_target_mcuboot_done(false);
+			return -EINVAL;
+		}
+
+		err = flush_out();
+		if (err != 0) {
+			LOG_ERR("Unable to flush decompressed data: %d", err);
+			(void)dfu_target_mcuboot_done(false);
+			return err;
+		}
+	}
+
+	return dfu_target_mcuboot_done(successful);
+}
@@ -36,6 +36,93 @@ LOG_MODULE_REGISTER(dfu_target_mcuboot, CONFIG_DFU_TARGET_LOG_LEVEL);
 static uint8_t *stream_buf;
 static size_t stream_buf_len;
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_WRITE_PIPELINE
+
+#define PIPELINE_BUF_SIZE CONFIG_DFU_TARGET_MCUBOOT_WRITE_PIPELINE_BUF_SIZE
+
+struct pipeline_buf {
+	uint8_t data[PIPELINE_BUF_SIZE];
+	size_t len;
+	struct k_work work;
+	struct k_sem free;
+};
+
+static struct pipeline_buf pipeline_bufs[2];
+static struct k_work_q pipeline_work_q;
+static K_THREAD_STACK_DEFINE(pipeline_stack,
+			     CONFIG_DFU_TARGET_MCUBOOT_WRITE_PIPELINE_STACK_SIZE);
+static int pipeline_err;
+static bool pipeline_started;
+
+static void pipeline_flush(struct k_work *work)
+{
+	struct pipeline_buf *pbuf = CONTAINER_OF(work, struct pipeline_buf,
+						 work);
+	int err = dfu_target_stream_write(pbuf->data, pbuf->len);
+
+	if (err != 0 && pipeline_err == 0) {
+		pipeline_err = err;
+	}
+
+	k_sem_give(&pbuf->free);
+}
+
+static void pipeline_init(void)
+{
+	if (!pipeline_started) {
+		k_work_queue_start(&pipeline_work_q, pipeline_stack,
+				   K_THREAD_STACK_SIZEOF(pipeline_stack),
+				   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+		for (size_t i = 0; i < ARRAY_SIZE(pipeline_bufs); i++) {
+			k_work_init(&pipeline_bufs[i].work, pipeline_flush);
+			k_sem_init(&pipeline_bufs[i].free, 1, 1);
+		}
+		pipeline_started = true;
+	}
+
+	pipeline_err = 0;
+}
+
+/* Wait until both staging buffers have been flushed to flash. */
+static int pipeline_drain(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(pipeline_bufs); i++) {
+		k_sem_take(&pipeline_bufs[i].free, K_FOREVER);
+		k_sem_give(&pipeline_bufs[i].free);
+	}
+
+	return pipeline_err;
+}
+
+static int pipeline_write(const uint8_t *buf, size_t len)
+{
+	static size_t next;
+
+	while (len > 0) {
+		struct pipeline_buf *pbuf = &pipeline_bufs[next];
+		size_t chunk = MIN(len, sizeof(pbuf->data));
+
+		k_sem_take(&pbuf->free, K_FOREVER);
+
+		if (pipeline_err != 0) {
+			k_sem_give(&pbuf->free);
+			return pipeline_err;
+		}
+
+		memcpy(pbuf->data, buf, chunk);
+		pbuf->len = chunk;
+		k_work_submit_to_queue(&pipeline_work_q, &pbuf->work);
+
+		next = (next + 1) % ARRAY_SIZE(pipeline_bufs);
+		buf += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_DFU_TARGET_MCUBOOT_WRITE_PIPELINE */
+
 int dfu_ctx_mcuboot_set_b1_file(const char *file, bool s0_active,
 				const char **update)
 {
@@ -145,6 +232,10 @@ int dfu_target_mcuboot_init(size_t file_size, dfu_target_callback_t cb)
 		return err;
 	}
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_WRITE_PIPELINE
+	pipeline_init();
+#endif
+
 	return 0;
 }
 
@@ -155,13 +246,26 @@ int dfu_target_mcuboot_offset_get(size_t *out)
 
 int dfu_target_mcuboot_write(const void *const buf, size_t len)
 {
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_WRITE_PIPELINE
+	return pipeline_write(buf, len);
+#else
 	return dfu_target_stream_write(buf, len);
+#endif
 }
 
 int dfu_target_mcuboot_done(bool successful)
 {
 	int err = 0;
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_WRITE_PIPELINE
+	err = pipeline_drain();
+	if (err != 0) {
+		LOG_ERR("Pipelined write error %d", err);
+		dfu_target_stream_done(false);
+		return err;
+	}
+#endif
+
 	err = dfu_target_stream_done(successful);
 	if (err != 0) {
 		LOG_ERR("dfu_target_stream_done error %d", err);
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr.h>
+#include <pm_config.h>
+#include <logging/log.h>
+#include <device.h>
+#include <drivers/flash.h>
+#include <sys/byteorder.h>
+#include <sys/crc.h>
+#include <dfu/dfu_target.h>
+#include <dfu/dfu_target_mcuboot.h>
+#include <dfu/dfu_target_patch.h>
+
+LOG_MODULE_REGISTER(dfu_target_patch, CONFIG_DFU_TARGET_LOG_LEVEL);
+
+#define PATCH_HEADER_MAGIC 0x4e504431
+#define PATCH_HEADER_SIZE 16
+
+#define CMD_COPY BIT(7)
+
+/* Control byte plus two 32 bit varints of up to 5 bytes each. */
+#define CMD_MAX_SIZE (1 + 2 * 5)
+
+struct patch_ctx {
+	/* Patch bytes consumed, including the header. */
+	size_t consumed;
+	/* Output bytes produced and expected in total. */
+	size_t produced;
+	size_t expected;
+	/* Number of header bytes received so far. */
+	size_t header_len;
+	uint8_t header[PATCH_HEADER_SIZE];
+	/* Accumulated command bytes while a command header is incomplete. */
+	uint8_t cmd[CMD_MAX_SIZE];
+	size_t cmd_len;
+	/* Literal bytes still owed by the current add command. */
+	size_t add_remaining;
+	/* Device holding the running image. */
+	const struct device *src_dev;
+	/* Staging buffer for source reads and CRC verification. */
+	uint8_t chunk[CONFIG_DFU_TARGET_PATCH_CHUNK_SIZE];
+};
+
+static struct patch_ctx ctx;
+
+/**
+ * @brief Decode a varint from data, at most len bytes.
+ *
+ * @return Number of bytes consumed, or 0 if the varint is incomplete.
+ */
+static size_t varint_decode(const uint8_t *data, size_t len, uint32_t *out)
+{
+	uint32_t val = 0;
+
+	for (size_t i = 0; i < len && i < 5; i++) {
+		val |= (uint32_t)(data[i] & 0x7f) << (7 * i);
+		if ((data[i] & 0x80) == 0) {
+			*out = val;
+			return i + 1;
+		}
+	}
+
+	return 0;
+}
+
+static int source_verify(uint32_t size, uint32_t crc)
+{
+	uint32_t calculated = 0;
+	size_t offset = 0;
+	int err;
+
+	if (size > PM_MCUBOOT_PRIMARY_SIZE) {
+		LOG_ERR("Source image larger than primary slot");
+		return -EINVAL;
+	}
+
+	while (offset < size) {
+		size_t read = MIN(size - offset, sizeof(ctx.chunk));
+
+		err = flash_read(ctx.src_dev,
+				 PM_MCUBOOT_PRIMARY_ADDRESS + offset,
+				 ctx.chunk, read);
+		if (err != 0) {
+			return err;
+		}
+
+		calculated = crc32_ieee_update(calculated, ctx.chunk, read);
+		offset += read;
+	}
+
+	if (calculated != crc) {
+		LOG_ERR("Patch does not match the running image "
+			"(CRC 0x%08x, expected 0x%08x)", calculated, crc);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int parse_header(void)
+{
+	uint32_t magic = sys_get_le32(&ctx.header[0]);
+
+	if (magic != PATCH_HEADER_MAGIC) {
+		LOG_ERR("Invalid patch header magic");
+		return -EINVAL;
+	}
+
+	ctx.expected = sys_get_le32(&ctx.header[4]);
+
+	return source_verify(sys_get_le32(&ctx.header[8]),
+			     sys_get_le32(&ctx.header[12]));
+}
+
+static int copy_exec(uint32_t src_offset, uint32_t length)
+{
+	int err;
+
+	if (src_offset + length < src_offset ||
+	    src_offset + length > PM_MCUBOOT_PRIMARY_SIZE) {
+		LOG_ERR("Copy command outside the source image");
+		return -EINVAL;
+	}
+
+	while (length > 0) {
+		size_t read = MIN(length, sizeof(ctx.chunk));
+
+		err = flash_read(ctx.src_dev,
+				 PM_MCUBOOT_PRIMARY_ADDRESS + src_offset,
+				 ctx.chunk, read);
+		if (err != 0) {
+			return err;
+		}
+
+		err = dfu_target_mcuboot_write(ctx.chunk, read);
+		if (err != 0) {
+			return err;
+		}
+
+		src_offset += read;
+		length -= read;
+		ctx.produced += read;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Try to decode and execute one command from the accumulated bytes.
+ *
+ * @return Number of command bytes consumed, 0 if the command is still
+ *	   incomplete, or a negative error code.
+ */
+static int cmd_exec(void)
+{
+	uint32_t length;
+	uint32_t src_offset;
+	size_t used = 1;
+	size_t ret;
+	int err;
+
+	if ((ctx.cmd[0] & ~CMD_COPY) != 0) {
+		LOG_ERR("Invalid command byte in stream");
+		return -EINVAL;
+	}
+
+	ret = varint_decode(&ctx.cmd[used], ctx.cmd_len - used, &length);
+	if (ret == 0) {
+		return 0;
+	}
+	used += ret;
+
+	if (ctx.cmd[0] & CMD_COPY) {
+		ret = varint_decode(&ctx.cmd[used], ctx.cmd_len - used,
+				    &src_offset);
+		if (ret == 0) {
+			return 0;
+		}
+		used += ret;
+
+		err = copy_exec(src_offset, length);
+		if (err != 0) {
+			return err;
+		}
+	} else {
+		ctx.add_remaining = length;
+	}
+
+	return used;
+}
+
+static int decode(const uint8_t *in, size_t len)
+{
+	int used;
+	int err;
+
+	while (len > 0 && ctx.produced < ctx.expected) {
+		if (ctx.add_remaining > 0) {
+			size_t copy = MIN(len, ctx.add_remaining);
+
+			err = dfu_target_mcuboot_write(in, copy);
+			if (err != 0) {
+				return err;
+			}
+
+			ctx.add_remaining -= copy;
+			ctx.produced += copy;
+			in += copy;
+			len -= copy;
+			continue;
+		}
+
+		while (ctx.cmd_len < sizeof(ctx.cmd) && len > 0) {
+			ctx.cmd[ctx.cmd_len++] = *in++;
+			len--;
+
+			used = cmd_exec();
+			if (used < 0) {
+				return used;
+			}
+
+			if (used > 0) {
+				if ((size_t)used != ctx.cmd_len) {
+					LOG_ERR("Trailing command bytes "
+						"in stream");
+					return -EINVAL;
+				}
+				ctx.cmd_len = 0;
+				break;
+			}
+		}
+
+		if (ctx.cmd_len == sizeof(ctx.cmd)) {
+			LOG_ERR("Oversized command in stream");
+			return -EINVAL;
+		}
+	}
+
+	if (len > 0 && ctx.produced >= ctx.expected) {
+		LOG_ERR("Patch data past the end of the output image");
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+bool dfu_target_patch_identify(const void *const buf)
+{
+	return sys_get_le32(buf) == PATCH_HEADER_MAGIC;
+}
+
+int dfu_target_patch_init(size_t file_size, dfu_target_callback_t cb)
+{
+	memset(&ctx, 0, sizeof(ctx));
+
+	ctx.src_dev = device_get_binding(PM_MCUBOOT_PRIMARY_DEV_NAME);
+	if (ctx.src_dev == NULL) {
+		LOG_ERR("Failed to get device '%s'",
+			PM_MCUBOOT_PRIMARY_DEV_NAME);
+		return -EFAULT;
+	}
+
+	/* Only the patch size is known at this point. The patched image
+	 * size from the header is bounds checked by the stream flash
+	 * instance of the MCUBoot target.
+	 */
+	return dfu_target_mcuboot_init(file_size, cb);
+}
+
+int dfu_target_patch_offset_get(size_t *out)
+{
+	*out = ctx.consumed;
+
+	return 0;
+}
+
+int dfu_target_patch_write(const void *const buf, size_t len)
+{
+	const uint8_t *data = buf;
+	int err;
+
+	ctx.consumed += len;
+
+	if (ctx.header_len < PATCH_HEADER_SIZE) {
+		size_t copy = MIN(len, PATCH_HEADER_SIZE - ctx.header_len);
+
+		memcpy(&ctx.header[ctx.header_len], data, copy);
+		ctx.header_len += copy;
+		data += copy;
+		len -= copy;
+
+		if (ctx.header_len < PATCH_HEADER_SIZE) {
+			return 0;
+		}
+
+		err = parse_header();
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	return decode(data, len);
+}
+
+int dfu_target_patch_done(bool successful)
+{
+	if (successful && ctx.produced != ctx.expected) {
+		LOG_ERR("Produced %u of %u bytes",
+			(unsigned int)ctx.produced,
+			(unsigned int)ctx.expected);
+		(void)dfu_target_mcuboot_done(false);
+		return -EINVAL;
+	}
+
+	return dfu_target_mcuboot_done(successful);
+}
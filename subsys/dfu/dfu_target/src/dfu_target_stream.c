@@ -14,6 +14,10 @@
 #define MODULE "dfu"
 #define DFU_STREAM_OFFSET "stream/offset"
 #include <settings/settings.h>
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_VERIFY
+#include <drivers/flash.h>
+#include <sys/crc.h>
+#endif
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
 LOG_MODULE_REGISTER(dfu_target_stream, CONFIG_DFU_TARGET_LOG_LEVEL);
@@ -25,6 +29,114 @@ static const char *current_id;
 
 static char current_name_key[32];
 
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_VERIFY
+
+#define VERIFY_BLOCK_SIZE CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_VERIFY_BLOCK_SIZE
+
+static char current_crc_key[36];
+static uint32_t block_crcs[CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_VERIFY_MAX_BLOCKS];
+static size_t block_count;
+static size_t stored_block_count;
+static uint32_t block_crc;
+static size_t block_fill;
+
+/**
+ * @brief Update the block CRC index with data that is about to be written.
+ *
+ * Data passes through here in write order, so the index always covers a
+ * contiguous prefix of the image. Blocks beyond the index capacity are
+ * written but not indexed, and will be re-downloaded on resume.
+ */
+static void block_index_update(const uint8_t *buf, size_t len)
+{
+	while (len > 0) {
+		size_t chunk = MIN(len, VERIFY_BLOCK_SIZE - block_fill);
+
+		block_crc = crc32_ieee_update(block_crc, buf, chunk);
+		block_fill += chunk;
+		buf += chunk;
+		len -= chunk;
+
+		if (block_fill == VERIFY_BLOCK_SIZE) {
+			if (block_count < ARRAY_SIZE(block_crcs)) {
+				block_crcs[block_count++] = block_crc;
+			}
+			block_crc = 0;
+			block_fill = 0;
+		}
+	}
+}
+
+/**
+ * @brief Read back the flash contents covered by the restored index and
+ *        truncate the resume offset to the last contiguous valid block.
+ */
+static int verify_progress(void)
+{
+	size_t blocks = MIN(stored_block_count,
+			    stream.bytes_written / VERIFY_BLOCK_SIZE);
+	size_t valid = 0;
+
+	for (size_t i = 0; i < blocks; i++) {
+		off_t addr = stream.offset + i * VERIFY_BLOCK_SIZE;
+		size_t left = VERIFY_BLOCK_SIZE;
+		uint32_t crc = 0;
+		int err;
+
+		while (left > 0) {
+			size_t chunk = MIN(left, stream.buf_len);
+
+			err = flash_read(stream.fdev, addr, stream.buf, chunk);
+			if (err != 0) {
+				LOG_ERR("flash_read error %d", err);
+				return err;
+			}
+
+			crc = crc32_ieee_update(crc, stream.buf, chunk);
+			addr += chunk;
+			left -= chunk;
+		}
+
+		if (crc != block_crcs[i]) {
+			LOG_WRN("Block %u CRC mismatch, truncating progress",
+				(unsigned int)i);
+			break;
+		}
+
+		valid++;
+	}
+
+	if (valid * VERIFY_BLOCK_SIZE < stream.bytes_written) {
+		struct flash_pages_info page;
+		int err;
+
+		stream.bytes_written = valid * VERIFY_BLOCK_SIZE;
+
+		err = flash_get_page_info_by_offs(stream.fdev,
+						  stream.offset +
+						  stream.bytes_written,
+						  &page);
+		if (err != 0) {
+			LOG_ERR("Error %d while getting page info", err);
+			return err;
+		}
+
+		stream.last_erased_page_start_offset = page.start_offset;
+	}
+
+	block_count = valid;
+	stored_block_count = valid;
+	block_crc = 0;
+	block_fill = 0;
+
+	LOG_INF("Resuming with %u of %u blocks verified",
+		(unsigned int)valid, (unsigned int)blocks);
+
+	return 0;
+}
+
+#endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_VERIFY */
+
 /**
  * @brief Store the information stored in the stream_flash instance so that it
  *        can be restored from flash in case of a power failure, reboot etc.
@@ -42,6 +154,19 @@ static int store_progress(void)
 		return err;
 	}
 
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_VERIFY
+	if (block_count != stored_block_count) {
+		err = settings_save_one(current_crc_key, block_crcs,
+					block_count * sizeof(block_crcs[0]));
+		if (err) {
+			LOG_ERR("Problem storing CRC index (err %d)", err);
+			return err;
+		}
+
+		stored_block_count = block_count;
+	}
+#endif
+
 	return 0;
 }
 
@@ -81,6 +206,20 @@ static int settings_set(const char *key, size_t len_rd,
 		stream.last_erased_page_start_offset = page.start_offset;
 	}
 
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_VERIFY
+	if (strncmp(key, current_id, strlen(current_id)) == 0 &&
+	    strcmp(key + strlen(current_id), "/crc") == 0) {
+		ssize_t len = read_cb(cb_arg, block_crcs, sizeof(block_crcs));
+
+		if (len < 0 || len % sizeof(block_crcs[0]) != 0) {
+			LOG_ERR("Can't read CRC index from storage");
+			return len < 0 ? len : -EINVAL;
+		}
+
+		stored_block_count = len / sizeof(block_crcs[0]);
+	}
+#endif
+
 	return 0;
 }
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
@@ -120,6 +259,20 @@ int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 		return -EFAULT;
 	}
 
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_VERIFY
+	err = snprintf(current_crc_key, sizeof(current_crc_key), "%s/crc",
+		       current_name_key);
+	if (err < 0 || err >= sizeof(current_crc_key)) {
+		LOG_ERR("Unable to generate current_crc_key");
+		return -EFAULT;
+	}
+
+	block_count = 0;
+	stored_block_count = 0;
+	block_crc = 0;
+	block_fill = 0;
+#endif
+
 	static struct settings_handler sh = {
 		.name = MODULE,
 		.h_set = settings_set,
@@ -143,6 +296,14 @@ int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 		LOG_ERR("settings_load failed (err %d)", err);
 		return err;
 	}
+
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_VERIFY
+	err = verify_progress();
+	if (err) {
+		LOG_ERR("verify_progress failed (err %d)", err);
+		return err;
+	}
+#endif
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
 	return 0;
@@ -157,7 +318,13 @@ int dfu_target_stream_offset_get(size_t *out)
 
 int dfu_target_stream_write(const uint8_t *buf, size_t len)
 {
-	int err = stream_flash_buffered_write(&stream, buf, len, false);
+	int err;
+
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_VERIFY
+	block_index_update(buf, len);
+#endif
+
+	err = stream_flash_buffered_write(&stream, buf, len, false);
 
 	if (err != 0) {
 		LOG_ERR("stream_flash_buffered_write error %d", err);
@@ -195,6 +362,13 @@ int dfu_target_stream_done(bool successful)
 			LOG_ERR("setting_delete error %d", err);
 		}
 
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS_VERIFY
+		err = settings_delete(current_crc_key);
+		if (err != 0) {
+			LOG_ERR("setting_delete error %d", err);
+		}
+#endif
+
 	} else {
 		/* The stream has not completed, store the progress so that
 		 * a new call to 'init' will pick up where we left off.
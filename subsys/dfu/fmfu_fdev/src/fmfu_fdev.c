@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <zephyr.h>
 #include <modem_update_decode.h>
 #include <drivers/flash.h>
 #include <logging/log.h>
@@ -79,6 +80,44 @@ static int write_chunk(uint8_t *buf, size_t buf_len, uint32_t address,
 	return 0;
 }
 
+#ifdef CONFIG_FMFU_FDEV_PIPELINE
+
+static struct {
+	uint8_t *buf;
+	size_t len;
+	uint32_t addr;
+	bool is_bootloader;
+	int err;
+	struct k_work work;
+	struct k_sem done;
+} pipeline;
+
+static struct k_work_q pipeline_work_q;
+static K_THREAD_STACK_DEFINE(pipeline_stack,
+			     CONFIG_FMFU_FDEV_PIPELINE_STACK_SIZE);
+static bool pipeline_started;
+
+static void pipeline_write(struct k_work *work)
+{
+	pipeline.err = write_chunk(pipeline.buf, pipeline.len, pipeline.addr,
+				   pipeline.is_bootloader);
+	k_sem_give(&pipeline.done);
+}
+
+static void pipeline_start(void)
+{
+	if (!pipeline_started) {
+		k_work_queue_start(&pipeline_work_q, pipeline_stack,
+				   K_THREAD_STACK_SIZEOF(pipeline_stack),
+				   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+		k_work_init(&pipeline.work, pipeline_write);
+		k_sem_init(&pipeline.done, 0, 1);
+		pipeline_started = true;
+	}
+}
+
+#endif /* CONFIG_FMFU_FDEV_PIPELINE */
+
 static int load_segment(const struct device *fdev, size_t seg_size,
 			uint32_t seg_target_addr, uint32_t seg_offset,
 			uint8_t *buf, size_t buf_len, bool is_bootloader)
@@ -87,6 +126,61 @@ static int load_segment(const struct device *fdev, size_t seg_size,
 	uint32_t read_addr = seg_offset;
 	size_t bytes_left = seg_size;
 
+#ifdef CONFIG_FMFU_FDEV_PIPELINE
+	/* Read into one half of the buffer while the other half is being
+	 * written to the modem, so the flash read of chunk N+1 overlaps
+	 * the modem transfer of chunk N.
+	 */
+	size_t half_len = buf_len / 2;
+	uint8_t *half[2] = { buf, buf + half_len };
+	bool pending = false;
+	int idx = 0;
+
+	pipeline_start();
+
+	while (bytes_left) {
+		uint32_t read_len = MIN(half_len, bytes_left);
+
+		err = flash_read(fdev, read_addr, half[idx], read_len);
+
+		if (pending) {
+			k_sem_take(&pipeline.done, K_FOREVER);
+			pending = false;
+			if (pipeline.err != 0) {
+				LOG_ERR("write_chunk failed: %d", pipeline.err);
+				return pipeline.err;
+			}
+		}
+
+		if (err != 0) {
+			LOG_ERR("flash_read failed: %d", err);
+			return err;
+		}
+
+		pipeline.buf = half[idx];
+		pipeline.len = read_len;
+		pipeline.addr = seg_target_addr;
+		pipeline.is_bootloader = is_bootloader;
+		k_work_submit_to_queue(&pipeline_work_q, &pipeline.work);
+		pending = true;
+
+		LOG_DBG("Read chunk: offset 0x%x target addr 0x%x size 0x%x",
+			read_addr, seg_target_addr, read_len);
+
+		seg_target_addr += read_len;
+		bytes_left -= read_len;
+		read_addr += read_len;
+		idx ^= 1;
+	}
+
+	if (pending) {
+		k_sem_take(&pipeline.done, K_FOREVER);
+		if (pipeline.err != 0) {
+			LOG_ERR("write_chunk failed: %d", pipeline.err);
+			return pipeline.err;
+		}
+	}
+#else
 	while (bytes_left) {
 		uint32_t read_len = MIN(buf_len, bytes_left);
 
@@ -110,6 +204,7 @@ static int load_segment(const struct device *fdev, size_t seg_size,
 		bytes_left -= read_len;
 		read_addr += read_len;
 	}
+#endif /* CONFIG_FMFU_FDEV_PIPELINE */
 
 	if (is_bootloader) {
 		/* We need to explicitly call _apply() once all chunks of the
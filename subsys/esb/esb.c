@@ -179,6 +179,216 @@ static struct payload_rx_fifo rx_fifo;
 static uint8_t tx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH + 2];
 static uint8_t rx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH + 2];
 
+#ifdef CONFIG_ESB_ZERO_COPY_TX
+/* Caller-owned frame buffers queued by reference, indexed by TX FIFO slot.
+ * NULL for slots holding regular (copied) payloads.
+ */
+static struct esb_zero_copy_buf *zc_bufs[CONFIG_ESB_TX_FIFO_SIZE];
+#endif
+
+static void zc_buf_complete(uint32_t slot, bool success)
+{
+#ifdef CONFIG_ESB_ZERO_COPY_TX
+	struct esb_zero_copy_buf *buf = zc_bufs[slot];
+
+	if (buf) {
+		zc_bufs[slot] = NULL;
+		if (buf->sent) {
+			buf->sent(buf, success);
+		}
+	}
+#endif
+}
+
+#ifdef CONFIG_ESB_TX_BURST
+/* When set, TX start is triggered by the system timer compare event over
+ * (D)PPI instead of by software.
+ */
+static volatile bool burst_active;
+#endif
+
+#ifdef CONFIG_ESB_PIPE_STATS
+/* Per-pipe link statistics */
+static struct esb_pipe_stats pipe_stats[CONFIG_ESB_PIPE_COUNT];
+
+#ifdef CONFIG_ESB_TX_ARBITRATION
+/* Number of consecutive failed transactions per pipe */
+static uint8_t pipe_fail_streak[CONFIG_ESB_PIPE_COUNT];
+#endif
+
+/* Estimate the on-air duration of one frame, in microseconds. */
+static uint32_t frame_airtime_us(uint32_t payload_length)
+{
+	/* Preamble, address, payload and CRC, plus the 9 packet header bits
+	 * used in DPL mode.
+	 */
+	uint32_t bits = 8 * (1 + esb_addr.addr_length + payload_length +
+			     esb_cfg.crc);
+
+	if (esb_cfg.protocol == ESB_PROTOCOL_ESB_DPL) {
+		bits += 9;
+	}
+
+	switch (esb_cfg.bitrate) {
+	case ESB_BITRATE_2MBPS:
+#if defined(CONFIG_SOC_SERIES_NRF52X) || defined(CONFIG_SOC_NRF5340_CPUNET)
+	case ESB_BITRATE_2MBPS_BLE:
+#endif
+		return bits / 2;
+#if !(defined(CONFIG_SOC_NRF52840) || defined(CONFIG_SOC_NRF52810) ||          \
+      defined(CONFIG_SOC_NRF52811) || defined(CONFIG_SOC_NRF5340_CPUNET))
+	case ESB_BITRATE_250KBPS:
+		return bits * 4;
+#endif
+	default:
+		return bits;
+	}
+}
+#endif /* CONFIG_ESB_PIPE_STATS */
+
+static void stats_on_tx(uint32_t pipe, uint32_t payload_length, bool retransmit)
+{
+#ifdef CONFIG_ESB_PIPE_STATS
+	pipe_stats[pipe].tx_attempts++;
+	if (retransmit) {
+		pipe_stats[pipe].retransmits++;
+	}
+	pipe_stats[pipe].airtime_us += frame_airtime_us(payload_length);
+#endif
+}
+
+static void stats_on_tx_done(uint32_t pipe, bool success)
+{
+#ifdef CONFIG_ESB_PIPE_STATS
+	if (success) {
+		pipe_stats[pipe].tx_success++;
+	} else {
+		pipe_stats[pipe].tx_failed++;
+	}
+#ifdef CONFIG_ESB_TX_ARBITRATION
+	if (success) {
+		pipe_fail_streak[pipe] = 0;
+	} else if (pipe_fail_streak[pipe] < UINT8_MAX) {
+		pipe_fail_streak[pipe]++;
+	}
+#endif
+#endif
+}
+
+static void stats_on_rx(uint32_t pipe, uint32_t payload_length)
+{
+#ifdef CONFIG_ESB_PIPE_STATS
+	pipe_stats[pipe].rx_received++;
+	pipe_stats[pipe].airtime_us += frame_airtime_us(payload_length);
+#endif
+}
+
+static void stats_on_rssi(uint32_t pipe, uint8_t rssi)
+{
+#ifdef CONFIG_ESB_PIPE_STATS
+	pipe_stats[pipe].rssi_sum += rssi;
+	pipe_stats[pipe].rssi_samples++;
+#endif
+}
+
+/* Number of retransmissions to attempt for the next payload on a pipe. */
+static uint32_t tx_retransmit_budget(uint32_t pipe)
+{
+#ifdef CONFIG_ESB_TX_ARBITRATION
+	if (pipe_fail_streak[pipe] >=
+		    CONFIG_ESB_TX_ARBITRATION_FAIL_THRESHOLD &&
+	    esb_cfg.retransmit_count >
+		    CONFIG_ESB_TX_ARBITRATION_RETRANSMIT_LIMIT) {
+		return CONFIG_ESB_TX_ARBITRATION_RETRANSMIT_LIMIT;
+	}
+#endif
+	return esb_cfg.retransmit_count;
+}
+
+#ifdef CONFIG_ESB_CHANNEL_HOP
+/* Adaptive hop table state. Entries with a non-zero skips count are
+ * blacklisted and passed over in the rotation until the count expires.
+ */
+struct hop_channel {
+	uint8_t channel;  /* RF channel number. */
+	uint8_t attempts; /* Attempts in the current error rate window. */
+	uint8_t fails;	  /* Failed attempts in the current window. */
+	uint8_t skips;	  /* Remaining rotations to pass this channel over. */
+};
+
+static struct hop_channel hop_table[CONFIG_ESB_CHANNEL_HOP_TABLE_SIZE];
+static uint8_t hop_count;
+static uint8_t hop_current;
+#endif
+
+/* Account the outcome of a transmission attempt on the current channel,
+ * blacklisting it when its error rate window closes above the threshold.
+ */
+static void hop_mark(bool success)
+{
+#ifdef CONFIG_ESB_CHANNEL_HOP
+	struct hop_channel *ch = &hop_table[hop_current];
+
+	if (hop_count == 0) {
+		return;
+	}
+
+	ch->attempts++;
+	if (!success) {
+		ch->fails++;
+	}
+
+	if (ch->attempts >= CONFIG_ESB_CHANNEL_HOP_PER_WINDOW) {
+		if ((ch->fails * 100) >=
+		    (ch->attempts * CONFIG_ESB_CHANNEL_HOP_BLACKLIST_PCT)) {
+			ch->skips = CONFIG_ESB_CHANNEL_HOP_BLACKLIST_SKIPS;
+		}
+		ch->attempts = 0;
+		ch->fails = 0;
+	}
+#endif
+}
+
+/* Advance to the next channel in the hop table that is not blacklisted. */
+static void hop_advance(void)
+{
+#ifdef CONFIG_ESB_CHANNEL_HOP
+	if (hop_count == 0) {
+		return;
+	}
+
+	for (int i = 0; i < hop_count; i++) {
+		hop_current = (hop_current + 1) % hop_count;
+		if (hop_table[hop_current].skips == 0) {
+			return;
+		}
+		hop_table[hop_current].skips--;
+	}
+	/* All channels are blacklisted; stay on the resulting channel. */
+#endif
+}
+
+/* Frequency to use for the next transmission. */
+static uint32_t tx_frequency(void)
+{
+#ifdef CONFIG_ESB_CHANNEL_HOP
+	if (hop_count > 0) {
+		return hop_table[hop_current].channel;
+	}
+#endif
+	return esb_addr.rf_channel;
+}
+
+static uint8_t *tx_current_packet(void)
+{
+#ifdef CONFIG_ESB_ZERO_COPY_TX
+	if (zc_bufs[tx_fifo.front]) {
+		return zc_bufs[tx_fifo.front]->frame;
+	}
+#endif
+	return tx_payload_buffer;
+}
+
 /* Random access buffer variables for ACK payload handling */
 struct payload_wrap ack_pl_wrap[CONFIG_ESB_TX_FIFO_SIZE];
 struct payload_wrap *ack_pl_wrap_pipe[CONFIG_ESB_PIPE_COUNT];
@@ -188,6 +398,7 @@ static uint8_t pids[CONFIG_ESB_PIPE_COUNT];
 static struct pipe_info rx_pipe_info[CONFIG_ESB_PIPE_COUNT];
 static volatile uint32_t interrupt_flags;
 static volatile uint32_t retransmits_remaining;
+static volatile uint32_t retransmit_budget;
 static volatile uint32_t last_tx_attempts;
 static volatile uint32_t wait_for_ack_timeout_us;
 
@@ -487,6 +698,8 @@ static void tx_fifo_remove_last(void)
 		return;
 	}
 
+	zc_buf_complete(tx_fifo.front, true);
+
 	uint32_t key = irq_lock();
 
 	tx_fifo.count--;
@@ -535,6 +748,11 @@ static bool rx_fifo_push_rfbuf(uint8_t pipe, uint8_t pid)
 	rx_fifo.payload[rx_fifo.back]->pid = pid;
 	rx_fifo.payload[rx_fifo.back]->noack = !(rx_payload_buffer[1] & 0x01);
 
+	stats_on_rx(pipe, rx_fifo.payload[rx_fifo.back]->length);
+	if (esb_cfg.mode != ESB_MODE_PTX) {
+		stats_on_rssi(pipe, rx_fifo.payload[rx_fifo.back]->rssi);
+	}
+
 	if (++rx_fifo.back >= CONFIG_ESB_RX_FIFO_SIZE) {
 		rx_fifo.back = 0;
 	}
@@ -589,19 +807,24 @@ static void ppi_init(void)
 
 static void start_tx_transaction(void)
 {
+	uint8_t *packet = tx_current_packet();
 	bool ack;
 
 	last_tx_attempts = 1;
 	/* Prepare the payload */
 	current_payload = tx_fifo.payload[tx_fifo.front];
 
+	stats_on_tx(current_payload->pipe, current_payload->length, false);
+
 	switch (esb_cfg.protocol) {
 	case ESB_PROTOCOL_ESB:
 		update_rf_payload_format(current_payload->length);
-		tx_payload_buffer[0] = current_payload->pid;
-		tx_payload_buffer[1] = 0;
-		memcpy(&tx_payload_buffer[2], current_payload->data,
-		       current_payload->length);
+		packet[0] = current_payload->pid;
+		packet[1] = 0;
+		if (packet == tx_payload_buffer) {
+			memcpy(&packet[2], current_payload->data,
+			       current_payload->length);
+		}
 
 		NRF_RADIO->SHORTS = radio_shorts_common |
 				    RADIO_SHORTS_DISABLED_RXEN_Msk;
@@ -609,18 +832,21 @@ static void start_tx_transaction(void)
 				      RADIO_INTENSET_READY_Msk;
 
 		/* Configure the retransmit counter */
-		retransmits_remaining = esb_cfg.retransmit_count;
+		retransmit_budget = tx_retransmit_budget(current_payload->pipe);
+		retransmits_remaining = retransmit_budget;
 		on_radio_disabled = on_radio_disabled_tx;
 		esb_state = ESB_STATE_PTX_TX_ACK;
 		break;
 
 	case ESB_PROTOCOL_ESB_DPL:
 		ack = !current_payload->noack || !esb_cfg.selective_auto_ack;
-		tx_payload_buffer[0] = current_payload->length;
-		tx_payload_buffer[1] = current_payload->pid << 1;
-		tx_payload_buffer[1] |= current_payload->noack ? 0x00 : 0x01;
-		memcpy(&tx_payload_buffer[2], current_payload->data,
-		       current_payload->length);
+		packet[0] = current_payload->length;
+		packet[1] = current_payload->pid << 1;
+		packet[1] |= current_payload->noack ? 0x00 : 0x01;
+		if (packet == tx_payload_buffer) {
+			memcpy(&packet[2], current_payload->data,
+			       current_payload->length);
+		}
 
 		/* Handling ack if noack is set to false or if
 		 * selective auto ack is turned off
@@ -650,9 +876,9 @@ static void start_tx_transaction(void)
 
 	NRF_RADIO->TXADDRESS = current_payload->pipe;
 	NRF_RADIO->RXADDRESSES = 1 << current_payload->pipe;
-	NRF_RADIO->FREQUENCY = esb_addr.rf_channel;
+	NRF_RADIO->FREQUENCY = tx_frequency();
 
-	NRF_RADIO->PACKETPTR = (uint32_t)tx_payload_buffer;
+	NRF_RADIO->PACKETPTR = (uint32_t)packet;
 
 	NVIC_ClearPendingIRQ(RADIO_IRQn);
 	irq_enable(RADIO_IRQn);
@@ -661,15 +887,44 @@ static void start_tx_transaction(void)
 	NRF_RADIO->EVENTS_PAYLOAD = 0;
 	NRF_RADIO->EVENTS_DISABLED = 0;
 
+#ifdef CONFIG_ESB_TX_BURST
+	/* In burst mode, the system timer compare event starts the radio. */
+	if (burst_active) {
+		return;
+	}
+#endif
+
 	NRF_RADIO->TASKS_TXEN = 1;
 }
 
+#ifdef CONFIG_ESB_TX_BURST
+static void burst_end(void)
+{
+	if (!burst_active) {
+		return;
+	}
+
+	burst_active = false;
+
+	nrfx_gppi_channels_disable(1 << ppi_ch_timer_compare1_radio_txen);
+	ESB_SYS_TIMER->TASKS_SHUTDOWN = 1;
+
+	/* Restore the one-shot retransmission delay behavior: */
+	ESB_SYS_TIMER->SHORTS = TIMER_SHORTS_COMPARE1_CLEAR_Msk |
+				TIMER_SHORTS_COMPARE1_STOP_Msk;
+}
+#endif
+
 static void on_radio_disabled_tx_noack(void)
 {
 	interrupt_flags |= INT_TX_SUCCESS_MSK;
+	stats_on_tx_done(current_payload->pipe, true);
 	tx_fifo_remove_last();
 
 	if (tx_fifo.count == 0) {
+#ifdef CONFIG_ESB_TX_BURST
+		burst_end();
+#endif
 		esb_state = ESB_STATE_IDLE;
 		NVIC_SetPendingIRQ(ESB_EVT_IRQ);
 	} else {
@@ -726,9 +981,13 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 		ESB_SYS_TIMER->TASKS_SHUTDOWN = 1;
 
 		interrupt_flags |= INT_TX_SUCCESS_MSK;
-		last_tx_attempts = esb_cfg.retransmit_count -
+		last_tx_attempts = retransmit_budget -
 				   retransmits_remaining + 1;
 
+		stats_on_tx_done(current_payload->pipe, true);
+		stats_on_rssi(current_payload->pipe, NRF_RADIO->RSSISAMPLE);
+		hop_mark(true);
+
 		tx_fifo_remove_last();
 
 		if (esb_cfg.protocol != ESB_PROTOCOL_ESB &&
@@ -755,8 +1014,11 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 			/* All retransmits are expended, and the TX operation is
 			 * suspended
 			 */
-			last_tx_attempts = esb_cfg.retransmit_count + 1;
+			last_tx_attempts = retransmit_budget + 1;
 			interrupt_flags |= INT_TX_FAILED_MSK;
+			stats_on_tx_done(current_payload->pipe, false);
+			hop_mark(false);
+			hop_advance();
 
 			esb_state = ESB_STATE_IDLE;
 			NVIC_SetPendingIRQ(ESB_EVT_IRQ);
@@ -765,10 +1027,18 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 			 * be entered again as soon as the system timer reaches
 			 * CC[1].
 			 */
+			stats_on_tx(current_payload->pipe,
+				    current_payload->length, true);
+			hop_mark(false);
+			hop_advance();
 			NRF_RADIO->SHORTS = radio_shorts_common |
 					    RADIO_SHORTS_DISABLED_RXEN_Msk;
 			update_rf_payload_format(current_payload->length);
-			NRF_RADIO->PACKETPTR = (uint32_t)tx_payload_buffer;
+			/* The radio is disabled, so retuning is only a
+			 * register write ahead of the next ramp-up.
+			 */
+			NRF_RADIO->FREQUENCY = tx_frequency();
+			NRF_RADIO->PACKETPTR = (uint32_t)tx_current_packet();
 			on_radio_disabled = on_radio_disabled_tx;
 			esb_state = ESB_STATE_PTX_TX_ACK;
 			ESB_SYS_TIMER->TASKS_START = 1;
@@ -1148,6 +1418,9 @@ int esb_write_payload(const struct esb_payload *payload)
 	uint32_t key = irq_lock();
 
 	if (esb_cfg.mode == ESB_MODE_PTX) {
+#ifdef CONFIG_ESB_ZERO_COPY_TX
+		zc_bufs[tx_fifo.back] = NULL;
+#endif
 		memcpy(tx_fifo.payload[tx_fifo.back], payload,
 			sizeof(struct esb_payload));
 
@@ -1195,6 +1468,64 @@ int esb_write_payload(const struct esb_payload *payload)
 	return 0;
 }
 
+#ifdef CONFIG_ESB_ZERO_COPY_TX
+int esb_write_zero_copy_buf(struct esb_zero_copy_buf *buf)
+{
+	if (!esb_initialized) {
+		return -EACCES;
+	}
+	if (buf == NULL || buf->frame == NULL) {
+		return -EINVAL;
+	}
+	if (buf->length == 0 ||
+	    buf->length > CONFIG_ESB_MAX_PAYLOAD_LENGTH ||
+	    (esb_cfg.protocol == ESB_PROTOCOL_ESB &&
+	     buf->length > esb_cfg.payload_length)) {
+		return -EMSGSIZE;
+	}
+	if (tx_fifo.count >= CONFIG_ESB_TX_FIFO_SIZE) {
+		return -ENOMEM;
+	}
+	if (buf->pipe >= CONFIG_ESB_PIPE_COUNT) {
+		return -EINVAL;
+	}
+	if (esb_cfg.mode != ESB_MODE_PTX) {
+		/* ACK payloads are not transmitted from caller buffers. */
+		return -ENOTSUP;
+	}
+
+	uint32_t key = irq_lock();
+
+	/* Only the payload header fields are copied to the FIFO slot; the
+	 * radio transmits the payload directly from the caller's frame.
+	 */
+	struct esb_payload *slot = tx_fifo.payload[tx_fifo.back];
+
+	pids[buf->pipe] = (pids[buf->pipe] + 1) % (PID_MAX + 1);
+	slot->length = buf->length;
+	slot->pipe = buf->pipe;
+	slot->noack = buf->noack;
+	slot->pid = pids[buf->pipe];
+
+	zc_bufs[tx_fifo.back] = buf;
+
+	if (++tx_fifo.back >= CONFIG_ESB_TX_FIFO_SIZE) {
+		tx_fifo.back = 0;
+	}
+
+	tx_fifo.count++;
+
+	irq_unlock(key);
+
+	if (esb_cfg.tx_mode == ESB_TXMODE_AUTO &&
+	    esb_state == ESB_STATE_IDLE) {
+		start_tx_transaction();
+	}
+
+	return 0;
+}
+#endif /* CONFIG_ESB_ZERO_COPY_TX */
+
 int esb_read_rx_payload(struct esb_payload *payload)
 {
 	if (!esb_initialized) {
@@ -1244,6 +1575,78 @@ int esb_start_tx(void)
 	return 0;
 }
 
+#ifdef CONFIG_ESB_TX_BURST
+int esb_start_tx_burst(uint16_t period_us)
+{
+	if (!esb_initialized) {
+		return -EACCES;
+	}
+	if (esb_state != ESB_STATE_IDLE) {
+		return -EBUSY;
+	}
+	if (tx_fifo.count == 0) {
+		return -ENODATA;
+	}
+	if (period_us == 0) {
+		return -EINVAL;
+	}
+	if (esb_cfg.mode != ESB_MODE_PTX ||
+	    esb_cfg.protocol != ESB_PROTOCOL_ESB_DPL ||
+	    !esb_cfg.selective_auto_ack ||
+	    !tx_fifo.payload[tx_fifo.front]->noack) {
+		/* Acknowledged transfers need the system timer for the ACK
+		 * timeout and retransmission delay.
+		 */
+		return -ENOTSUP;
+	}
+
+	ESB_SYS_TIMER->TASKS_SHUTDOWN = 1;
+	ESB_SYS_TIMER->TASKS_CLEAR = 1;
+	/* Periodic: clear on compare, but keep running. */
+	ESB_SYS_TIMER->SHORTS = TIMER_SHORTS_COMPARE1_CLEAR_Msk;
+	ESB_SYS_TIMER->CC[1] = period_us;
+	ESB_SYS_TIMER->EVENTS_COMPARE[1] = 0;
+
+	burst_active = true;
+
+	/* Prepare the first packet. TX start is left to the timer. */
+	start_tx_transaction();
+
+	nrfx_gppi_channels_enable(1 << ppi_ch_timer_compare1_radio_txen);
+	ESB_SYS_TIMER->TASKS_START = 1;
+
+	return 0;
+}
+
+int esb_stop_tx_burst(void)
+{
+	if (!esb_initialized) {
+		return -EACCES;
+	}
+
+	uint32_t key = irq_lock();
+
+	if (!burst_active) {
+		irq_unlock(key);
+		return -EINVAL;
+	}
+
+	burst_end();
+
+	/* If a packet was prepared but its compare event has not fired yet,
+	 * send it by software to keep the state machine moving.
+	 */
+	if (esb_state == ESB_STATE_PTX_TX &&
+	    NRF_RADIO->STATE == RADIO_STATE_STATE_Disabled) {
+		NRF_RADIO->TASKS_TXEN = 1;
+	}
+
+	irq_unlock(key);
+
+	return 0;
+}
+#endif /* CONFIG_ESB_TX_BURST */
+
 int esb_start_rx(void)
 {
 	if (esb_state != ESB_STATE_IDLE) {
@@ -1303,6 +1706,11 @@ int esb_flush_tx(void)
 
 	uint32_t key = irq_lock();
 
+	for (uint32_t i = 0; i < tx_fifo.count; i++) {
+		zc_buf_complete((tx_fifo.front + i) % CONFIG_ESB_TX_FIFO_SIZE,
+				false);
+	}
+
 	tx_fifo.count = 0;
 	tx_fifo.back = 0;
 	tx_fifo.front = 0;
@@ -1323,6 +1731,10 @@ int esb_pop_tx(void)
 
 	uint32_t key = irq_lock();
 
+	zc_buf_complete((tx_fifo.back + CONFIG_ESB_TX_FIFO_SIZE - 1) %
+				CONFIG_ESB_TX_FIFO_SIZE,
+			false);
+
 	if (++tx_fifo.back >= CONFIG_ESB_TX_FIFO_SIZE) {
 		tx_fifo.back = 0;
 	}
@@ -1477,6 +1889,35 @@ int esb_get_rf_channel(uint32_t *channel)
 	return 0;
 }
 
+#ifdef CONFIG_ESB_CHANNEL_HOP
+int esb_set_channel_hop_table(const uint8_t *channels, uint8_t count)
+{
+	if (esb_state != ESB_STATE_IDLE) {
+		return -EBUSY;
+	}
+	if (channels == NULL && count != 0) {
+		return -EINVAL;
+	}
+	if (count > CONFIG_ESB_CHANNEL_HOP_TABLE_SIZE) {
+		return -EINVAL;
+	}
+	for (int i = 0; i < count; i++) {
+		if (channels[i] > 100) {
+			return -EINVAL;
+		}
+	}
+
+	memset(hop_table, 0, sizeof(hop_table));
+	for (int i = 0; i < count; i++) {
+		hop_table[i].channel = channels[i];
+	}
+	hop_count = count;
+	hop_current = 0;
+
+	return 0;
+}
+#endif /* CONFIG_ESB_CHANNEL_HOP */
+
 int esb_set_tx_power(enum esb_tx_power tx_output_power)
 {
 	if (esb_state != ESB_STATE_IDLE) {
@@ -1540,3 +1981,41 @@ int esb_reuse_pid(uint8_t pipe)
 
 	return 0;
 }
+
+#ifdef CONFIG_ESB_PIPE_STATS
+int esb_pipe_stats_get(uint8_t pipe, struct esb_pipe_stats *stats)
+{
+	if (stats == NULL) {
+		return -EINVAL;
+	}
+	if (!(pipe < CONFIG_ESB_PIPE_COUNT)) {
+		return -EINVAL;
+	}
+
+	uint32_t key = irq_lock();
+
+	*stats = pipe_stats[pipe];
+
+	irq_unlock(key);
+
+	return 0;
+}
+
+int esb_pipe_stats_clear(uint8_t pipe)
+{
+	if (!(pipe < CONFIG_ESB_PIPE_COUNT)) {
+		return -EINVAL;
+	}
+
+	uint32_t key = irq_lock();
+
+	memset(&pipe_stats[pipe], 0, sizeof(pipe_stats[pipe]));
+#ifdef CONFIG_ESB_TX_ARBITRATION
+	pipe_fail_streak[pipe] = 0;
+#endif
+
+	irq_unlock(key);
+
+	return 0;
+}
+#endif /* CONFIG_ESB_PIPE_STATS */
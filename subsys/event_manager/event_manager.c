@@ -23,6 +23,81 @@ const struct {} linker_tag __attribute__((__section__("event_manager"))) __used;
 static void event_processor_fn(struct k_work *work);
 
 
+#ifdef CONFIG_EVENT_MANAGER_EVENT_BUF
+struct event_buf *event_buf_alloc(size_t size)
+{
+	struct event_buf *buf = k_malloc(sizeof(*buf) + size);
+
+	if (unlikely(!buf)) {
+		printk("Event Manager OOM error\n");
+		LOG_PANIC();
+		__ASSERT_NO_MSG(false);
+		sys_reboot(SYS_REBOOT_WARM);
+		return NULL;
+	}
+
+	atomic_set(&buf->refcnt, 1);
+	buf->size = size;
+
+	return buf;
+}
+
+struct event_buf *event_buf_get(struct event_buf *buf)
+{
+	__ASSERT_NO_MSG(atomic_get(&buf->refcnt) > 0);
+
+	atomic_inc(&buf->refcnt);
+
+	return buf;
+}
+
+void event_buf_put(struct event_buf *buf)
+{
+	atomic_val_t prev = atomic_dec(&buf->refcnt);
+
+	__ASSERT_NO_MSG(prev > 0);
+
+	if (prev == 1) {
+		k_free(buf);
+	}
+}
+
+static void event_buf_release(struct event_header *eh)
+{
+	if (!eh->type_id->has_buf) {
+		return;
+	}
+
+	/* For event types carrying a payload buffer, the buffer pointer
+	 * directly follows the event header.
+	 */
+	struct event_buf **buf = (struct event_buf **)(eh + 1);
+
+	if (*buf) {
+		event_buf_put(*buf);
+	}
+}
+#else
+static void event_buf_release(struct event_header *eh)
+{
+	ARG_UNUSED(eh);
+}
+#endif /* CONFIG_EVENT_MANAGER_EVENT_BUF */
+
+static void event_free(struct event_header *eh)
+{
+	event_buf_release(eh);
+
+#ifdef CONFIG_EVENT_MANAGER_ALLOC_SLAB
+	void *block = eh;
+
+	k_mem_slab_free(eh->type_id->slab, &block);
+#else
+	k_free(eh);
+#endif
+}
+
+
 #if CONFIG_EVENT_MANAGER_PROFILER_ENABLED
 #define IDS_COUNT CONFIG_EVENT_MANAGER_MAX_EVENT_CNT
 #else
@@ -36,23 +111,46 @@ static uint32_t event_manager_displayed_events;
 #endif
 
 static uint16_t profiler_event_ids[IDS_COUNT];
+#ifdef CONFIG_EVENT_MANAGER_PRIORITY_EVENTS
+#define EVENT_QUEUE_CNT EVENT_PRIO_COUNT
+#else
+#define EVENT_QUEUE_CNT 1
+#endif
+
 static K_WORK_DEFINE(event_processor, event_processor_fn);
-static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
+/* Event queue lanes, one per priority class. Zero-initialized lists
+ * are valid empty slists.
+ */
+static sys_slist_t eventq[EVENT_QUEUE_CNT];
 static struct k_spinlock lock;
 
 
+static size_t event_queue_idx(const struct event_type *et)
+{
+#ifdef CONFIG_EVENT_MANAGER_PRIORITY_EVENTS
+	__ASSERT_NO_MSG(et->priority < EVENT_PRIO_COUNT);
+
+	/* Lane 0 is drained first - map higher priorities to lower lanes. */
+	return EVENT_PRIO_COUNT - 1 - et->priority;
+#else
+	ARG_UNUSED(et);
+
+	return 0;
+#endif
+}
+
+
 static bool log_is_event_displayed(const struct event_type *et)
 {
 	uint32_t event_mask = BIT(et - __start_event_types);
 	return event_manager_displayed_events & event_mask;
 }
 
-static void log_event(const struct event_header *eh)
+static void log_event(const struct event_header *eh, bool displayed)
 {
 	const struct event_type *et = eh->type_id;
 
-	if (!IS_ENABLED(CONFIG_EVENT_MANAGER_SHOW_EVENTS) ||
-	    !log_is_event_displayed(et)) {
+	if (!displayed) {
 		return;
 	}
 
@@ -80,23 +178,20 @@ static void log_event(const struct event_header *eh)
 	}
 }
 
-static void log_event_progress(const struct event_type *et,
-			       const struct event_listener *el)
+static void log_event_progress(const struct event_listener *el, bool displayed)
 {
-	if (!IS_ENABLED(CONFIG_EVENT_MANAGER_SHOW_EVENTS) ||
-	    !IS_ENABLED(CONFIG_EVENT_MANAGER_SHOW_EVENT_HANDLERS) ||
-	    !log_is_event_displayed(et)) {
+	if (!IS_ENABLED(CONFIG_EVENT_MANAGER_SHOW_EVENT_HANDLERS) ||
+	    !displayed) {
 		return;
 	}
 
 	LOG_INF("|\tnotifying %s", el->name);
 }
 
-static void log_event_consumed(const struct event_type *et)
+static void log_event_consumed(bool displayed)
 {
-	if (!IS_ENABLED(CONFIG_EVENT_MANAGER_SHOW_EVENTS) ||
-	    !IS_ENABLED(CONFIG_EVENT_MANAGER_SHOW_EVENT_HANDLERS) ||
-	    !log_is_event_displayed(et)) {
+	if (!IS_ENABLED(CONFIG_EVENT_MANAGER_SHOW_EVENT_HANDLERS) ||
+	    !displayed) {
 		return;
 	}
 
@@ -138,6 +233,27 @@ static void trace_event_execution(const struct event_header *eh, bool is_start)
 	profiler_log_send(&buf, trace_evt_id);
 }
 
+static void trace_event_propagation(const struct event_header *eh)
+{
+	if (!IS_ENABLED(CONFIG_EVENT_MANAGER_TRACE_EVENT_PROPAGATION)) {
+		return;
+	}
+
+	size_t event_cnt = __stop_event_types - __start_event_types;
+	size_t trace_evt_id = profiler_event_ids[event_cnt + 2];
+
+	if (!is_profiling_enabled(trace_evt_id)) {
+		return;
+	}
+
+	struct log_event_buf buf;
+	ARG_UNUSED(buf);
+
+	profiler_log_start(&buf);
+	profiler_log_add_mem_address(&buf, eh);
+	profiler_log_send(&buf, trace_evt_id);
+}
+
 static void trace_event_submission(const struct event_header *eh)
 {
 	if (!IS_ENABLED(CONFIG_EVENT_MANAGER_PROFILER_ENABLED)) {
@@ -190,6 +306,18 @@ static void trace_register_execution_tracking_events(void)
 				"event_processing_end",
 				labels, types, 1);
 	profiler_event_ids[event_cnt + 1] = profiler_event_id;
+
+	if (IS_ENABLED(CONFIG_EVENT_MANAGER_TRACE_EVENT_PROPAGATION)) {
+		/* Event submission event. Together with the processing
+		 * start and end events it allows the host to reconstruct
+		 * the full propagation path of every event instance with
+		 * hardware cycle accuracy.
+		 */
+		profiler_event_id = profiler_register_event_type(
+					"event_submitted",
+					labels, types, 1);
+		profiler_event_ids[event_cnt + 2] = profiler_event_id;
+	}
 }
 
 static void trace_register_events(void)
@@ -228,68 +356,94 @@ static int trace_event_init(void)
 	return 0;
 }
 
-static void event_processor_fn(struct k_work *work)
+static void event_dispatch(struct event_header *eh)
 {
-	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
-
-	/* Make current event list local. */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	ASSERT_EVENT_ID(eh->type_id);
 
-	if (sys_slist_is_empty(&eventq)) {
-		k_spin_unlock(&lock, key);
-		return;
-	}
+	const struct event_type *et = eh->type_id;
 
-	sys_slist_merge_slist(&events, &eventq);
+	trace_event_execution(eh, true);
 
-	k_spin_unlock(&lock, key);
+	/* Resolve the display filter once per event; the per-subscriber
+	 * logging below reuses the result.
+	 */
+	bool displayed = IS_ENABLED(CONFIG_EVENT_MANAGER_SHOW_EVENTS) &&
+			 log_is_event_displayed(et);
 
+	log_event(eh, displayed);
 
-	/* Traverse the list of events. */
-	sys_snode_t *node;
-	while (NULL != (node = sys_slist_get(&events))) {
-		struct event_header *eh = CONTAINER_OF(node,
-						       struct event_header,
-						       node);
+	bool consumed = false;
 
-		ASSERT_EVENT_ID(eh->type_id);
+	for (size_t prio = SUBS_PRIO_MIN;
+	     (prio <= SUBS_PRIO_MAX) && !consumed;
+	     prio++) {
+		for (const struct event_subscriber *es =
+				et->subs_start[prio];
+		     (es != et->subs_stop[prio]) && !consumed;
+		     es++) {
 
-		const struct event_type *et = eh->type_id;
+			__ASSERT_NO_MSG(es != NULL);
 
-		trace_event_execution(eh, true);
+			const struct event_listener *el = es->listener;
 
-		log_event(eh);
+			__ASSERT_NO_MSG(el != NULL);
+			__ASSERT_NO_MSG(el->notification != NULL);
 
-		bool consumed = false;
+			log_event_progress(el, displayed);
 
-		for (size_t prio = SUBS_PRIO_MIN;
-		     (prio <= SUBS_PRIO_MAX) && !consumed;
-		     prio++) {
-			for (const struct event_subscriber *es =
-					et->subs_start[prio];
-			     (es != et->subs_stop[prio]) && !consumed;
-			     es++) {
+			consumed = el->notification(eh);
 
-				__ASSERT_NO_MSG(es != NULL);
+			if (consumed) {
+				log_event_consumed(displayed);
+			}
+		}
+	}
 
-				const struct event_listener *el = es->listener;
+	trace_event_execution(eh, false);
 
-				__ASSERT_NO_MSG(el != NULL);
-				__ASSERT_NO_MSG(el->notification != NULL);
+	event_free(eh);
+}
 
-				log_event_progress(et, el);
+/* Make current event lists local. Lanes are merged in priority order,
+ * so higher priority events are always dispatched first.
+ */
+static bool event_queue_drain(sys_slist_t *events)
+{
+	bool pending = false;
 
-				consumed = el->notification(eh);
+	k_spinlock_key_t key = k_spin_lock(&lock);
 
-				if (consumed) {
-					log_event_consumed(et);
-				}
-			}
+	for (size_t i = 0; i < EVENT_QUEUE_CNT; i++) {
+		if (!sys_slist_is_empty(&eventq[i])) {
+			sys_slist_merge_slist(events, &eventq[i]);
+			pending = true;
 		}
+	}
 
-		trace_event_execution(eh, false);
+	k_spin_unlock(&lock, key);
 
-		k_free(eh);
+	return pending;
+}
+
+static void event_processor_fn(struct k_work *work)
+{
+	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+
+	while (event_queue_drain(&events)) {
+		/* Traverse the list of events. */
+		sys_snode_t *node;
+		while (NULL != (node = sys_slist_get(&events))) {
+			event_dispatch(CONTAINER_OF(node,
+						    struct event_header,
+						    node));
+		}
+
+		/* In batched mode events submitted during dispatching are
+		 * processed within the same wakeup.
+		 */
+		if (!IS_ENABLED(CONFIG_EVENT_MANAGER_BATCH_DISPATCH)) {
+			break;
+		}
 	}
 }
 
@@ -299,12 +453,23 @@ void _event_submit(struct event_header *eh)
 	ASSERT_EVENT_ID(eh->type_id);
 
 	trace_event_submission(eh);
+	trace_event_propagation(eh);
+
+	sys_slist_t *queue = &eventq[event_queue_idx(eh->type_id)];
 
 	k_spinlock_key_t key = k_spin_lock(&lock);
-	sys_slist_append(&eventq, &eh->node);
+
+	bool first = sys_slist_is_empty(queue);
+
+	sys_slist_append(queue, &eh->node);
 	k_spin_unlock(&lock, key);
 
-	k_work_submit(&event_processor);
+	/* In batched mode the processor drains the whole queue on a single
+	 * wakeup. Submitting work again for a non-empty queue is redundant.
+	 */
+	if (!IS_ENABLED(CONFIG_EVENT_MANAGER_BATCH_DISPATCH) || first) {
+		k_work_submit(&event_processor);
+	}
 }
 
 int event_manager_init(void)
@@ -82,6 +82,55 @@ extern "C" {
 #define _EVENT_ID(ename) (&_CONCAT(__event_type_, ename))
 
 
+/* Statically allocated memory slab backend.
+ * A dedicated memory slab is defined for every event type. Slab block size
+ * is derived from the event structure size. Extra space for dynamic event
+ * data is reserved in every block.
+ */
+#ifdef CONFIG_EVENT_MANAGER_ALLOC_SLAB
+
+#define _EVENT_SLAB_NAME(ename) _CONCAT(__event_slab_, ename)
+
+#define _EVENT_SLAB_DECLARE(ename) \
+	extern struct k_mem_slab _EVENT_SLAB_NAME(ename)
+
+#define _EVENT_SLAB_DEFINE(ename)						\
+	K_MEM_SLAB_DEFINE(_EVENT_SLAB_NAME(ename),				\
+			  WB_UP(sizeof(struct ename) +				\
+				CONFIG_EVENT_MANAGER_SLAB_DYNDATA_SIZE),	\
+			  CONFIG_EVENT_MANAGER_SLAB_BLOCK_CNT,			\
+			  sizeof(void *))
+
+#define _EVENT_TYPE_SLAB_INIT(ename) .slab = &_EVENT_SLAB_NAME(ename),
+
+static inline void *_event_slab_alloc(struct k_mem_slab *slab, size_t size)
+{
+	void *block;
+
+	if ((size > slab->block_size) ||
+	    (k_mem_slab_alloc(slab, &block, K_NO_WAIT) != 0)) {
+		return NULL;
+	}
+
+	return block;
+}
+
+#define _EVENT_ALLOC(ename, asize) \
+	_event_slab_alloc(&_EVENT_SLAB_NAME(ename), asize)
+
+#else
+
+#define _EVENT_SLAB_DECLARE(ename) extern const struct {} _CONCAT(__event_no_slab_, ename)
+
+#define _EVENT_SLAB_DEFINE(ename)
+
+#define _EVENT_TYPE_SLAB_INIT(ename)
+
+#define _EVENT_ALLOC(ename, asize) k_malloc(asize)
+
+#endif /* CONFIG_EVENT_MANAGER_ALLOC_SLAB */
+
+
 /* Macro generates a function of name new_ename where ename is provided as
  * an argument. Allocator function is used to create an event of the given
  * ename type.
@@ -89,7 +138,7 @@ extern "C" {
 #define _EVENT_ALLOCATOR_FN(ename)					\
 	static inline struct ename *_CONCAT(new_, ename)(void)		\
 	{								\
-		struct ename *event = (struct ename *)k_malloc(sizeof(*event));\
+		struct ename *event = (struct ename *)_EVENT_ALLOC(ename, sizeof(*event));\
 		BUILD_ASSERT(offsetof(struct ename, header) == 0,	\
 				 "");					\
 		if (unlikely(!event)) {					\
@@ -111,7 +160,7 @@ extern "C" {
 #define _EVENT_ALLOCATOR_DYNDATA_FN(ename)				\
 	static inline struct ename *_CONCAT(new_, ename)(size_t size)	\
 	{								\
-		struct ename *event = (struct ename *)k_malloc(sizeof(*event) + size);\
+		struct ename *event = (struct ename *)_EVENT_ALLOC(ename, sizeof(*event) + size);\
 		BUILD_ASSERT((offsetof(struct ename, dyndata) +		\
 				  sizeof(event->dyndata.size)) ==	\
 				 sizeof(*event), "");			\
@@ -206,6 +255,7 @@ extern "C" {
 
 #define _EVENT_TYPE_DECLARE_COMMON(ename)				\
 	extern const struct event_type _CONCAT(__event_type_, ename);	\
+	_EVENT_SLAB_DECLARE(ename);					\
 	_EVENT_SUBSCRIBERS_DECLARE(ename);				\
 	_EVENT_CASTER_FN(ename);					\
 	_EVENT_TYPECHECK_FN(ename)
@@ -221,11 +271,29 @@ extern "C" {
 	_EVENT_ALLOCATOR_DYNDATA_FN(ename)
 
 
-#define _EVENT_TYPE_DEFINE(ename, init_log_en, log_fn, ev_info_struct)							\
+#ifdef CONFIG_EVENT_MANAGER_PRIORITY_EVENTS
+#define _EVENT_TYPE_PRIO_INIT(prio) .priority = prio,
+#else
+#define _EVENT_TYPE_PRIO_INIT(prio)
+#endif
+
+
+#ifdef CONFIG_EVENT_MANAGER_EVENT_BUF
+#define _EVENT_TYPE_BUF_INIT .has_buf = true,
+#else
+#define _EVENT_TYPE_BUF_INIT
+#endif
+
+
+#define _EVENT_TYPE_DEFINE_COMMON(ename, init_log_en, log_fn, ev_info_struct, prio, buf_init)			\
 	_EVENT_SUBSCRIBERS_DEFINE(ename);										\
+	_EVENT_SLAB_DEFINE(ename);											\
 	const struct event_type _CONCAT(__event_type_, ename) __used							\
 	__attribute__((__section__("event_types"))) = {									\
 		.name				= STRINGIFY(ename),							\
+		_EVENT_TYPE_SLAB_INIT(ename)										\
+		_EVENT_TYPE_PRIO_INIT(prio)										\
+		buf_init												\
 		.subs_start	= {											\
 			[_SUBS_PRIO_FIRST]	= _EVENT_SUBSCRIBERS_START(ename, _SUBS_PRIO_ID(_SUBS_PRIO_FIRST)),	\
 			[_SUBS_PRIO_NORMAL]	= _EVENT_SUBSCRIBERS_START(ename, _SUBS_PRIO_ID(_SUBS_PRIO_NORMAL)),	\
@@ -242,6 +310,15 @@ extern "C" {
 	}
 
 
+#define _EVENT_TYPE_DEFINE(ename, init_log_en, log_fn, ev_info_struct, prio)		\
+	_EVENT_TYPE_DEFINE_COMMON(ename, init_log_en, log_fn, ev_info_struct, prio,)
+
+
+#define _EVENT_TYPE_BUF_DEFINE(ename, init_log_en, log_fn, ev_info_struct)		\
+	_EVENT_TYPE_DEFINE_COMMON(ename, init_log_en, log_fn, ev_info_struct,		\
+				  EVENT_PRIO_NORMAL, _EVENT_TYPE_BUF_INIT)
+
+
 #ifdef __cplusplus
 }
 #endif
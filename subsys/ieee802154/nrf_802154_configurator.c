@@ -10,6 +10,7 @@
 #include <devicetree.h>
 #include <nrf_802154.h>
 #include <nrf_802154_config.h>
+#include <nrf_802154_configurator.h>
 
 LOG_MODULE_REGISTER(nrf_802154_configure);
 
@@ -27,19 +28,37 @@ LOG_MODULE_REGISTER(nrf_802154_configure);
 #define LNA_GAIN 0U
 #endif
 
-static void ccaed_threshold_configure(void)
+void nrf_802154_configurator_cca_threshold_set(uint8_t ed_threshold,
+					       uint8_t corr_threshold)
 {
 	nrf_802154_cca_cfg_t cca_cfg;
 
 	nrf_802154_cca_cfg_get(&cca_cfg);
 
 	/* Overwrite thresholds accounting for RX track gain. */
-	cca_cfg.ed_threshold = NRF_802154_CCA_ED_THRESHOLD_DEFAULT + LNA_GAIN;
-	cca_cfg.corr_threshold = NRF_802154_CCA_CORR_THRESHOLD_DEFAULT + LNA_GAIN;
+	cca_cfg.ed_threshold = ed_threshold + LNA_GAIN;
+	cca_cfg.corr_threshold = corr_threshold + LNA_GAIN;
 
 	nrf_802154_cca_cfg_set(&cca_cfg);
 }
 
+void nrf_802154_configurator_tx_power_set(int8_t power_dbm)
+{
+	nrf_802154_tx_power_set(power_dbm);
+}
+
+void nrf_802154_configurator_auto_pending_bit_set(bool enabled)
+{
+	nrf_802154_auto_pending_bit_set(enabled);
+}
+
+static void ccaed_threshold_configure(void)
+{
+	nrf_802154_configurator_cca_threshold_set(
+		NRF_802154_CCA_ED_THRESHOLD_DEFAULT,
+		NRF_802154_CCA_CORR_THRESHOLD_DEFAULT);
+}
+
 static int nrf_802154_configure(const struct device *dev)
 {
 	ARG_UNUSED(dev);
@@ -16,6 +16,7 @@
 #elif IS_ENABLED(CONFIG_HAS_HW_NRF_DPPIC)
 #include <nrfx_dppi.h>
 #endif
+#include <mpsl/mpsl_fem_gain.h>
 
 #define MPSL_FEM_GPIO_POLARITY_GET(dt_property) \
 	((GPIO_ACTIVE_LOW & \
@@ -145,6 +146,50 @@ static int egu_channel_alloc(uint8_t *egu_channels, size_t size, uint8_t egu_ins
 }
 #endif
 
+#if IS_ENABLED(CONFIG_MPSL_FEM_NRF21540_GPIO) && \
+	DT_NODE_HAS_PROP(DT_NODELABEL(nrf_radio_fem), mode_gpios)
+
+/* State of the MODE pin, cached so that re-selecting the current gain
+ * state performs no GPIO access.
+ */
+static const struct device *mode_gpio_port;
+static gpio_pin_t mode_gpio_pin;
+static enum mpsl_fem_gain_state mode_gain_state;
+
+int mpsl_fem_gain_state_set(enum mpsl_fem_gain_state state)
+{
+	int err;
+
+	if (mode_gpio_port == NULL) {
+		return -ENODEV;
+	}
+
+	if (state == mode_gain_state) {
+		return 0;
+	}
+
+	err = gpio_pin_set(mode_gpio_port, mode_gpio_pin,
+			   (state == MPSL_FEM_GAIN_POUTB) ? 1 : 0);
+	if (err) {
+		return err;
+	}
+
+	mode_gain_state = state;
+
+	return 0;
+}
+
+#else
+
+int mpsl_fem_gain_state_set(enum mpsl_fem_gain_state state)
+{
+	(void)state;
+
+	return -ENODEV;
+}
+
+#endif /* IS_ENABLED(CONFIG_MPSL_FEM_NRF21540_GPIO) && mode_gpios */
+
 #if IS_ENABLED(CONFIG_MPSL_FEM_NRF21540_GPIO)
 static int fem_nrf21540_gpio_configure(void)
 {
@@ -286,6 +331,12 @@ static int fem_nrf21540_gpio_configure(void)
 	if (err) {
 		return err;
 	}
+
+	/* The inactive MODE pin level selects the POUTA gain state. */
+	mode_gpio_port = device_get_binding(
+		DT_GPIO_LABEL(DT_NODELABEL(nrf_radio_fem), mode_gpios));
+	mode_gpio_pin = DT_GPIO_PIN(DT_NODELABEL(nrf_radio_fem), mode_gpios);
+	mode_gain_state = MPSL_FEM_GAIN_POUTA;
 #endif
 
 #if DT_NODE_HAS_PROP(DT_NODELABEL(nrf_radio_fem), ant_sel_gpios)
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <kernel.h>
+#include <string.h>
+#include <logging/log.h>
+#include <mpsl_timeslot.h>
+#include <hal/nrf_timer.h>
+#include <mpsl/mpsl_timeslot_sched.h>
+
+LOG_MODULE_REGISTER(mpsl_timeslot_sched, CONFIG_MPSL_LOG_LEVEL);
+
+BUILD_ASSERT(CONFIG_MPSL_TIMESLOT_SESSION_COUNT > 0,
+	     "The timeslot scheduler requires at least one timeslot session");
+
+/* Time reserved at the end of a timeslot for the end callback and for
+ * winding the radio down.
+ */
+#define SLOT_END_MARGIN_US 100
+
+static struct {
+	struct mpsl_timeslot_sched_config config;
+	struct mpsl_timeslot_sched_stats stats;
+	mpsl_timeslot_session_id_t session_id;
+	mpsl_timeslot_request_t request;
+	uint32_t current_length_us;
+	bool high_prio_request;
+	volatile bool stop_requested;
+	bool active;
+} sched;
+
+static mpsl_timeslot_signal_return_param_t signal_return_param;
+
+static uint8_t request_priority(void)
+{
+	return sched.high_prio_request ? MPSL_TIMESLOT_PRIORITY_HIGH :
+					 MPSL_TIMESLOT_PRIORITY_NORMAL;
+}
+
+static void request_earliest_prepare(void)
+{
+	sched.request.request_type = MPSL_TIMESLOT_REQ_TYPE_EARLIEST;
+	sched.request.params.earliest.hfclk =
+		MPSL_TIMESLOT_HFCLK_CFG_XTAL_GUARANTEED;
+	sched.request.params.earliest.priority = request_priority();
+	sched.request.params.earliest.length_us = sched.config.length_us;
+	sched.request.params.earliest.timeout_us = sched.config.period_us;
+}
+
+static void request_normal_prepare(void)
+{
+	sched.request.request_type = MPSL_TIMESLOT_REQ_TYPE_NORMAL;
+	sched.request.params.normal.hfclk =
+		MPSL_TIMESLOT_HFCLK_CFG_XTAL_GUARANTEED;
+	sched.request.params.normal.priority = request_priority();
+	sched.request.params.normal.distance_us = sched.config.period_us;
+	sched.request.params.normal.length_us = sched.config.length_us;
+}
+
+static void slot_end_timer_set(uint32_t expiry_us)
+{
+	nrf_timer_cc_set(NRF_TIMER0, NRF_TIMER_CC_CHANNEL0,
+			 expiry_us - SLOT_END_MARGIN_US);
+	nrf_timer_int_enable(NRF_TIMER0, NRF_TIMER_INT_COMPARE0_MASK);
+}
+
+static bool extension_possible(void)
+{
+	return (sched.config.extension_us > 0) &&
+	       ((sched.current_length_us + sched.config.extension_us) <=
+		sched.config.max_length_us);
+}
+
+static mpsl_timeslot_signal_return_param_t *timeslot_callback(
+	mpsl_timeslot_session_id_t session_id, uint32_t signal_type)
+{
+	ARG_UNUSED(session_id);
+
+	signal_return_param.callback_action = MPSL_TIMESLOT_SIGNAL_ACTION_NONE;
+
+	switch (signal_type) {
+	case MPSL_TIMESLOT_SIGNAL_START:
+		sched.stats.granted++;
+		/* A granted slot ends the priority escalation. */
+		sched.high_prio_request = false;
+		sched.current_length_us = sched.config.length_us;
+
+		if (sched.config.start_cb) {
+			sched.config.start_cb();
+		}
+
+		slot_end_timer_set(sched.current_length_us);
+
+		if (extension_possible()) {
+			signal_return_param.callback_action =
+				MPSL_TIMESLOT_SIGNAL_ACTION_EXTEND;
+			signal_return_param.params.extend.length_us =
+				sched.config.extension_us;
+		}
+		break;
+
+	case MPSL_TIMESLOT_SIGNAL_EXTEND_SUCCEEDED:
+		sched.stats.extensions_granted++;
+		sched.current_length_us += sched.config.extension_us;
+		slot_end_timer_set(sched.current_length_us);
+
+		/* Keep extending back-to-back up to the configured bound. */
+		if (extension_possible()) {
+			signal_return_param.callback_action =
+				MPSL_TIMESLOT_SIGNAL_ACTION_EXTEND;
+			signal_return_param.params.extend.length_us =
+				sched.config.extension_us;
+		}
+		break;
+
+	case MPSL_TIMESLOT_SIGNAL_EXTEND_FAILED:
+		sched.stats.extensions_denied++;
+		break;
+
+	case MPSL_TIMESLOT_SIGNAL_TIMER0:
+		nrf_timer_int_disable(NRF_TIMER0, NRF_TIMER_INT_COMPARE0_MASK);
+		nrf_timer_event_clear(NRF_TIMER0, NRF_TIMER_EVENT_COMPARE0);
+
+		if (sched.config.end_cb) {
+			sched.config.end_cb();
+		}
+
+		if (sched.stop_requested) {
+			signal_return_param.callback_action =
+				MPSL_TIMESLOT_SIGNAL_ACTION_END;
+		} else {
+			request_normal_prepare();
+			signal_return_param.params.request.p_next =
+				&sched.request;
+			signal_return_param.callback_action =
+				MPSL_TIMESLOT_SIGNAL_ACTION_REQUEST;
+		}
+		break;
+
+	case MPSL_TIMESLOT_SIGNAL_BLOCKED:
+	case MPSL_TIMESLOT_SIGNAL_CANCELLED:
+		sched.stats.denied++;
+
+		if (sched.config.high_prio_fallback) {
+			sched.high_prio_request = true;
+		}
+
+		/* This signal is given in the low-priority signal context,
+		 * in which a new request may be made directly.
+		 */
+		if (!sched.stop_requested) {
+			request_earliest_prepare();
+			(void)mpsl_timeslot_request(sched.session_id,
+						    &sched.request);
+		}
+		break;
+
+	case MPSL_TIMESLOT_SIGNAL_SESSION_IDLE:
+	case MPSL_TIMESLOT_SIGNAL_SESSION_CLOSED:
+		break;
+
+	default:
+		LOG_ERR("Unexpected timeslot signal: %u", signal_type);
+		break;
+	}
+
+	return &signal_return_param;
+}
+
+int mpsl_timeslot_sched_start(const struct mpsl_timeslot_sched_config *config)
+{
+	int err;
+
+	if (config == NULL) {
+		return -EINVAL;
+	}
+
+	if ((config->length_us <= SLOT_END_MARGIN_US) ||
+	    (config->period_us <= MAX(config->length_us,
+				      config->max_length_us))) {
+		return -EINVAL;
+	}
+
+	if ((config->extension_us > 0) &&
+	    (config->max_length_us < (config->length_us +
+				      config->extension_us))) {
+		return -EINVAL;
+	}
+
+	if (sched.active) {
+		return -EALREADY;
+	}
+
+	sched.config = *config;
+	memset(&sched.stats, 0, sizeof(sched.stats));
+	sched.high_prio_request = false;
+	sched.stop_requested = false;
+
+	err = mpsl_timeslot_session_open(timeslot_callback, &sched.session_id);
+	if (err) {
+		LOG_ERR("Timeslot session open failed: %d", err);
+		return err;
+	}
+
+	request_earliest_prepare();
+
+	err = mpsl_timeslot_request(sched.session_id, &sched.request);
+	if (err) {
+		LOG_ERR("Timeslot request failed: %d", err);
+		(void)mpsl_timeslot_session_close(sched.session_id);
+		return err;
+	}
+
+	sched.active = true;
+
+	return 0;
+}
+
+int mpsl_timeslot_sched_stop(void)
+{
+	int err;
+
+	if (!sched.active) {
+		return -EALREADY;
+	}
+
+	sched.stop_requested = true;
+
+	err = mpsl_timeslot_session_close(sched.session_id);
+	if (err) {
+		LOG_ERR("Timeslot session close failed: %d", err);
+		return err;
+	}
+
+	sched.active = false;
+
+	return 0;
+}
+
+void mpsl_timeslot_sched_stats_get(struct mpsl_timeslot_sched_stats *stats)
+{
+	*stats = sched.stats;
+}
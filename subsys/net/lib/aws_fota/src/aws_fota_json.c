@@ -6,12 +6,317 @@
 
 #include <zephyr.h>
 #include <string.h>
+#include <stdlib.h>
+#include <errno.h>
 #include <cJSON.h>
 #include <sys/util.h>
 #include <net/aws_jobs.h>
 
 #include "aws_fota_json.h"
 
+#ifdef CONFIG_AWS_FOTA_DIRECT_JSON_PARSE
+/* In-place extraction for the fixed job document schema. The scanner walks
+ * the document one object member at a time and skips values that are not of
+ * interest, so no tree is built and nothing is allocated.
+ */
+
+static const char *skip_ws(const char *p, const char *end)
+{
+	while ((p < end) &&
+	       ((*p == ' ') || (*p == '\t') || (*p == '\n') || (*p == '\r'))) {
+		p++;
+	}
+	return p;
+}
+
+/* Expects p at the opening quote. Returns the position after the closing
+ * quote, or NULL if the string is unterminated.
+ */
+static const char *skip_string(const char *p, const char *end)
+{
+	p++;
+	while (p < end) {
+		if (*p == '\\') {
+			p += 2;
+			continue;
+		}
+		if (*p == '"') {
+			return p + 1;
+		}
+		p++;
+	}
+	return NULL;
+}
+
+static const char *skip_value(const char *p, const char *end)
+{
+	p = skip_ws(p, end);
+	if (p >= end) {
+		return NULL;
+	}
+
+	if (*p == '"') {
+		return skip_string(p, end);
+	}
+
+	if ((*p == '{') || (*p == '[')) {
+		int depth = 0;
+
+		while (p < end) {
+			if (*p == '"') {
+				p = skip_string(p, end);
+				if (p == NULL) {
+					return NULL;
+				}
+				continue;
+			}
+			if ((*p == '{') || (*p == '[')) {
+				depth++;
+			} else if ((*p == '}') || (*p == ']')) {
+				depth--;
+				if (depth == 0) {
+					return p + 1;
+				}
+			}
+			p++;
+		}
+		return NULL;
+	}
+
+	/* Number or literal, ends at a delimiter or whitespace. */
+	while ((p < end) && (*p != ',') && (*p != '}') && (*p != ']') &&
+	       (*p != ' ') && (*p != '\t') && (*p != '\n') && (*p != '\r')) {
+		p++;
+	}
+	return p;
+}
+
+/* Finds a member by key in the object starting at obj and returns a pointer
+ * to its value, or NULL. The scan stops at the closing brace of the object,
+ * so nested objects can be searched by passing the document end as bound.
+ */
+static const char *object_get(const char *obj, const char *end,
+			      const char *key)
+{
+	size_t key_len = strlen(key);
+	const char *p = skip_ws(obj, end);
+
+	if ((p >= end) || (*p != '{')) {
+		return NULL;
+	}
+	p = skip_ws(p + 1, end);
+
+	while ((p < end) && (*p == '"')) {
+		const char *name = p + 1;
+		const char *name_end = skip_string(p, end);
+		bool match;
+
+		if (name_end == NULL) {
+			return NULL;
+		}
+
+		match = (((size_t)(name_end - 1 - name) == key_len) &&
+			 (memcmp(name, key, key_len) == 0));
+
+		p = skip_ws(name_end, end);
+		if ((p >= end) || (*p != ':')) {
+			return NULL;
+		}
+		p = skip_ws(p + 1, end);
+
+		if (match) {
+			return p;
+		}
+
+		p = skip_value(p, end);
+		if (p == NULL) {
+			return NULL;
+		}
+		p = skip_ws(p, end);
+		if ((p < end) && (*p == ',')) {
+			p = skip_ws(p + 1, end);
+		}
+	}
+
+	return NULL;
+}
+
+/* Copies the string value at value into buf, resolving escapes the same way
+ * cJSON does. Truncates silently, like the cJSON-based implementation.
+ */
+static int string_get(const char *value, const char *end,
+		      char *buf, size_t buf_size)
+{
+	size_t len = 0;
+
+	if ((value >= end) || (*value != '"')) {
+		return -ENODATA;
+	}
+	value++;
+
+	while ((value < end) && (*value != '"')) {
+		char c = *value++;
+
+		if ((c == '\\') && (value < end)) {
+			c = *value++;
+			switch (c) {
+			case 'b':
+				c = '\b';
+				break;
+			case 'f':
+				c = '\f';
+				break;
+			case 'n':
+				c = '\n';
+				break;
+			case 'r':
+				c = '\r';
+				break;
+			case 't':
+				c = '\t';
+				break;
+			default:
+				/* '"', '\\' and '/' map to themselves. */
+				break;
+			}
+		}
+
+		if (len < (buf_size - 1)) {
+			buf[len++] = c;
+		}
+	}
+
+	if (value >= end) {
+		return -ENODATA;
+	}
+
+	buf[len] = '\0';
+	return 0;
+}
+
+static int number_get(const char *value, const char *end, int *num)
+{
+	char tmp[12];
+	char *endptr;
+	size_t len = 0;
+
+	while ((value < end) && (len < (sizeof(tmp) - 1)) &&
+	       ((*value == '-') || ((*value >= '0') && (*value <= '9')))) {
+		tmp[len++] = *value++;
+	}
+
+	if (len == 0) {
+		return -ENODATA;
+	}
+	tmp[len] = '\0';
+
+	errno = 0;
+	*num = strtol(tmp, &endptr, 10);
+	if ((errno == ERANGE) || (*endptr != '\0')) {
+		return -ENODATA;
+	}
+	return 0;
+}
+
+int aws_fota_parse_UpdateJobExecution_rsp(const char *update_rsp_document,
+					  size_t payload_len, char *status_buf)
+{
+	if (update_rsp_document == NULL || status_buf == NULL) {
+		return -EINVAL;
+	}
+
+	const char *end = update_rsp_document + payload_len;
+	const char *status = object_get(update_rsp_document, end, "status");
+
+	if (status == NULL) {
+		return -ENODATA;
+	}
+
+	return string_get(status, end, status_buf, STATUS_MAX_LEN);
+}
+
+int aws_fota_parse_DescribeJobExecution_rsp(const char *job_document,
+					   uint32_t payload_len,
+					   char *job_id_buf,
+					   char *hostname_buf,
+					   char *file_path_buf,
+					   int *execution_version_number)
+{
+	if (job_document == NULL
+	    || job_id_buf == NULL
+	    || hostname_buf == NULL
+	    || file_path_buf == NULL
+	    || execution_version_number == NULL) {
+		return -EINVAL;
+	}
+
+	int err;
+	const char *end = job_document + payload_len;
+	const char *value;
+	const char *execution = object_get(job_document, end, "execution");
+
+	if (execution == NULL) {
+		const char *p = skip_ws(job_document, end);
+
+		/* An empty Job Execution object is not an error. */
+		return ((p < end) && (*p == '{')) ? 0 : -ENODATA;
+	}
+
+	value = object_get(execution, end, "jobId");
+	if (value == NULL) {
+		return -ENODATA;
+	}
+	err = string_get(value, end, job_id_buf, AWS_JOBS_JOB_ID_MAX_LEN);
+	if (err) {
+		return err;
+	}
+
+	const char *job_data = object_get(execution, end, "jobDocument");
+
+	if (job_data == NULL) {
+		return -ENODATA;
+	}
+
+	const char *location = object_get(job_data, end, "location");
+
+	if (location == NULL) {
+		return -ENODATA;
+	}
+
+	value = object_get(location, end, "host");
+	if (value == NULL) {
+		return -ENODATA;
+	}
+	err = string_get(value, end, hostname_buf,
+			 CONFIG_AWS_FOTA_HOSTNAME_MAX_LEN);
+	if (err) {
+		return err;
+	}
+
+	value = object_get(location, end, "path");
+	if (value == NULL) {
+		return -ENODATA;
+	}
+	err = string_get(value, end, file_path_buf,
+			 CONFIG_AWS_FOTA_FILE_PATH_MAX_LEN);
+	if (err) {
+		return err;
+	}
+
+	value = object_get(execution, end, "versionNumber");
+	if (value == NULL) {
+		return -ENODATA;
+	}
+	err = number_get(value, end, execution_version_number);
+	if (err) {
+		return err;
+	}
+
+	return 1;
+}
+
+#else /* CONFIG_AWS_FOTA_DIRECT_JSON_PARSE */
+
 /**@brief Copy max maxlen bytes from src to dst. Insert null-terminator.
  */
 static void strncpy_nullterm(char *dst, const char *src, size_t maxlen)
@@ -142,3 +447,5 @@ cleanup:
 	cJSON_Delete(json_data);
 	return ret;
 }
+
+#endif /* CONFIG_AWS_FOTA_DIRECT_JSON_PARSE */
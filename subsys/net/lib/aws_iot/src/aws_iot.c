@@ -59,6 +59,13 @@ static char get_topic[GET_TOPIC_LEN + 1];
 static char update_topic[UPDATE_TOPIC_LEN + 1];
 static char delete_topic[DELETE_TOPIC_LEN + 1];
 
+/* Lengths of the shadow topic strings, stored when the topics are
+ * populated so that publishing does not recompute them.
+ */
+static size_t get_topic_len;
+static size_t update_topic_len;
+static size_t delete_topic_len;
+
 #if defined(CONFIG_AWS_IOT_TOPIC_UPDATE_ACCEPTED_SUBSCRIBE)
 #define UPDATE_ACCEPTED_TOPIC AWS_TOPIC "%s/shadow/update/accepted"
 #define UPDATE_ACCEPTED_TOPIC_LEN (AWS_TOPIC_LEN + AWS_CLIENT_ID_LEN_MAX + 23)
@@ -377,18 +384,21 @@ static int aws_iot_topics_populate(char *const id, size_t id_len)
 	if (err >= GET_TOPIC_LEN) {
 		return -ENOMEM;
 	}
+	get_topic_len = err;
 
 	err = snprintf(update_topic, sizeof(update_topic),
 		       UPDATE_TOPIC, client_id_buf);
 	if (err >= UPDATE_TOPIC_LEN) {
 		return -ENOMEM;
 	}
+	update_topic_len = err;
 
 	err = snprintf(delete_topic, sizeof(delete_topic),
 		       DELETE_TOPIC, client_id_buf);
 	if (err >= DELETE_TOPIC_LEN) {
 		return -ENOMEM;
 	}
+	delete_topic_len = err;
 
 #if defined(CONFIG_AWS_IOT_TOPIC_GET_ACCEPTED_SUBSCRIBE)
 	err = snprintf(get_accepted_topic, sizeof(get_accepted_topic),
@@ -1059,6 +1069,109 @@ int aws_iot_input(void)
 	return mqtt_input(&client);
 }
 
+static int publish_message(const char *const topic, size_t topic_len,
+			   const char *const ptr, size_t len,
+			   enum mqtt_qos qos)
+{
+	struct mqtt_publish_param param;
+
+	param.message.topic.qos		= qos;
+	param.message.topic.topic.utf8	= topic;
+	param.message.topic.topic.size	= topic_len;
+	param.message.payload.data	= (char *)ptr;
+	param.message.payload.len	= len;
+	param.message_id		= k_cycle_get_32();
+	param.dup_flag			= 0;
+	param.retain_flag		= 0;
+
+	LOG_DBG("Publishing to topic: %s",
+		log_strdup(param.message.topic.topic.utf8));
+
+	return mqtt_publish(&client, &param);
+}
+
+#if defined(CONFIG_AWS_IOT_PUBLISH_QUEUE)
+/* Queued QoS 0 messages, each entry holding the topic followed by the
+ * payload. The topic is copied because application topic strings are not
+ * required to stay valid after aws_iot_send() returns.
+ */
+static struct pub_queue_msg {
+	char data[CONFIG_AWS_IOT_PUBLISH_QUEUE_ENTRY_SIZE];
+	size_t topic_len;
+	size_t payload_len;
+} pub_queue[CONFIG_AWS_IOT_PUBLISH_QUEUE_COUNT];
+static size_t pub_queue_count;
+static K_MUTEX_DEFINE(pub_queue_lock);
+
+static void pub_queue_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(pub_queue_work, pub_queue_work_fn);
+
+static void pub_queue_flush(void)
+{
+	int err;
+
+	k_mutex_lock(&pub_queue_lock, K_FOREVER);
+
+	for (size_t i = 0; i < pub_queue_count; i++) {
+		err = publish_message(pub_queue[i].data,
+				      pub_queue[i].topic_len,
+				      pub_queue[i].data + pub_queue[i].topic_len,
+				      pub_queue[i].payload_len,
+				      MQTT_QOS_0_AT_MOST_ONCE);
+		if (err) {
+			LOG_ERR("Failed to publish queued message, error: %d",
+				err);
+			break;
+		}
+	}
+
+	pub_queue_count = 0;
+	k_mutex_unlock(&pub_queue_lock);
+}
+
+static void pub_queue_work_fn(struct k_work *work)
+{
+	pub_queue_flush();
+}
+
+static int pub_queue_add(const char *const topic, size_t topic_len,
+			 const char *const ptr, size_t len)
+{
+	bool full;
+
+	if ((topic_len + len) > sizeof(pub_queue[0].data)) {
+		/* Too large to queue, publish directly. */
+		return publish_message(topic, topic_len, ptr, len,
+				       MQTT_QOS_0_AT_MOST_ONCE);
+	}
+
+	k_mutex_lock(&pub_queue_lock, K_FOREVER);
+
+	struct pub_queue_msg *msg = &pub_queue[pub_queue_count++];
+
+	memcpy(msg->data, topic, topic_len);
+	memcpy(msg->data + topic_len, ptr, len);
+	msg->topic_len = topic_len;
+	msg->payload_len = len;
+	full = (pub_queue_count == ARRAY_SIZE(pub_queue));
+
+	k_mutex_unlock(&pub_queue_lock);
+
+	if (full) {
+		(void)k_work_cancel_delayable(&pub_queue_work);
+		pub_queue_flush();
+	} else {
+		/* No-op if already scheduled; the window is measured from
+		 * the first queued message.
+		 */
+		(void)k_work_schedule(&pub_queue_work,
+			K_MSEC(CONFIG_AWS_IOT_PUBLISH_QUEUE_WINDOW_MS));
+	}
+
+	return 0;
+}
+#endif /* defined(CONFIG_AWS_IOT_PUBLISH_QUEUE) */
+
 int aws_iot_send(const struct aws_iot_data *const tx_data)
 {
 	struct aws_iot_data tx_data_pub = {
@@ -1074,28 +1187,28 @@ int aws_iot_send(const struct aws_iot_data *const tx_data)
 #if defined(CONFIG_CLOUD_API)
 	case CLOUD_EP_STATE_GET:
 		tx_data_pub.topic.str = get_topic;
-		tx_data_pub.topic.len = strlen(get_topic);
+		tx_data_pub.topic.len = get_topic_len;
 		break;
 	case CLOUD_EP_STATE:
 		tx_data_pub.topic.str = update_topic;
-		tx_data_pub.topic.len = strlen(update_topic);
+		tx_data_pub.topic.len = update_topic_len;
 		break;
 	case CLOUD_EP_STATE_DELETE:
 		tx_data_pub.topic.str = delete_topic;
-		tx_data_pub.topic.len = strlen(delete_topic);
+		tx_data_pub.topic.len = delete_topic_len;
 		break;
 #else
 	case AWS_IOT_SHADOW_TOPIC_GET:
 		tx_data_pub.topic.str = get_topic;
-		tx_data_pub.topic.len = strlen(get_topic);
+		tx_data_pub.topic.len = get_topic_len;
 		break;
 	case AWS_IOT_SHADOW_TOPIC_UPDATE:
 		tx_data_pub.topic.str = update_topic;
-		tx_data_pub.topic.len = strlen(update_topic);
+		tx_data_pub.topic.len = update_topic_len;
 		break;
 	case AWS_IOT_SHADOW_TOPIC_DELETE:
 		tx_data_pub.topic.str = delete_topic;
-		tx_data_pub.topic.len = strlen(delete_topic);
+		tx_data_pub.topic.len = delete_topic_len;
 		break;
 #endif
 	default:
@@ -1107,25 +1220,34 @@ int aws_iot_send(const struct aws_iot_data *const tx_data)
 		break;
 	}
 
-	struct mqtt_publish_param param;
-
-	param.message.topic.qos		= tx_data_pub.qos;
-	param.message.topic.topic.utf8	= tx_data_pub.topic.str;
-	param.message.topic.topic.size	= tx_data_pub.topic.len;
-	param.message.payload.data	= tx_data_pub.ptr;
-	param.message.payload.len	= tx_data_pub.len;
-	param.message_id		= k_cycle_get_32();
-	param.dup_flag			= 0;
-	param.retain_flag		= 0;
+#if defined(CONFIG_AWS_IOT_PUBLISH_QUEUE)
+	if (tx_data_pub.qos == MQTT_QOS_0_AT_MOST_ONCE) {
+		return pub_queue_add(tx_data_pub.topic.str,
+				     tx_data_pub.topic.len,
+				     tx_data_pub.ptr,
+				     tx_data_pub.len);
+	}
 
-	LOG_DBG("Publishing to topic: %s",
-		log_strdup(param.message.topic.topic.utf8));
+	/* Flush queued messages first so that ordering across QoS levels
+	 * is preserved; the QoS 1 message rides the same burst.
+	 */
+	(void)k_work_cancel_delayable(&pub_queue_work);
+	pub_queue_flush();
+#endif
 
-	return mqtt_publish(&client, &param);
+	return publish_message(tx_data_pub.topic.str,
+			       tx_data_pub.topic.len,
+			       tx_data_pub.ptr,
+			       tx_data_pub.len,
+			       tx_data_pub.qos);
 }
 
 int aws_iot_disconnect(void)
 {
+#if defined(CONFIG_AWS_IOT_PUBLISH_QUEUE)
+	(void)k_work_cancel_delayable(&pub_queue_work);
+	pub_queue_flush();
+#endif
 	atomic_set(&disconnect_requested, 1);
 	return mqtt_disconnect(&client);
 }
@@ -18,12 +18,21 @@ LOG_MODULE_REGISTER(azure_iot_hub_topic, CONFIG_AZURE_IOT_HUB_LOG_LEVEL);
 #define PROP_BAG_STR_EMPTY_VAL	"%s="
 #define PROP_BAG_STR_NO_VAL	"%s"
 
-static char *topic_prefixes[] = {
-	[TOPIC_TYPE_DEVICEBOUND] = TOPIC_PREFIX_DEVICEBOUND,
-	[TOPIC_TYPE_TWIN_UPDATE_DESIRED] = TOPIC_PREFIX_TWIN_DESIRED,
-	[TOPIC_TYPE_TWIN_UPDATE_RESULT] = TOPIC_PREFIX_TWIN_RES,
-	[TOPIC_TYPE_DPS_REG_RESULT] = TOPIC_PREFIX_DPS_REG_RESULT,
-	[TOPIC_TYPE_DIRECT_METHOD] = TOPIC_PREFIX_DIRECT_METHOD,
+/* Dispatch table for incoming topics, indexed by topic type. The prefix
+ * lengths are computed at compile time so classifying a topic does not
+ * run strlen() over the table for every message.
+ */
+#define TOPIC_PREFIX(_prefix) { .str = _prefix, .len = sizeof(_prefix) - 1 }
+
+static const struct topic_prefix {
+	const char *str;
+	size_t len;
+} topic_prefixes[] = {
+	[TOPIC_TYPE_DEVICEBOUND] = TOPIC_PREFIX(TOPIC_PREFIX_DEVICEBOUND),
+	[TOPIC_TYPE_TWIN_UPDATE_DESIRED] = TOPIC_PREFIX(TOPIC_PREFIX_TWIN_DESIRED),
+	[TOPIC_TYPE_TWIN_UPDATE_RESULT] = TOPIC_PREFIX(TOPIC_PREFIX_TWIN_RES),
+	[TOPIC_TYPE_DPS_REG_RESULT] = TOPIC_PREFIX(TOPIC_PREFIX_DPS_REG_RESULT),
+	[TOPIC_TYPE_DIRECT_METHOD] = TOPIC_PREFIX(TOPIC_PREFIX_DIRECT_METHOD),
 };
 
 /* If the topic type is TOPIC_TYPE_DEVICEBOUND, the dynamic value in the
@@ -41,7 +50,7 @@ static char *topic_prefixes[] = {
  */
 static inline char *skip_prefix(char *const buf, enum topic_type type)
 {
-	return buf + strlen(topic_prefixes[type]);
+	return buf + topic_prefixes[type].len;
 }
 
 /* Get the next occurence of a character within a string, where the length
@@ -171,8 +180,16 @@ enum topic_type topic_type_get(const char *buf, const size_t len)
 	}
 
 	for (size_t i = 0; i < ARRAY_SIZE(topic_prefixes); i++) {
-		if (strncmp(topic_prefixes[i], buf,
-			    MIN(strlen(topic_prefixes[i]), len)) == 0) {
+		/* The prefixes only start with 'd' or '$'; comparing the
+		 * discriminating first byte rejects most non-matching
+		 * prefixes without a full comparison.
+		 */
+		if (buf[0] != topic_prefixes[i].str[0]) {
+			continue;
+		}
+
+		if (memcmp(topic_prefixes[i].str, buf,
+			   MIN(topic_prefixes[i].len, len)) == 0) {
 			return i;
 		}
 	}
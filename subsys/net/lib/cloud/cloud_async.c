@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr.h>
+#include <net/cloud.h>
+
+#include <logging/log.h>
+
+LOG_MODULE_REGISTER(cloud_async, CONFIG_CLOUD_ASYNC_LOG_LEVEL);
+
+/* Queued message. The topic string and payload are copied into the
+ * flexible array member, so the caller's buffers may be reused as soon
+ * as cloud_send_async returns.
+ */
+struct queued_msg {
+	void *fifo_reserved;
+	const struct cloud_backend *backend;
+	struct cloud_msg msg;
+	cloud_send_cb_t cb;
+	void *user_data;
+	char data[];
+};
+
+static K_FIFO_DEFINE(tx_fifo);
+static atomic_t tx_depth;
+
+static void tx_work_fn(struct k_work *work);
+static K_WORK_DEFINE(tx_work, tx_work_fn);
+
+static void tx_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	int err;
+	struct queued_msg *queued;
+
+	/* Messages are sent one at a time, in the order they were queued. */
+	while ((queued = k_fifo_get(&tx_fifo, K_NO_WAIT)) != NULL) {
+		err = cloud_send(queued->backend, &queued->msg);
+		if (err) {
+			LOG_ERR("cloud_send, error: %d", err);
+		}
+
+		if (queued->cb) {
+			queued->cb(queued->backend, err, queued->user_data);
+		}
+
+		k_free(queued);
+		atomic_dec(&tx_depth);
+	}
+}
+
+int cloud_send_async(const struct cloud_backend *const backend,
+		     const struct cloud_msg *const msg,
+		     cloud_send_cb_t cb, void *user_data)
+{
+	struct queued_msg *queued;
+	size_t topic_len;
+
+	if (backend == NULL || backend->api == NULL ||
+	    backend->api->send == NULL) {
+		return -ENOTSUP;
+	}
+
+	if (msg == NULL || msg->buf == NULL) {
+		return -EINVAL;
+	}
+
+	if (atomic_inc(&tx_depth) >= CONFIG_CLOUD_ASYNC_QUEUE_DEPTH) {
+		atomic_dec(&tx_depth);
+		return -ENOBUFS;
+	}
+
+	topic_len = msg->endpoint.str ? strlen(msg->endpoint.str) + 1 : 0;
+
+	queued = k_malloc(sizeof(*queued) + topic_len + msg->len);
+	if (!queued) {
+		atomic_dec(&tx_depth);
+		return -ENOMEM;
+	}
+
+	queued->backend = backend;
+	queued->msg = *msg;
+	queued->cb = cb;
+	queued->user_data = user_data;
+
+	if (topic_len) {
+		memcpy(queued->data, msg->endpoint.str, topic_len);
+		queued->msg.endpoint.str = queued->data;
+	}
+
+	memcpy(&queued->data[topic_len], msg->buf, msg->len);
+	queued->msg.buf = &queued->data[topic_len];
+
+	k_fifo_put(&tx_fifo, queued);
+	k_work_submit(&tx_work);
+
+	return 0;
+}
+
+uint32_t cloud_send_queue_depth(void)
+{
+	return (uint32_t)atomic_get(&tx_depth);
+}
@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr.h>
+#include <device.h>
+#include <drivers/flash.h>
+#include <sys/crc.h>
+#include <net/cloud.h>
+
+#include <logging/log.h>
+
+LOG_MODULE_REGISTER(cloud_store, CONFIG_CLOUD_STORE_LOG_LEVEL);
+
+#define PAGE_SIZE	CONFIG_CLOUD_STORE_PAGE_SIZE
+#define PAGE_MAGIC	0x53444C43 /* "CLDS" */
+#define RECORD_MAGIC	0x4352     /* "RC" */
+
+/* Each flash page starts with a header carrying a monotonically increasing
+ * sequence number, so the oldest and newest pages can be identified when the
+ * ring is rebuilt after a reboot.
+ */
+struct page_hdr {
+	uint32_t magic;
+	uint32_t seq;
+} __packed;
+
+/* Records follow the page header back to back, padded to the flash write
+ * alignment. A record never spans a page boundary; the remainder of a page
+ * that cannot hold the next record is left erased and skipped when reading.
+ */
+struct record_hdr {
+	uint16_t magic;
+	uint16_t ep_type;
+	uint16_t qos;
+	uint16_t topic_len;
+	uint16_t data_len;
+	uint16_t crc; /* CRC-16/CCITT over topic and payload */
+} __packed;
+
+#define RECORD_ALIGN		4
+#define RECORD_SIZE(t_len, d_len) \
+	ROUND_UP(sizeof(struct record_hdr) + (t_len) + (d_len), RECORD_ALIGN)
+#define RECORD_SIZE_MAX		RECORD_SIZE(0, CONFIG_CLOUD_STORE_MAX_RECORD_SIZE)
+
+BUILD_ASSERT((sizeof(struct page_hdr) + RECORD_SIZE_MAX) <=
+	     CONFIG_CLOUD_STORE_PAGE_SIZE,
+	     "Cloud store records must fit within one flash page");
+
+static const struct device *flash_dev;
+static uint32_t store_base;
+static uint32_t store_size;
+
+/* Ring state; offsets are relative to store_base. */
+static uint32_t head_page;   /* page being appended to */
+static uint32_t head_offset; /* append position within head_page */
+static uint32_t tail_page;   /* oldest page with data */
+static uint32_t page_seq;    /* sequence number of head_page */
+static bool empty;
+
+static K_MUTEX_DEFINE(store_lock);
+
+/* Staging buffer so each record is written in one aligned operation. */
+static uint8_t record_buf[RECORD_SIZE_MAX];
+
+static const struct cloud_backend *replay_backend;
+static void replay_work_fn(struct k_work *work);
+static K_WORK_DEFINE(replay_work, replay_work_fn);
+
+static uint32_t next_page(uint32_t page)
+{
+	page += PAGE_SIZE;
+	return (page >= store_size) ? 0 : page;
+}
+
+static int page_open(uint32_t page, uint32_t seq)
+{
+	int err;
+	struct page_hdr hdr = {
+		.magic = PAGE_MAGIC,
+		.seq = seq
+	};
+
+	err = flash_erase(flash_dev, store_base + page, PAGE_SIZE);
+	if (err) {
+		LOG_ERR("Failed to erase page at 0x%X, error: %d", page, err);
+		return err;
+	}
+
+	err = flash_write(flash_dev, store_base + page, &hdr, sizeof(hdr));
+	if (err) {
+		LOG_ERR("Failed to write page header at 0x%X, error: %d",
+			page, err);
+	}
+	return err;
+}
+
+static uint16_t record_crc(const struct record_hdr *hdr, const uint8_t *body)
+{
+	return crc16_ccitt(0, body, hdr->topic_len + hdr->data_len);
+}
+
+/* Returns the size of the record at the given offset, 0 if the rest of the
+ * page is unused, or a negative error code.
+ */
+static int record_peek(uint32_t page, uint32_t offset, struct record_hdr *hdr)
+{
+	int err;
+
+	if ((offset + sizeof(*hdr)) > PAGE_SIZE) {
+		return 0;
+	}
+
+	err = flash_read(flash_dev, store_base + page + offset,
+			 hdr, sizeof(*hdr));
+	if (err) {
+		return err;
+	}
+
+	if (hdr->magic != RECORD_MAGIC) {
+		return 0;
+	}
+
+	if ((hdr->topic_len + hdr->data_len) >
+	    CONFIG_CLOUD_STORE_MAX_RECORD_SIZE) {
+		return -EFAULT;
+	}
+
+	return RECORD_SIZE(hdr->topic_len, hdr->data_len);
+}
+
+/* Rebuilds the ring state by locating the oldest and newest valid pages. */
+static void scan_storage(void)
+{
+	struct page_hdr hdr;
+	struct record_hdr rec;
+	uint32_t seq_min = UINT32_MAX;
+	uint32_t seq_max = 0;
+	bool found = false;
+	int size;
+
+	for (uint32_t page = 0; page < store_size; page += PAGE_SIZE) {
+		if (flash_read(flash_dev, store_base + page,
+			       &hdr, sizeof(hdr))) {
+			continue;
+		}
+		if (hdr.magic != PAGE_MAGIC) {
+			continue;
+		}
+
+		found = true;
+		if (hdr.seq <= seq_min) {
+			seq_min = hdr.seq;
+			tail_page = page;
+		}
+		if (hdr.seq >= seq_max) {
+			seq_max = hdr.seq;
+			head_page = page;
+		}
+	}
+
+	if (!found) {
+		head_page = 0;
+		head_offset = sizeof(struct page_hdr);
+		tail_page = 0;
+		page_seq = 0;
+		empty = true;
+		return;
+	}
+
+	page_seq = seq_max;
+	head_offset = sizeof(struct page_hdr);
+	while ((size = record_peek(head_page, head_offset, &rec)) > 0) {
+		head_offset += size;
+	}
+	empty = false;
+
+	LOG_DBG("Found stored data, pages 0x%X-0x%X", tail_page, head_page);
+}
+
+int cloud_store_init(uint32_t storage_base, uint32_t storage_size)
+{
+	const char *name = DT_PROP(DT_NODELABEL(flash_controller), label);
+
+	if ((storage_size < (2 * PAGE_SIZE)) ||
+	    (storage_base % PAGE_SIZE) || (storage_size % PAGE_SIZE)) {
+		return -EINVAL;
+	}
+
+	flash_dev = device_get_binding(name);
+	if (flash_dev == NULL) {
+		LOG_ERR("Failed to get device:'%s'", name);
+		return -ENXIO;
+	}
+
+	store_base = storage_base;
+	store_size = storage_size;
+
+	scan_storage();
+
+	return 0;
+}
+
+int cloud_store_save(const struct cloud_msg *const msg)
+{
+	int err;
+	size_t topic_len;
+	size_t size;
+	struct record_hdr *hdr = (struct record_hdr *)record_buf;
+	uint8_t *body = record_buf + sizeof(*hdr);
+
+	if (flash_dev == NULL) {
+		return -ENXIO;
+	}
+
+	if (msg == NULL || msg->buf == NULL) {
+		return -EINVAL;
+	}
+
+	topic_len = (msg->endpoint.str != NULL) ? msg->endpoint.len : 0;
+	if ((topic_len + msg->len) > CONFIG_CLOUD_STORE_MAX_RECORD_SIZE) {
+		return -EMSGSIZE;
+	}
+
+	size = RECORD_SIZE(topic_len, msg->len);
+	memset(record_buf, 0xFF, size);
+
+	hdr->magic = RECORD_MAGIC;
+	hdr->ep_type = msg->endpoint.type;
+	hdr->qos = msg->qos;
+	hdr->topic_len = topic_len;
+	hdr->data_len = msg->len;
+	memcpy(body, msg->endpoint.str, topic_len);
+	memcpy(body + topic_len, msg->buf, msg->len);
+	hdr->crc = record_crc(hdr, body);
+
+	k_mutex_lock(&store_lock, K_FOREVER);
+
+	if (empty) {
+		err = page_open(head_page, page_seq);
+		if (err) {
+			goto out;
+		}
+		empty = false;
+	}
+
+	if ((head_offset + size) > PAGE_SIZE) {
+		uint32_t page = next_page(head_page);
+
+		if (page == tail_page) {
+			/* Ring is full, drop the oldest page. */
+			tail_page = next_page(tail_page);
+			LOG_WRN("Store full, oldest page dropped");
+		}
+
+		err = page_open(page, ++page_seq);
+		if (err) {
+			goto out;
+		}
+		head_page = page;
+		head_offset = sizeof(struct page_hdr);
+	}
+
+	err = flash_write(flash_dev, store_base + head_page + head_offset,
+			  record_buf, size);
+	if (err) {
+		LOG_ERR("Failed to write record, error: %d", err);
+		goto out;
+	}
+	head_offset += size;
+
+out:
+	k_mutex_unlock(&store_lock);
+	return err;
+}
+
+static int replay_records(const struct cloud_backend *const backend)
+{
+	int err = 0;
+	int size;
+	uint32_t page = tail_page;
+	struct record_hdr hdr;
+	uint8_t *body = record_buf + sizeof(hdr);
+
+	while (true) {
+		uint32_t offset = sizeof(struct page_hdr);
+
+		while ((size = record_peek(page, offset, &hdr)) > 0) {
+			err = flash_read(flash_dev,
+					 store_base + page + offset +
+					 sizeof(hdr),
+					 body, hdr.topic_len + hdr.data_len);
+			if (err) {
+				return err;
+			}
+
+			if (record_crc(&hdr, body) != hdr.crc) {
+				LOG_WRN("Record CRC mismatch, skipped");
+				offset += size;
+				continue;
+			}
+
+			struct cloud_msg msg = {
+				.buf = body + hdr.topic_len,
+				.len = hdr.data_len,
+				.qos = hdr.qos,
+				.endpoint = {
+					.type = hdr.ep_type,
+					.str = hdr.topic_len ?
+					       (char *)body : NULL,
+					.len = hdr.topic_len
+				}
+			};
+
+			err = backend->api->send(backend, &msg);
+			if (err) {
+				LOG_ERR("Replay send failed, error: %d", err);
+				return err;
+			}
+
+			offset += size;
+		}
+
+		if (size < 0) {
+			return size;
+		}
+
+		if (page == head_page) {
+			return 0;
+		}
+		page = next_page(page);
+	}
+}
+
+static void replay_work_fn(struct k_work *work)
+{
+	int err;
+
+	k_mutex_lock(&store_lock, K_FOREVER);
+
+	if (empty || replay_backend == NULL) {
+		goto out;
+	}
+
+	err = replay_records(replay_backend);
+	if (err) {
+		/* Stored data is kept; the next reconnect retries. */
+		goto out;
+	}
+
+	/* All records delivered; erase the ring so a reboot does not
+	 * replay the same data again.
+	 */
+	for (uint32_t page = 0; page < store_size; page += PAGE_SIZE) {
+		(void)flash_erase(flash_dev, store_base + page, PAGE_SIZE);
+	}
+	head_page = 0;
+	head_offset = sizeof(struct page_hdr);
+	tail_page = 0;
+	empty = true;
+
+	LOG_DBG("Stored messages replayed");
+out:
+	k_mutex_unlock(&store_lock);
+}
+
+void cloud_store_replay_schedule(const struct cloud_backend *const backend)
+{
+	if (flash_dev == NULL || empty) {
+		return;
+	}
+
+	replay_backend = backend;
+	k_work_submit(&replay_work);
+}
@@ -14,7 +14,9 @@ LOG_MODULE_REGISTER(coap_utils, CONFIG_COAP_UTILS_LOG_LEVEL);
 #define MAX_COAP_MSG_LEN 256
 #define COAP_VER 1
 #define COAP_TOKEN_LEN 8
-#define COAP_MAX_REPLIES 1
+#define COAP_MAX_REPLIES CONFIG_COAP_UTILS_MAX_REPLIES
+#define COAP_OBSERVE_REGISTER 0
+#define COAP_OBSERVE_DEREGISTER 1
 #define COAP_POOL_SLEEP 500
 #define COAP_OPEN_SOCKET_SLEEP 200
 #if defined(CONFIG_NRF_MODEM_LIB)
@@ -26,6 +28,7 @@ LOG_MODULE_REGISTER(coap_utils, CONFIG_COAP_UTILS_LOG_LEVEL);
 const static int nfds = 1;
 static struct pollfd fds;
 static struct coap_reply replies[COAP_MAX_REPLIES];
+static bool observe_slot[COAP_MAX_REPLIES];
 static int proto_family;
 static struct sockaddr *bind_addr;
 
@@ -60,6 +63,67 @@ static void coap_close_socket(int socket)
 	(void)close(socket);
 }
 
+/* The reply table is indexed by a hash of the message token, so a
+ * response is matched without scanning every pending reply or
+ * observation. coap_next_token() generates random tokens, which keeps
+ * the distribution even. Collisions are resolved by linear probing.
+ */
+static uint32_t coap_token_hash(const uint8_t *token, uint8_t tkl)
+{
+	uint32_t hash = 5381;
+
+	for (uint8_t i = 0; i < tkl; i++) {
+		hash = hash * 33 + token[i];
+	}
+
+	return hash;
+}
+
+static struct coap_reply *coap_reply_slot_claim(const uint8_t *token,
+						uint8_t tkl)
+{
+	uint32_t idx = coap_token_hash(token, tkl) % COAP_MAX_REPLIES;
+
+	for (int i = 0; i < COAP_MAX_REPLIES; i++) {
+		struct coap_reply *reply = &replies[(idx + i) % COAP_MAX_REPLIES];
+
+		if (reply->reply == NULL) {
+			return reply;
+		}
+	}
+
+	/* No free slot, evict a one-shot reply. Observations are kept as
+	 * they stay matchable until cancelled.
+	 */
+	for (int i = 0; i < COAP_MAX_REPLIES; i++) {
+		uint32_t slot = (idx + i) % COAP_MAX_REPLIES;
+
+		if (!observe_slot[slot]) {
+			coap_reply_clear(&replies[slot]);
+			return &replies[slot];
+		}
+	}
+
+	return NULL;
+}
+
+static struct coap_reply *coap_reply_slot_find(const uint8_t *token,
+					       uint8_t tkl)
+{
+	uint32_t idx = coap_token_hash(token, tkl) % COAP_MAX_REPLIES;
+
+	for (int i = 0; i < COAP_MAX_REPLIES; i++) {
+		struct coap_reply *reply = &replies[(idx + i) % COAP_MAX_REPLIES];
+
+		if ((reply->reply != NULL) && (reply->tkl == tkl) &&
+		    (memcmp(reply->token, token, tkl) == 0)) {
+			return reply;
+		}
+	}
+
+	return NULL;
+}
+
 static void coap_receive(void)
 {
 	static uint8_t buf[MAX_COAP_MSG_LEN + 1];
@@ -67,6 +131,8 @@ static void coap_receive(void)
 	struct coap_reply *reply = NULL;
 	static struct sockaddr from_addr;
 	socklen_t from_addr_len;
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint8_t tkl;
 	int len;
 	int ret;
 
@@ -128,9 +194,25 @@ static void coap_receive(void)
 			continue;
 		}
 
-		reply = coap_response_received(&response, &from_addr, replies,
-					       COAP_MAX_REPLIES);
-		if (reply) {
+		tkl = coap_header_get_token(&response, token);
+		if (tkl > 0) {
+			/* Look up the matching reply by token hash, then let
+			 * coap_response_received() verify it, track the
+			 * observe age and run the callback.
+			 */
+			reply = coap_reply_slot_find(token, tkl);
+			if (reply) {
+				reply = coap_response_received(&response,
+							       &from_addr,
+							       reply, 1);
+			}
+		} else {
+			/* Empty token, matched against the message ID */
+			reply = coap_response_received(&response, &from_addr,
+						       replies,
+						       COAP_MAX_REPLIES);
+		}
+		if (reply && !observe_slot[reply - replies]) {
 			coap_reply_clear(reply);
 		}
 	}
@@ -140,19 +222,35 @@ static int coap_init_request(enum coap_method method,
 			     enum coap_msgtype msg_type,
 			     const char *const *uri_path_options, uint8_t *payload,
 			     uint16_t payload_size, struct coap_packet *request,
-			     uint8_t *buf)
+			     uint8_t *buf, int observe,
+			     const uint8_t *token, uint8_t tkl)
 {
 	const char *const *opt;
 	int ret;
 
+	if (token == NULL) {
+		token = coap_next_token();
+		tkl = COAP_TOKEN_LEN;
+	}
+
 	ret = coap_packet_init(request, buf, MAX_COAP_MSG_LEN, COAP_VER,
-			       msg_type, COAP_TOKEN_LEN, coap_next_token(),
+			       msg_type, tkl, token,
 			       method, coap_next_id());
 	if (ret < 0) {
 		LOG_ERR("Failed to init CoAP message");
 		goto end;
 	}
 
+	if (observe >= 0) {
+		/* The observe option must precede the URI path options */
+		ret = coap_append_option_int(request, COAP_OPTION_OBSERVE,
+					     observe);
+		if (ret < 0) {
+			LOG_ERR("Unable add observe option to request");
+			goto end;
+		}
+	}
+
 	for (opt = uri_path_options; opt && *opt; opt++) {
 		ret = coap_packet_append_option(request, COAP_OPTION_URI_PATH,
 						*(const uint8_t *const *)opt, strlen(*opt));
@@ -189,15 +287,23 @@ static int coap_send_message(const struct sockaddr *addr,
 }
 
 static void coap_set_response_callback(struct coap_packet *request,
-				       coap_reply_t reply_cb)
+				       coap_reply_t reply_cb, bool observe)
 {
 	struct coap_reply *reply;
-
-	reply = &replies[0];
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint8_t tkl;
+
+	tkl = coap_header_get_token(request, token);
+	reply = coap_reply_slot_claim(token, tkl);
+	if (reply == NULL) {
+		LOG_ERR("No free reply slot, response will not be matched");
+		return;
+	}
 
 	coap_reply_clear(reply);
 	coap_reply_init(reply, request);
 	reply->reply = reply_cb;
+	observe_slot[reply - replies] = observe;
 }
 
 void coap_init(int ip_family, struct sockaddr *addr)
@@ -231,15 +337,43 @@ int coap_send_request(enum coap_method method, const struct sockaddr *addr,
 	uint8_t buf[MAX_COAP_MSG_LEN];
 
 	ret = coap_init_request(method, COAP_TYPE_NON_CON, uri_path_options,
-				payload, payload_size, &request, buf);
+				payload, payload_size, &request, buf,
+				-1, NULL, 0);
 	if (ret < 0) {
 		goto end;
 	}
 
 	if (reply_cb != NULL) {
-		coap_set_response_callback(&request, reply_cb);
+		coap_set_response_callback(&request, reply_cb, false);
+	}
+
+	ret = coap_send_message(addr, &request);
+	if (ret < 0) {
+		LOG_ERR("Transmission failed: %d", errno);
+		goto end;
 	}
 
+end:
+	return ret;
+}
+
+int coap_send_observe_request(const struct sockaddr *addr,
+			      const char *const *uri_path_options,
+			      coap_reply_t reply_cb)
+{
+	int ret;
+	struct coap_packet request;
+	uint8_t buf[MAX_COAP_MSG_LEN];
+
+	ret = coap_init_request(COAP_METHOD_GET, COAP_TYPE_NON_CON,
+				uri_path_options, NULL, 0, &request, buf,
+				COAP_OBSERVE_REGISTER, NULL, 0);
+	if (ret < 0) {
+		goto end;
+	}
+
+	coap_set_response_callback(&request, reply_cb, true);
+
 	ret = coap_send_message(addr, &request);
 	if (ret < 0) {
 		LOG_ERR("Transmission failed: %d", errno);
@@ -249,3 +383,45 @@ int coap_send_request(enum coap_method method, const struct sockaddr *addr,
 end:
 	return ret;
 }
+
+int coap_cancel_observe_request(const struct sockaddr *addr,
+				const char *const *uri_path_options,
+				coap_reply_t reply_cb)
+{
+	int ret;
+	struct coap_packet request;
+	uint8_t buf[MAX_COAP_MSG_LEN];
+	struct coap_reply *reply = NULL;
+
+	for (int i = 0; i < COAP_MAX_REPLIES; i++) {
+		if (observe_slot[i] && (replies[i].reply == reply_cb)) {
+			reply = &replies[i];
+			break;
+		}
+	}
+	if (reply == NULL) {
+		return -ENOENT;
+	}
+
+	/* Deregister with the token of the original registration so the
+	 * server can identify the observation
+	 */
+	ret = coap_init_request(COAP_METHOD_GET, COAP_TYPE_NON_CON,
+				uri_path_options, NULL, 0, &request, buf,
+				COAP_OBSERVE_DEREGISTER, reply->token,
+				reply->tkl);
+	if (ret < 0) {
+		goto end;
+	}
+
+	ret = coap_send_message(addr, &request);
+	if (ret < 0) {
+		LOG_ERR("Transmission failed: %d", errno);
+		goto end;
+	}
+
+end:
+	observe_slot[reply - replies] = false;
+	coap_reply_clear(reply);
+	return ret;
+}
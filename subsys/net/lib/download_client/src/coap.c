@@ -15,13 +15,26 @@ LOG_MODULE_DECLARE(download_client, CONFIG_DOWNLOAD_CLIENT_LOG_LEVEL);
 #define FILENAME_SIZE CONFIG_DOWNLOAD_CLIENT_MAX_FILENAME_SIZE
 
 int url_parse_file(const char *url, char *file, size_t len);
-int socket_send(const struct download_client *client, size_t len);
+int socket_send(const struct download_client *client, const char *buf,
+		size_t len);
+
+#ifdef CONFIG_DOWNLOAD_CLIENT_COAP_PIPELINING
+#define NSTART CONFIG_DOWNLOAD_CLIENT_COAP_NSTART
+#define BLOCK_BYTES (1 << (CONFIG_DOWNLOAD_CLIENT_COAP_BLOCK_SIZE + 4))
+#endif
 
 int coap_block_init(struct download_client *client, size_t from)
 {
 	coap_block_transfer_init(&client->coap.block_ctx,
 				 CONFIG_DOWNLOAD_CLIENT_COAP_BLOCK_SIZE, 0);
 	client->coap.block_ctx.current = from;
+#ifdef CONFIG_DOWNLOAD_CLIENT_COAP_PIPELINING
+	memset(client->coap.pending, 0, sizeof(client->coap.pending));
+	memset(client->coap.window, 0, sizeof(client->coap.window));
+	client->coap.block_deliver = from / BLOCK_BYTES;
+	client->coap.block_request = from / BLOCK_BYTES;
+	client->coap.retransmit = false;
+#endif
 	return 0;
 }
 
@@ -56,6 +69,8 @@ int coap_block_update(struct download_client *client, struct coap_packet *pkt,
 	return 0;
 }
 
+#ifndef CONFIG_DOWNLOAD_CLIENT_COAP_PIPELINING
+
 int coap_parse(struct download_client *client, size_t len)
 {
 	int err;
@@ -112,7 +127,7 @@ int coap_request_send(struct download_client *client)
 	struct coap_packet request;
 
 	err = coap_packet_init(
-		&request, client->buf, CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
+		&request, client->buf, download_client_buf_size(client),
 		COAP_VER, COAP_TYPE_CON, 8, coap_next_token(),
 		COAP_METHOD_GET, coap_next_id()
 	);
@@ -147,7 +162,81 @@ int coap_request_send(struct download_client *client)
 
 	LOG_DBG("CoAP next block: %d", client->coap.block_ctx.current);
 
-	err = socket_send(client, request.offset);
+	err = socket_send(client, client->buf, request.offset);
+	if (err) {
+		LOG_ERR("Failed to send CoAP request, errno %d", errno);
+		return err;
+	}
+
+	if (IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_LOG_HEADERS)) {
+		LOG_HEXDUMP_DBG(request.data, request.offset, "CoAP request");
+	}
+
+	return 0;
+}
+
+#else /* CONFIG_DOWNLOAD_CLIENT_COAP_PIPELINING */
+
+static int in_flight(const struct download_client *client)
+{
+	int count = 0;
+
+	for (int i = 0; i < NSTART; i++) {
+		if (client->coap.pending[i].busy) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+static int block_request_send(struct download_client *client,
+			      const uint8_t *token, uint8_t tkl,
+			      uint32_t block)
+{
+	int err;
+	char file[FILENAME_SIZE];
+	struct coap_packet request;
+
+	err = coap_packet_init(
+		&request, client->buf, download_client_buf_size(client),
+		COAP_VER, COAP_TYPE_CON, tkl, (uint8_t *)token,
+		COAP_METHOD_GET, coap_next_id()
+	);
+	if (err) {
+		LOG_ERR("Failed to init CoAP message, err %d", err);
+		return err;
+	}
+
+	err = url_parse_file(client->file, file, sizeof(file));
+	if (err) {
+		return err;
+	}
+
+	err = coap_packet_append_option(&request, COAP_OPTION_URI_PATH,
+					file, strlen(file));
+	if (err) {
+		LOG_ERR("Unable add option to request");
+		return err;
+	}
+
+	err = coap_append_option_int(&request, COAP_OPTION_BLOCK2,
+				     (block << 4) |
+				     CONFIG_DOWNLOAD_CLIENT_COAP_BLOCK_SIZE);
+	if (err) {
+		LOG_ERR("Unable to add block2 option");
+		return err;
+	}
+
+	err = coap_append_option_int(&request, COAP_OPTION_SIZE2, 0);
+	if (err) {
+		LOG_ERR("Unable to add size2 option");
+		return err;
+	}
+
+	LOG_DBG("CoAP block request: %d", block);
+
+	err = socket_send(client, client->buf, request.offset);
 	if (err) {
 		LOG_ERR("Failed to send CoAP request, errno %d", errno);
 		return err;
@@ -159,3 +248,222 @@ int coap_request_send(struct download_client *client)
 
 	return 0;
 }
+
+int coap_request_send(struct download_client *client)
+{
+	int err;
+
+	if (client->coap.retransmit) {
+		/* The socket timed out, send all requests in flight again */
+		client->coap.retransmit = false;
+
+		for (int i = 0; i < NSTART; i++) {
+			if (!client->coap.pending[i].busy) {
+				continue;
+			}
+
+			err = block_request_send(
+				client, client->coap.pending[i].token,
+				client->coap.pending[i].tkl,
+				client->coap.pending[i].block);
+			if (err) {
+				return err;
+			}
+		}
+	}
+
+	/* Keep NSTART block requests in flight. Until the file size is
+	 * known from the first response, only one request may be
+	 * outstanding, since the end of the file must not be requested
+	 * past.
+	 */
+	while (in_flight(client) < NSTART) {
+		int free_slot = -1;
+
+		if (client->file_size == 0 && in_flight(client) > 0) {
+			break;
+		}
+
+		if (client->file_size != 0 &&
+		    (size_t)client->coap.block_request * BLOCK_BYTES >=
+		    client->file_size) {
+			break;
+		}
+
+		for (int i = 0; i < NSTART; i++) {
+			if (!client->coap.pending[i].busy) {
+				free_slot = i;
+				break;
+			}
+		}
+
+		memcpy(client->coap.pending[free_slot].token,
+		       coap_next_token(), 8);
+		client->coap.pending[free_slot].tkl = 8;
+
+		err = block_request_send(client,
+					 client->coap.pending[free_slot].token,
+					 client->coap.pending[free_slot].tkl,
+					 client->coap.block_request);
+		if (err) {
+			return err;
+		}
+
+		client->coap.pending[free_slot].block =
+			client->coap.block_request++;
+		client->coap.pending[free_slot].busy = true;
+	}
+
+	return 0;
+}
+
+/* Returns:
+ *  1 if the block is out of order or a duplicate; wait for more data
+ *  0 if the next in-order block has been received
+ * -1 on error
+ */
+int coap_parse(struct download_client *client, size_t len)
+{
+	int err;
+	int slot = -1;
+	uint32_t block;
+	uint8_t tkl;
+	uint8_t token[8];
+	uint8_t response_code;
+	uint16_t payload_len;
+	const uint8_t *payload;
+	struct coap_option option;
+	struct coap_packet response;
+
+	err = coap_packet_parse(&response, client->buf, len, NULL, 0);
+	if (err) {
+		LOG_ERR("Failed to parse CoAP packet, err %d", err);
+		return -1;
+	}
+
+	tkl = coap_header_get_token(&response, token);
+
+	for (int i = 0; i < NSTART; i++) {
+		if (client->coap.pending[i].busy &&
+		    client->coap.pending[i].tkl == tkl &&
+		    memcmp(client->coap.pending[i].token, token, tkl) == 0) {
+			slot = i;
+			break;
+		}
+	}
+
+	if (slot < 0) {
+		/* Stale or duplicate response, wait for more data */
+		LOG_DBG("Unexpected token, ignoring response");
+		return 1;
+	}
+
+	response_code = coap_header_get_code(&response);
+	if (response_code != COAP_RESPONSE_CODE_OK &&
+	    response_code != COAP_RESPONSE_CODE_CONTENT) {
+		LOG_ERR("Server responded with code 0x%x", response_code);
+		return -1;
+	}
+
+	err = coap_find_options(&response, COAP_OPTION_BLOCK2, &option, 1);
+	if (err != 1) {
+		LOG_ERR("No block2 option in response");
+		return -1;
+	}
+
+	block = coap_option_value_to_int(&option) >> 4;
+	if (block != client->coap.pending[slot].block) {
+		LOG_ERR("Block number does not match request");
+		return -1;
+	}
+
+	if (client->file_size == 0) {
+		err = coap_find_options(&response, COAP_OPTION_SIZE2,
+					&option, 1);
+		if (err != 1) {
+			LOG_ERR("Server did not send the total size (Size2)");
+			return -1;
+		}
+		client->file_size = coap_option_value_to_int(&option);
+		LOG_DBG("Total size: %d", client->file_size);
+	}
+
+	payload = coap_packet_get_payload(&response, &payload_len);
+	if (!payload) {
+		LOG_WRN("No CoAP payload!");
+		return -1;
+	}
+
+	if (payload_len > BLOCK_BYTES) {
+		LOG_ERR("Payload exceeds negotiated block size (%d > %d)",
+			payload_len, BLOCK_BYTES);
+		return -1;
+	}
+
+	client->coap.pending[slot].busy = false;
+
+	if (block == client->coap.block_deliver) {
+		/* The block offset is non-zero only when resuming the
+		 * download from an offset within a block.
+		 */
+		size_t blk_off =
+			client->progress - (size_t)block * BLOCK_BYTES;
+
+		LOG_DBG("CoAP response: %d, copying %d bytes",
+			response_code, payload_len - blk_off);
+		memcpy(client->buf, payload + blk_off, payload_len - blk_off);
+
+		client->offset = payload_len - blk_off;
+		client->progress += payload_len - blk_off;
+		client->coap.block_deliver++;
+
+		return 0;
+	}
+
+	if (block < client->coap.block_deliver) {
+		/* Already delivered */
+		return 1;
+	}
+
+	/* Hold the block until its turn. There is always a free entry,
+	 * since at most NSTART - 1 in-flight blocks can be ahead of the
+	 * next block to deliver.
+	 */
+	for (int i = 0; i < ARRAY_SIZE(client->coap.window); i++) {
+		if (!client->coap.window[i].valid) {
+			client->coap.window[i].block = block;
+			client->coap.window[i].len = payload_len;
+			memcpy(client->coap.window[i].data, payload,
+			       payload_len);
+			client->coap.window[i].valid = true;
+			break;
+		}
+	}
+
+	LOG_DBG("Out of order block %d held for delivery", block);
+
+	return 1;
+}
+
+int coap_pending_block_pop(struct download_client *client)
+{
+	for (int i = 0; i < ARRAY_SIZE(client->coap.window); i++) {
+		if (client->coap.window[i].valid &&
+		    client->coap.window[i].block ==
+		    client->coap.block_deliver) {
+			memcpy(client->buf, client->coap.window[i].data,
+			       client->coap.window[i].len);
+
+			client->offset = client->coap.window[i].len;
+			client->progress += client->coap.window[i].len;
+			client->coap.window[i].valid = false;
+			client->coap.block_deliver++;
+
+			return 0;
+		}
+	}
+
+	return -ENOENT;
+}
+
+#endif /* CONFIG_DOWNLOAD_CLIENT_COAP_PIPELINING */
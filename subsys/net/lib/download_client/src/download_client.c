@@ -34,10 +34,12 @@ int url_parse_host(const char *url, char *host, size_t len);
 
 int http_parse(struct download_client *client, size_t len);
 int http_get_request_send(struct download_client *client);
+int http_get_pipelined_requests_send(struct download_client *client);
 
 int coap_block_init(struct download_client *client, size_t from);
 int coap_parse(struct download_client *client, size_t len);
 int coap_request_send(struct download_client *client);
+int coap_pending_block_pop(struct download_client *client);
 
 static const char *str_family(int family)
 {
@@ -362,13 +364,14 @@ cleanup:
 	return err;
 }
 
-int socket_send(const struct download_client *client, size_t len)
+int socket_send(const struct download_client *client, const char *buf,
+		size_t len)
 {
 	int sent;
 	size_t off = 0;
 
 	while (len) {
-		sent = send(client->fd, client->buf + off, len, 0);
+		sent = send(client->fd, buf + off, len, 0);
 		if (sent <= 0) {
 			return -errno;
 		}
@@ -385,7 +388,11 @@ static int request_send(struct download_client *dl)
 	switch (dl->proto) {
 	case IPPROTO_TCP:
 	case IPPROTO_TLS_1_2:
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+		return http_get_pipelined_requests_send(dl);
+#else
 		return http_get_request_send(dl);
+#endif
 	case IPPROTO_UDP:
 	case IPPROTO_DTLS_1_2:
 		if (IS_ENABLED(CONFIG_COAP)) {
@@ -398,7 +405,7 @@ static int request_send(struct download_client *dl)
 
 static int fragment_evt_send(const struct download_client *client)
 {
-	__ASSERT(client->offset <= CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
+	__ASSERT(client->offset <= download_client_buf_size(client),
 		 "Buffer overflow!");
 
 	const struct download_client_evt evt = {
@@ -425,6 +432,44 @@ static int error_evt_send(const struct download_client *dl, int error)
 	return dl->callback(&evt);
 }
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_ADAPTIVE_FRAG_SIZE
+
+static size_t frag_size_max(const struct download_client *dl)
+{
+	if (dl->config.frag_size_override != 0) {
+		return dl->config.frag_size_override;
+	}
+
+	return CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE;
+}
+
+static void frag_size_shrink(struct download_client *dl)
+{
+	size_t size = MAX(dl->frag_size / 2,
+			  CONFIG_DOWNLOAD_CLIENT_ADAPTIVE_FRAG_SIZE_MIN);
+
+	if (size != dl->frag_size) {
+		LOG_INF("Fragment size reduced to %u bytes",
+			(unsigned int)size);
+		dl->frag_size = size;
+	}
+}
+
+static void frag_size_grow(struct download_client *dl)
+{
+	size_t size = MIN(dl->frag_size +
+			  CONFIG_DOWNLOAD_CLIENT_ADAPTIVE_FRAG_SIZE_STEP,
+			  frag_size_max(dl));
+
+	if (size != dl->frag_size) {
+		LOG_DBG("Fragment size increased to %u bytes",
+			(unsigned int)size);
+		dl->frag_size = size;
+	}
+}
+
+#endif /* CONFIG_DOWNLOAD_CLIENT_ADAPTIVE_FRAG_SIZE */
+
 static int reconnect(struct download_client *dl)
 {
 	int err;
@@ -440,6 +485,16 @@ static int reconnect(struct download_client *dl)
 		return err;
 	}
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+	/* The new connection carries no outstanding requests, and any
+	 * carried over response bytes belong to the old connection.
+	 */
+	dl->http.pending = 0;
+	dl->http.extra = 0;
+	dl->http.payload_len = 0;
+	dl->http.requested = dl->progress;
+#endif
+
 	return 0;
 }
 
@@ -448,26 +503,46 @@ void download_thread(void *client, void *a, void *b)
 	int rc = 0;
 	int error_cause;
 	size_t len;
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+	size_t carry;
+#endif
 	struct download_client *const dl = client;
 
 restart_and_suspend:
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+	carry = 0;
+#endif
 	k_thread_suspend(dl->tid);
 
 	while (true) {
-		__ASSERT(dl->offset < sizeof(dl->buf), "Buffer overflow");
+		__ASSERT(dl->offset < download_client_buf_size(dl),
+			 "Buffer overflow");
 
-		if (sizeof(dl->buf) - dl->offset == 0) {
+		if (download_client_buf_size(dl) - dl->offset == 0) {
 			LOG_ERR("Could not fit HTTP header from server (> %d)",
-				sizeof(dl->buf));
+				download_client_buf_size(dl));
 			error_evt_send(dl, E2BIG);
 			break;
 		}
 
-		LOG_DBG("Receiving up to %d bytes at %p...",
-			(sizeof(dl->buf) - dl->offset), (dl->buf + dl->offset));
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+		if (carry) {
+			/* Parse the bytes of the next pipelined response
+			 * carried over from the previous one before
+			 * receiving more data.
+			 */
+			len = carry;
+			carry = 0;
+		} else
+#endif
+		{
+			LOG_DBG("Receiving up to %d bytes at %p...",
+				(download_client_buf_size(dl) - dl->offset),
+				(dl->buf + dl->offset));
 
-		len = recv(dl->fd, dl->buf + dl->offset,
-			   sizeof(dl->buf) - dl->offset, 0);
+			len = recv(dl->fd, dl->buf + dl->offset,
+				   download_client_buf_size(dl) - dl->offset, 0);
+		}
 
 		if ((len == 0) || (len == -1)) {
 			/* We just had an unexpected socket error or closure */
@@ -476,7 +551,8 @@ restart_and_suspend:
 			 * and it has been accounted in our progress, we have
 			 * to hand it to the application before discarding it.
 			 */
-			if ((dl->offset > 0) && (dl->http.has_header)) {
+			if (!IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING) &&
+			    (dl->offset > 0) && (dl->http.has_header)) {
 				rc = fragment_evt_send(dl);
 				if (rc) {
 					/* Restart and suspend */
@@ -493,6 +569,9 @@ restart_and_suspend:
 					if (dl->proto == IPPROTO_UDP ||
 					    dl->proto == IPPROTO_DTLS_1_2) {
 						LOG_DBG("Socket timeout, resending");
+#ifdef CONFIG_DOWNLOAD_CLIENT_COAP_PIPELINING
+						dl->coap.retransmit = true;
+#endif
 						goto send_again;
 					}
 					error_cause = ETIMEDOUT;
@@ -504,6 +583,14 @@ restart_and_suspend:
 				LOG_WRN("Peer closed connection!");
 			}
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_ADAPTIVE_FRAG_SIZE
+			/* The link is struggling, use smaller fragments */
+			if (dl->proto == IPPROTO_TCP ||
+			    dl->proto == IPPROTO_TLS_1_2) {
+				frag_size_shrink(dl);
+			}
+#endif
+
 			/* Notify the application of the error via en event.
 			 * Attempt to reconnect and resume the download
 			 * if the application returns Zero via the event.
@@ -531,8 +618,21 @@ restart_and_suspend:
 				/* Wait for more data (fragment/header) */
 				continue;
 			}
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+			if (rc == 0) {
+				dl->http.pending--;
+			}
+#endif
 		} else if (IS_ENABLED(CONFIG_COAP)) {
 			rc = coap_parse(client, len);
+#ifdef CONFIG_DOWNLOAD_CLIENT_COAP_PIPELINING
+			if (rc > 0) {
+				/* Duplicate or out of order block, stashed
+				 * for delivery in its turn.
+				 */
+				continue;
+			}
+#endif
 		}
 
 		if (rc < 0) {
@@ -543,6 +643,9 @@ restart_and_suspend:
 			break;
 		}
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_COAP_PIPELINING
+deliver:
+#endif
 		if (dl->file_size) {
 			LOG_INF("Downloaded %u/%u bytes (%d%%)",
 				dl->progress, dl->file_size,
@@ -561,6 +664,13 @@ restart_and_suspend:
 			break;
 		}
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_ADAPTIVE_FRAG_SIZE
+		/* Grow the fragment size back one step per fragment */
+		if (dl->proto == IPPROTO_TCP || dl->proto == IPPROTO_TLS_1_2) {
+			frag_size_grow(dl);
+		}
+#endif
+
 		if (dl->progress == dl->file_size) {
 			LOG_INF("Download complete");
 			const struct download_client_evt evt = {
@@ -577,7 +687,26 @@ restart_and_suspend:
 			reconnect(dl);
 		}
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_COAP_PIPELINING
+		/* Deliver any stashed block whose turn has come */
+		if ((dl->proto == IPPROTO_UDP || dl->proto == IPPROTO_DTLS_1_2) &&
+		    coap_pending_block_pop(dl) == 0) {
+			goto deliver;
+		}
+#endif
+
 send_again:
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+		if (dl->http.extra) {
+			/* Move the bytes of the next pipelined response to
+			 * the front of the buffer and parse them on the next
+			 * loop, before receiving more data.
+			 */
+			memmove(dl->buf, dl->buf + dl->offset, dl->http.extra);
+			carry = dl->http.extra;
+			dl->http.extra = 0;
+		}
+#endif
 		dl->offset = 0;
 		/* Request next fragment, if necessary (HTTPS/CoAP) */
 		if (dl->proto != IPPROTO_TCP || len == 0
@@ -598,6 +727,12 @@ send_again:
 					break;
 				}
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+				/* Carried over bytes belong to the old
+				 * connection.
+				 */
+				carry = 0;
+#endif
 				goto send_again;
 			}
 		}
@@ -607,6 +742,26 @@ send_again:
 	goto restart_and_suspend;
 }
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_EXTERNAL_BUF
+int download_client_buf_set(struct download_client *client, void *buf,
+			    size_t size)
+{
+	if (client == NULL || buf == NULL || size == 0) {
+		return -EINVAL;
+	}
+
+	if (client->fd != -1) {
+		/* The buffer may not be swapped while connected */
+		return -EBUSY;
+	}
+
+	client->buf = buf;
+	client->buf_size = size;
+
+	return 0;
+}
+#endif
+
 int download_client_init(struct download_client *const client,
 			 download_client_callback_t callback)
 {
@@ -646,7 +801,14 @@ int download_client_connect(struct download_client *client, const char *host,
 		return 0;
 	}
 
-	if (config->frag_size_override > CONFIG_DOWNLOAD_CLIENT_BUF_SIZE) {
+#ifdef CONFIG_DOWNLOAD_CLIENT_EXTERNAL_BUF
+	if (client->buf == NULL) {
+		LOG_ERR("No receive buffer registered");
+		return -ENOMEM;
+	}
+#endif
+
+	if (config->frag_size_override > download_client_buf_size(client)) {
 		LOG_ERR("The configured fragment size is larger than buffer");
 		return -E2BIG;
 	}
@@ -713,6 +875,15 @@ int download_client_start(struct download_client *client, const char *file,
 
 	client->offset = 0;
 	client->http.has_header = false;
+#ifdef CONFIG_DOWNLOAD_CLIENT_ADAPTIVE_FRAG_SIZE
+	client->frag_size = frag_size_max(client);
+#endif
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+	client->http.pending = 0;
+	client->http.extra = 0;
+	client->http.payload_len = 0;
+	client->http.requested = from;
+#endif
 
 	if (client->proto == IPPROTO_UDP || client->proto == IPPROTO_DTLS_1_2) {
 		if (IS_ENABLED(CONFIG_COAP)) {
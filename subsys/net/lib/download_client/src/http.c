@@ -42,7 +42,22 @@ LOG_MODULE_DECLARE(download_client, CONFIG_DOWNLOAD_CLIENT_LOG_LEVEL);
 
 int url_parse_host(const char *url, char *host, size_t len);
 int url_parse_file(const char *url, char *file, size_t len);
-int socket_send(const struct download_client *client, size_t len);
+int socket_send(const struct download_client *client, const char *buf,
+		size_t len);
+
+static size_t frag_size(struct download_client *client)
+{
+#ifdef CONFIG_DOWNLOAD_CLIENT_ADAPTIVE_FRAG_SIZE
+	if (client->frag_size != 0) {
+		return client->frag_size;
+	}
+#endif
+	if (client->config.frag_size_override != 0) {
+		return client->config.frag_size_override;
+	}
+
+	return CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE;
+}
 
 int http_get_request_send(struct download_client *client)
 {
@@ -66,12 +81,7 @@ int http_get_request_send(struct download_client *client)
 	}
 
 	/* Offset of last byte in range (Content-Range) */
-	if (client->config.frag_size_override) {
-		off = client->progress + client->config.frag_size_override - 1;
-	} else {
-		off = client->progress +
-			CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE - 1;
-	}
+	off = client->progress + frag_size(client) - 1;
 
 	if (client->file_size != 0) {
 		/* Don't request bytes past the end of file */
@@ -81,19 +91,19 @@ int http_get_request_send(struct download_client *client)
 	if (client->proto == IPPROTO_TLS_1_2
 	   || IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_RANGE_REQUESTS)) {
 		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
+			download_client_buf_size(client),
 			HTTP_GET_RANGE, file, host, client->progress, off);
 	} else if (client->progress) {
 		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
+			download_client_buf_size(client),
 			HTTP_GET_OFFSET, file, host, client->progress);
 	} else {
 		len = snprintf(client->buf,
-			CONFIG_DOWNLOAD_CLIENT_BUF_SIZE,
+			download_client_buf_size(client),
 			HTTP_GET, file, host);
 	}
 
-	if (len < 0 || len > CONFIG_DOWNLOAD_CLIENT_BUF_SIZE) {
+	if (len < 0 || (size_t)len > download_client_buf_size(client)) {
 		LOG_ERR("Cannot create GET request, buffer too small");
 		return -ENOMEM;
 	}
@@ -102,7 +112,7 @@ int http_get_request_send(struct download_client *client)
 		LOG_HEXDUMP_DBG(client->buf, len, "HTTP request");
 	}
 
-	err = socket_send(client, len);
+	err = socket_send(client, client->buf, len);
 	if (err) {
 		LOG_ERR("Failed to send HTTP request, errno %d", errno);
 		return err;
@@ -111,6 +121,79 @@ int http_get_request_send(struct download_client *client)
 	return 0;
 }
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+int http_get_pipelined_requests_send(struct download_client *client)
+{
+	int err;
+	int len;
+	size_t off;
+	size_t frag;
+	char host[HOSTNAME_SIZE];
+	char file[FILENAME_SIZE];
+
+	__ASSERT_NO_MSG(client->host);
+	__ASSERT_NO_MSG(client->file);
+
+	err = url_parse_host(client->host, host, sizeof(host));
+	if (err) {
+		return err;
+	}
+
+	err = url_parse_file(client->file, file, sizeof(file));
+	if (err) {
+		return err;
+	}
+
+	frag = frag_size(client);
+
+	/* Keep two range requests in flight. Until the file size is known
+	 * from the first response, only one request may be outstanding,
+	 * since the end of the file must not be requested past.
+	 */
+	while (client->http.pending < 2) {
+		if (client->http.pending > 0 && client->file_size == 0) {
+			break;
+		}
+
+		if (client->file_size != 0 &&
+		    client->http.requested >= client->file_size) {
+			break;
+		}
+
+		/* Offset of last byte in range (Content-Range) */
+		off = client->http.requested + frag - 1;
+		if (client->file_size != 0) {
+			off = MIN(off, client->file_size - 1);
+		}
+
+		len = snprintf(client->http.request,
+			       sizeof(client->http.request), HTTP_GET_RANGE,
+			       file, host, client->http.requested, off);
+
+		if (len < 0 || (size_t)len >= sizeof(client->http.request)) {
+			LOG_ERR("Cannot create GET request, buffer too small");
+			return -ENOMEM;
+		}
+
+		if (IS_ENABLED(CONFIG_DOWNLOAD_CLIENT_LOG_HEADERS)) {
+			LOG_HEXDUMP_DBG(client->http.request, len,
+					"HTTP request");
+		}
+
+		err = socket_send(client, client->http.request, len);
+		if (err) {
+			LOG_ERR("Failed to send HTTP request, errno %d", errno);
+			return err;
+		}
+
+		client->http.requested = off + 1;
+		client->http.pending++;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING */
+
 /* Returns:
  *  1 while the header is being received
  *  0 if the header has been fully received
@@ -215,6 +298,21 @@ static int http_header_parse(struct download_client *client, size_t *hdr_len)
 		LOG_DBG("File size = %u", client->file_size);
 	}
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+	/* The payload length of each response is needed to tell where
+	 * the next pipelined response begins in the stream.
+	 */
+	p = strstr(client->buf, "content-length");
+	if (p) {
+		p = strstr(p, ":");
+	}
+	if (!p) {
+		LOG_ERR("Server did not send \"Content-Length\" in response");
+		return -1;
+	}
+	client->http.payload_len = atoi(p + 1);
+#endif
+
 	p = strstr(client->buf, "connection: close");
 	if (p) {
 		LOG_WRN("Peer closed connection, will re-connect");
@@ -269,6 +367,21 @@ int http_parse(struct download_client *client, size_t len)
 		}
 	}
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING
+	if (client->offset < client->http.payload_len) {
+		/* Wait for the remainder of the fragment */
+		return 1;
+	}
+
+	/* Any bytes past the payload belong to the next pipelined
+	 * response; deliver exactly the payload and carry the rest over.
+	 */
+	client->http.extra = client->offset - client->http.payload_len;
+	client->offset = client->http.payload_len;
+	client->progress += client->http.payload_len;
+
+	return 0;
+#else
 	/* Accumulate overall file progress.
 	 * If the last recv() call read an HTTP header,
 	 * `offset` has been moved at the end of any trailing
@@ -280,11 +393,10 @@ int http_parse(struct download_client *client, size_t len)
 
 	/* Have we received a whole fragment or the whole file? */
 	if (client->progress != client->file_size &&
-	    client->offset < (client->config.frag_size_override != 0 ?
-			      client->config.frag_size_override :
-			      CONFIG_DOWNLOAD_CLIENT_HTTP_FRAG_SIZE)) {
+	    client->offset < frag_size(client)) {
 		return 1;
 	}
 
 	return 0;
+#endif /* CONFIG_DOWNLOAD_CLIENT_HTTP_PIPELINING */
 }
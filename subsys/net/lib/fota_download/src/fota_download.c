@@ -9,6 +9,7 @@
 #include <net/fota_download.h>
 #include <net/download_client.h>
 #include <pm_config.h>
+#include "fota_download_hash.h"
 
 #if defined(PM_S1_ADDRESS) || defined(CONFIG_DFU_TARGET_MCUBOOT)
 /* MCUBoot support is required */
@@ -35,12 +36,100 @@ static struct k_work_delayable  dlc_with_offset_work;
 static int socket_retries_left;
 #ifdef CONFIG_DFU_TARGET_MCUBOOT
 static uint8_t mcuboot_buf[CONFIG_FOTA_DOWNLOAD_MCUBOOT_FLASH_BUF_SZ] __aligned(4);
+#if defined(PM_MCUBOOT_SECONDARY_WRITE_BLOCK_SIZE)
+/* An unaligned buffer degrades to per-block padding writes on flashes with
+ * large write blocks, such as external QSPI flash.
+ */
+BUILD_ASSERT((CONFIG_FOTA_DOWNLOAD_MCUBOOT_FLASH_BUF_SZ %
+	      PM_MCUBOOT_SECONDARY_WRITE_BLOCK_SIZE) == 0,
+	     "Flash buffer size must be a multiple of the write block size "
+	     "of the secondary slot");
+#endif
+#endif
+#ifdef CONFIG_DOWNLOAD_CLIENT_EXTERNAL_BUF
+/* Word-aligned receive buffer, so that fragments can be written to flash
+ * directly from the buffer they were received into.
+ */
+static uint8_t dlc_buf[CONFIG_DOWNLOAD_CLIENT_BUF_SIZE] __aligned(4);
 #endif
 static enum dfu_target_image_type img_type;
 static enum dfu_target_image_type img_type_expected = DFU_TARGET_IMAGE_TYPE_ANY;
 static bool first_fragment;
 static bool downloading;
 
+#ifdef CONFIG_FOTA_DOWNLOAD_RRC_PACING
+#include <modem/lte_lc.h>
+
+/* Duty cycling of the download: fragments are fetched in batches, with
+ * rest periods in between during which the download client is paused and
+ * the modem may fall back to PSM or eDRX sleep.
+ */
+static struct k_work_delayable pacing_work;
+/* True when the download client is paused by the pacer. */
+static bool paced_rest;
+
+static void pacing_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	if (!downloading) {
+		return;
+	}
+
+	if (paced_rest) {
+		paced_rest = false;
+		download_client_resume(&dlc);
+		k_work_reschedule(&pacing_work,
+			K_SECONDS(CONFIG_FOTA_DOWNLOAD_RRC_PACING_BATCH_TIME));
+	} else {
+		paced_rest = true;
+		download_client_pause(&dlc);
+		k_work_reschedule(&pacing_work,
+			K_SECONDS(CONFIG_FOTA_DOWNLOAD_RRC_PACING_REST_TIME));
+	}
+}
+
+static void pacing_lte_handler(const struct lte_lc_evt *const evt)
+{
+	if (evt->type != LTE_LC_EVT_RRC_UPDATE) {
+		return;
+	}
+
+	/* If other traffic brought the modem to RRC connected mode during
+	 * a rest period, ride the already-paid connected window instead of
+	 * forcing a new RRC setup later.
+	 */
+	if ((evt->rrc_mode == LTE_LC_RRC_MODE_CONNECTED) &&
+	    paced_rest && downloading) {
+		k_work_reschedule(&pacing_work, K_NO_WAIT);
+	}
+}
+
+static void pacing_start(void)
+{
+	paced_rest = false;
+	k_work_reschedule(&pacing_work,
+		K_SECONDS(CONFIG_FOTA_DOWNLOAD_RRC_PACING_BATCH_TIME));
+}
+
+static void pacing_stop(void)
+{
+	(void)k_work_cancel_delayable(&pacing_work);
+	paced_rest = false;
+}
+
+#else
+
+static void pacing_start(void)
+{
+}
+
+static void pacing_stop(void)
+{
+}
+
+#endif /* CONFIG_FOTA_DOWNLOAD_RRC_PACING */
+
 static void send_evt(enum fota_download_evt_id id)
 {
 	__ASSERT(id != FOTA_DOWNLOAD_EVT_PROGRESS, "use send_progress");
@@ -53,6 +142,7 @@ static void send_evt(enum fota_download_evt_id id)
 
 static void send_error_evt(enum fota_download_error_cause cause)
 {
+	pacing_stop();
 	__ASSERT(cause != FOTA_DOWNLOAD_ERROR_CAUSE_NO_ERROR, "use a valid error cause");
 	const struct fota_download_evt evt = {
 		.id = FOTA_DOWNLOAD_EVT_ERROR,
@@ -149,8 +239,11 @@ static int download_client_callback(const struct download_client_evt *event)
 
 			if (offset != 0) {
 				/* Abort current download procedure, and
-				 * schedule new download from offset.
+				 * schedule new download from offset. The
+				 * restarted download is not hashed from its
+				 * first byte, so drop any hash session.
 				 */
+				fota_download_hash_stop();
 				(void)download_client_disconnect(&dlc);
 				k_work_schedule(&dlc_with_offset_work,
 						K_SECONDS(1));
@@ -158,6 +251,11 @@ static int download_client_callback(const struct download_client_evt *event)
 
 				return -1;
 			}
+
+			/* Only downloads starting from offset 0 can be
+			 * hashed in a streamed fashion.
+			 */
+			fota_download_hash_start(img_type);
 		}
 
 		err = dfu_target_write(event->fragment.buf,
@@ -169,12 +267,16 @@ static int download_client_callback(const struct download_client_evt *event)
 			if (res != 0) {
 				LOG_ERR("Unable to free DFU target resources");
 			}
+			fota_download_hash_stop();
 			first_fragment = true;
 			(void) download_client_disconnect(&dlc);
 			send_error_evt(FOTA_DOWNLOAD_ERROR_CAUSE_INVALID_UPDATE);
 			return err;
 		}
 
+		fota_download_hash_fragment(event->fragment.buf,
+					    event->fragment.len);
+
 		if (IS_ENABLED(CONFIG_FOTA_DOWNLOAD_PROGRESS_EVT) &&
 		    !first_fragment) {
 			err = dfu_target_offset_get(&offset);
@@ -198,6 +300,19 @@ static int download_client_callback(const struct download_client_evt *event)
 	}
 
 	case DOWNLOAD_CLIENT_EVT_DONE:
+		err = fota_download_hash_verify();
+		if (err != 0) {
+			int res = dfu_target_done(false);
+
+			if (res != 0) {
+				LOG_ERR("Unable to free DFU target resources");
+			}
+			first_fragment = true;
+			(void)download_client_disconnect(&dlc);
+			send_error_evt(FOTA_DOWNLOAD_ERROR_CAUSE_INVALID_UPDATE);
+			return err;
+		}
+
 		err = dfu_target_done(true);
 		if (err != 0) {
 			LOG_ERR("dfu_target_done error: %d", err);
@@ -213,6 +328,7 @@ static int download_client_callback(const struct download_client_evt *event)
 		send_evt(FOTA_DOWNLOAD_EVT_FINISHED);
 		first_fragment = true;
 		downloading = false;
+		pacing_stop();
 		break;
 
 	case DOWNLOAD_CLIENT_EVT_ERROR: {
@@ -237,6 +353,7 @@ static int download_client_callback(const struct download_client_evt *event)
 				LOG_ERR("Unable to deinitialze resources "
 					"used by dfu_target.");
 			}
+			fota_download_hash_stop();
 			first_fragment = true;
 			send_error_evt(FOTA_DOWNLOAD_ERROR_CAUSE_DOWNLOAD_FAILED);
 			/* Return non-zero to tell download_client to stop */
@@ -273,6 +390,7 @@ static void download_with_offset(struct k_work *unused)
 	}
 	LOG_INF("Downloading from offset: 0x%x", offset);
 	downloading = true;
+	pacing_start();
 	return;
 }
 
@@ -373,6 +491,7 @@ int fota_download_start_with_image_type(const char *host, const char *file,
 	}
 
 	downloading = true;
+	pacing_start();
 
 	return 0;
 }
@@ -399,11 +518,23 @@ int fota_download_init(fota_download_callback_t client_callback)
 
 	k_work_init_delayable(&dlc_with_offset_work, download_with_offset);
 
+#ifdef CONFIG_FOTA_DOWNLOAD_RRC_PACING
+	k_work_init_delayable(&pacing_work, pacing_work_handler);
+	lte_lc_register_handler(pacing_lte_handler);
+#endif
+
 	err = download_client_init(&dlc, download_client_callback);
 	if (err != 0) {
 		return err;
 	}
 
+#ifdef CONFIG_DOWNLOAD_CLIENT_EXTERNAL_BUF
+	err = download_client_buf_set(&dlc, dlc_buf, sizeof(dlc_buf));
+	if (err != 0) {
+		return err;
+	}
+#endif
+
 	first_fragment = true;
 	return 0;
 }
@@ -413,6 +544,7 @@ int fota_download_cancel(void)
 	int err;
 
 	downloading = false;
+	pacing_stop();
 
 	if (dlc.fd == -1) {
 		/* Download not started, aborted or completed */
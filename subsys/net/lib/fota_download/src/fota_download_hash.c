@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <logging/log.h>
+#include <sys/byteorder.h>
+#include <mbedtls/sha256.h>
+#include "fota_download_hash.h"
+
+LOG_MODULE_DECLARE(fota_download, CONFIG_FOTA_DOWNLOAD_LOG_LEVEL);
+
+/* MCUboot image format constants, from MCUboot's image.h. The SHA-256
+ * covers the header, the payload and the protected TLVs. The SHA-256 TLV
+ * itself sits in the unprotected trailer that follows them.
+ */
+#define IMAGE_HEADER_SIZE	32
+#define IMAGE_TLV_INFO_MAGIC	0x6907
+#define IMAGE_TLV_SHA256	0x10
+
+/* Offsets of the header fields needed to find the hashed region. */
+#define HDR_SIZE_OFFSET		8
+#define PROT_TLV_SIZE_OFFSET	10
+#define IMG_SIZE_OFFSET		12
+
+#define SHA256_LEN 32
+
+static struct {
+	mbedtls_sha256_context ctx;
+	uint8_t hdr[IMAGE_HEADER_SIZE];
+	uint8_t tlv[CONFIG_FOTA_DOWNLOAD_STREAM_HASH_TLV_BUF_SIZE];
+	/* Number of bytes of the file processed so far. */
+	size_t offset;
+	/* End of the hashed region. Zero until the header is complete. */
+	size_t hash_end;
+	/* Number of trailer bytes captured in tlv. */
+	size_t tlv_len;
+	bool active;
+	bool overflow;
+} stream;
+
+void fota_download_hash_start(enum dfu_target_image_type img_type)
+{
+	stream.active = (img_type == DFU_TARGET_IMAGE_TYPE_MCUBOOT);
+	if (!stream.active) {
+		return;
+	}
+
+	mbedtls_sha256_init(&stream.ctx);
+	if (mbedtls_sha256_starts_ret(&stream.ctx, false) != 0) {
+		stream.active = false;
+		return;
+	}
+
+	stream.offset = 0;
+	stream.hash_end = 0;
+	stream.tlv_len = 0;
+	stream.overflow = false;
+}
+
+void fota_download_hash_stop(void)
+{
+	/* Abandon the session so fragments of a restarted or resumed
+	 * download are not fed into stale hash state.
+	 */
+	stream.active = false;
+}
+
+void fota_download_hash_fragment(const void *buf, size_t len)
+{
+	const uint8_t *data = buf;
+	size_t hash_len;
+
+	if (!stream.active) {
+		return;
+	}
+
+	/* Capture the image header to learn where the hashed region ends. */
+	if (stream.offset < IMAGE_HEADER_SIZE) {
+		size_t copy = MIN(len, IMAGE_HEADER_SIZE - stream.offset);
+
+		memcpy(&stream.hdr[stream.offset], data, copy);
+		if ((stream.offset + copy) == IMAGE_HEADER_SIZE) {
+			uint16_t hdr_size =
+				sys_get_le16(&stream.hdr[HDR_SIZE_OFFSET]);
+			uint16_t prot_size =
+				sys_get_le16(&stream.hdr[PROT_TLV_SIZE_OFFSET]);
+			uint32_t img_size =
+				sys_get_le32(&stream.hdr[IMG_SIZE_OFFSET]);
+
+			stream.hash_end =
+				(size_t)hdr_size + img_size + prot_size;
+		}
+	}
+
+	/* Hash the part of the fragment inside the hashed region. The
+	 * header is always part of it, so hashing ahead of a split header
+	 * is safe.
+	 */
+	if ((stream.hash_end == 0) || (stream.offset < stream.hash_end)) {
+		hash_len = (stream.hash_end == 0) ?
+			len : MIN(len, stream.hash_end - stream.offset);
+		if (mbedtls_sha256_update_ret(&stream.ctx, data,
+					      hash_len) != 0) {
+			stream.active = false;
+			return;
+		}
+	}
+
+	/* Capture the unprotected trailer that follows the hashed region. */
+	if ((stream.hash_end > 0) &&
+	    ((stream.offset + len) > stream.hash_end)) {
+		size_t start = MAX(stream.offset, stream.hash_end);
+		size_t tlv_off = start - stream.hash_end;
+		size_t copy = stream.offset + len - start;
+
+		if ((tlv_off + copy) <= sizeof(stream.tlv)) {
+			memcpy(&stream.tlv[tlv_off],
+			       &data[start - stream.offset], copy);
+			stream.tlv_len = tlv_off + copy;
+		} else {
+			stream.overflow = true;
+		}
+	}
+
+	stream.offset += len;
+}
+
+int fota_download_hash_verify(void)
+{
+	uint8_t hash[SHA256_LEN];
+	const uint8_t *expected = NULL;
+	size_t trailer_len;
+	size_t off;
+
+	if (!stream.active) {
+		return 0;
+	}
+	stream.active = false;
+
+	if (stream.overflow) {
+		LOG_WRN("Image trailer exceeds buffer, skipping hash check");
+		return 0;
+	}
+
+	if ((stream.tlv_len < 4) ||
+	    (sys_get_le16(&stream.tlv[0]) != IMAGE_TLV_INFO_MAGIC)) {
+		LOG_WRN("No image trailer found, skipping hash check");
+		return 0;
+	}
+
+	trailer_len = MIN(stream.tlv_len, sys_get_le16(&stream.tlv[2]));
+
+	/* Find the SHA-256 TLV: each entry is a type byte, a pad byte and
+	 * a 16-bit length, followed by the value.
+	 */
+	for (off = 4; (off + 4) <= trailer_len;) {
+		uint8_t type = stream.tlv[off];
+		uint16_t len = sys_get_le16(&stream.tlv[off + 2]);
+
+		if ((type == IMAGE_TLV_SHA256) && (len == sizeof(hash)) &&
+		    ((off + 4 + len) <= stream.tlv_len)) {
+			expected = &stream.tlv[off + 4];
+			break;
+		}
+		off += 4 + len;
+	}
+
+	if (expected == NULL) {
+		LOG_WRN("No SHA-256 TLV in trailer, skipping hash check");
+		return 0;
+	}
+
+	if (mbedtls_sha256_finish_ret(&stream.ctx, hash) != 0) {
+		LOG_WRN("Hash finalization failed, skipping hash check");
+		return 0;
+	}
+
+	if (memcmp(hash, expected, sizeof(hash)) != 0) {
+		LOG_ERR("Downloaded image hash mismatch");
+		return -EILSEQ;
+	}
+
+	LOG_DBG("Downloaded image hash verified");
+
+	return 0;
+}
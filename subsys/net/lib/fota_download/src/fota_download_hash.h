@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#ifndef FOTA_DOWNLOAD_HASH_H__
+#define FOTA_DOWNLOAD_HASH_H__
+
+#include <stddef.h>
+#include <dfu/dfu_target.h>
+
+/* Streamed image hash verification. Fragments are hashed as they arrive
+ * and the digest is checked against the SHA-256 TLV in the MCUboot image
+ * trailer before the target is marked done, catching corrupt transfers
+ * without a reboot-and-revert cycle. Only MCUboot images are covered;
+ * for other image types the calls are no-ops.
+ */
+
+#if defined(CONFIG_FOTA_DOWNLOAD_STREAM_HASH)
+void fota_download_hash_start(enum dfu_target_image_type img_type);
+void fota_download_hash_stop(void);
+void fota_download_hash_fragment(const void *buf, size_t len);
+int fota_download_hash_verify(void);
+#else
+static inline void fota_download_hash_start(enum dfu_target_image_type img_type)
+{
+}
+
+static inline void fota_download_hash_stop(void)
+{
+}
+
+static inline void fota_download_hash_fragment(const void *buf, size_t len)
+{
+}
+
+static inline int fota_download_hash_verify(void)
+{
+	return 0;
+}
+#endif
+
+#endif /* FOTA_DOWNLOAD_HASH_H__ */
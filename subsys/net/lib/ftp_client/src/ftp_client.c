@@ -59,6 +59,27 @@ static struct data_task {
 
 static bool ftp_inactivity;
 
+#if defined(CONFIG_FTP_CLIENT_STREAM_RX)
+/* Two receive buffers used in turn. While a chunk is delivered to the
+ * application from the system workqueue, the data task keeps receiving
+ * into the other buffer. The semaphore blocks the receive loop until
+ * the callback has returned, so a buffer is never overwritten while
+ * the application still reads from it.
+ */
+static char stream_buf[2][FTP_MAX_BUFFER_SIZE];
+static char *stream_data;
+static int stream_length;
+static K_SEM_DEFINE(stream_delivered, 1, 1);
+
+static void stream_deliver_handler(struct k_work *work)
+{
+	client.data_callback(stream_data, stream_length);
+	k_sem_give(&stream_delivered);
+}
+
+static K_WORK_DEFINE(stream_deliver_work, stream_deliver_handler);
+#endif /* CONFIG_FTP_CLIENT_STREAM_RX */
+
 static int parse_return_code(const uint8_t *message, int success_code)
 {
 	char success_code_str[6]; /* max 1xxxx*/
@@ -306,7 +327,11 @@ static void do_ftp_recv_data(const char *pasv_msg)
 {
 	int ret;
 	struct pollfd fds[1];
+#if defined(CONFIG_FTP_CLIENT_STREAM_RX)
+	int buf_sel = 0;
+#else
 	char data_buf[FTP_MAX_BUFFER_SIZE];
+#endif
 
 	/* Establish data channel */
 	ret = establish_data_channel(pasv_msg);
@@ -327,6 +352,27 @@ static void do_ftp_recv_data(const char *pasv_msg)
 			LOG_DBG("No more data");
 			break;
 		}
+#if defined(CONFIG_FTP_CLIENT_STREAM_RX)
+		ret = recv(client.data_sock, stream_buf[buf_sel],
+			   sizeof(stream_buf[0]), 0);
+		if (ret < 0) {
+			LOG_ERR("recv(data) failed: (%d)", -errno);
+			break;
+		}
+		if (ret == 0) {
+			/* Server close connection */
+			break;
+		}
+		/* Hand the buffer over once the previous chunk has been
+		 * consumed, then receive into the other buffer while the
+		 * callback runs.
+		 */
+		k_sem_take(&stream_delivered, K_FOREVER);
+		stream_data = stream_buf[buf_sel];
+		stream_length = ret;
+		k_work_submit(&stream_deliver_work);
+		buf_sel = 1 - buf_sel;
+#else
 		ret = recv(client.data_sock, data_buf, sizeof(data_buf), 0);
 		if (ret < 0) {
 			LOG_ERR("recv(data) failed: (%d)", -errno);
@@ -337,9 +383,15 @@ static void do_ftp_recv_data(const char *pasv_msg)
 			break;
 		}
 		client.data_callback(data_buf, ret);
+#endif
 		LOG_DBG("DATA received %d", ret);
 	} while (true);
 
+#if defined(CONFIG_FTP_CLIENT_STREAM_RX)
+	/* Wait for the last chunk to be delivered before closing */
+	k_sem_take(&stream_delivered, K_FOREVER);
+	k_sem_give(&stream_delivered);
+#endif
 	close(client.data_sock);
 	ftp_inactivity = false;
 }
@@ -768,6 +820,58 @@ int ftp_get(const char *file)
 	return ret;
 }
 
+int ftp_get_resume(const char *file, uint32_t offset)
+{
+	int ret;
+	char get_cmd[128];
+	char pasv_msg[128];
+
+	/* Always set Passive mode to act as TCP client */
+	ret = do_ftp_send_ctrl(CMD_PASV, sizeof(CMD_PASV) - 1);
+	if (ret) {
+		return -EIO;
+	}
+	ret = do_ftp_recv_ctrl(true, FTP_CODE_227);
+	if (ret != FTP_CODE_227) {
+		return ret;
+	}
+	/* The reply to REST overwrites ctrl_buf, keep a copy of the
+	 * passive message for the data task
+	 */
+	strncpy(pasv_msg, ctrl_buf, sizeof(pasv_msg) - 1);
+	pasv_msg[sizeof(pasv_msg) - 1] = 0x00;
+	data_task_param.ctrl_msg = pasv_msg;
+	data_task_param.task = TASK_RECEIVE;
+
+	/* Send REST command in control channel */
+	sprintf(get_cmd, CMD_REST, offset);
+	ret = do_ftp_send_ctrl(get_cmd, strlen(get_cmd));
+	if (ret) {
+		return -EIO;
+	}
+	ret = do_ftp_recv_ctrl(true, FTP_CODE_350);
+	if (ret != FTP_CODE_350) {
+		return ret;
+	}
+
+	/* Send RETR command in control channel */
+	sprintf(get_cmd, CMD_RETR, file);
+	ret = do_ftp_send_ctrl(get_cmd, strlen(get_cmd));
+	if (ret) {
+		return -EIO;
+	}
+
+	/* Set up data connection */
+	k_work_submit_to_queue(&ftp_work_q, &data_task_param.work);
+
+	ret = poll_data_task_done();
+	if (ret == FTP_CODE_226) {
+		client.ctrl_callback(ctrl_buf, strlen(ctrl_buf));
+	}
+
+	return ret;
+}
+
 int ftp_put(const char *file, const uint8_t *data, uint16_t length, int type)
 {
 	int ret;
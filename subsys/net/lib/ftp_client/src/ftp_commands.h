@@ -62,7 +62,7 @@ extern "C" {
 /* Re-initializes the connection*/
 #define CMD_REIN	"REIN\r\n"
 /* Restart transfer from the specified point */
-#define CMD_REST	"REST\r\n"
+#define CMD_REST	"REST %u\r\n"
 /* Retrieve a copy of the file */
 #define CMD_RETR	"RETR %s\r\n"
 /* Remove a directory */
@@ -5,6 +5,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <strings.h>
 #include <zephyr.h>
 #include <zephyr/types.h>
@@ -14,388 +15,237 @@
 
 LOG_MODULE_REGISTER(icalendar_parser, CONFIG_ICAL_PARSER_LOG_LEVEL);
 
-static size_t unfold_contentline(const char *buf, char *prop_buf)
+/* Content line assembly states. Content lines are delimited by "\r\n", but a
+ * line followed by a space or tab is a folded continuation of the previous
+ * one, so a line is complete only once the first character of the next line
+ * is seen.
+ *
+ * Reference: RFC 5545 3.1 Content Lines
+ */
+enum line_state {
+	LINE_DATA,
+	LINE_CR,
+	LINE_CRLF,
+};
+
+static const char *const component_name[] = {
+	[ICAL_EVT_VEVENT] = "VEVENT",
+	[ICAL_EVT_VTODO] = "VTODO",
+	[ICAL_EVT_VJOURNAL] = "VJOURNAL",
+	[ICAL_EVT_VTIMEZONE] = "VTIMEZONE",
+	[ICAL_EVT_VFREEBUSY] = "VFREEBUSY",
+};
+
+static bool parse_prop_value(const char *line, size_t line_len,
+			     const char *name, size_t name_size, bool datetime,
+			     char *value, size_t max_value_len)
 {
-	const char *sol = buf;
-	char *eol;
-	uint16_t total_line_len = 0, single_line_len = 0;
-
-	while (1) {
-		eol = strstr(sol, "\r\n");
-		if (!eol) {
-			return 0;
+	const char *prop_value;
+
+	if (line[name_size] == ':') {
+		prop_value = line + name_size + 1;
+	} else if (line[name_size] == ';') {
+		if (!datetime) {
+			/* Does not support property parameter. */
+			LOG_ERR("%s param not supported.", name);
+			return false;
 		}
-		single_line_len = eol - sol;
-		if ((total_line_len + single_line_len) <= CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE) {
-			memcpy(prop_buf + total_line_len, sol, single_line_len);
-			total_line_len += single_line_len;
-		} else {
-			LOG_WRN("Property value overflow."
-				"Increase CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE.");
-			return 0;
-		}
-		if (!strncmp(eol, "\r\n ", strlen("\r\n "))) {
-			/* Long content line is split into multiple lines.
-			 * Copy the folded part to unfolded buffer.
-			 */
-			sol = eol + strlen("\r\n ");
-		} else {
-			/* Content line is delimited. */
-			break;
-		}
-	}
-	prop_buf[total_line_len] = '\0';
 
-	return total_line_len;
-}
-
-static bool parse_desc_props(const char *buf,
-			     const char *name,
-			     size_t name_size,
-			     char *value,
-			     size_t max_value_len)
-{
-	bool ret;
-	size_t unfold_size;
-	char ical_prop_buf[CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE + 1];
-
-	unfold_size = unfold_contentline(buf, ical_prop_buf);
-	if (unfold_size <= 0) {
-		/* Property wrong format - no parameter or value. */
-		LOG_ERR("%s no value/param.", name);
-		return false;
-	}
-
-	if (ical_prop_buf[name_size] == ':') {
-		size_t value_len = unfold_size - name_size - 1;
-
-		if (value_len <= max_value_len) {
-			memcpy(value, ical_prop_buf + name_size + 1, value_len);
-			value[value_len] = '\0';
-			ret = true;
-		} else {
-			/* Property value overflow. */
-			LOG_ERR("%s value overflow.", name);
-			ret = false;
+		prop_value = strchr(line + name_size, ':');
+		if (!prop_value) {
+			/* Property wrong format - no value. */
+			LOG_ERR("%s wrong format - no value.", name);
+			return false;
 		}
-	} else if (ical_prop_buf[name_size] == ';') {
-		/* Does not support property parameter. */
-		LOG_ERR("%s param not supported.", name);
-		ret = false;
+		prop_value++;
 	} else {
 		/* Property wrong format - no parameter or value. */
 		LOG_ERR("%s wrong format.", name);
-		ret = false;
+		return false;
 	}
 
-	return ret;
-}
+	size_t value_len = line_len - (prop_value - line);
 
-static bool parse_datetime_props(const char *buf,
-				 const char *name,
-				 size_t name_size,
-				 char *value,
-				 size_t max_value_len)
-{
-	bool ret;
-	size_t unfold_size;
-	char ical_prop_buf[CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE + 1];
-
-	unfold_size = unfold_contentline(buf, ical_prop_buf);
-	if (unfold_size <= 0) {
-		/* Property wrong format - fail to unfold property. */
-		LOG_ERR("%s wrong format. Fail to unfold property", name);
+	if (value_len > max_value_len) {
+		/* Property value overflow. */
+		LOG_ERR("%s value overflow.", name);
 		return false;
 	}
 
-	if (ical_prop_buf[name_size] == ':') {
-		size_t value_len = unfold_size - name_size - 1;
-
-		if (value_len <= max_value_len) {
-			memcpy(value, ical_prop_buf + name_size + 1, value_len);
-			value[value_len] = '\0';
-			ret = true;
-		} else {
-			/* Property value overflow. */
-			LOG_ERR("%s value overflow.", name);
-			ret = false;
-		}
-	} else if (ical_prop_buf[name_size] == ';') {
-		char *dtvalue;
-
-		dtvalue = strchr(ical_prop_buf, ':');
-		if (dtvalue) {
-			dtvalue = dtvalue + 1;
-			size_t value_len;
-
-			value_len = unfold_size - (dtvalue - ical_prop_buf);
-			if (value_len <= max_value_len) {
-				memcpy(value, dtvalue, value_len);
-				value[value_len] = '\0';
-				ret = true;
-			} else {
-				/* Property value overflow. */
-				LOG_ERR("%s value overflow.", name);
-				ret = false;
-			}
-		} else {
-			/* Property wrong format - no value. */
-			LOG_ERR("%s wrong format - no value.", name);
-			ret = false;
-		}
-	} else {
-		/* Property wrong format - no parameter or value. */
-		LOG_ERR("%s wrong format.", name);
-		ret = false;
-	}
+	memcpy(value, prop_value, value_len);
+	value[value_len] = '\0';
 
-	return ret;
+	return true;
 }
 
-static size_t parse_calprops(const char *buf)
+static void parse_eventprop(struct icalendar_parser *ical, const char *line)
 {
-	const char *parsed = buf;
-	char *end = NULL;
-	char prop_value[CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE + 1];
+	struct ical_parser_evt *evt = &ical->evt;
 
-	parsed = strstr(parsed, "BEGIN:VCALENDAR\r\n");
-	if (parsed == NULL) {
-		return 0;
+	if (!strncasecmp(line, "SUMMARY", 7)) {
+		if (!parse_prop_value(line, ical->offset, "SUMMARY", 7, false,
+				      evt->ical_com.summary,
+				      CONFIG_ICAL_PARSER_SUMMARY_SIZE)) {
+			evt->error = ICAL_ERROR_SUMMARY;
+		}
+	} else if (!strncasecmp(line, "LOCATION", 8)) {
+		if (!parse_prop_value(line, ical->offset, "LOCATION", 8, false,
+				      evt->ical_com.location,
+				      CONFIG_ICAL_PARSER_LOCATION_SIZE)) {
+			evt->error = ICAL_ERROR_LOCATION;
+		}
+	} else if (!strncasecmp(line, "DESCRIPTION", 11)) {
+		if (!parse_prop_value(line, ical->offset, "DESCRIPTION", 11,
+				      false, evt->ical_com.description,
+				      CONFIG_ICAL_PARSER_DESCRIPTION_SIZE)) {
+			evt->error = ICAL_ERROR_DESCRIPTION;
+		}
+	} else if (!strncasecmp(line, "DTSTART", 7)) {
+		if (!parse_prop_value(line, ical->offset, "DTSTART", 7, true,
+				      evt->ical_com.dtstart,
+				      CONFIG_ICAL_PARSER_DTSTART_SIZE)) {
+			evt->error = ICAL_ERROR_DTSTART;
+		}
+	} else if (!strncasecmp(line, "DTEND", 5)) {
+		if (!parse_prop_value(line, ical->offset, "DTEND", 5, true,
+				      evt->ical_com.dtend,
+				      CONFIG_ICAL_PARSER_DTEND_SIZE)) {
+			evt->error = ICAL_ERROR_DTEND;
+		}
 	}
-	parsed += strlen("BEGIN:VCALENDAR\r\n");
+}
 
-	end = strstr(parsed, "\r\nBEGIN:");
-	if (end == NULL) {
-		return 0;
-	}
-	end += strlen("\r\n");
-
-	while (parsed < end) {
-		memset(prop_value, 0, sizeof(prop_value));
-		if (!strncmp(parsed, "PRODID", 6)) {
-			if (!parse_desc_props(parsed, "PRODID", 6,
-					prop_value, sizeof(prop_value))) {
-				LOG_ERR("Wrong PRODID");
-			}
-		} else if (!strncmp(parsed, "VERSION", 7)) {
-			if (!parse_desc_props(parsed, "VERSION", 7,
-					prop_value, sizeof(prop_value))) {
-				LOG_ERR("Wrong VERSION");
-			}
+static void component_begin(struct icalendar_parser *ical, const char *name)
+{
+	struct ical_parser_evt *evt = &ical->evt;
+
+	memset(evt, 0, sizeof(*evt));
+
+	for (int i = 0; i < ARRAY_SIZE(component_name); ++i) {
+		if (!strcmp(name, component_name[i])) {
+			evt->id = i;
+			evt->error = (i == ICAL_EVT_VEVENT) ?
+				ICAL_ERROR_NONE :
+				ICAL_ERROR_COM_NOT_SUPPORTED;
+			ical->in_component = true;
+			ical->depth = 0;
+			return;
 		}
-		parsed = strstr(parsed, "\r\n");
-		parsed += strlen("\r\n");
 	}
-
-	return (parsed - buf);
 }
 
-static size_t parse_eventprop(const char *buf, struct ical_parser_evt *evt)
+static void line_handle(struct icalendar_parser *ical)
 {
-	const char *parsed = buf;
-	char *com_end;
+	char *line = ical->buf;
 
-	if (strncmp(buf, "BEGIN:VEVENT\r\n", strlen("BEGIN:VEVENT\r\n"))) {
-		return 0;
-	}
+	line[ical->offset] = '\0';
 
-	com_end = strstr(buf, "END:VEVENT\r\n");
-	if (com_end == NULL) {
-		return 0;
+	if (ical->overflow) {
+		LOG_WRN("Property value overflow."
+			"Increase CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE.");
+		ical->overflow = false;
+		return;
 	}
 
-	evt->id = ICAL_EVT_VEVENT;
-	evt->error = ICAL_ERROR_NONE;
-	com_end += strlen("END:VEVENT\r\n");
-	while (parsed < com_end) {
-		if (!strncasecmp(parsed, "SUMMARY", 7)) {
-			if (!parse_desc_props(
-				parsed, "SUMMARY", 7,
-				evt->ical_com.summary,
-				CONFIG_ICAL_PARSER_SUMMARY_SIZE)) {
-				evt->error = ICAL_ERROR_SUMMARY;
-				parsed = com_end;
-			}
-		} else if (!strncasecmp(parsed, "LOCATION", 8)) {
-			if (!parse_desc_props(
-				parsed, "LOCATION", 8,
-				evt->ical_com.location,
-				CONFIG_ICAL_PARSER_LOCATION_SIZE)) {
-				evt->error = ICAL_ERROR_LOCATION;
-				parsed = com_end;
-			}
-		} else if (!strncasecmp(parsed, "DESCRIPTION", 11)) {
-			if (!parse_desc_props(
-				parsed, "DESCRIPTION", 11,
-				evt->ical_com.description,
-				CONFIG_ICAL_PARSER_DESCRIPTION_SIZE)) {
-				evt->error = ICAL_ERROR_DESCRIPTION;
-				parsed = com_end;
-			}
-		} else if (!strncasecmp(parsed, "DTSTART", 7)) {
-			if (!parse_datetime_props(
-				parsed, "DTSTART", 7,
-				evt->ical_com.dtstart,
-				CONFIG_ICAL_PARSER_DTSTART_SIZE)) {
-				evt->error = ICAL_ERROR_DTSTART;
-				parsed = com_end;
-			}
-		} else if (!strncasecmp(parsed,
-					"DTEND", 5)) {
-			if (!parse_datetime_props(
-				parsed, "DTEND", 5,
-				evt->ical_com.dtend,
-				CONFIG_ICAL_PARSER_DTEND_SIZE)) {
-				evt->error = ICAL_ERROR_DTEND;
-				parsed = com_end;
-			}
+	/* Check begin of iCalendar object delimiter
+	 * Reference: RFC 5545 3.4 iCalendar Object
+	 */
+	if (!ical->icalobject_begin) {
+		if (!strcmp(line, "BEGIN:VCALENDAR")) {
+			LOG_DBG("Found a calendar stream");
+			ical->icalobject_begin = true;
 		}
-
-		/* Move parsed pointer to end of line break */
-		parsed = strstr(parsed, "\r\n") + 2;
+		return;
 	}
 
-	return parsed - buf;
-}
-
-static size_t parse_todoprop(const char *buf, struct ical_parser_evt *evt)
-{
-	const char *parsed = buf;
-	char *com_end;
-
-	com_end = strstr(buf, "END:VTODO\r\n");
-	if (com_end) {
-		parsed = com_end + strlen("END:VTODO\r\n");
+	if (!ical->in_component) {
+		if (!strncmp(line, "BEGIN:", 6)) {
+			component_begin(ical, line + 6);
+		} else if (!strcmp(line, "END:VCALENDAR")) {
+			ical->icalobject_begin = false;
+		}
+		/* Calendar properties (PRODID, VERSION, ...) are ignored. */
+		return;
 	}
-	evt->id = ICAL_EVT_VTODO;
-	evt->error = ICAL_ERROR_COM_NOT_SUPPORTED;
-
-	return parsed - buf;
-}
 
-static size_t parse_jourprop(const char *buf,
-				struct ical_parser_evt *evt)
-{
-	const char *parsed = buf;
-	char *com_end;
-
-	com_end = strstr(buf, "END:VJOURNAL\r\n");
-	if (com_end) {
-		parsed = com_end + strlen("END:VJOURNAL\r\n");
+	if (!strncmp(line, "BEGIN:", 6)) {
+		/* Sub-components (such as VALARM) are not parsed. */
+		ical->depth++;
+		return;
 	}
-	evt->id = ICAL_EVT_VJOURNAL;
-	evt->error = ICAL_ERROR_COM_NOT_SUPPORTED;
 
-	return parsed - buf;
-}
-
-static size_t parse_fbprop(const char *buf, struct ical_parser_evt *evt)
-{
-	const char *parsed = buf;
-	char *com_end;
+	if (!strncmp(line, "END:", 4)) {
+		if (ical->depth > 0) {
+			ical->depth--;
+			return;
+		}
 
-	com_end = strstr(buf, "END:VFREEBUSY\r\n");
-	if (com_end) {
-		parsed = com_end + strlen("END:VFREEBUSY\r\n");
+		if (!strcmp(line + 4, component_name[ical->evt.id])) {
+			ical->in_component = false;
+			ical->callback(&ical->evt);
+		}
+		return;
 	}
-	evt->id = ICAL_EVT_VFREEBUSY;
-	evt->error = ICAL_ERROR_COM_NOT_SUPPORTED;
-
-	return parsed - buf;
-}
 
-static size_t parse_tzprop(const char *buf, struct ical_parser_evt *evt)
-{
-	const char *parsed = buf;
-	char *com_end;
-
-	com_end = strstr(buf, "END:VTIMEZONE\r\n");
-	if (com_end) {
-		parsed = com_end + strlen("END:VTIMEZONE\r\n");
+	if (ical->evt.id == ICAL_EVT_VEVENT &&
+	    ical->evt.error == ICAL_ERROR_NONE && ical->depth == 0) {
+		parse_eventprop(ical, line);
 	}
-	evt->id = ICAL_EVT_VTIMEZONE;
-	evt->error = ICAL_ERROR_COM_NOT_SUPPORTED;
-
-	return parsed - buf;
 }
 
-static size_t parse_component(char *buf, struct ical_parser_evt *evt)
+static void line_append(struct icalendar_parser *ical, char c)
 {
-	char *com_begin = buf;
-	size_t ret = 0;
-
-	/* Search begin of component */
-	if (!strncmp(com_begin, "BEGIN:VEVENT\r\n", 14)) {
-		ret += parse_eventprop(com_begin, evt);
-	} else if (!strncmp(com_begin, "BEGIN:VTODO\r\n", 13)) {
-		ret += parse_todoprop(com_begin, evt);
-	} else if (!strncmp(com_begin, "BEGIN:VJOURNAL\r\n", 16)) {
-		ret += parse_jourprop(com_begin, evt);
-	} else if (!strncmp(com_begin, "BEGIN:VFREEBUSY\r\n", 17)) {
-		ret += parse_fbprop(com_begin, evt);
-	} else if (!strncmp(com_begin, "BEGIN:VTIMEZONE\r\n", 17)) {
-		ret += parse_tzprop(com_begin, evt);
+	if (ical->offset < CONFIG_ICAL_PARSER_MAX_PROPERTY_SIZE) {
+		ical->buf[ical->offset++] = c;
+	} else {
+		ical->overflow = true;
 	}
-
-	return ret;
-}
-
-static size_t parse_icalbody(char *buf,	icalendar_parser_callback_t callback)
-{
-	size_t parsed_bytes = 0, parsed_offset = 0;
-
-	do {
-		struct ical_parser_evt evt;
-
-		parsed_bytes = parse_component(buf + parsed_offset, &evt);
-		parsed_offset += parsed_bytes;
-		if (parsed_bytes > 0) {
-			callback(&evt);
-		}
-	} while (parsed_bytes > 0);
-
-	return parsed_offset;
 }
 
 size_t ical_parser_parse(struct icalendar_parser *ical, const char *data, size_t len)
 {
-	size_t parsed_offset = 0;
-
-	if (CONFIG_ICAL_PARSER_BUFFER_SIZE < (ical->offset + len)) {
-		return -ENOBUFS;
-	}
-
-	memcpy(ical->buf + ical->offset, data, len);
-	ical->buf[ical->offset + len] = '\0';
-
-	/* Check begin of iCalendar object delimiter
-	 * Reference: RFC 5545 3.4 iCalendar Object
+	/* Each input byte is consumed exactly once, and only the content
+	 * line being assembled is retained between fragments.
 	 */
-	if (!ical->icalobject_begin) {
-		/* The body of the iCalendar object consists of
-		 * a sequence of calendar properties and
-		 * one or more calendar components.
-		 *
-		 * Reference: RFC 5545 3.6 Calendar Components
-		 */
-		parsed_offset += parse_calprops(ical->buf);
-		if (parsed_offset > 0) {
-			LOG_DBG("Found a calendar stream");
-			ical->icalobject_begin = true;
+	for (size_t i = 0; i < len; i++) {
+		char c = data[i];
+
+		switch (ical->line_state) {
+		case LINE_CR:
+			if (c == '\n') {
+				ical->line_state = LINE_CRLF;
+				continue;
+			}
+			/* Stray carriage return; keep it in the line. */
+			ical->line_state = LINE_DATA;
+			line_append(ical, '\r');
+			break;
+		case LINE_CRLF:
+			ical->line_state = LINE_DATA;
+			if (c == ' ' || c == '\t') {
+				/* Long content line is split into multiple
+				 * lines. Append the folded part to the
+				 * unfolded buffer.
+				 */
+				continue;
+			}
+			/* Content line is delimited. */
+			line_handle(ical);
+			ical->offset = 0;
+			break;
+		default:
+			break;
 		}
-	}
 
-	/* If we got a calendar property, start parsing calendar body. */
-	if (ical->icalobject_begin) {
-		parsed_offset += parse_icalbody(ical->buf + parsed_offset, ical->callback);
-	}
+		if (c == '\r') {
+			ical->line_state = LINE_CR;
+			continue;
+		}
 
-	if (parsed_offset) {
-		ical->offset = ical->offset + len - parsed_offset;
-		memcpy(ical->buf, ical->buf + parsed_offset, ical->offset);
+		line_append(ical, c);
 	}
 
-	return parsed_offset;
+	return len;
 }
 
 int ical_parser_init(struct icalendar_parser *ical, icalendar_parser_callback_t callback)
@@ -406,6 +256,10 @@ int ical_parser_init(struct icalendar_parser *ical, icalendar_parser_callback_t
 
 	ical->callback = callback;
 	ical->icalobject_begin = false;
+	ical->in_component = false;
+	ical->overflow = false;
+	ical->depth = 0;
+	ical->line_state = LINE_DATA;
 	ical->offset = 0;
 
 	return 0;
@@ -100,6 +100,70 @@ static void dfu_target_cb(enum dfu_target_evt_id evt)
 	ARG_UNUSED(evt);
 }
 
+#if CONFIG_LWM2M_CLIENT_UTILS_FIRMWARE_WRITE_BUF_SIZE > 0
+/* Coalesce received blocks so the DFU target sees one write per buffer
+ * instead of one write per CoAP block.
+ */
+static uint8_t write_buf[CONFIG_LWM2M_CLIENT_UTILS_FIRMWARE_WRITE_BUF_SIZE];
+static size_t write_buf_fill;
+
+static int firmware_write_flush(void)
+{
+	int ret;
+
+	if (write_buf_fill == 0) {
+		return 0;
+	}
+
+	ret = dfu_target_write(write_buf, write_buf_fill);
+	write_buf_fill = 0;
+
+	return ret;
+}
+
+static int firmware_write(const uint8_t *data, size_t len)
+{
+	int ret;
+	size_t copy;
+
+	while (len > 0) {
+		copy = MIN(len, sizeof(write_buf) - write_buf_fill);
+		memcpy(&write_buf[write_buf_fill], data, copy);
+		write_buf_fill += copy;
+		data += copy;
+		len -= copy;
+
+		if (write_buf_fill == sizeof(write_buf)) {
+			ret = firmware_write_flush();
+			if (ret < 0) {
+				return ret;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static void firmware_write_reset(void)
+{
+	write_buf_fill = 0;
+}
+#else
+static int firmware_write_flush(void)
+{
+	return 0;
+}
+
+static int firmware_write(const uint8_t *data, size_t len)
+{
+	return dfu_target_write(data, len);
+}
+
+static void firmware_write_reset(void)
+{
+}
+#endif /* CONFIG_LWM2M_CLIENT_UTILS_FIRMWARE_WRITE_BUF_SIZE > 0 */
+
 static int firmware_block_received_cb(uint16_t obj_inst_id,
 				      uint16_t res_id, uint16_t res_inst_id,
 				      uint8_t *data, uint16_t data_len,
@@ -172,7 +236,7 @@ static int firmware_block_received_cb(uint16_t obj_inst_id,
 		return 0;
 	}
 
-	ret = dfu_target_write(data + skip, data_len - skip);
+	ret = firmware_write(data + skip, data_len - skip);
 	if (ret < 0) {
 		LOG_ERR("dfu_target_write error, err %d", ret);
 		goto cleanup;
@@ -181,11 +245,17 @@ static int firmware_block_received_cb(uint16_t obj_inst_id,
 	if (!last_block) {
 		/* Keep going */
 		return 0;
-	} else {
-		LOG_INF("Firmware downloaded, %d bytes in total",
-			bytes_downloaded);
 	}
 
+	/* Write out the coalesced remainder before finishing */
+	ret = firmware_write_flush();
+	if (ret < 0) {
+		LOG_ERR("dfu_target_write error, err %d", ret);
+		goto cleanup;
+	}
+
+	LOG_INF("Firmware downloaded, %d bytes in total", bytes_downloaded);
+
 	if (total_size && (bytes_downloaded != total_size)) {
 		LOG_ERR("Early last block, downloaded %d, expecting %d",
 			bytes_downloaded, total_size);
@@ -199,6 +269,7 @@ cleanup:
 		}
 	}
 
+	firmware_write_reset();
 	bytes_downloaded = 0;
 	percent_downloaded = 0;
 
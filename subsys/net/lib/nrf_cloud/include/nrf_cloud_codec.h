@@ -106,6 +106,13 @@ int nrf_cloud_device_status_encode(const struct nrf_cloud_device_status * const
 /** @brief Free memory allocated by @ref nrf_cloud_device_status_encode. */
 void nrf_cloud_device_status_free(struct nrf_cloud_data *status);
 
+#ifdef CONFIG_NRF_CLOUD_SHADOW_DELTA_TRACKING
+/** @brief Forgets the tracked device shadow state so that the next device
+ * status update reports all sections.
+ */
+void nrf_cloud_codec_shadow_delta_reset(void);
+#endif
+
 /** @brief Frees memory allocated by @ref nrf_cloud_rest_fota_execution_parse */
 void nrf_cloud_fota_job_free(struct nrf_cloud_fota_job_info *const job);
 
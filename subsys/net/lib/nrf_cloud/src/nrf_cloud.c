@@ -69,6 +69,9 @@ void nfsm_set_current_state_and_notify(enum nfsm_state state,
 
 	if (discon_evt) {
 		atomic_set(&transport_disconnected, 1);
+#ifdef CONFIG_NRF_CLOUD_SHADOW_DELTA_TRACKING
+		nrf_cloud_codec_shadow_delta_reset();
+#endif
 	}
 
 	if ((app_event_handler != NULL) && (evt != NULL)) {
@@ -277,7 +280,10 @@ int nrf_cloud_shadow_device_status_update(const struct nrf_cloud_device_status *
 	}
 
 	err = nrf_cloud_device_status_encode(dev_status, &tx_data.data);
-	if (err) {
+	if (err == -ENODATA && IS_ENABLED(CONFIG_NRF_CLOUD_SHADOW_DELTA_TRACKING)) {
+		/* Nothing changed since the last report */
+		return 0;
+	} else if (err) {
 		return err;
 	}
 
@@ -12,6 +12,7 @@
 #include <math.h>
 #include <stdlib.h>
 #include <zephyr.h>
+#include <sys/crc.h>
 #include <logging/log.h>
 #include <modem/modem_info.h>
 #include "cJSON_os.h"
@@ -282,6 +283,185 @@ static void nrf_cloud_decode_desired_obj(cJSON *const root_obj,
 	}
 }
 
+#ifdef CONFIG_NRF_CLOUD_DIRECT_SENSOR_ENCODE
+
+/* Literal parts of the fixed sensor message schemas */
+#define SENSOR_MSG_APPID	"{\"" JSON_KEY_APPID "\":"
+#define SENSOR_MSG_DATA		",\"" JSON_KEY_DATA "\":"
+#define SENSOR_MSG_TAIL		",\"" JSON_KEY_MSGTYPE "\":\"" \
+				MSGTYPE_VAL_DATA "\"}"
+#define SHADOW_MSG_HEAD		"{\"" JSON_KEY_STATE "\":{\"" JSON_KEY_REP \
+				"\":{\""
+#define SHADOW_MSG_TAIL		"}}}"
+
+/* Bytes needed to serialize str as a JSON string, quotes and
+ * escapes included, terminator excluded.
+ */
+static size_t json_string_size(const char *str)
+{
+	size_t len = 2;
+
+	for (; *str; str++) {
+		switch (*str) {
+		case '"':
+		case '\\':
+		case '\b':
+		case '\f':
+		case '\n':
+		case '\r':
+		case '\t':
+			len += 2;
+			break;
+		default:
+			if ((uint8_t)*str < 0x20) {
+				len += sizeof("\\u0000") - 1;
+			} else {
+				len++;
+			}
+			break;
+		}
+	}
+	return len;
+}
+
+static char *json_append_string(char *p, const char *str)
+{
+	static const char hex[] = "0123456789abcdef";
+
+	*p++ = '"';
+	for (; *str; str++) {
+		char esc = 0;
+
+		switch (*str) {
+		case '"':
+			esc = '"';
+			break;
+		case '\\':
+			esc = '\\';
+			break;
+		case '\b':
+			esc = 'b';
+			break;
+		case '\f':
+			esc = 'f';
+			break;
+		case '\n':
+			esc = 'n';
+			break;
+		case '\r':
+			esc = 'r';
+			break;
+		case '\t':
+			esc = 't';
+			break;
+		default:
+			break;
+		}
+
+		if (esc) {
+			*p++ = '\\';
+			*p++ = esc;
+		} else if ((uint8_t)*str < 0x20) {
+			*p++ = '\\';
+			*p++ = 'u';
+			*p++ = '0';
+			*p++ = '0';
+			*p++ = hex[((uint8_t)*str) >> 4];
+			*p++ = hex[((uint8_t)*str) & 0xf];
+		} else {
+			*p++ = *str;
+		}
+	}
+	*p++ = '"';
+	return p;
+}
+
+static char *json_append_literal(char *p, const char *str)
+{
+	size_t len = strlen(str);
+
+	memcpy(p, str, len);
+	return p + len;
+}
+
+int nrf_cloud_encode_shadow_data(const struct nrf_cloud_sensor_data *sensor,
+				 struct nrf_cloud_data *output)
+{
+	size_t len;
+	char *buffer;
+	char *p;
+
+	__ASSERT_NO_MSG(sensor != NULL);
+	__ASSERT_NO_MSG(sensor->data.ptr != NULL);
+	__ASSERT_NO_MSG(sensor->data.len != 0);
+	__ASSERT_NO_MSG(output != NULL);
+	__ASSERT_NO_MSG(sensor->type < SENSOR_TYPE_ARRAY_SIZE);
+
+	/* {"state":{"reported":{"<type>":<data>}}}
+	 * The data is embedded as-is; it must be valid JSON.
+	 */
+	len = strlen(SHADOW_MSG_HEAD) +
+	      strlen(sensor_type_str[sensor->type]) + strlen("\":") +
+	      sensor->data.len + strlen(SHADOW_MSG_TAIL);
+
+	buffer = nrf_cloud_malloc(len + 1);
+	if (buffer == NULL) {
+		return -ENOMEM;
+	}
+
+	p = json_append_literal(buffer, SHADOW_MSG_HEAD);
+	p = json_append_literal(p, sensor_type_str[sensor->type]);
+	p = json_append_literal(p, "\":");
+	memcpy(p, sensor->data.ptr, sensor->data.len);
+	p += sensor->data.len;
+	p = json_append_literal(p, SHADOW_MSG_TAIL);
+	*p = '\0';
+
+	output->ptr = buffer;
+	output->len = p - buffer;
+
+	return 0;
+}
+
+int nrf_cloud_encode_sensor_data(const struct nrf_cloud_sensor_data *sensor,
+				 struct nrf_cloud_data *output)
+{
+	size_t len;
+	char *buffer;
+	char *p;
+
+	__ASSERT_NO_MSG(sensor != NULL);
+	__ASSERT_NO_MSG(sensor->data.ptr != NULL);
+	__ASSERT_NO_MSG(sensor->data.len != 0);
+	__ASSERT_NO_MSG(output != NULL);
+	__ASSERT_NO_MSG(sensor->type < SENSOR_TYPE_ARRAY_SIZE);
+
+	/* {"appId":"<type>","data":"<data>","messageType":"DATA"} */
+	len = strlen(SENSOR_MSG_APPID) +
+	      json_string_size(sensor_type_str[sensor->type]) +
+	      strlen(SENSOR_MSG_DATA) + json_string_size(sensor->data.ptr) +
+	      strlen(SENSOR_MSG_TAIL);
+
+	buffer = nrf_cloud_malloc(len + 1);
+	if (buffer == NULL) {
+		return -ENOMEM;
+	}
+
+	p = json_append_literal(buffer, SENSOR_MSG_APPID);
+	p = json_append_string(p, sensor_type_str[sensor->type]);
+	p = json_append_literal(p, SENSOR_MSG_DATA);
+	p = json_append_string(p, sensor->data.ptr);
+	p = json_append_literal(p, SENSOR_MSG_TAIL);
+	*p = '\0';
+
+	output->ptr = buffer;
+	output->len = p - buffer;
+
+	return 0;
+}
+
+#else /* CONFIG_NRF_CLOUD_DIRECT_SENSOR_ENCODE */
+
 int nrf_cloud_encode_shadow_data(const struct nrf_cloud_sensor_data *sensor,
 				 struct nrf_cloud_data *output)
 {
@@ -355,6 +535,8 @@ int nrf_cloud_encode_sensor_data(const struct nrf_cloud_sensor_data *sensor,
 	return 0;
 }
 
+#endif /* CONFIG_NRF_CLOUD_DIRECT_SENSOR_ENCODE */
+
 #ifdef CONFIG_NRF_CLOUD_GATEWAY
 void nrf_cloud_register_gateway_state_handler(gateway_state_handler_t handler)
 {
@@ -916,6 +1098,76 @@ int nrf_cloud_service_info_json_encode(const struct nrf_cloud_svc_info *const sv
 	return nrf_cloud_encode_service_info_ui(svc_inf->ui, svc_inf_obj);
 }
 
+#ifdef CONFIG_NRF_CLOUD_SHADOW_DELTA_TRACKING
+#define SHADOW_DELTA_MAX_SECTIONS 8
+
+/* Last-reported device shadow, kept as one checksum per section instead
+ * of the JSON itself.
+ */
+static struct {
+	uint32_t key_crc;
+	uint32_t val_crc;
+	bool used;
+} shadow_delta[SHADOW_DELTA_MAX_SECTIONS];
+
+void nrf_cloud_codec_shadow_delta_reset(void)
+{
+	memset(shadow_delta, 0, sizeof(shadow_delta));
+}
+
+/* Removes children of obj whose printed value matches what was last reported
+ * and records the checksums of the children that remain.
+ */
+static void shadow_delta_prune(cJSON *const obj)
+{
+	cJSON *child = obj->child;
+
+	while (child != NULL) {
+		cJSON *next = child->next;
+		char *printed = cJSON_PrintUnformatted(child);
+
+		if (!printed) {
+			/* Send the section rather than risk dropping a change */
+			child = next;
+			continue;
+		}
+
+		uint32_t key_crc = crc32_ieee((const uint8_t *)child->string,
+					      strlen(child->string));
+		uint32_t val_crc = crc32_ieee((const uint8_t *)printed, strlen(printed));
+		int free_idx = -1;
+		int idx;
+
+		cJSON_free(printed);
+
+		for (idx = 0; idx < SHADOW_DELTA_MAX_SECTIONS; ++idx) {
+			if (shadow_delta[idx].used) {
+				if (shadow_delta[idx].key_crc == key_crc) {
+					break;
+				}
+			} else if (free_idx < 0) {
+				free_idx = idx;
+			}
+		}
+
+		if (idx < SHADOW_DELTA_MAX_SECTIONS) {
+			if (shadow_delta[idx].val_crc == val_crc) {
+				/* Unchanged since last report */
+				cJSON_Delete(cJSON_DetachItemViaPointer(obj, child));
+			} else {
+				shadow_delta[idx].val_crc = val_crc;
+			}
+		} else if (free_idx >= 0) {
+			shadow_delta[free_idx].key_crc = key_crc;
+			shadow_delta[free_idx].val_crc = val_crc;
+			shadow_delta[free_idx].used = true;
+		}
+
+		child = next;
+	}
+}
+#endif /* CONFIG_NRF_CLOUD_SHADOW_DELTA_TRACKING */
+
 void nrf_cloud_device_status_free(struct nrf_cloud_data *status)
 {
 	if (status && status->ptr) {
@@ -958,6 +1210,15 @@ int nrf_cloud_device_status_encode(const struct nrf_cloud_device_status *const d
 		}
 	}
 
+#ifdef CONFIG_NRF_CLOUD_SHADOW_DELTA_TRACKING
+	shadow_delta_prune(device_obj);
+	if (device_obj->child == NULL) {
+		/* Nothing changed since the last report */
+		err = -ENODATA;
+		goto cleanup;
+	}
+#endif
+
 	output->ptr = cJSON_PrintUnformatted(root_obj);
 	if (output->ptr) {
 		output->len = strlen(output->ptr);
@@ -140,6 +140,11 @@ static struct mqtt_topic sub_topics[SUB_TOPIC_IDX__COUNT] = {
 
 static enum fota_download_evt_id last_fota_dl_evt = FOTA_DOWNLOAD_EVT_ERROR;
 static struct nrf_cloud_fota_job current_fota;
+
+#ifdef CONFIG_NRF_CLOUD_FOTA_PROGRESS_OFFLOAD
+static void progress_offload_handler(struct k_work *work);
+static K_WORK_DEFINE(progress_offload_work, progress_offload_handler);
+#endif
 static uint8_t last_job[JOB_ID_STRING_SIZE];
 static struct settings_fota_job saved_job = {
 	.type = NRF_CLOUD_FOTA_TYPE__INVALID
@@ -594,6 +599,25 @@ static int save_validate_status(const char *const job_id,
 	return ret;
 }
 
+#ifdef CONFIG_NRF_CLOUD_FOTA_PROGRESS_OFFLOAD
+static void progress_offload_handler(struct k_work *work)
+{
+	int ret;
+
+	if (current_fota.status != NRF_CLOUD_FOTA_DOWNLOADING) {
+		/* Job finished or failed before the update was sent;
+		 * the terminal status has already been reported.
+		 */
+		return;
+	}
+
+	ret = send_job_update(&current_fota);
+	if (ret) {
+		LOG_ERR("Failed to send job update to cloud: %d", ret);
+	}
+}
+#endif
+
 static void http_fota_handler(const struct fota_download_evt *evt)
 {
 	__ASSERT_NO_MSG(evt != NULL);
@@ -687,7 +711,15 @@ static void http_fota_handler(const struct fota_download_evt *evt)
 		}
 
 		current_fota.sent_dl_progress = current_fota.dl_progress;
+#ifdef CONFIG_NRF_CLOUD_FOTA_PROGRESS_OFFLOAD
+		/* Publish from the system workqueue so the download thread
+		 * does not block on the MQTT socket between fragments.
+		 * Pending updates coalesce to the latest progress value.
+		 */
+		k_work_submit(&progress_offload_work);
+#else
 		ret = send_job_update(&current_fota);
+#endif
 		break;
 	default:
 		break;
@@ -910,6 +942,11 @@ static void cleanup_job(struct nrf_cloud_fota_job *const job)
 	if (job->parsed_payload) {
 		cJSON_Delete(job->parsed_payload);
 	}
+#ifdef CONFIG_NRF_CLOUD_FOTA_PROGRESS_OFFLOAD
+	if (job == &current_fota) {
+		(void)k_work_cancel(&progress_offload_work);
+	}
+#endif
 	memset(job, 0, sizeof(*job));
 	job->info.type = NRF_CLOUD_FOTA_TYPE__INVALID;
 }
@@ -1040,6 +1040,134 @@ static int flush_storage(void)
 	return stream_flash_buffered_write(&stream, NULL, 0, true);
 }
 
+#ifdef CONFIG_NRF_CLOUD_PGPS_STORAGE_WORKQ
+
+/* Staged storage operation; either a prediction to write (len != 0),
+ * or a flush and reopen at a new flash region (rotate).
+ */
+struct pgps_op {
+	uint8_t buf[PGPS_PREDICTION_DL_SIZE];
+	size_t len;
+	uint32_t sentinel;
+	bool last;
+	bool rotate;
+	uint32_t rotate_offset;
+	struct k_work work;
+	struct k_sem free;
+};
+
+static struct pgps_op pgps_ops[2];
+static struct k_work_q storage_work_q;
+static K_THREAD_STACK_DEFINE(storage_work_q_stack,
+			     CONFIG_NRF_CLOUD_PGPS_STORAGE_WORKQ_STACK_SIZE);
+static bool storage_work_q_started;
+static int storage_err;
+
+static void storage_op_handler(struct k_work *work)
+{
+	struct pgps_op *op = CONTAINER_OF(work, struct pgps_op, work);
+	int err = 0;
+
+	if (op->len) {
+		err = store_prediction(op->buf, op->len, op->sentinel,
+				       op->last);
+	}
+	if (!err && op->rotate) {
+		err = flush_storage();
+		if (err) {
+			LOG_ERR("Error flushing storage:%d", err);
+		} else {
+			err = open_storage(op->rotate_offset, false);
+		}
+	}
+	if (err && !storage_err) {
+		/* latched; reported on the next submit or drain */
+		storage_err = err;
+	}
+	k_sem_give(&op->free);
+}
+
+/* Wait for all staged operations to reach flash */
+static int storage_drain(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(pgps_ops); i++) {
+		k_sem_take(&pgps_ops[i].free, K_FOREVER);
+		k_sem_give(&pgps_ops[i].free);
+	}
+	return storage_err;
+}
+
+/* Start the storage work queue on first use; on subsequent loads,
+ * wait out any operations left over from an aborted load.
+ */
+static int storage_start(void)
+{
+	int err = 0;
+
+	if (!storage_work_q_started) {
+		k_work_queue_start(&storage_work_q, storage_work_q_stack,
+				   K_THREAD_STACK_SIZEOF(storage_work_q_stack),
+				   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+		k_thread_name_set(&storage_work_q.thread, "pgps_storage");
+		for (int i = 0; i < ARRAY_SIZE(pgps_ops); i++) {
+			k_sem_init(&pgps_ops[i].free, 1, 1);
+			k_work_init(&pgps_ops[i].work, storage_op_handler);
+		}
+		storage_work_q_started = true;
+	} else {
+		err = storage_drain();
+	}
+	storage_err = 0;
+	return err;
+}
+
+static struct pgps_op *storage_op_get(void)
+{
+	static int next;
+	struct pgps_op *op = &pgps_ops[next];
+
+	k_sem_take(&op->free, K_FOREVER);
+	if (storage_err) {
+		k_sem_give(&op->free);
+		return NULL;
+	}
+	next = (next + 1) % ARRAY_SIZE(pgps_ops);
+	op->len = 0;
+	op->rotate = false;
+	return op;
+}
+
+static int storage_submit(const uint8_t *p, size_t len, uint32_t sentinel,
+			  bool last)
+{
+	struct pgps_op *op = storage_op_get();
+
+	if (op == NULL) {
+		return storage_err;
+	}
+	memcpy(op->buf, p, len);
+	op->len = len;
+	op->sentinel = sentinel;
+	op->last = last;
+	k_work_submit_to_queue(&storage_work_q, &op->work);
+	return 0;
+}
+
+static int storage_rotate_submit(uint32_t offset)
+{
+	struct pgps_op *op = storage_op_get();
+
+	if (op == NULL) {
+		return storage_err;
+	}
+	op->rotate = true;
+	op->rotate_offset = offset;
+	k_work_submit_to_queue(&storage_work_q, &op->work);
+	return 0;
+}
+
+#endif /* CONFIG_NRF_CLOUD_PGPS_STORAGE_WORKQ */
+
 static int process_buffer(uint8_t *buf, size_t len)
 {
 	int err;
@@ -1269,12 +1397,36 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len)
 
 			index.loading_count++;
 			finished = (index.loading_count == index.expected_count);
+#ifdef CONFIG_NRF_CLOUD_PGPS_STORAGE_WORKQ
+			err = storage_submit(prediction_ptr, buf_len,
+					     (uint32_t)gps_sec,
+					     finished ||
+					     (index.storage_extent == 1));
+			if (err) {
+				LOG_ERR("Error storing prediction:%d", err);
+				state = PGPS_NONE;
+				return err;
+			}
+#else
 			store_prediction(prediction_ptr, buf_len, (uint32_t)gps_sec,
 					 finished || (index.storage_extent == 1));
+#endif
 			index.predictions[pnum] = npgps_block_to_pointer(index.store_block);
 
 			if (pgps_need_assistance &&
 			    (finished || (index.loading_count > 1))) {
+#ifdef CONFIG_NRF_CLOUD_PGPS_STORAGE_WORKQ
+				/* the prediction is validated in flash when
+				 * notifying; make sure it has been written
+				 */
+				err = storage_drain();
+				if (err) {
+					LOG_ERR("Error storing prediction:%d",
+						err);
+					state = PGPS_NONE;
+					return err;
+				}
+#endif
 				nrf_cloud_pgps_notify_prediction();
 			}
 
@@ -1287,6 +1439,15 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len)
 					evt_handler(&evt);
 				}
 			} else {
+#ifdef CONFIG_NRF_CLOUD_PGPS_STORAGE_WORKQ
+				err = storage_drain();
+				if (err) {
+					LOG_ERR("Error storing prediction:%d",
+						err);
+					state = PGPS_NONE;
+					return err;
+				}
+#endif
 				LOG_INF("All P-GPS data received. Done.");
 				state = PGPS_READY;
 				if (evt_handler) {
@@ -1310,6 +1471,14 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len)
 				index.storage_extent = npgps_get_block_extent(index.store_block);
 				LOG_INF("Moving to new flash region:%d, len:%d",
 					index.store_block, index.storage_extent);
+#ifdef CONFIG_NRF_CLOUD_PGPS_STORAGE_WORKQ
+				err = storage_rotate_submit(
+					npgps_block_to_offset(index.store_block));
+				if (err) {
+					LOG_ERR("Error rotating storage:%d", err);
+					return err;
+				}
+#else
 				err = flush_storage();
 				if (err) {
 					LOG_ERR("Error flushing storage:%d", err);
@@ -1321,6 +1490,7 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len)
 					LOG_ERR("Error opening storage again:%d", err);
 					return err;
 				}
+#endif
 			}
 		}
 	} else {
@@ -1393,6 +1563,12 @@ int nrf_cloud_pgps_process(const char *buf, size_t buf_len)
 		index.storage_extent = npgps_get_block_extent(index.store_block);
 		LOG_INF("opening storage at block:%d, len:%d", index.store_block,
 			index.storage_extent);
+#ifdef CONFIG_NRF_CLOUD_PGPS_STORAGE_WORKQ
+		err = storage_start();
+		if (err) {
+			LOG_ERR("Error from previous storage operation:%d", err);
+		}
+#endif
 		err = open_storage(npgps_block_to_offset(index.store_block),
 				   index.partial_request);
 		if (err) {
@@ -203,6 +203,20 @@ static int tls_setup(int fd, const char *const tls_hostname, const sec_tag_t sec
 			return err;
 		}
 	}
+
+	if (IS_ENABLED(CONFIG_NRF_CLOUD_REST_SESSION_CACHE)) {
+		int cache = TLS_SESSION_CACHE_ENABLED;
+
+		err = setsockopt(fd, SOL_TLS, TLS_SESSION_CACHE, &cache,
+				 sizeof(cache));
+		if (err) {
+			/* Unsupported on older modem firmware; the connection
+			 * can still proceed with a full handshake.
+			 */
+			LOG_WRN("Failed to enable TLS session cache, error: %d",
+				errno);
+		}
+	}
 	return 0;
 }
 
@@ -319,8 +333,9 @@ static int do_api_call(struct http_request *http_req, struct nrf_cloud_rest_cont
 	const uint16_t port_num, const sec_tag_t sec_tag)
 {
 	int err = 0;
+	bool reused = (rest_ctx->connect_socket >= 0);
 
-	if (rest_ctx->connect_socket < 0) {
+	if (!reused) {
 		err = do_connect(&rest_ctx->connect_socket,
 				 http_req->host,
 				 port_num,
@@ -331,25 +346,46 @@ static int do_api_call(struct http_request *http_req, struct nrf_cloud_rest_cont
 		}
 	}
 
-	/* Assign the user provided receive buffer into the http request */
-	http_req->recv_buf	= rest_ctx->rx_buf;
-	http_req->recv_buf_len	= rest_ctx->rx_buf_len;
+	while (true) {
+		/* Assign the user provided receive buffer into the http request */
+		http_req->recv_buf	= rest_ctx->rx_buf;
+		http_req->recv_buf_len	= rest_ctx->rx_buf_len;
 
-	memset(http_req->recv_buf, 0, http_req->recv_buf_len);
-	/* Ensure receive buffer stays NULL terminated */
-	--http_req->recv_buf_len;
+		memset(http_req->recv_buf, 0, http_req->recv_buf_len);
+		/* Ensure receive buffer stays NULL terminated */
+		--http_req->recv_buf_len;
 
-	rest_ctx->response		= NULL;
-	rest_ctx->response_len		= 0;
-	rest_ctx->total_response_len	= 0;
+		rest_ctx->response		= NULL;
+		rest_ctx->response_len		= 0;
+		rest_ctx->total_response_len	= 0;
 
-	/* The http_client timeout does not seem to work correctly, so
-	 * for now do not use a timeout.
-	 */
-	err = http_client_req(rest_ctx->connect_socket,
-			      http_req,
-			      NRF_CLOUD_REST_TIMEOUT_NONE,
-			      rest_ctx);
+		/* The http_client timeout does not seem to work correctly, so
+		 * for now do not use a timeout.
+		 */
+		err = http_client_req(rest_ctx->connect_socket,
+				      http_req,
+				      NRF_CLOUD_REST_TIMEOUT_NONE,
+				      rest_ctx);
+
+		if (reused && ((err < 0) || (rest_ctx->total_response_len == 0))) {
+			/* The keep-alive connection was closed by the server
+			 * while idle; reconnect and try again, once.
+			 */
+			LOG_DBG("Stale connection, reconnecting");
+			(void)nrf_cloud_rest_disconnect(rest_ctx);
+			err = do_connect(&rest_ctx->connect_socket,
+					 http_req->host,
+					 port_num,
+					 NULL,
+					 sec_tag);
+			if (err) {
+				return err;
+			}
+			reused = false;
+			continue;
+		}
+		break;
+	}
 
 	if (err < 0) {
 		LOG_ERR("http_client_req() error: %d", err);
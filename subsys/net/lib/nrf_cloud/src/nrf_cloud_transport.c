@@ -221,6 +221,81 @@ static uint32_t dc_send(const struct nct_dc_data *dc_data, uint8_t qos)
 	return mqtt_publish(&nct.client, &publish);
 }
 
+#ifdef CONFIG_NRF_CLOUD_TX_BATCH
+
+/* Fixed pool of QoS 0 messages awaiting the end of the batching window */
+static struct {
+	uint8_t data[CONFIG_NRF_CLOUD_TX_BATCH_BUF_SIZE];
+	size_t len;
+} tx_batch_pool[CONFIG_NRF_CLOUD_TX_BATCH_POOL_SIZE];
+static int tx_batch_count;
+static K_MUTEX_DEFINE(tx_batch_lock);
+
+static void tx_batch_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(tx_batch_work, tx_batch_work_handler);
+
+/* Publish all pooled messages back to back, in arrival order */
+static int tx_batch_flush(void)
+{
+	int err = 0;
+
+	k_mutex_lock(&tx_batch_lock, K_FOREVER);
+	for (int i = 0; i < tx_batch_count; i++) {
+		struct nct_dc_data dc_data = {
+			.data.ptr = tx_batch_pool[i].data,
+			.data.len = tx_batch_pool[i].len,
+		};
+
+		err = dc_send(&dc_data, MQTT_QOS_0_AT_MOST_ONCE);
+		if (err) {
+			LOG_ERR("Failed to publish batched message: %d", err);
+			break;
+		}
+	}
+	tx_batch_count = 0;
+	k_mutex_unlock(&tx_batch_lock);
+
+	return err;
+}
+
+static void tx_batch_work_handler(struct k_work *work)
+{
+	(void)tx_batch_flush();
+}
+
+static int tx_batch_add(const struct nct_dc_data *dc_data)
+{
+	if (dc_data->data.len > CONFIG_NRF_CLOUD_TX_BATCH_BUF_SIZE) {
+		/* Too large to pool; publish immediately */
+		return dc_send(dc_data, MQTT_QOS_0_AT_MOST_ONCE);
+	}
+
+	bool full;
+
+	k_mutex_lock(&tx_batch_lock, K_FOREVER);
+	memcpy(tx_batch_pool[tx_batch_count].data, dc_data->data.ptr,
+	       dc_data->data.len);
+	tx_batch_pool[tx_batch_count].len = dc_data->data.len;
+	tx_batch_count++;
+	full = (tx_batch_count == CONFIG_NRF_CLOUD_TX_BATCH_POOL_SIZE);
+	k_mutex_unlock(&tx_batch_lock);
+
+	if (full) {
+		k_work_cancel_delayable(&tx_batch_work);
+		return tx_batch_flush();
+	}
+
+	/* Hold the batch until the window from its first message expires.
+	 * Scheduling is a no-op if the work is already pending.
+	 */
+	k_work_schedule(&tx_batch_work,
+			K_MSEC(CONFIG_NRF_CLOUD_TX_BATCH_WINDOW_MS));
+
+	return 0;
+}
+
+#endif /* CONFIG_NRF_CLOUD_TX_BATCH */
+
 static bool strings_compare(const char *s1, const char *s2, uint32_t s1_len,
 			    uint32_t s2_len)
 {
@@ -1279,7 +1354,15 @@ int nct_dc_send(const struct nct_dc_data *dc_data)
 
 int nct_dc_stream(const struct nct_dc_data *dc_data)
 {
+#ifdef CONFIG_NRF_CLOUD_TX_BATCH
+	if (dc_data == NULL) {
+		return -EINVAL;
+	}
+
+	return tx_batch_add(dc_data);
+#else
 	return dc_send(dc_data, MQTT_QOS_0_AT_MOST_ONCE);
+#endif
 }
 
 int nct_dc_disconnect(void)
@@ -1288,6 +1371,12 @@ int nct_dc_disconnect(void)
 
 	LOG_DBG("nct_dc_disconnect");
 
+#ifdef CONFIG_NRF_CLOUD_TX_BATCH
+	/* Send off anything still held in the batching window */
+	k_work_cancel_delayable(&tx_batch_work);
+	(void)tx_batch_flush();
+#endif
+
 	const struct mqtt_subscription_list subscription_list = {
 		.list = (struct mqtt_topic *)&nct.dc_rx_endp,
 		.list_count = 1,
@@ -8,6 +8,7 @@
 #include <errno.h>
 #include <nfc/ndef/record.h>
 #include <sys/byteorder.h>
+#include <sys/util.h>
 
 /* Sum of sizes of fields: TNF-flags, Type Length, Payload Length in long
  * NDEF record.
@@ -29,6 +30,31 @@ static uint32_t record_header_size_calc(
 	return len;
 }
 
+/* Check if the payload length is known before the payload constructor is run.
+ * Only in that case the record can be encoded in the short form, as the
+ * header layout depends on the payload length.
+ */
+static bool record_payload_len_get(
+			struct nfc_ndef_record_desc const *ndef_record_desc,
+			uint32_t *payload_len)
+{
+	if (ndef_record_desc->tnf == TNF_EMPTY) {
+		*payload_len = 0;
+		return true;
+	}
+
+	if (ndef_record_desc->payload_constructor ==
+	    (payload_constructor_t)nfc_ndef_bin_payload_memcopy) {
+		struct nfc_ndef_bin_payload_desc const *bin_desc =
+			ndef_record_desc->payload_descriptor;
+
+		*payload_len = bin_desc->payload_length;
+		return true;
+	}
+
+	return false;
+}
+
 int nfc_ndef_record_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
 			   enum nfc_ndef_record_location const record_location,
 			   uint8_t *record_buffer,
@@ -42,6 +68,20 @@ int nfc_ndef_record_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
 	}
 	/* count record length without payload */
 	uint32_t record_header_len = record_header_size_calc(ndef_record_desc);
+	bool short_record = false;
+
+	if (IS_ENABLED(CONFIG_NFC_NDEF_RECORD_SHORT)) {
+		uint32_t known_payload_len;
+
+		short_record = record_payload_len_get(ndef_record_desc,
+						      &known_payload_len) &&
+			       (known_payload_len <= UINT8_MAX);
+
+		if (short_record) {
+			record_header_len -= NDEF_RECORD_PAYLOAD_LEN_LONG_SIZE -
+					     NDEF_RECORD_PAYLOAD_LEN_SHORT_SIZE;
+		}
+	}
 
 	if (record_buffer) {
 		uint8_t *flags; /* use as pointer to TNF + flags field */
@@ -65,11 +105,17 @@ int nfc_ndef_record_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
 		/* TYPE LENGTH */
 		*record_buffer = ndef_record_desc->type_length;
 		record_buffer++;
-		/* use always long record and remember payload len field memory
-		 * offset.
+		/* Remember payload len field memory offset. The long record
+		 * form is used unless the payload length is known up front
+		 * and fits in the short form.
 		 */
 		payload_len = record_buffer;
-		record_buffer += NDEF_RECORD_PAYLOAD_LEN_LONG_SIZE;
+		if (short_record) {
+			*flags |= NDEF_RECORD_SR_MASK;
+			record_buffer += NDEF_RECORD_PAYLOAD_LEN_SHORT_SIZE;
+		} else {
+			record_buffer += NDEF_RECORD_PAYLOAD_LEN_LONG_SIZE;
+		}
 		/* ID LENGTH - option */
 		if (ndef_record_desc->id_length > 0) {
 			*record_buffer = ndef_record_desc->id_length;
@@ -114,7 +160,11 @@ int nfc_ndef_record_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
 
 	if (record_buffer) {
 		/* PAYLOAD LENGTH */
-		*(uint32_t *)payload_len = sys_cpu_to_be32(record_payload_len);
+		if (short_record) {
+			*payload_len = record_payload_len;
+		} else {
+			sys_put_be32(record_payload_len, payload_len);
+		}
 	}
 
 	*record_len = record_header_len + record_payload_len;
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr.h>
+#include <logging/log.h>
+
+#include <nfc_t2t_lib.h>
+#include <nfc/ndef/msg.h>
+#include <nfc/t2t/payload.h>
+
+LOG_MODULE_REGISTER(nfc_t2t_payload, CONFIG_NFC_T2T_PAYLOAD_LOG_LEVEL);
+
+static struct {
+	uint8_t *data;
+	uint8_t *swap_data;
+	size_t len;
+	uint8_t *current_buff;
+	struct k_mutex lock;
+} payload;
+
+int nfc_t2t_payload_buf_register(uint8_t *buf, uint8_t *swap_buf, size_t len)
+{
+	if (!buf || !swap_buf || !len) {
+		return -EINVAL;
+	}
+
+	k_mutex_init(&payload.lock);
+
+	payload.data = buf;
+	payload.swap_data = swap_buf;
+	payload.len = len;
+	payload.current_buff = NULL;
+
+	return 0;
+}
+
+int nfc_t2t_payload_publish(const struct nfc_ndef_msg_desc *msg)
+{
+	int err;
+	uint8_t *buf;
+	uint32_t len;
+
+	if (!msg) {
+		return -EINVAL;
+	}
+
+	if (!payload.data) {
+		return -EACCES;
+	}
+
+	k_mutex_lock(&payload.lock, K_FOREVER);
+
+	/* Encode into the buffer which is not presented to the reader. */
+	if (payload.current_buff == payload.data) {
+		buf = payload.swap_data;
+	} else {
+		buf = payload.data;
+	}
+
+	len = payload.len;
+
+	err = nfc_ndef_msg_encode(msg, buf, &len);
+	if (err) {
+		LOG_ERR("NDEF message encoding error: %d", err);
+		goto out;
+	}
+
+	err = nfc_t2t_payload_set(buf, len);
+	if (err) {
+		LOG_ERR("Payload set error: %d", err);
+		goto out;
+	}
+
+	payload.current_buff = buf;
+
+out:
+	k_mutex_unlock(&payload.lock);
+
+	return err;
+}
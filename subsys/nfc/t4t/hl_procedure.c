@@ -134,8 +134,11 @@ static int on_ndef_nlen_read(const struct nfc_t4t_apdu_resp *resp)
 	const uint8_t *data = resp->data.buff;
 	uint16_t len = resp->data.len;
 
-	if (len != NDEF_FILE_NLEN_SIZE) {
-		LOG_ERR("NDEF NLEN response is to long");
+	/* The response can carry the beginning of the file content behind
+	 * the NLEN field if the eager read is enabled.
+	 */
+	if (len < NDEF_FILE_NLEN_SIZE) {
+		LOG_ERR("NDEF NLEN response is to short");
 		return -EINVAL;
 	}
 
@@ -417,6 +420,24 @@ int nfc_t4t_hl_procedure_ndef_read(struct nfc_t4t_cc_file *cc,
 	apdu_comm.parameter = 0;
 	apdu_comm.resp_len = NDEF_FILE_NLEN_SIZE;
 
+	if (IS_ENABLED(CONFIG_NFC_T4T_HL_PROCEDURE_EAGER_NDEF_READ)) {
+		struct nfc_t4t_tlv_block *tlv_block =
+			nfc_t4t_cc_file_content_get(cc,
+					sys_get_be16(t4t_hl.ndef.file_id));
+
+		/* Fetch the beginning of the file content together with the
+		 * NLEN field to save one frame exchange. Reading within the
+		 * file size announced in the Capability Container is allowed
+		 * also beyond the NDEF message length.
+		 */
+		if (tlv_block) {
+			apdu_comm.resp_len = MIN(ndef_len,
+				MIN(tlv_block->value.max_file_size,
+				    MIN(APDU_LE_MAP_2_MAX_VALUE,
+					cc->max_rapdu_size)));
+		}
+	}
+
 	t4t_hl.ndef.buff = ndef_buff;
 	t4t_hl.ndef.buff_size = ndef_len;
 	t4t_hl.ndef.cc = cc;
@@ -45,6 +45,8 @@ static atomic_t current_state = TNEP_STATE_DISABLED;
 struct tnep_buffer {
 	uint8_t *data;
 	uint8_t *swap_data;
+	size_t data_used;
+	size_t swap_data_used;
 	size_t len;
 };
 
@@ -111,16 +113,24 @@ static int tnep_tx_msg_encode(struct nfc_ndef_msg_desc *msg)
 	int err = 0;
 	unsigned int key;
 	size_t len;
+	size_t *used;
 	uint8_t *data;
 
 
 	if (tnep.current_buff == tnep.tx.data) {
 		tnep.current_buff = tnep.tx.swap_data;
+		used = &tnep.tx.swap_data_used;
 	} else {
 		tnep.current_buff = tnep.tx.data;
+		used = &tnep.tx.data_used;
 	}
 
-	memset(tnep.current_buff, 0, tnep.tx.len);
+	/* Clear only the part of the buffer used by the previous message.
+	 * The rest of the NDEF area has never been written to, so clearing
+	 * the whole area on every message would only burn CPU time during
+	 * the exchange.
+	 */
+	memset(tnep.current_buff, 0, MIN(*used, tnep.tx.len));
 
 	len = tnep.tx.len;
 	data = tnep.current_buff;
@@ -140,6 +150,8 @@ static int tnep_tx_msg_encode(struct nfc_ndef_msg_desc *msg)
 		nfc_t4t_ndef_file_encode(tnep.current_buff, &len);
 	}
 
+	*used = err ? tnep.tx.len : len;
+
 	key = irq_lock();
 
 	__ASSERT_NO_MSG(tnep.data_set);
@@ -489,6 +501,12 @@ int nfc_tnep_tag_tx_msg_buffer_register(uint8_t *tx_buff,
 	tnep.tx.data = tx_buff;
 	tnep.tx.swap_data = tx_swap_buff;
 
+	/* The registered buffers can hold arbitrary data, so make the first
+	 * encode into each of them clear the whole NDEF area.
+	 */
+	tnep.tx.data_used = len;
+	tnep.tx.swap_data_used = len;
+
 	return 0;
 }
 
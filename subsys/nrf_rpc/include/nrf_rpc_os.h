@@ -34,10 +34,21 @@ struct nrf_rpc_os_msg {
 
 typedef void (*nrf_rpc_os_work_t)(const uint8_t *data, size_t len);
 
+/** Classifies an incoming packet before it is queued to the thread pool.
+ * Returns true for packets that must go to the high-priority workers.
+ */
+typedef bool (*nrf_rpc_os_prio_filter_t)(const uint8_t *data, size_t len);
+
 int nrf_rpc_os_init(nrf_rpc_os_work_t callback);
 
 void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len);
 
+/** Register the packet filter used to pick the high-priority queue.
+ * Requires CONFIG_NRF_RPC_PRIO_DISPATCH. Without a filter all packets go
+ * to the normal queue.
+ */
+void nrf_rpc_os_prio_filter_set(nrf_rpc_os_prio_filter_t filter);
+
 static inline int nrf_rpc_os_event_init(struct nrf_rpc_os_event *event)
 {
 	return k_sem_init(&event->sem, 0, 1);
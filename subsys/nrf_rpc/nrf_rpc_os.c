@@ -29,6 +29,16 @@ static nrf_rpc_os_work_t thread_pool_callback;
 static struct pool_start_msg pool_start_msg_buf[2];
 static struct k_msgq pool_start_msg;
 
+#ifdef CONFIG_NRF_RPC_PRIO_DISPATCH
+static struct pool_start_msg pool_start_msg_high_buf[2];
+static struct k_msgq pool_start_msg_high;
+static nrf_rpc_os_prio_filter_t prio_filter;
+
+BUILD_ASSERT(CONFIG_NRF_RPC_THREAD_POOL_HIGH_SIZE <
+		     CONFIG_NRF_RPC_THREAD_POOL_SIZE,
+	     "At least one thread must be left for normal commands");
+#endif
+
 static struct k_sem context_reserved;
 static atomic_t context_mask;
 
@@ -51,10 +61,11 @@ BUILD_ASSERT(sizeof(uint32_t) == sizeof(atomic_val_t),
 
 static void thread_pool_entry(void *p1, void *p2, void *p3)
 {
+	struct k_msgq *msgq = (struct k_msgq *)p1;
 	struct pool_start_msg msg;
 
 	do {
-		k_msgq_get(&pool_start_msg, &msg, K_FOREVER);
+		k_msgq_get(msgq, &msg, K_FOREVER);
 		thread_pool_callback(msg.data, msg.len);
 	} while (1);
 }
@@ -86,23 +97,57 @@ int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
 		    sizeof(struct pool_start_msg),
 		    ARRAY_SIZE(pool_start_msg_buf));
 
+#ifdef CONFIG_NRF_RPC_PRIO_DISPATCH
+	k_msgq_init(&pool_start_msg_high, (char *)pool_start_msg_high_buf,
+		    sizeof(struct pool_start_msg),
+		    ARRAY_SIZE(pool_start_msg_high_buf));
+#endif
+
 	for (i = 0; i < CONFIG_NRF_RPC_THREAD_POOL_SIZE; i++) {
+		struct k_msgq *msgq = &pool_start_msg;
+		int prio = CONFIG_NRF_RPC_THREAD_PRIORITY;
+
+#ifdef CONFIG_NRF_RPC_PRIO_DISPATCH
+		/* The first threads of the pool serve the high-priority
+		 * queue only, at elevated thread priority.
+		 */
+		if (i < CONFIG_NRF_RPC_THREAD_POOL_HIGH_SIZE) {
+			msgq = &pool_start_msg_high;
+			prio = CONFIG_NRF_RPC_THREAD_PRIORITY_HIGH;
+		}
+#endif
+
 		k_thread_create(&pool_threads[i], pool_stacks[i],
 			K_THREAD_STACK_SIZEOF(pool_stacks[i]),
 			thread_pool_entry,
-			NULL, NULL, NULL,
-			CONFIG_NRF_RPC_THREAD_PRIORITY, 0, K_NO_WAIT);
+			msgq, NULL, NULL,
+			prio, 0, K_NO_WAIT);
 	}
 
 	return 0;
 }
 
+#ifdef CONFIG_NRF_RPC_PRIO_DISPATCH
+void nrf_rpc_os_prio_filter_set(nrf_rpc_os_prio_filter_t filter)
+{
+	prio_filter = filter;
+}
+#endif
+
 void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len)
 {
 	struct pool_start_msg msg;
 
 	msg.data = data;
 	msg.len = len;
+
+#ifdef CONFIG_NRF_RPC_PRIO_DISPATCH
+	if (prio_filter != NULL && prio_filter(data, len)) {
+		k_msgq_put(&pool_start_msg_high, &msg, K_FOREVER);
+		return;
+	}
+#endif
+
 	k_msgq_put(&pool_start_msg, &msg, K_FOREVER);
 }
 
@@ -9,6 +9,7 @@
 
 #include <zephyr.h>
 #include <errno.h>
+#include <string.h>
 #include <metal/sys.h>
 #include <metal/device.h>
 #include <metal/alloc.h>
@@ -89,6 +90,122 @@ static void event_handler(enum nrf_rpc_event_type event,
 	receive_callback(buf, length);
 }
 
+#ifdef CONFIG_NRF_RPC_RPMSG_ZERO_COPY
+
+BUILD_ASSERT(CONFIG_NRF_RPC_RPMSG_ZERO_COPY_BLOCK_SIZE % 4 == 0,
+	     "Arena block size must be a multiple of 4");
+
+/* Message passed over the dedicated zero-copy endpoint. The packet itself
+ * stays in the sender's arena; only this descriptor travels through RPMsg.
+ */
+enum zc_msg_type {
+	ZC_MSG_DESC = 1,    /* Packet handed over in the arena. */
+	ZC_MSG_RELEASE = 2, /* Receiver is done with the arena block. */
+};
+
+struct zc_msg {
+	uint8_t type;     /* One of enum zc_msg_type. */
+	uint8_t reserved;
+	uint16_t len;     /* Packet length, for ZC_MSG_DESC. */
+	uint32_t addr;    /* Address of the arena block. */
+};
+
+/* Packet arena. Each block holds one in-flight packet and is owned by the
+ * receiving side until it sends ZC_MSG_RELEASE back.
+ */
+static uint8_t zc_arena[CONFIG_NRF_RPC_RPMSG_ZERO_COPY_BLOCK_SIZE *
+			CONFIG_NRF_RPC_RPMSG_ZERO_COPY_BLOCK_COUNT]
+	__aligned(4);
+static struct k_mem_slab zc_slab;
+
+static int zc_endpoint_id;
+
+static bool zc_addr_valid(uint32_t addr)
+{
+	uint32_t base = (uint32_t)zc_arena;
+
+	return addr >= base && addr < base + sizeof(zc_arena) &&
+	       (addr - base) % CONFIG_NRF_RPC_RPMSG_ZERO_COPY_BLOCK_SIZE == 0;
+}
+
+static int zc_endpoint_cb(struct rpmsg_endpoint *ept, void *data, size_t len,
+	uint32_t src, void *priv)
+{
+	struct zc_msg msg;
+	void *block;
+
+	if (len != sizeof(msg)) {
+		NRF_RPC_ERR("Invalid zero-copy message length %u", len);
+		return RPMSG_SUCCESS;
+	}
+
+	memcpy(&msg, data, sizeof(msg));
+
+	switch (msg.type) {
+	case ZC_MSG_DESC:
+		event_handler(NRF_RPC_EVENT_DATA, (const uint8_t *)msg.addr,
+			      msg.len);
+		/* The upper layer is done with the packet when the receive
+		 * handler returns, so the block can be handed back.
+		 */
+		msg.type = ZC_MSG_RELEASE;
+		msg.len = 0;
+		rpmsg_service_send(zc_endpoint_id, &msg, sizeof(msg));
+		break;
+
+	case ZC_MSG_RELEASE:
+		if (!zc_addr_valid(msg.addr)) {
+			NRF_RPC_ERR("Invalid zero-copy release address");
+			break;
+		}
+		block = (void *)msg.addr;
+		k_mem_slab_free(&zc_slab, &block);
+		break;
+
+	default:
+		NRF_RPC_ERR("Invalid zero-copy message type %u", msg.type);
+		break;
+	}
+
+	return RPMSG_SUCCESS;
+}
+
+/* Try to pass a packet through the arena. Returns a negative value when the
+ * packet does not fit or the arena is exhausted, in which case the caller
+ * falls back to the inline path.
+ */
+static int zc_send(const uint8_t *buf, size_t len)
+{
+	struct zc_msg msg;
+	void *block;
+	int err;
+
+	if (len > CONFIG_NRF_RPC_RPMSG_ZERO_COPY_BLOCK_SIZE) {
+		return -NRF_ENOMEM;
+	}
+
+	if (k_mem_slab_alloc(&zc_slab, &block, K_NO_WAIT) != 0) {
+		return -NRF_ENOMEM;
+	}
+
+	memcpy(block, buf, len);
+
+	msg.type = ZC_MSG_DESC;
+	msg.reserved = 0;
+	msg.len = len;
+	msg.addr = (uint32_t)block;
+
+	err = rpmsg_service_send(zc_endpoint_id, &msg, sizeof(msg));
+	if (err < 0) {
+		k_mem_slab_free(&zc_slab, &block);
+		return translate_error(err);
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_NRF_RPC_RPMSG_ZERO_COPY */
+
 static int endpoint_cb(struct rpmsg_endpoint *ept, void *data, size_t len,
 	uint32_t src, void *priv)
 {
@@ -123,9 +240,35 @@ static int nrf_rpc_register_endpoint(const struct device *dev)
 		return err;
 	}
 
+#ifdef CONFIG_NRF_RPC_RPMSG_ZERO_COPY
+	k_mem_slab_init(&zc_slab, zc_arena,
+			CONFIG_NRF_RPC_RPMSG_ZERO_COPY_BLOCK_SIZE,
+			CONFIG_NRF_RPC_RPMSG_ZERO_COPY_BLOCK_COUNT);
+
+	err = rpmsg_service_register_endpoint("nrf_rpc_zc", zc_endpoint_cb);
+
+	zc_endpoint_id = err;
+
+	if (err < 0) {
+		NRF_RPC_ERR("Registering zero-copy endpoint failed with %d",
+			    err);
+		return err;
+	}
+#endif
+
 	return 0;
 }
 
+static bool endpoints_bound(void)
+{
+#ifdef CONFIG_NRF_RPC_RPMSG_ZERO_COPY
+	if (!rpmsg_service_endpoint_is_bound(zc_endpoint_id)) {
+		return false;
+	}
+#endif
+	return rpmsg_service_endpoint_is_bound(endpoint_id);
+}
+
 int nrf_rpc_tr_init(nrf_rpc_tr_receive_handler_t callback)
 {
 	NRF_RPC_ASSERT(callback != NULL);
@@ -133,7 +276,7 @@ int nrf_rpc_tr_init(nrf_rpc_tr_receive_handler_t callback)
 
 	if (IS_ENABLED(CONFIG_RPMSG_SERVICE_MODE_MASTER)) {
 		NRF_RPC_INF("RPC master");
-		while (!rpmsg_service_endpoint_is_bound(endpoint_id)) {
+		while (!endpoints_bound()) {
 			k_sleep(K_MSEC(1));
 		}
 
@@ -160,6 +303,14 @@ int nrf_rpc_tr_send(uint8_t *buf, size_t len)
 	NRF_RPC_DBG("Send %u bytes.", len);
 	DUMP_LIMITED_DBG(buf, len, "Data:");
 
+#ifdef CONFIG_NRF_RPC_RPMSG_ZERO_COPY
+	if (len >= CONFIG_NRF_RPC_RPMSG_ZERO_COPY_THRESHOLD &&
+	    zc_send(buf, len) == 0) {
+		return 0;
+	}
+	/* Oversized packet or arena exhausted; send inline instead. */
+#endif
+
 	err = rpmsg_service_send(endpoint_id, buf, len);
 	if (err > 0) {
 		err = 0;
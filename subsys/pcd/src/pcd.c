@@ -42,6 +42,11 @@ struct pcd_cmd {
 	const void *data;     /* Data to copy*/
 	size_t len;           /* Number of bytes to copy */
 	off_t offset;         /* Offset to store the flash image in */
+#ifdef CONFIG_PCD_CHUNKED
+	volatile size_t copied; /* Number of bytes copied, written by the
+				 * network core as the copy progresses.
+				 */
+#endif
 } __aligned(4);
 
 static struct pcd_cmd *cmd = (struct pcd_cmd *)PCD_CMD_ADDRESS;
@@ -67,6 +72,13 @@ const void *pcd_cmd_data_ptr_get(void)
 	return cmd->data;
 }
 
+#ifdef CONFIG_PCD_CHUNKED
+size_t pcd_fw_copy_progress_get(void)
+{
+	return cmd->copied;
+}
+#endif
+
 #ifdef CONFIG_PCD_NET
 
 int pcd_fw_copy(const struct device *fdev)
@@ -86,12 +98,36 @@ int pcd_fw_copy(const struct device *fdev)
 		return rc;
 	}
 
+#ifdef CONFIG_PCD_CHUNKED
+	const uint8_t *data = cmd->data;
+	size_t left = cmd->len;
+
+	/* Write one buffer worth of data at a time and publish the
+	 * progress, so the application core can poll how far the copy
+	 * has come instead of only seeing the final done flag.
+	 */
+	while (left > 0) {
+		size_t chunk = MIN(left, sizeof(buf));
+
+		rc = stream_flash_buffered_write(&stream, data, chunk,
+						 chunk == left);
+		if (rc != 0) {
+			LOG_ERR("stream_flash_buffered_write fail: %d", rc);
+			return rc;
+		}
+
+		data += chunk;
+		left -= chunk;
+		cmd->copied = cmd->len - left;
+	}
+#else
 	rc = stream_flash_buffered_write(&stream, (uint8_t *)cmd->data,
 					 cmd->len, true);
 	if (rc != 0) {
 		LOG_ERR("stream_flash_buffered_write fail: %d", rc);
 		return rc;
 	}
+#endif /* CONFIG_PCD_CHUNKED */
 
 	LOG_INF("Transfer done");
 
@@ -127,6 +163,9 @@ static int pcd_cmd_write(const void *data, size_t len, off_t offset)
 	cmd->data = data;
 	cmd->len = len;
 	cmd->offset = offset;
+#ifdef CONFIG_PCD_CHUNKED
+	cmd->copied = 0;
+#endif
 
 	return 0;
 }
@@ -158,6 +197,19 @@ static int network_core_update(const void *src_addr, size_t len, bool wait)
 		return 0;
 	}
 
+#ifdef CONFIG_PCD_CHUNKED
+	do {
+		/* Let other threads run between polls instead of
+		 * busy-waiting for the whole copy.
+		 */
+		k_sleep(K_MSEC(CONFIG_PCD_CHUNKED_POLL_INTERVAL_MS));
+
+		LOG_DBG("Copied %u of %u bytes", (unsigned int)cmd->copied,
+			(unsigned int)len);
+
+		err = pcd_fw_copy_status_get();
+	} while (err == PCD_STATUS_COPY);
+#else
 	do {
 		/* Wait for 1 second to avoid issue where network core
 		 * is unable to write to shared RAM.
@@ -166,6 +218,7 @@ static int network_core_update(const void *src_addr, size_t len, bool wait)
 
 		err = pcd_fw_copy_status_get();
 	} while (err == PCD_STATUS_COPY);
+#endif /* CONFIG_PCD_CHUNKED */
 
 	if (err == PCD_STATUS_COPY_FAILED) {
 		LOG_ERR("Network core update failed");
@@ -188,6 +241,25 @@ int pcd_network_core_update(const void *src_addr, size_t len)
 	return network_core_update(src_addr, len, true);
 }
 
+int pcd_network_core_update_finish(void)
+{
+	enum pcd_status status = pcd_fw_copy_status_get();
+
+	if (status == PCD_STATUS_COPY) {
+		return -EAGAIN;
+	}
+
+	nrf_reset_network_force_off(NRF_RESET, true);
+	LOG_INF("Turned off network core");
+
+	if (status == PCD_STATUS_COPY_FAILED) {
+		LOG_ERR("Network core update failed");
+		return -EFAULT;
+	}
+
+	return 0;
+}
+
 void pcd_lock_ram(void)
 {
 	uint32_t region = PCD_CMD_ADDRESS/CONFIG_NRF_SPU_RAM_REGION_SIZE;
@@ -53,6 +53,75 @@ static uint8_t buffer_commands[CONFIG_PROFILER_NORDIC_COMMAND_BUFFER_SIZE];
 
 static k_tid_t protocol_thread_id;
 
+#ifdef CONFIG_PROFILER_NORDIC_RING_TRANSPORT
+#define RING_SIZE CONFIG_PROFILER_NORDIC_RING_BUF_SIZE
+BUILD_ASSERT((RING_SIZE & (RING_SIZE - 1)) == 0,
+		 "Ring buffer size must be a power of 2");
+
+/* Intermediate event ring. Records are length-prefixed. The write index is
+ * published by the producing context, the read index is advanced only by
+ * the protocol thread, so the drain path needs no locking.
+ */
+static uint8_t ring_data[RING_SIZE];
+static volatile uint32_t ring_write_idx;
+static volatile uint32_t ring_read_idx;
+static uint32_t ring_dropped_events;
+static K_SEM_DEFINE(ring_sem, 0, 1);
+
+static void ring_put(const uint8_t *data, size_t len)
+{
+	int key = irq_lock();
+	uint32_t used = ring_write_idx - ring_read_idx;
+
+	if ((RING_SIZE - used) < (len + 1)) {
+		ring_dropped_events++;
+		irq_unlock(key);
+		return;
+	}
+
+	uint32_t idx = ring_write_idx;
+
+	ring_data[idx++ & (RING_SIZE - 1)] = (uint8_t)len;
+	for (size_t i = 0; i < len; i++) {
+		ring_data[idx++ & (RING_SIZE - 1)] = data[i];
+	}
+
+	/* Memory barrier to make sure that the record is visible
+	 * before the write index is published.
+	 */
+	__DMB();
+	ring_write_idx = idx;
+	irq_unlock(key);
+
+	k_sem_give(&ring_sem);
+}
+
+static void ring_drain(void)
+{
+	while (ring_read_idx != ring_write_idx) {
+		uint8_t record[CONFIG_PROFILER_CUSTOM_EVENT_BUF_LEN];
+		uint32_t idx = ring_read_idx;
+		uint8_t len = ring_data[idx++ & (RING_SIZE - 1)];
+
+		__ASSERT_NO_MSG(len <= sizeof(record));
+
+		for (size_t i = 0; i < len; i++) {
+			record[i] = ring_data[idx++ & (RING_SIZE - 1)];
+		}
+
+		/* Memory barrier to make sure that the record is read
+		 * before its space is reclaimed.
+		 */
+		__DMB();
+		ring_read_idx = idx;
+
+		(void)SEGGER_RTT_WriteNoLock(
+				CONFIG_PROFILER_NORDIC_RTT_CHANNEL_DATA,
+				record, len);
+	}
+}
+#endif /* CONFIG_PROFILER_NORDIC_RING_TRANSPORT */
+
 static K_THREAD_STACK_DEFINE(profiler_nordic_stack,
 			     CONFIG_PROFILER_NORDIC_STACK_SIZE);
 static struct k_thread profiler_nordic_thread;
@@ -99,6 +168,13 @@ static void send_system_description(void)
 	char end_line = '\n';
 	int err = 0;
 
+	if (IS_ENABLED(CONFIG_PROFILER_NORDIC_COMPACT_ENCODING)) {
+		/* Let the host know that events use the compact encoding. */
+		static const char format_descr[] = "format:compact\n";
+
+		err = send_info_data(format_descr, strlen(format_descr));
+	}
+
 	for (size_t t = 0; ((t < ne) && !err); t++) {
 		err = send_info_data(descr[t], strlen(descr[t]));
 		if (!err) {
@@ -136,7 +212,12 @@ static void profiler_nordic_thread_fn(void)
 				break;
 			}
 		}
+#ifdef CONFIG_PROFILER_NORDIC_RING_TRANSPORT
+		k_sem_take(&ring_sem, K_MSEC(500));
+		ring_drain();
+#else
 		k_sleep(K_MSEC(500));
+#endif
 	}
 	k_sem_give(&profiler_sem);
 }
@@ -186,6 +267,9 @@ void profiler_term(void)
 {
 	sending_events = false;
 	protocol_running = false;
+#ifdef CONFIG_PROFILER_NORDIC_RING_TRANSPORT
+	k_sem_give(&ring_sem);
+#endif
 	k_wakeup(protocol_thread_id);
 	k_sem_take(&profiler_sem, K_FOREVER);
 }
@@ -241,12 +325,49 @@ uint16_t profiler_register_event_type(const char *name, const char * const *args
 	return ne;
 }
 
+#ifdef CONFIG_PROFILER_NORDIC_COMPACT_ENCODING
+static uint32_t last_timestamp;
+
+/* Encode an unsigned value as a LEB128 varint (7 bits per byte,
+ * MSB marks continuation).
+ */
+static void log_encode_varint(struct log_event_buf *buf, uint32_t value)
+{
+	do {
+		uint8_t byte = value & 0x7f;
+
+		value >>= 7;
+		if (value) {
+			byte |= 0x80;
+		}
+		profiler_log_encode_uint8(buf, byte);
+	} while (value);
+}
+
+static void log_encode_timestamp(struct log_event_buf *buf)
+{
+	int key = irq_lock();
+	uint32_t now = k_cycle_get_32();
+	uint32_t delta = now - last_timestamp;
+
+	last_timestamp = now;
+	irq_unlock(key);
+
+	log_encode_varint(buf, delta);
+}
+#else
+static void log_encode_timestamp(struct log_event_buf *buf)
+{
+	profiler_log_encode_uint32(buf, k_cycle_get_32());
+}
+#endif /* CONFIG_PROFILER_NORDIC_COMPACT_ENCODING */
+
 void profiler_log_start(struct log_event_buf *buf)
 {
 	/* Adding one to pointer to make space for event type ID */
 	__ASSERT_NO_MSG(sizeof(uint8_t) <= CONFIG_PROFILER_CUSTOM_EVENT_BUF_LEN);
 	buf->payload = buf->payload_start + sizeof(uint8_t);
-	profiler_log_encode_uint32(buf, k_cycle_get_32());
+	log_encode_timestamp(buf);
 }
 
 void profiler_log_encode_uint32(struct log_event_buf *buf, uint32_t data)
@@ -320,6 +441,10 @@ void profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
 		uint8_t type_id = event_type_id & UCHAR_MAX;
 
 		buf->payload_start[0] = type_id;
+#ifdef CONFIG_PROFILER_NORDIC_RING_TRANSPORT
+		ring_put(buf->payload_start,
+			 buf->payload - buf->payload_start);
+#else
 		int key = irq_lock();
 
 		uint8_t num_bytes_send = SEGGER_RTT_WriteNoLock(
@@ -329,5 +454,6 @@ void profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
 		ARG_UNUSED(num_bytes_send);
 		irq_unlock(key);
 		__ASSERT_NO_MSG(num_bytes_send > 0);
+#endif
 	}
 }
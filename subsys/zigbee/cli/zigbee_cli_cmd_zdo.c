@@ -2255,28 +2255,32 @@ error:
 	return ret_err;
 }
 
+/* Keep subcommand sets in alphabetical order. The shell walks the table in
+ * order during tab completion and relies on the sorting to terminate the
+ * prefix search early.
+ */
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_bind,
-	SHELL_CMD_ARG(on, NULL, BIND_ON_HELP, cmd_zb_bind, 7, 0),
 	SHELL_CMD_ARG(off, NULL, BIND_OFF_HELP, cmd_zb_bind, 7, 0),
+	SHELL_CMD_ARG(on, NULL, BIND_ON_HELP, cmd_zb_bind, 7, 0),
 	SHELL_SUBCMD_SET_END);
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_zdo,
 	SHELL_CMD_ARG(active_ep, NULL, ACTIVE_EP_HELP, cmd_zb_active_ep, 2, 0),
-	SHELL_CMD_ARG(simple_desc_req, NULL, SIMPLE_DESC_HELP,
-		      cmd_zb_simple_desc, 3, 0),
-	SHELL_CMD_ARG(match_desc, NULL, MATCH_DESC_HELP, cmd_zb_match_desc, 6,
-		      SHELL_OPT_ARG_CHECK_SKIP),
-	SHELL_CMD_ARG(nwk_addr, NULL, NWK_ADDR_HELP, cmd_zb_nwk_addr, 2, 0),
-	SHELL_CMD_ARG(ieee_addr, NULL, IEEE_ADDR_HELP, cmd_zb_ieee_addr, 2, 0),
-	SHELL_CMD_ARG(eui64, NULL, EUI64_HELP, cmd_zb_eui64, 1, 1),
-	SHELL_CMD_ARG(short, NULL, "Get the short address of the node.",
-		      cmd_zb_short, 1, 0),
 	SHELL_CMD(bind, &sub_bind,
 		  "Create/remove the binding entry in the remote node", NULL),
+	SHELL_CMD_ARG(eui64, NULL, EUI64_HELP, cmd_zb_eui64, 1, 1),
+	SHELL_CMD_ARG(ieee_addr, NULL, IEEE_ADDR_HELP, cmd_zb_ieee_addr, 2, 0),
+	SHELL_CMD_ARG(match_desc, NULL, MATCH_DESC_HELP, cmd_zb_match_desc, 6,
+		      SHELL_OPT_ARG_CHECK_SKIP),
 	SHELL_CMD_ARG(mgmt_bind, NULL, MGMT_BIND_HELP, cmd_zb_mgmt_bind, 2, 1),
 	SHELL_CMD_ARG(mgmt_leave, NULL, MGMT_LEAVE_HELP, cmd_zb_mgmt_leave,
 		      2, 3),
 	SHELL_CMD_ARG(mgmt_lqi, NULL, MGMT_LQI_HELP, cmd_zb_mgmt_lqi, 2, 1),
+	SHELL_CMD_ARG(nwk_addr, NULL, NWK_ADDR_HELP, cmd_zb_nwk_addr, 2, 0),
+	SHELL_CMD_ARG(short, NULL, "Get the short address of the node.",
+		      cmd_zb_short, 1, 0),
+	SHELL_CMD_ARG(simple_desc_req, NULL, SIMPLE_DESC_HELP,
+		      cmd_zb_simple_desc, 3, 0),
 	SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(zdo, &sub_zdo, "ZDO manipulation", NULL);
@@ -12,6 +12,12 @@
 /* The table to store context manager entries. */
 static struct ctx_entry zb_cli_ctx[CONFIG_ZIGBEE_SHELL_CTX_MGR_ENTRIES_NBR];
 
+/* Index at which the search for a free entry starts. Points at the most
+ * recently freed entry, so that an allocation typically succeeds without
+ * scanning the table.
+ */
+static uint8_t free_entry_hint;
+
 /* Mutex to protect context manager from being simultaneously accessed
  * by multiple threads.
  */
@@ -22,6 +28,7 @@ void ctx_mgr_delete_entry(struct ctx_entry *ctx_entry)
 	k_mutex_lock(&ctx_mgr_mutex, K_FOREVER);
 
 	memset(ctx_entry, 0, sizeof(struct ctx_entry));
+	free_entry_hint = ctx_entry - zb_cli_ctx;
 
 	k_mutex_unlock(&ctx_mgr_mutex);
 }
@@ -33,13 +40,18 @@ struct ctx_entry *ctx_mgr_new_entry(enum ctx_entry_type type)
 	k_mutex_lock(&ctx_mgr_mutex, K_FOREVER);
 
 	for (i = 0; i < CONFIG_ZIGBEE_SHELL_CTX_MGR_ENTRIES_NBR; i++) {
-		if (zb_cli_ctx[i].taken == false) {
+		uint8_t idx = (free_entry_hint + i) %
+			      CONFIG_ZIGBEE_SHELL_CTX_MGR_ENTRIES_NBR;
+
+		if (zb_cli_ctx[idx].taken == false) {
 			/* Mark the entry as used and assign an entry type. */
-			zb_cli_ctx[i].taken = true;
-			zb_cli_ctx[i].type = type;
+			zb_cli_ctx[idx].taken = true;
+			zb_cli_ctx[idx].type = type;
+			free_entry_hint = (idx + 1) %
+				CONFIG_ZIGBEE_SHELL_CTX_MGR_ENTRIES_NBR;
 			k_mutex_unlock(&ctx_mgr_mutex);
 
-			return (zb_cli_ctx + i);
+			return (zb_cli_ctx + idx);
 		}
 	}
 	k_mutex_unlock(&ctx_mgr_mutex);
@@ -67,30 +79,23 @@ struct ctx_entry *ctx_mgr_find_ctx_entry(uint8_t id, enum ctx_entry_type type)
 	return NULL;
 }
 
+/* The index translation functions only perform pointer arithmetic on
+ * the static table, so they do not take the mutex.
+ */
 uint8_t ctx_mgr_get_index_by_entry(struct ctx_entry *ctx_entry)
 {
-	k_mutex_lock(&ctx_mgr_mutex, K_FOREVER);
-
 	if (!PART_OF_ARRAY(zb_cli_ctx, ctx_entry)) {
-		k_mutex_unlock(&ctx_mgr_mutex);
-
 		return CTX_MGR_ENTRY_IVALID_INDEX;
 	}
-	k_mutex_unlock(&ctx_mgr_mutex);
 
 	return (ctx_entry - zb_cli_ctx);
 }
 
 struct ctx_entry *ctx_mgr_get_entry_by_index(uint8_t index)
 {
-	k_mutex_lock(&ctx_mgr_mutex, K_FOREVER);
-
 	if (index < CONFIG_ZIGBEE_SHELL_CTX_MGR_ENTRIES_NBR) {
-		k_mutex_unlock(&ctx_mgr_mutex);
-
 		return (zb_cli_ctx + index);
 	}
-	k_mutex_unlock(&ctx_mgr_mutex);
 
 	return NULL;
 }
@@ -9,6 +9,7 @@
 #include <zboss_api.h>
 #include "zb_nrf_platform.h"
 #include <sys/ring_buffer.h>
+#include <sys/util.h>
 
 static K_SEM_DEFINE(tx_done_sem, 1, 1);
 static K_SEM_DEFINE(rx_done_sem, 1, 1);
@@ -33,6 +34,14 @@ static volatile size_t uart_tx_buf_len;
 static uint8_t uart_rx_buf_mem[CONFIG_ZIGBEE_UART_RX_BUF_LEN];
 static struct ring_buf rx_ringbuf;
 
+#ifdef CONFIG_ZIGBEE_UART_USE_DMA
+/* Two reception buffers, swapped on the UART_RX_BUF_REQUEST event to keep
+ * the DMA transfer running without gaps.
+ */
+static uint8_t uart_rx_dma_buf[2][CONFIG_ZIGBEE_UART_RX_BUF_LEN];
+static uint8_t uart_rx_dma_buf_idx;
+#endif /* CONFIG_ZIGBEE_UART_USE_DMA */
+
 static uint8_t *uart_rx_buf;
 static volatile size_t uart_rx_buf_offset;
 static volatile size_t uart_rx_buf_len;
@@ -107,6 +116,120 @@ static void uart_rx_timeout(struct k_timer *dummy)
 	}
 }
 
+#ifdef CONFIG_ZIGBEE_UART_USE_DMA
+
+/**
+ * Pass a block of received data to the user's buffer or, if no reception
+ * is pending, to the ring buffer.
+ */
+static void rx_process_block(const uint8_t *data, size_t len)
+{
+	uart_rx_bytes((uint8_t *)data, len);
+
+	/* Copy data to the user's buffer. */
+	if (uart_rx_buf && (uart_rx_buf_offset < uart_rx_buf_len)) {
+		size_t copy_len;
+
+		uart_rx_buf_offset += ring_buf_get(
+			&rx_ringbuf,
+			&uart_rx_buf[uart_rx_buf_offset],
+			uart_rx_buf_len - uart_rx_buf_offset);
+
+		copy_len = MIN(len, uart_rx_buf_len - uart_rx_buf_offset);
+		memcpy(&uart_rx_buf[uart_rx_buf_offset], data, copy_len);
+		uart_rx_buf_offset += copy_len;
+		data += copy_len;
+		len -= copy_len;
+	}
+
+	/* Store remaining bytes inside the ring buffer. */
+	if (len > 0) {
+		if (len > ring_buf_space_get(&rx_ringbuf)) {
+			uint8_t dummy_buffer[CONFIG_ZIGBEE_UART_RX_BUF_LEN];
+
+			(void)ring_buf_get(&rx_ringbuf, dummy_buffer,
+				len - ring_buf_space_get(&rx_ringbuf));
+		}
+
+		(void)ring_buf_put(&rx_ringbuf, data, len);
+	}
+
+	if (uart_rx_buf == NULL) {
+		return;
+	}
+
+	if (uart_rx_buf_offset == uart_rx_buf_len) {
+		uart_rx_buf_len = 0;
+		k_timer_stop(&uart_rx_timer);
+
+		if (zigbee_schedule_callback(uart_rx_notify, 0)) {
+			uart_rx_buf_offset = 0;
+			uart_rx_buf = NULL;
+			k_sem_give(&rx_done_sem);
+		}
+	} else {
+		k_timer_start(
+			&uart_rx_timer,
+			K_MSEC(CONFIG_ZIGBEE_UART_PARTIAL_RX_TIMEOUT),
+			K_NO_WAIT);
+	}
+}
+
+static void uart_evt_handler(const struct device *dev, struct uart_event *evt,
+			     void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+		uart_tx_buf_offset = 0;
+		uart_tx_buf_len = 0;
+		uart_tx_buf = uart_tx_buf_bak;
+		k_sem_give(&tx_done_sem);
+
+		if (tx_trx_data_cb) {
+			zigbee_schedule_callback(
+				tx_trx_data_cb,
+				SERIAL_SEND_SUCCESS);
+			tx_trx_data_cb = NULL;
+		}
+		break;
+
+	case UART_TX_ABORTED:
+		uart_tx_timeout(NULL);
+		break;
+
+	case UART_RX_RDY:
+		rx_process_block(&evt->data.rx.buf[evt->data.rx.offset],
+				 evt->data.rx.len);
+		break;
+
+	case UART_RX_BUF_REQUEST:
+		uart_rx_dma_buf_idx ^= 1;
+		(void)uart_rx_buf_rsp(dev,
+				      uart_rx_dma_buf[uart_rx_dma_buf_idx],
+				      sizeof(uart_rx_dma_buf[0]));
+		break;
+
+	case UART_RX_DISABLED:
+		/* Keep the reception running unless suspended on purpose. */
+		if (!is_sleeping) {
+			(void)uart_rx_enable(
+				dev,
+				uart_rx_dma_buf[uart_rx_dma_buf_idx],
+				sizeof(uart_rx_dma_buf[0]),
+				CONFIG_ZIGBEE_UART_PARTIAL_RX_TIMEOUT *
+					USEC_PER_MSEC);
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+#else /* CONFIG_ZIGBEE_UART_USE_DMA */
+
 static void handle_rx_ready_evt(const struct device *dev)
 {
 	int recv_len = 0;
@@ -205,6 +328,8 @@ static void interrupt_handler(const struct device *dev, void *user_data)
 	}
 }
 
+#endif /* CONFIG_ZIGBEE_UART_USE_DMA */
+
 void zb_osif_async_serial_init(void)
 {
 	if (uart_dev != NULL) {
@@ -239,10 +364,23 @@ void zb_osif_async_serial_init(void)
 	}
 
 	ring_buf_init(&rx_ringbuf, sizeof(uart_rx_buf_mem), uart_rx_buf_mem);
+
+#ifdef CONFIG_ZIGBEE_UART_USE_DMA
+	uart_rx_dma_buf_idx = 0;
+	(void)uart_callback_set(uart_dev, uart_evt_handler, NULL);
+
+	/* Start the continuous reception. */
+	(void)uart_rx_enable(uart_dev,
+			     uart_rx_dma_buf[0],
+			     sizeof(uart_rx_dma_buf[0]),
+			     CONFIG_ZIGBEE_UART_PARTIAL_RX_TIMEOUT *
+				USEC_PER_MSEC);
+#else
 	uart_irq_callback_set(uart_dev, interrupt_handler);
 
 	/* Enable rx interrupts. */
 	uart_irq_rx_enable(uart_dev);
+#endif /* CONFIG_ZIGBEE_UART_USE_DMA */
 }
 
 void zb_osif_async_serial_sleep(void)
@@ -252,8 +390,12 @@ void zb_osif_async_serial_sleep(void)
 	}
 
 	is_sleeping = true;
+#ifdef CONFIG_ZIGBEE_UART_USE_DMA
+	(void)uart_rx_disable(uart_dev);
+#else
 	uart_irq_tx_disable(uart_dev);
 	uart_irq_rx_disable(uart_dev);
+#endif /* CONFIG_ZIGBEE_UART_USE_DMA */
 }
 
 void zb_osif_async_serial_wake_up(void)
@@ -264,8 +406,17 @@ void zb_osif_async_serial_wake_up(void)
 
 	is_sleeping = false;
 
+#ifdef CONFIG_ZIGBEE_UART_USE_DMA
+	/* Restart the continuous reception. */
+	(void)uart_rx_enable(uart_dev,
+			     uart_rx_dma_buf[uart_rx_dma_buf_idx],
+			     sizeof(uart_rx_dma_buf[0]),
+			     CONFIG_ZIGBEE_UART_PARTIAL_RX_TIMEOUT *
+				USEC_PER_MSEC);
+#else
 	/* Enable rx interrupts. */
 	uart_irq_rx_enable(uart_dev);
+#endif /* CONFIG_ZIGBEE_UART_USE_DMA */
 }
 
 void zb_osif_serial_recv_data(zb_uint8_t *buf, zb_ushort_t len)
@@ -343,8 +494,23 @@ void zb_osif_serial_send_data(zb_uint8_t *buf, zb_ushort_t len)
 	/* Pass the TX callback for a single (ongoing) tranmission. */
 	tx_trx_data_cb = tx_data_cb;
 
+#ifdef CONFIG_ZIGBEE_UART_USE_DMA
+	if (uart_tx(uart_dev, buf, len,
+		    len * CONFIG_ZIGBEE_UART_PARTIAL_TX_TIMEOUT *
+			USEC_PER_MSEC)) {
+		uart_tx_buf_len = 0;
+		uart_tx_buf = uart_tx_buf_bak;
+		tx_trx_data_cb = NULL;
+		k_sem_give(&tx_done_sem);
+
+		if (tx_data_cb) {
+			tx_data_cb(SERIAL_SEND_ERROR);
+		}
+	}
+#else
 	/* Enable TX ready event. */
 	uart_irq_tx_enable(uart_dev);
+#endif /* CONFIG_ZIGBEE_UART_USE_DMA */
 }
 
 void zb_osif_serial_set_cb_send_data(serial_send_data_cb_t cb)
@@ -397,8 +563,17 @@ void zb_osif_async_serial_put_bytes(const zb_uint8_t *buf, zb_short_t len)
 	uart_tx_buf_len = len;
 	uart_tx_buf_offset = 0;
 
+#ifdef CONFIG_ZIGBEE_UART_USE_DMA
+	if (uart_tx(uart_dev, uart_tx_buf, len,
+		    len * CONFIG_ZIGBEE_UART_PARTIAL_TX_TIMEOUT *
+			USEC_PER_MSEC)) {
+		uart_tx_buf_len = 0;
+		k_sem_give(&tx_done_sem);
+	}
+#else
 	/* Enable tx interrupts. */
 	uart_irq_tx_enable(uart_dev);
+#endif /* CONFIG_ZIGBEE_UART_USE_DMA */
 
 #endif /* !(ZB_HAVE_ASYNC_SERIAL && CONFIG_ZBOSS_TRACE_LOG_LEVEL_OFF) */
 }
@@ -4,9 +4,11 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <kernel.h>
 #include <pm_config.h>
 #include <storage/flash_map.h>
 #include <logging/log.h>
+#include <sys/util.h>
 
 #include <zboss_api.h>
 
@@ -33,11 +35,145 @@ static const struct flash_area *fa; /* ZBOSS nvram */
 static const struct flash_area *fa_pc; /* production config */
 #endif
 
+#ifdef CONFIG_ZIGBEE_NVRAM_WRITE_CACHE
+
+/* A single cached dataset write, kept in RAM until committed. */
+struct nvram_cache_entry {
+	zb_uint32_t pos;
+	zb_uint16_t len;
+	zb_uint8_t page;
+	zb_uint8_t data[CONFIG_ZIGBEE_NVRAM_WRITE_CACHE_ENTRY_SIZE];
+};
+
+static struct nvram_cache_entry
+	nvram_cache[CONFIG_ZIGBEE_NVRAM_WRITE_CACHE_ENTRY_CNT];
+static size_t nvram_cache_used;
+static struct k_mutex nvram_cache_lock;
+
+static void nvram_cache_commit_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(nvram_cache_commit_work,
+			       nvram_cache_commit_handler);
+
+static zb_uint32_t get_page_base_offset(int page_num);
+
+/* Write all cached entries to flash, preserving the write order.
+ * Must be called with the cache lock held.
+ */
+static zb_ret_t nvram_cache_commit_locked(void)
+{
+	zb_ret_t ret = RET_OK;
+
+	for (size_t i = 0; i < nvram_cache_used; i++) {
+		struct nvram_cache_entry *entry = &nvram_cache[i];
+		uint32_t flash_addr = get_page_base_offset(entry->page) +
+				      entry->pos;
+
+		int err = flash_area_write(fa, flash_addr, entry->data,
+					   entry->len);
+
+		if (err) {
+			LOG_ERR("Write error: %d", err);
+			ret = RET_ERROR;
+		}
+	}
+
+	nvram_cache_used = 0;
+
+	return ret;
+}
+
+static zb_ret_t nvram_cache_commit(void)
+{
+	zb_ret_t ret;
+
+	k_mutex_lock(&nvram_cache_lock, K_FOREVER);
+	ret = nvram_cache_commit_locked();
+	k_mutex_unlock(&nvram_cache_lock);
+
+	return ret;
+}
+
+static void nvram_cache_commit_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	(void)nvram_cache_commit();
+}
+
+/* Keep a dataset write in RAM. The commit is scheduled once the ZBOSS
+ * main loop stays idle for the configured period.
+ */
+static zb_ret_t nvram_cache_write(zb_uint8_t page, zb_uint32_t pos,
+				  void *buf, zb_uint16_t len)
+{
+	struct nvram_cache_entry *entry;
+
+	if (len > CONFIG_ZIGBEE_NVRAM_WRITE_CACHE_ENTRY_SIZE) {
+		return RET_NO_MEMORY;
+	}
+
+	k_mutex_lock(&nvram_cache_lock, K_FOREVER);
+
+	if (nvram_cache_used >= ARRAY_SIZE(nvram_cache)) {
+		(void)nvram_cache_commit_locked();
+	}
+
+	entry = &nvram_cache[nvram_cache_used++];
+	entry->page = page;
+	entry->pos = pos;
+	entry->len = len;
+	memcpy(entry->data, buf, len);
+
+	k_mutex_unlock(&nvram_cache_lock);
+
+	(void)k_work_reschedule(
+		&nvram_cache_commit_work,
+		K_MSEC(CONFIG_ZIGBEE_NVRAM_WRITE_CACHE_TIMEOUT));
+
+	return RET_OK;
+}
+
+/* Overlay pending cached writes over data read from flash, so that
+ * ZBOSS observes its own writes before they are committed.
+ */
+static void nvram_cache_overlay(zb_uint8_t page, zb_uint32_t pos,
+				zb_uint8_t *buf, zb_uint16_t len)
+{
+	k_mutex_lock(&nvram_cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < nvram_cache_used; i++) {
+		struct nvram_cache_entry *entry = &nvram_cache[i];
+		zb_uint32_t start;
+		zb_uint32_t end;
+
+		if (entry->page != page) {
+			continue;
+		}
+
+		start = MAX(entry->pos, pos);
+		end = MIN(entry->pos + entry->len, pos + len);
+
+		if (start < end) {
+			memcpy(&buf[start - pos],
+			       &entry->data[start - entry->pos],
+			       end - start);
+		}
+	}
+
+	k_mutex_unlock(&nvram_cache_lock);
+}
+
+#endif /* CONFIG_ZIGBEE_NVRAM_WRITE_CACHE */
+
 void zb_osif_nvram_init(const zb_char_t *name)
 {
 	ARG_UNUSED(name);
 	int ret;
 
+#ifdef CONFIG_ZIGBEE_NVRAM_WRITE_CACHE
+	k_mutex_init(&nvram_cache_lock);
+#endif
+
 	ret = flash_area_open(PM_ZBOSS_NVRAM_ID, &fa);
 	if (ret) {
 		LOG_ERR("Can't open ZBOSS NVRAM flash area");
@@ -95,6 +231,11 @@ zb_ret_t zb_osif_nvram_read(zb_uint8_t page, zb_uint32_t pos, zb_uint8_t *buf,
 		LOG_ERR("Read error: %d", err);
 		return RET_ERROR;
 	}
+
+#ifdef CONFIG_ZIGBEE_NVRAM_WRITE_CACHE
+	nvram_cache_overlay(page, pos, buf, len);
+#endif
+
 	return RET_OK;
 }
 
@@ -126,6 +267,17 @@ zb_ret_t zb_osif_nvram_write(zb_uint8_t page, zb_uint32_t pos, void *buf,
 	LOG_DBG("Function: %s, page: %d, pos: %d, len: %d",
 		__func__, page, pos, len);
 
+#ifdef CONFIG_ZIGBEE_NVRAM_WRITE_CACHE
+	if (nvram_cache_write(page, pos, buf, len) == RET_OK) {
+		return RET_OK;
+	}
+
+	/* The write does not fit into a cache entry. Commit what is
+	 * pending to preserve the write order and store it directly.
+	 */
+	(void)nvram_cache_commit();
+#endif
+
 	int err = flash_area_write(fa, flash_addr, buf, len);
 
 	if (err) {
@@ -140,6 +292,14 @@ zb_ret_t zb_osif_nvram_erase_async(zb_uint8_t page)
 {
 	zb_ret_t ret = RET_OK;
 
+#ifdef CONFIG_ZIGBEE_NVRAM_WRITE_CACHE
+	/* The erased page content must not resurface from the cache and
+	 * the other page holds the migrated datasets, so commit
+	 * everything up front.
+	 */
+	(void)nvram_cache_commit();
+#endif
+
 	if (page < zb_get_nvram_page_count()) {
 		int err = flash_area_erase(fa, get_page_base_offset(page),
 					   zb_get_nvram_page_length());
@@ -154,11 +314,18 @@ zb_ret_t zb_osif_nvram_erase_async(zb_uint8_t page)
 
 void zb_osif_nvram_wait_for_last_op(void)
 {
+#ifdef CONFIG_ZIGBEE_NVRAM_WRITE_CACHE
+	(void)nvram_cache_commit();
+#endif
 	/* empty for synchronous erase and write */
 }
 
 void zb_osif_nvram_flush(void)
 {
+#ifdef CONFIG_ZIGBEE_NVRAM_WRITE_CACHE
+	/* Called by ZBOSS on network-critical transitions. */
+	(void)nvram_cache_commit();
+#endif
 	/* empty for synchronous erase and write */
 }
 
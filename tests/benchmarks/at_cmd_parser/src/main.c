@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <ztest.h>
+#include <string.h>
+#include <kernel.h>
+
+#include <modem/at_cmd_parser.h>
+#include <modem/at_params.h>
+
+#include "bench.h"
+
+#define BENCH_OPS 1000
+#define MAX_PARAMS 10
+
+/* Standard corpus: typical notification, multi-parameter response with
+ * empty parameters, SMS PDU and a certificate listing, mirroring the
+ * inputs of the functional test.
+ */
+static const char *singleline = "+CEREG: 2,\"76C1\",\"0102DA04\", 7\r\n";
+static const char *emptyparamline =
+	"+CPSMS: 1,,,\"10101111\",\"01101100\"\r\n";
+static const char *pduline = "+CMT: \"12345678\", 24\r\n"
+	"06917429000171040A91747966543100009160402143708006C8329BFD0601\r\n";
+static const char *certificate = "%CMNG: 12345678, 0, \"978C...02C4\","
+	"\"-----BEGIN CERTIFICATE-----"
+	"MIIBc464..."
+	"...bW9aAa4"
+	"-----END CERTIFICATE-----\"\r\n";
+
+static struct at_param_list params;
+
+static void parse_op(void *ctx)
+{
+	const char *str = ctx;
+
+	(void)at_parser_params_from_str(str, NULL, &params);
+}
+
+static void test_bench_at_cmd_parser(void)
+{
+	zassert_equal(at_params_list_init(&params, MAX_PARAMS), 0,
+		      "Could not init params list");
+
+	/* Validate once before measuring. */
+	zassert_equal(at_parser_params_from_str(singleline, NULL, &params),
+		      0, "Corpus line does not parse");
+
+	bench_run("at_cmd_parser/singleline", BENCH_OPS, parse_op,
+		  (void *)singleline);
+	bench_run("at_cmd_parser/emptyparamline", BENCH_OPS, parse_op,
+		  (void *)emptyparamline);
+	bench_run("at_cmd_parser/pduline", BENCH_OPS, parse_op,
+		  (void *)pduline);
+	bench_run("at_cmd_parser/certificate", BENCH_OPS, parse_op,
+		  (void *)certificate);
+
+	at_params_list_free(&params);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(benchmark_at_cmd_parser,
+			 ztest_unit_test(test_bench_at_cmd_parser));
+
+	ztest_run_test_suite(benchmark_at_cmd_parser);
+}
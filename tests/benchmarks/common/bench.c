@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr.h>
+#include <timing/timing.h>
+
+#ifdef CONFIG_NEWLIB_LIBC
+#include <malloc.h>
+#endif
+
+#include "bench.h"
+
+void bench_run(const char *name, uint32_t ops, bench_fn_t fn, void *ctx)
+{
+	timing_t start;
+	timing_t end;
+	uint64_t cycles;
+	uint64_t ns;
+	int32_t heap_delta_per_op = -1;
+#ifdef CONFIG_NEWLIB_LIBC
+	struct mallinfo heap_before;
+	struct mallinfo heap_after;
+#endif
+
+	/* Warm up caches and lazily initialized state. */
+	fn(ctx);
+
+	timing_init();
+	timing_start();
+
+#ifdef CONFIG_NEWLIB_LIBC
+	heap_before = mallinfo();
+#endif
+	start = timing_counter_get();
+
+	for (uint32_t i = 0; i < ops; i++) {
+		fn(ctx);
+	}
+
+	end = timing_counter_get();
+#ifdef CONFIG_NEWLIB_LIBC
+	heap_after = mallinfo();
+	heap_delta_per_op = (int32_t)(heap_after.uordblks -
+				      heap_before.uordblks) /
+			    (int32_t)ops;
+#endif
+
+	timing_stop();
+
+	cycles = timing_cycles_get(&start, &end);
+	ns = timing_cycles_to_ns(cycles);
+
+	printk("BENCH {\"name\":\"%s\",\"ops\":%u,\"cycles_per_op\":%u,"
+	       "\"ns_per_op\":%u,\"libc_heap_delta_per_op\":%d}\n",
+	       name, ops, (uint32_t)(cycles / ops), (uint32_t)(ns / ops),
+	       heap_delta_per_op);
+}
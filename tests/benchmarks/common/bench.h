@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file
+ * @brief Cycle-count harness for on-target microbenchmarks.
+ *
+ * Thin wrapper around the Zephyr timing API (DWT cycle counter on
+ * Cortex-M) which runs a function in a loop and reports the cost per
+ * operation on one line prefixed with "BENCH " followed by a JSON
+ * object, so CI can grep the console output and track trends:
+ *
+ *   BENCH {"name":"...","ops":N,"cycles_per_op":C,"ns_per_op":T,
+ *	    "libc_heap_delta_per_op":H}
+ *
+ * The libc heap delta is measured with mallinfo() and is only visible
+ * for allocations going through the C library allocator (e.g. cJSON);
+ * it is reported as -1 when the toolchain does not provide mallinfo().
+ */
+
+#ifndef BENCH_H__
+#define BENCH_H__
+
+#include <zephyr.h>
+
+/** @brief Benchmarked operation. Called once per measured iteration. */
+typedef void (*bench_fn_t)(void *ctx);
+
+/**
+ * @brief Run a benchmark and print the machine-readable result.
+ *
+ * The function is called once unmeasured to warm up caches and lazily
+ * initialized state, then @p ops times inside the measured window.
+ *
+ * @param[in] name Benchmark name, printed verbatim in the result line.
+ * @param[in] ops  Number of measured iterations.
+ * @param[in] fn   Operation to measure.
+ * @param[in] ctx  Context passed to each invocation of @p fn.
+ */
+void bench_run(const char *name, uint32_t ops, bench_fn_t fn, void *ctx);
+
+#endif /* BENCH_H__ */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <ztest.h>
+#include <string.h>
+
+#include <bluetooth/mesh/sensor_types.h>
+
+#include "sensor.h"
+
+#include "bench.h"
+
+#define BENCH_OPS 1000
+
+struct codec_ctx {
+	const struct bt_mesh_sensor_type *type;
+	struct sensor_value values[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+	uint8_t encoded[16];
+	size_t encoded_len;
+};
+
+/* One single-channel and one three-channel type, covering the scalar
+ * codec for both a small and a composite characteristic.
+ */
+static struct codec_ctx temp_ctx = {
+	.type = &bt_mesh_sensor_present_dev_op_temp,
+	.values = { { .val1 = 25 } },
+};
+
+static struct codec_ctx runtime_ctx = {
+	.type = &bt_mesh_sensor_rel_runtime_in_a_dev_op_temp_range,
+	.values = { { .val1 = 50 }, { .val1 = 10 }, { .val1 = 30 } },
+};
+
+static void encode_op(void *ctx)
+{
+	struct codec_ctx *c = ctx;
+
+	NET_BUF_SIMPLE_DEFINE(buf, 16);
+
+	(void)sensor_value_encode(&buf, c->type, c->values);
+}
+
+static void decode_op(void *ctx)
+{
+	struct codec_ctx *c = ctx;
+	struct sensor_value out[CONFIG_BT_MESH_SENSOR_CHANNELS_MAX];
+	struct net_buf_simple buf;
+
+	net_buf_simple_init_with_data(&buf, c->encoded, c->encoded_len);
+
+	(void)sensor_value_decode(&buf, c->type, out);
+}
+
+static void ctx_prepare(struct codec_ctx *ctx)
+{
+	NET_BUF_SIMPLE_DEFINE(buf, 16);
+
+	zassert_equal(sensor_value_encode(&buf, ctx->type, ctx->values), 0,
+		      "Value does not encode");
+
+	memcpy(ctx->encoded, buf.data, buf.len);
+	ctx->encoded_len = buf.len;
+}
+
+static void test_bench_sensor_types(void)
+{
+	ctx_prepare(&temp_ctx);
+	ctx_prepare(&runtime_ctx);
+
+	bench_run("mesh_sensor_types/dev_op_temp/encode", BENCH_OPS,
+		  encode_op, &temp_ctx);
+	bench_run("mesh_sensor_types/dev_op_temp/decode", BENCH_OPS,
+		  decode_op, &temp_ctx);
+	bench_run("mesh_sensor_types/rel_runtime_temp_range/encode",
+		  BENCH_OPS, encode_op, &runtime_ctx);
+	bench_run("mesh_sensor_types/rel_runtime_temp_range/decode",
+		  BENCH_OPS, decode_op, &runtime_ctx);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(benchmark_mesh_sensor_types,
+			 ztest_unit_test(test_bench_sensor_types));
+
+	ztest_run_test_suite(benchmark_mesh_sensor_types);
+}
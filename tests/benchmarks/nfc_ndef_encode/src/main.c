@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2021 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <ztest.h>
+#include <string.h>
+
+#include <nfc/ndef/msg.h>
+#include <nfc/ndef/text_rec.h>
+#include <nfc/ndef/uri_rec.h>
+
+#include "bench.h"
+
+#define BENCH_OPS 1000
+#define MAX_REC_COUNT 2
+
+static const uint8_t en_code[] = {'e', 'n'};
+static const uint8_t en_payload[] =
+	"The quick brown fox jumps over the lazy dog";
+static const uint8_t uri_data[] = "nordicsemi.com";
+
+NFC_NDEF_TEXT_RECORD_DESC_DEF(text_rec, UTF_8, en_code, sizeof(en_code),
+			      en_payload, sizeof(en_payload) - 1);
+NFC_NDEF_URI_RECORD_DESC_DEF(uri_rec, NFC_URI_HTTP_WWW, uri_data,
+			     sizeof(uri_data) - 1);
+NFC_NDEF_MSG_DEF(bench_msg, MAX_REC_COUNT);
+
+static uint8_t buffer[256];
+
+static void encode_op(void *ctx)
+{
+	uint32_t len = sizeof(buffer);
+
+	(void)nfc_ndef_msg_encode(ctx, buffer, &len);
+}
+
+static void test_bench_ndef_encode(void)
+{
+	uint32_t len = sizeof(buffer);
+
+	zassert_equal(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(bench_msg),
+					      &NFC_NDEF_TEXT_RECORD_DESC(
+						      text_rec)),
+		      0, "Could not add text record");
+	zassert_equal(nfc_ndef_msg_record_add(&NFC_NDEF_MSG(bench_msg),
+					      &NFC_NDEF_URI_RECORD_DESC(
+						      uri_rec)),
+		      0, "Could not add URI record");
+
+	/* Validate once before measuring. */
+	zassert_equal(nfc_ndef_msg_encode(&NFC_NDEF_MSG(bench_msg), buffer,
+					  &len),
+		      0, "Message does not encode");
+
+	bench_run("nfc_ndef/msg_encode", BENCH_OPS, encode_op,
+		  &NFC_NDEF_MSG(bench_msg));
+}
+
+void test_main(void)
+{
+	ztest_test_suite(benchmark_nfc_ndef_encode,
+			 ztest_unit_test(test_bench_ndef_encode));
+
+	ztest_run_test_suite(benchmark_nfc_ndef_encode);
+}